@@ -5,7 +5,7 @@ namespace FieaGameEngine
 {
 	RTTI_DEFINITIONS(Action)
 
-	Vector<Signature> Action::Signatures()
+	SignatureListType Action::Signatures()
 	{
 		return {
 			{ "Name", Datum::DatumType::STRING, 1, offsetof(Action, mName) }
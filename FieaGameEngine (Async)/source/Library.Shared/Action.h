@@ -16,7 +16,7 @@ namespace FieaGameEngine
 		/// <summary>
 		/// signatures of action
 		/// </summary>
-		static Vector<Signature> Signatures();
+		static SignatureListType Signatures();
 
 	public:
 		/// <summary>
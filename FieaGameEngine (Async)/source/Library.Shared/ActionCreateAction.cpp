@@ -12,7 +12,7 @@ namespace FieaGameEngine
 	const std::string ActionCreateAction::ActionNameKey = "ActionName";
 	const std::size_t ActionCreateAction::ActionNameIndex = 3;
 
-	Vector<Signature> ActionCreateAction::Signatures()
+	SignatureListType ActionCreateAction::Signatures()
 	{
 		return {
 			{ PrototypeKey, Datum::DatumType::STRING, 1, offsetof(ActionCreateAction, mPrototype) },
@@ -23,8 +23,8 @@ namespace FieaGameEngine
 	ActionCreateAction::ActionCreateAction(const std::string& className, const std::string& actionName, const std::string& name) :
 		Action(TypeIdClass(), name), mPrototype(className), mActionName(actionName)
 	{
-		assert(mList[PrototypeIndex]->first == PrototypeKey);
-		assert(mList[ActionNameIndex]->first == ActionNameKey);
+		assert(mMap.EntryAt(PrototypeIndex).first == PrototypeKey);
+		assert(mMap.EntryAt(ActionNameIndex).first == ActionNameKey);
 	}
 
 	gsl::owner<ActionCreateAction*> ActionCreateAction::Clone() const
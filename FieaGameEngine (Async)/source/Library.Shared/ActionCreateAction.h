@@ -14,7 +14,7 @@ namespace FieaGameEngine
 		static const std::size_t PrototypeIndex;
 		static const std::string ActionNameKey;
 		static const std::size_t ActionNameIndex;
-		static Vector<Signature> Signatures();
+		static SignatureListType Signatures();
 
 	public:
 		explicit ActionCreateAction(const std::string& className = std::string(), const std::string& actionName = std::string(), const std::string& name = std::string());
@@ -10,7 +10,7 @@ namespace FieaGameEngine
 	const std::string ActionDeleteAction::ActionNameKey = "Action";
 	const std::size_t ActionDeleteAction::ActionNameIndex = 2;
 
-	Vector<Signature> ActionDeleteAction::Signatures()
+	SignatureListType ActionDeleteAction::Signatures()
 	{
 		return {
 			{ ActionNameKey, Datum::DatumType::STRING, 1, offsetof(ActionDeleteAction, mActionName) }
@@ -20,7 +20,7 @@ namespace FieaGameEngine
 	ActionDeleteAction::ActionDeleteAction(const std::string& action, const std::string& name) :
 		Action(TypeIdClass(), name), mActionName(action)
 	{
-		assert(mList[ActionNameIndex]->first == ActionNameKey);
+		assert(mMap.EntryAt(ActionNameIndex).first == ActionNameKey);
 	}
 
 	gsl::owner<ActionDeleteAction*> ActionDeleteAction::Clone() const
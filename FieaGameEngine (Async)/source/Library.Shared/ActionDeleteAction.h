@@ -12,7 +12,7 @@ namespace FieaGameEngine
 	public:
 		static const std::string ActionNameKey;
 		static const std::size_t ActionNameIndex;
-		static Vector<Signature> Signatures();
+		static SignatureListType Signatures();
 
 	public:
 		explicit ActionDeleteAction(const std::string& action = std::string(), const std::string& name = std::string());
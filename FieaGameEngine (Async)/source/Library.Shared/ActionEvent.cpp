@@ -12,7 +12,7 @@ namespace FieaGameEngine
 
 	const std::string ActionEvent::DelayKey = "Delay";
 
-	Vector<Signature> ActionEvent::Signatures()
+	SignatureListType ActionEvent::Signatures()
 	{
 		return {
 			{ SubtypeKey, Datum::DatumType::STRING, 1, offsetof(ActionEvent, mSubtype) },
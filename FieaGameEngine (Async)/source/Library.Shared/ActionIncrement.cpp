@@ -9,7 +9,7 @@ namespace FieaGameEngine
 
 	const std::string ActionIncrement::StepKey = "Step";
 
-	Vector<Signature> ActionIncrement::Signatures()
+	SignatureListType ActionIncrement::Signatures()
 	{
 		return {
 			{ TargetKey, Datum::DatumType::STRING, 1, offsetof(ActionIncrement, mTarget) },
@@ -32,7 +32,7 @@ namespace FieaGameEngine
 
 	void ActionIncrement::Update(WorldState&)
 	{
-		mReference = Search(mTarget);
+		mReference = Search(mTarget, mTargetCache);
 		if (mReference == nullptr)
 		{
 			throw std::exception("Unable to dereference target.");
@@ -26,7 +26,7 @@ namespace FieaGameEngine
 		/// <summary>
 		/// signatures
 		/// </summary>
-		static Vector<Signature> Signatures();
+		static SignatureListType Signatures();
 
 	public:
 		/// <summary>
@@ -72,6 +72,11 @@ namespace FieaGameEngine
 		/// cached reference to target
 		/// </summary>
 		Datum* mReference = nullptr;
+
+		/// <summary>
+		/// where the target was found last update, it is searched again only after the hierarchy changes
+		/// </summary>
+		SearchCache mTargetCache;
 	};
 
 	CONCRETE_FACTORY(ActionIncrement, FieaGameEngine::Scope)
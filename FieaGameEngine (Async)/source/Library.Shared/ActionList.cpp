@@ -9,7 +9,7 @@ namespace FieaGameEngine
 
 	const std::size_t ActionList::ActionsIndex = 2;
 
-	Vector<Signature> ActionList::Signatures()
+	SignatureListType ActionList::Signatures()
 	{
 		return {
 			{ ActionsKey, Datum::DatumType::TABLE, 0, 0 }
@@ -59,6 +59,6 @@ namespace FieaGameEngine
 
 	ActionList::ActionList(RTTI::IdType type, const std::string& name) : Action(type, name)
 	{
-		assert(mList[ActionsIndex]->first == ActionsKey);
+		assert(mMap.EntryAt(ActionsIndex).first == ActionsKey);
 	}
 }
@@ -15,7 +15,7 @@ namespace FieaGameEngine
 	public:
 		static const std::string ActionsKey;
 		static const std::size_t ActionsIndex;
-		static Vector<Signature> Signatures();
+		static SignatureListType Signatures();
 
 	public:
 		/// <summary>
@@ -9,7 +9,7 @@ namespace FieaGameEngine
 	const std::string ActionListIf::TrueActionsKey = "True";
 	const std::string ActionListIf::FalseActionsKey = "False";
 
-	Vector<Signature> ActionListIf::Signatures()
+	SignatureListType ActionListIf::Signatures()
 	{
 		return {
 			{ ConditionKey, Datum::DatumType::INTEGER, 1, offsetof(ActionListIf, mCondition) }
@@ -31,7 +31,7 @@ namespace FieaGameEngine
 		/// signatures
 		/// </summary>
 		/// <returns></returns>
-		static Vector<Signature> Signatures();
+		static SignatureListType Signatures();
 
 	public:
 		/// <summary>
@@ -0,0 +1,221 @@
+#pragma once
+
+/// \file Allocator.h
+/// \brief Definition of the allocation policies of the containers
+
+#include <cstddef>
+#include <memory_resource>
+#include <type_traits>
+#include "Utility.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Allocation policy taking memory from the global heap with malloc, realloc and free,
+	/// which is what the containers always did. Any policy given to Vector, SList or HashMap
+	/// provides the same four members; copies of a policy that compare equal can release
+	/// each other's memory
+	/// </summary>
+	class DefaultAllocator final
+	{
+	public:
+		/// <summary>
+		/// Allocates a block of memory
+		/// </summary>
+		/// <exception cref="std::bad_alloc">Thrown if the heap is out of memory</exception>
+		/// <param name="bytes">Size of the block</param>
+		/// <param name="alignment">Alignment of the block, at most the fundamental alignment</param>
+		/// <returns>Pointer to the block</returns>
+		void* Allocate(size_t bytes, size_t alignment);
+
+		/// <summary>
+		/// Resizes a block of memory, keeping its contents. Only used for trivially relocatable elements
+		/// </summary>
+		/// <exception cref="std::bad_alloc">Thrown if the heap is out of memory, the block is left as it was</exception>
+		/// <param name="memory">Block to resize, may be null</param>
+		/// <param name="bytes">Current size of the block</param>
+		/// <param name="newBytes">New size of the block, a zero size releases it</param>
+		/// <param name="alignment">Alignment of the block</param>
+		/// <returns>Pointer to the resized block, null if the new size is zero</returns>
+		void* Reallocate(void* memory, size_t bytes, size_t newBytes, size_t alignment);
+
+		/// <summary>
+		/// Releases a block of memory
+		/// </summary>
+		/// <param name="memory">Block to release, may be null</param>
+		/// <param name="bytes">Size of the block</param>
+		/// <param name="alignment">Alignment of the block</param>
+		void Deallocate(void* memory, size_t bytes, size_t alignment);
+
+		/// <summary>
+		/// The global heap is shared, so all default allocators are interchangeable
+		/// </summary>
+		/// <param name="other">Allocator to compare against</param>
+		/// <returns>Always true</returns>
+		bool operator==(const DefaultAllocator& other) const;
+	};
+
+	/// <summary>
+	/// Allocation policy taking memory from a std::pmr::memory_resource, so containers can live
+	/// in an arena, a pool or any other heap. The resource must outlive the containers using it
+	/// </summary>
+	class ResourceAllocator final
+	{
+	public:
+		/// <summary>
+		/// Creates an allocator for the given resource
+		/// </summary>
+		/// <param name="resource">Resource to allocate from, the current default resource if none is given</param>
+		explicit ResourceAllocator(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+		/// <summary>
+		/// Allocates a block of memory from the resource
+		/// </summary>
+		/// <param name="bytes">Size of the block</param>
+		/// <param name="alignment">Alignment of the block</param>
+		/// <returns>Pointer to the block</returns>
+		void* Allocate(size_t bytes, size_t alignment);
+
+		/// <summary>
+		/// Moves the contents of a block to a block of the new size, resources cannot grow blocks in place
+		/// </summary>
+		/// <param name="memory">Block to resize, may be null</param>
+		/// <param name="bytes">Current size of the block</param>
+		/// <param name="newBytes">New size of the block, a zero size releases it</param>
+		/// <param name="alignment">Alignment of the block</param>
+		/// <returns>Pointer to the new block, null if the new size is zero</returns>
+		void* Reallocate(void* memory, size_t bytes, size_t newBytes, size_t alignment);
+
+		/// <summary>
+		/// Returns a block of memory to the resource
+		/// </summary>
+		/// <param name="memory">Block to release, may be null</param>
+		/// <param name="bytes">Size of the block</param>
+		/// <param name="alignment">Alignment of the block</param>
+		void Deallocate(void* memory, size_t bytes, size_t alignment);
+
+		/// <summary>
+		/// Compares the resources of two allocators
+		/// </summary>
+		/// <param name="other">Allocator to compare against</param>
+		/// <returns>True if the resources are the same or compare equal</returns>
+		bool operator==(const ResourceAllocator& other) const;
+
+		/// <summary>
+		/// Gets the resource this allocator takes memory from
+		/// </summary>
+		/// <returns>Pointer to the resource</returns>
+		std::pmr::memory_resource* Resource() const;
+
+	private:
+		/// <summary>
+		/// Resource the memory comes from
+		/// </summary>
+		std::pmr::memory_resource* mResource;
+	};
+
+	/// <summary>
+	/// Allocation policy with room for N elements of T inside itself. Blocks that fit are handed out
+	/// from there and bigger ones come from TFallback, so a Vector using it starts with its elements
+	/// inline and only allocates once it outgrows them, see SmallVector.
+	/// The inline room is one block, which suits Vector since it never holds two blocks of the same size.
+	/// Copies start with empty room of their own and only share the fallback
+	/// </summary>
+	template <typename T, size_t N, typename TFallback = DefaultAllocator>
+	class InlineAllocator final
+	{
+		static_assert(N > 0, "An inline allocator needs room for at least one element.");
+
+	public:
+		/// <summary>
+		/// Number of elements that fit inline
+		/// </summary>
+		static constexpr size_t InlineCapacity = N;
+
+		/// <summary>
+		/// Creates an allocator with empty inline room
+		/// </summary>
+		/// <param name="fallback">Allocator for the blocks that do not fit inline</param>
+		explicit InlineAllocator(const TFallback& fallback = TFallback());
+
+		/// <summary>
+		/// Creates an allocator with empty inline room and a copy of the other's fallback
+		/// </summary>
+		/// <param name="other">Allocator to copy the fallback from</param>
+		InlineAllocator(const InlineAllocator& other);
+
+		/// <summary>
+		/// Copies the fallback of another allocator, the inline room is left as it is
+		/// </summary>
+		/// <param name="other">Allocator to copy the fallback from</param>
+		/// <returns>This allocator</returns>
+		InlineAllocator& operator=(const InlineAllocator& other);
+
+		/// <summary>
+		/// Allocates a block of memory, from the inline room if it fits
+		/// </summary>
+		/// <param name="bytes">Size of the block</param>
+		/// <param name="alignment">Alignment of the block, at most the alignment of T</param>
+		/// <returns>Pointer to the block</returns>
+		void* Allocate(size_t bytes, size_t alignment);
+
+		/// <summary>
+		/// Resizes a block of memory, keeping its contents. Blocks move in and out of the inline room as their size crosses it
+		/// </summary>
+		/// <param name="memory">Block to resize, may be null</param>
+		/// <param name="bytes">Current size of the block</param>
+		/// <param name="newBytes">New size of the block, a zero size releases it</param>
+		/// <param name="alignment">Alignment of the block</param>
+		/// <returns>Pointer to the resized block, null if the new size is zero</returns>
+		void* Reallocate(void* memory, size_t bytes, size_t newBytes, size_t alignment);
+
+		/// <summary>
+		/// Releases a block of memory, the inline room needs no releasing
+		/// </summary>
+		/// <param name="memory">Block to release, may be null</param>
+		/// <param name="bytes">Size of the block</param>
+		/// <param name="alignment">Alignment of the block</param>
+		void Deallocate(void* memory, size_t bytes, size_t alignment);
+
+		/// <summary>
+		/// Inline room cannot be released by anyone else, so an allocator only equals itself
+		/// </summary>
+		/// <param name="other">Allocator to compare against</param>
+		/// <returns>True if both are the same allocator</returns>
+		bool operator==(const InlineAllocator& other) const;
+
+		/// <summary>
+		/// Gets the inline room
+		/// </summary>
+		/// <returns>Uninitialized storage for N elements</returns>
+		T* InlineBuffer();
+
+		/// <summary>
+		/// Gets the inline room
+		/// </summary>
+		/// <returns>Uninitialized storage for N elements</returns>
+		const T* InlineBuffer() const;
+
+	private:
+		/// <summary>
+		/// The inline room
+		/// </summary>
+		alignas(T) unsigned char mStorage[sizeof(T) * N];
+
+		/// <summary>
+		/// Where the blocks that do not fit inline come from
+		/// </summary>
+		FIEA_NO_UNIQUE_ADDRESS TFallback mFallback;
+	};
+
+	/// <summary>
+	/// Tells if an allocation policy has inline room, which containers then start out in
+	/// </summary>
+	template <typename TAllocator, typename = void>
+	struct HasInlineStorage : std::false_type {};
+
+	template <typename TAllocator>
+	struct HasInlineStorage<TAllocator, std::void_t<decltype(TAllocator::InlineCapacity)>> : std::true_type {};
+}
+
+#include "Allocator.inl"
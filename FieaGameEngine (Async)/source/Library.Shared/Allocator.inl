@@ -0,0 +1,177 @@
+/// \file Allocator.inl
+/// \brief Implementation of the allocation policies of the containers
+
+#include "Allocator.h"
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+namespace FieaGameEngine
+{
+	inline void* DefaultAllocator::Allocate(size_t bytes, size_t)
+	{
+		void* memory = malloc(bytes);
+		if (memory == nullptr && bytes > 0)
+		{
+			throw std::bad_alloc();
+		}
+
+		return memory;
+	}
+
+	inline void* DefaultAllocator::Reallocate(void* memory, size_t, size_t newBytes, size_t)
+	{
+		if (newBytes == 0)
+		{
+			free(memory);
+			return nullptr;
+		}
+
+		// a failed realloc leaves the block where it was, and so does the throw
+		void* block = realloc(memory, newBytes);
+		if (block == nullptr)
+		{
+			throw std::bad_alloc();
+		}
+
+		return block;
+	}
+
+	inline void DefaultAllocator::Deallocate(void* memory, size_t, size_t)
+	{
+		free(memory);
+	}
+
+	inline bool DefaultAllocator::operator==(const DefaultAllocator&) const
+	{
+		return true;
+	}
+
+	inline ResourceAllocator::ResourceAllocator(std::pmr::memory_resource* resource) :
+		mResource(resource)
+	{
+	}
+
+	inline void* ResourceAllocator::Allocate(size_t bytes, size_t alignment)
+	{
+		return mResource->allocate(bytes, alignment);
+	}
+
+	inline void* ResourceAllocator::Reallocate(void* memory, size_t bytes, size_t newBytes, size_t alignment)
+	{
+		void* block = newBytes > 0 ? mResource->allocate(newBytes, alignment) : nullptr;
+		if (memory != nullptr)
+		{
+			if (block != nullptr)
+			{
+				std::memcpy(block, memory, bytes < newBytes ? bytes : newBytes);
+			}
+
+			mResource->deallocate(memory, bytes, alignment);
+		}
+
+		return block;
+	}
+
+	inline void ResourceAllocator::Deallocate(void* memory, size_t bytes, size_t alignment)
+	{
+		if (memory != nullptr)
+		{
+			mResource->deallocate(memory, bytes, alignment);
+		}
+	}
+
+	inline bool ResourceAllocator::operator==(const ResourceAllocator& other) const
+	{
+		return mResource == other.mResource || mResource->is_equal(*other.mResource);
+	}
+
+	inline std::pmr::memory_resource* ResourceAllocator::Resource() const
+	{
+		return mResource;
+	}
+
+	template <typename T, size_t N, typename TFallback>
+	inline InlineAllocator<T, N, TFallback>::InlineAllocator(const TFallback& fallback) :
+		mFallback(fallback)
+	{
+	}
+
+	template <typename T, size_t N, typename TFallback>
+	inline InlineAllocator<T, N, TFallback>::InlineAllocator(const InlineAllocator& other) :
+		mFallback(other.mFallback)
+	{
+	}
+
+	template <typename T, size_t N, typename TFallback>
+	inline InlineAllocator<T, N, TFallback>& InlineAllocator<T, N, TFallback>::operator=(const InlineAllocator& other)
+	{
+		mFallback = other.mFallback;
+
+		return *this;
+	}
+
+	template <typename T, size_t N, typename TFallback>
+	inline void* InlineAllocator<T, N, TFallback>::Allocate(size_t bytes, size_t alignment)
+	{
+		return bytes <= sizeof(mStorage) ? mStorage : mFallback.Allocate(bytes, alignment);
+	}
+
+	template <typename T, size_t N, typename TFallback>
+	void* InlineAllocator<T, N, TFallback>::Reallocate(void* memory, size_t bytes, size_t newBytes, size_t alignment)
+	{
+		const bool fits = newBytes > 0 && newBytes <= sizeof(mStorage);
+		if (memory == mStorage)
+		{
+			if (fits || newBytes == 0)
+			{
+				return fits ? memory : nullptr;
+			}
+
+			void* block = mFallback.Allocate(newBytes, alignment);
+			std::memcpy(block, memory, bytes < newBytes ? bytes : newBytes);
+
+			return block;
+		}
+
+		if (fits)
+		{
+			if (memory != nullptr)
+			{
+				std::memcpy(mStorage, memory, bytes < newBytes ? bytes : newBytes);
+				mFallback.Deallocate(memory, bytes, alignment);
+			}
+
+			return mStorage;
+		}
+
+		return mFallback.Reallocate(memory, bytes, newBytes, alignment);
+	}
+
+	template <typename T, size_t N, typename TFallback>
+	inline void InlineAllocator<T, N, TFallback>::Deallocate(void* memory, size_t bytes, size_t alignment)
+	{
+		if (memory != mStorage)
+		{
+			mFallback.Deallocate(memory, bytes, alignment);
+		}
+	}
+
+	template <typename T, size_t N, typename TFallback>
+	inline bool InlineAllocator<T, N, TFallback>::operator==(const InlineAllocator& other) const
+	{
+		return this == &other;
+	}
+
+	template <typename T, size_t N, typename TFallback>
+	inline T* InlineAllocator<T, N, TFallback>::InlineBuffer()
+	{
+		return reinterpret_cast<T*>(mStorage);
+	}
+
+	template <typename T, size_t N, typename TFallback>
+	inline const T* InlineAllocator<T, N, TFallback>::InlineBuffer() const
+	{
+		return reinterpret_cast<const T*>(mStorage);
+	}
+}
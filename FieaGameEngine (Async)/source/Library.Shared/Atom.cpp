@@ -0,0 +1,323 @@
+#include "pch.h"
+#include "Atom.h"
+#include <atomic>
+#include <cstring>
+#include <new>
+#include <shared_mutex>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#endif
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Interned strings packed one after the other in large blocks, with an open addressed index of
+	/// entry pointers over them. Lookups share the lock, only adding a string takes it exclusively.
+	/// Its memory comes straight from the system rather than the CRT heap, since none of it is ever
+	/// given back: strings interned by one test would otherwise show up in the next one's leak check
+	/// </summary>
+	class Atom::Pool final
+	{
+	public:
+		/// <summary>
+		/// Gets the pool shared by every thread. It is never destroyed, so atoms held
+		/// by objects in static storage stay readable during shutdown
+		/// </summary>
+		/// <returns>Reference to the pool</returns>
+		static Pool& Shared();
+
+		Pool() = default;
+		Pool(const Pool&) = delete;
+		Pool(Pool&&) = delete;
+		Pool& operator=(const Pool&) = delete;
+		Pool& operator=(Pool&&) = delete;
+		~Pool() = default;
+
+		/// <summary>
+		/// Gets the entry of a string, storing the string first if it is new
+		/// </summary>
+		/// <param name="name">Non empty string</param>
+		/// <returns>Entry of the string</returns>
+		const Entry* Intern(std::string_view name);
+
+		/// <summary>
+		/// Gets the entry of a string without storing it
+		/// </summary>
+		/// <param name="name">Non empty string</param>
+		/// <returns>Entry of the string if interned, null otherwise</returns>
+		const Entry* Find(std::string_view name) const;
+
+		/// <summary>
+		/// Gets the number of interned strings
+		/// </summary>
+		/// <returns>Number of entries</returns>
+		size_t Count() const;
+
+		/// <summary>
+		/// Gets the memory taken from the system
+		/// </summary>
+		/// <returns>Number of bytes</returns>
+		size_t Size() const;
+
+	private:
+		/// <summary>
+		/// Size of the blocks strings are packed in, strings too long for one get a block of their own
+		/// </summary>
+		static constexpr size_t BlockSize = 64 * 1024;
+
+		/// <summary>
+		/// Slots of the first index, it takes one block
+		/// </summary>
+		static constexpr size_t MinSlotCount = BlockSize / sizeof(const Entry*);
+
+		/// <summary>
+		/// Index slots, each empty or pointing at an entry, probed linearly from hash & (slot count - 1)
+		/// </summary>
+		const Entry** mSlots = nullptr;
+		size_t mSlotCount = 0;
+
+		/// <summary>
+		/// Number of entries, read without the lock since it only grows
+		/// </summary>
+		std::atomic<size_t> mCount = 0;
+
+		/// <summary>
+		/// Free room left in the current block
+		/// </summary>
+		std::byte* mCursor = nullptr;
+		size_t mRemaining = 0;
+
+		/// <summary>
+		/// Bytes taken from the system so far
+		/// </summary>
+		size_t mSize = 0;
+
+		mutable std::shared_mutex mMutex;
+
+		/// <summary>
+		/// Looks for an entry in the index, the caller holds the lock
+		/// </summary>
+		/// <param name="name">String</param>
+		/// <param name="hash">Hash of the string</param>
+		/// <returns>Entry if found, null otherwise</returns>
+		const Entry* Probe(std::string_view name, size_t hash) const;
+
+		/// <summary>
+		/// Copies a string into the blocks and indexes it, the caller holds the lock exclusively
+		/// </summary>
+		/// <param name="name">String, not interned yet</param>
+		/// <param name="hash">Hash of the string</param>
+		/// <returns>New entry</returns>
+		const Entry* Store(std::string_view name, size_t hash);
+
+		/// <summary>
+		/// Doubles the index, or creates the first one
+		/// </summary>
+		void Grow();
+
+		/// <summary>
+		/// Places an entry in the first free slot of its probe sequence
+		/// </summary>
+		/// <param name="entry">Entry</param>
+		void Link(const Entry* entry);
+
+		/// <summary>
+		/// Takes memory from the system
+		/// </summary>
+		/// <param name="bytes">Number of bytes</param>
+		/// <returns>Zeroed memory</returns>
+		void* Acquire(size_t bytes);
+
+		/// <summary>
+		/// Gives memory back to the system
+		/// </summary>
+		/// <param name="memory">Memory taken with Acquire</param>
+		/// <param name="bytes">Number of bytes it was taken with</param>
+		void Release(void* memory, size_t bytes);
+	};
+
+	Atom::Pool& Atom::Pool::Shared()
+	{
+		// built in place and never destroyed
+		alignas(Pool) static std::byte storage[sizeof(Pool)];
+		static Pool* pool = new (storage)Pool();
+
+		return *pool;
+	}
+
+	const Atom::Entry* Atom::Pool::Intern(std::string_view name)
+	{
+		const size_t hash = DefaultHash<std::string_view>()(name);
+
+		{
+			std::shared_lock<std::shared_mutex> lock(mMutex);
+			const Entry* entry = Probe(name, hash);
+			if (entry != nullptr)
+			{
+				return entry;
+			}
+		}
+
+		// another thread may have stored it between the two locks
+		std::unique_lock<std::shared_mutex> lock(mMutex);
+		const Entry* entry = Probe(name, hash);
+
+		return entry != nullptr ? entry : Store(name, hash);
+	}
+
+	const Atom::Entry* Atom::Pool::Find(std::string_view name) const
+	{
+		const size_t hash = DefaultHash<std::string_view>()(name);
+
+		std::shared_lock<std::shared_mutex> lock(mMutex);
+		return Probe(name, hash);
+	}
+
+	size_t Atom::Pool::Count() const
+	{
+		return mCount.load(std::memory_order_acquire);
+	}
+
+	size_t Atom::Pool::Size() const
+	{
+		std::shared_lock<std::shared_mutex> lock(mMutex);
+		return mSize;
+	}
+
+	const Atom::Entry* Atom::Pool::Probe(std::string_view name, size_t hash) const
+	{
+		if (mSlotCount == 0)
+		{
+			return nullptr;
+		}
+
+		const size_t mask = mSlotCount - 1;
+		for (size_t slot = hash & mask; mSlots[slot] != nullptr; slot = (slot + 1) & mask)
+		{
+			const Entry* entry = mSlots[slot];
+			if (entry->Hash == hash && Atom(entry).View() == name)
+			{
+				return entry;
+			}
+		}
+
+		return nullptr;
+	}
+
+	const Atom::Entry* Atom::Pool::Store(std::string_view name, size_t hash)
+	{
+		// keep the index at most half full, probe sequences stay short
+		if ((mCount + 1) * 2 > mSlotCount)
+		{
+			Grow();
+		}
+
+		// the characters follow the entry with a terminator, and the next entry starts aligned
+		const size_t bytes = (sizeof(Entry) + name.size() + 1 + alignof(Entry) - 1) / alignof(Entry) * alignof(Entry);
+		if (bytes > mRemaining)
+		{
+			const size_t blockSize = bytes > BlockSize ? bytes : BlockSize;
+			mCursor = static_cast<std::byte*>(Acquire(blockSize));
+			mRemaining = blockSize;
+		}
+
+		Entry* entry = new (mCursor)Entry{ hash, name.size() };
+		std::memcpy(entry + 1, name.data(), name.size());
+		reinterpret_cast<char*>(entry + 1)[name.size()] = '\0';
+		mCursor += bytes;
+		mRemaining -= bytes;
+
+		Link(entry);
+		mCount.fetch_add(1, std::memory_order_release);
+
+		return entry;
+	}
+
+	void Atom::Pool::Grow()
+	{
+		const Entry** oldSlots = mSlots;
+		const size_t oldSlotCount = mSlotCount;
+
+		mSlotCount = oldSlotCount > 0 ? oldSlotCount * 2 : MinSlotCount;
+		mSlots = static_cast<const Entry**>(Acquire(mSlotCount * sizeof(const Entry*)));
+
+		for (size_t i = 0; i < oldSlotCount; ++i)
+		{
+			if (oldSlots[i] != nullptr)
+			{
+				Link(oldSlots[i]);
+			}
+		}
+
+		if (oldSlots != nullptr)
+		{
+			Release(oldSlots, oldSlotCount * sizeof(const Entry*));
+		}
+	}
+
+	void Atom::Pool::Link(const Entry* entry)
+	{
+		const size_t mask = mSlotCount - 1;
+		size_t slot = entry->Hash & mask;
+		while (mSlots[slot] != nullptr)
+		{
+			slot = (slot + 1) & mask;
+		}
+
+		mSlots[slot] = entry;
+	}
+
+	void* Atom::Pool::Acquire(size_t bytes)
+	{
+#if defined(_WIN32)
+		void* memory = VirtualAlloc(nullptr, bytes, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+		if (memory == nullptr)
+		{
+			throw std::bad_alloc();
+		}
+#else
+		void* memory = ::operator new(bytes);
+		std::memset(memory, 0, bytes);
+#endif
+
+		mSize += bytes;
+
+		return memory;
+	}
+
+	void Atom::Pool::Release(void* memory, size_t bytes)
+	{
+#if defined(_WIN32)
+		VirtualFree(memory, 0, MEM_RELEASE);
+#else
+		::operator delete(memory);
+#endif
+
+		mSize -= bytes;
+	}
+
+	// Atom
+
+	Atom::Atom(std::string_view name) :
+		mEntry(name.empty() ? nullptr : Pool::Shared().Intern(name))
+	{
+	}
+
+	Atom Atom::Find(std::string_view name)
+	{
+		return Atom(name.empty() ? nullptr : Pool::Shared().Find(name));
+	}
+
+	size_t Atom::Count()
+	{
+		return Pool::Shared().Count();
+	}
+
+	size_t Atom::PoolSize()
+	{
+		return Pool::Shared().Size();
+	}
+}
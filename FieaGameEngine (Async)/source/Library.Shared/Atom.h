@@ -0,0 +1,148 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include "DefaultHash.h"
+#include "DefaultComparator.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Handle to a string interned in a global pool. Every spelling is stored once, with its hash
+	/// worked out up front, so copying an atom copies a pointer and two atoms are equal exactly when
+	/// they point at the same entry. The pool is shared by every thread and never shrinks:
+	/// interned strings live until the program ends, which suits names and not arbitrary text
+	/// </summary>
+	class Atom final
+	{
+	public:
+		/// <summary>
+		/// Creates the empty atom, it does not touch the pool
+		/// </summary>
+		Atom() = default;
+
+		/// <summary>
+		/// Interns the given string, adding it to the pool if it is not there yet
+		/// </summary>
+		/// <param name="name">String to intern</param>
+		explicit Atom(std::string_view name);
+
+		Atom(const Atom&) = default;
+		Atom(Atom&&) = default;
+		Atom& operator=(const Atom&) = default;
+		Atom& operator=(Atom&&) = default;
+		~Atom() = default;
+
+		/// <summary>
+		/// Looks for a string in the pool without adding it, for lookups that must not grow it
+		/// </summary>
+		/// <param name="name">String to look for</param>
+		/// <returns>Atom of the string if interned, the empty atom otherwise</returns>
+		static Atom Find(std::string_view name);
+
+		/// <summary>
+		/// Gets the number of strings interned so far. It never goes down and takes no lock,
+		/// so an unchanged count tells that a string not found before is still not interned
+		/// </summary>
+		/// <returns>Number of atoms in the pool</returns>
+		static size_t Count();
+
+		/// <summary>
+		/// Gets the memory held by the pool, strings and index together
+		/// </summary>
+		/// <returns>Number of bytes reserved by the pool</returns>
+		static size_t PoolSize();
+
+		/// <summary>
+		/// Compares two atoms by identity
+		/// </summary>
+		/// <param name="other">Atom</param>
+		/// <returns>True if both name the same string, false otherwise</returns>
+		bool operator==(const Atom& other) const;
+
+		/// <summary>
+		/// Compares the interned string with another string
+		/// </summary>
+		/// <param name="other">String</param>
+		/// <returns>True if the strings match, false otherwise</returns>
+		bool operator==(std::string_view other) const;
+
+		/// <summary>
+		/// Gets the interned string, it stays valid for the rest of the program
+		/// </summary>
+		/// <returns>Interned string</returns>
+		std::string_view View() const;
+
+		/// <summary>
+		/// Gets the interned string, it stays valid for the rest of the program
+		/// </summary>
+		/// <returns>Interned string</returns>
+		operator std::string_view() const;
+
+		/// <summary>
+		/// Gets the hash of the interned string, the same DefaultHash gives the string itself
+		/// </summary>
+		/// <returns>Hash</returns>
+		size_t Hash() const;
+
+		/// <summary>
+		/// Checks if this is the empty atom
+		/// </summary>
+		/// <returns>True if empty, false otherwise</returns>
+		bool IsEmpty() const;
+
+	private:
+		/// <summary>
+		/// Interned string as laid out in the pool, its characters follow it
+		/// </summary>
+		struct Entry final
+		{
+			size_t Hash;
+			size_t Length;
+		};
+
+		class Pool;
+
+		explicit Atom(const Entry* entry);
+
+		/// <summary>
+		/// Pooled entry, null for the empty atom
+		/// </summary>
+		const Entry* mEntry = nullptr;
+	};
+
+	/// <summary>
+	/// Transparent, hands out the hash stored in the atom and hashes strings the
+	/// same way as DefaultHash of std::string, so maps keyed by atoms can be searched by name
+	/// </summary>
+	template <>
+	class DefaultHash<Atom> final
+	{
+	public:
+		using is_transparent = void;
+		using is_avalanching = void;
+
+		size_t operator()(const Atom& key) const;
+		size_t operator()(std::string_view key) const;
+		size_t operator()(const std::string& key) const;
+		size_t operator()(const char* key) const;
+	};
+
+	/// <summary>
+	/// Transparent, compares atoms by identity and strings by their characters
+	/// </summary>
+	template <>
+	class DefaultComparator<Atom> final
+	{
+	public:
+		using is_transparent = void;
+
+		bool operator()(const Atom& left, const Atom& right) const;
+		bool operator()(std::string_view left, const Atom& right) const;
+		bool operator()(const std::string& left, const Atom& right) const;
+		bool operator()(const char* left, const Atom& right) const;
+	};
+}
+
+#include "Atom.inl"
@@ -0,0 +1,85 @@
+#include "Atom.h"
+
+namespace FieaGameEngine
+{
+	inline Atom::Atom(const Entry* entry) :
+		mEntry(entry)
+	{
+	}
+
+	inline bool Atom::operator==(const Atom& other) const
+	{
+		return mEntry == other.mEntry;
+	}
+
+	inline bool Atom::operator==(std::string_view other) const
+	{
+		return View() == other;
+	}
+
+	inline std::string_view Atom::View() const
+	{
+		if (mEntry == nullptr)
+		{
+			return std::string_view();
+		}
+
+		// the characters are stored right after the entry
+		return std::string_view(reinterpret_cast<const char*>(mEntry + 1), mEntry->Length);
+	}
+
+	inline Atom::operator std::string_view() const
+	{
+		return View();
+	}
+
+	inline size_t Atom::Hash() const
+	{
+		return mEntry != nullptr ? mEntry->Hash : DefaultHash<std::string_view>()(std::string_view());
+	}
+
+	inline bool Atom::IsEmpty() const
+	{
+		return mEntry == nullptr;
+	}
+
+	inline size_t DefaultHash<Atom>::operator()(const Atom& key) const
+	{
+		return key.Hash();
+	}
+
+	inline size_t DefaultHash<Atom>::operator()(std::string_view key) const
+	{
+		return DefaultHash<std::string_view>()(key);
+	}
+
+	inline size_t DefaultHash<Atom>::operator()(const std::string& key) const
+	{
+		return DefaultHash<std::string_view>()(key);
+	}
+
+	inline size_t DefaultHash<Atom>::operator()(const char* key) const
+	{
+		return DefaultHash<std::string_view>()(key);
+	}
+
+	inline bool DefaultComparator<Atom>::operator()(const Atom& left, const Atom& right) const
+	{
+		return left == right;
+	}
+
+	inline bool DefaultComparator<Atom>::operator()(std::string_view left, const Atom& right) const
+	{
+		return right == left;
+	}
+
+	inline bool DefaultComparator<Atom>::operator()(const std::string& left, const Atom& right) const
+	{
+		return right == std::string_view(left);
+	}
+
+	inline bool DefaultComparator<Atom>::operator()(const char* left, const Atom& right) const
+	{
+		return right == std::string_view(left);
+	}
+}
@@ -6,12 +6,14 @@
 #include "Attributed.h"
 
 using namespace std::literals::string_literals;
+using namespace std::literals::string_view_literals;
 
 namespace FieaGameEngine
 {
 	RTTI_DEFINITIONS(Attributed)
 
-	Attributed::Attributed(RTTI::IdType type)
+	Attributed::Attributed(RTTI::IdType type) :
+		Scope(0)
 	{
 		Populate(type);
 	}
@@ -62,9 +64,7 @@ namespace FieaGameEngine
 
 		for (size_t i = 1; i < Size(); ++i)
 		{
-			auto thisPair = mList[i];
-			auto thatPair = other.mList[i];
-			if (*thisPair != *thatPair)
+			if (mMap.EntryAt(i) != other.mMap.EntryAt(i))
 			{
 				return false;
 			}
@@ -85,6 +85,13 @@ namespace FieaGameEngine
 		return Append(name);
 	}
 
+	Datum& Attributed::AppendAuxiliaryAttribute(Atom name)
+	{
+		PrescribedNameGuard(name);
+
+		return Append(name);
+	}
+
 	Datum& Attributed::AppendAuxiliaryAttribute(const std::string& name, const Datum& datum)
 	{
 		PrescribedNameGuard(name);
@@ -106,98 +113,93 @@ namespace FieaGameEngine
 		return Append(std::move(pair));
 	}
 
-	bool Attributed::IsAttribute(const std::string& name) const
+	bool Attributed::IsAttribute(std::string_view name) const
 	{
 		return mMap.ContainsKey(name);
 	}
 
-	bool Attributed::IsPrescribedAttribute(const std::string& name) const
+	bool Attributed::IsPrescribedAttribute(std::string_view name) const
 	{
-		if (name == "this"s)
-		{
-			return true;
-		}
-
-		for (const auto& signature : GetSignatures())
-		{
-			if (signature.Name == name)
-			{
-				assert(IsAttribute(name));
-				return true;
-			}
-		}
+		const bool prescribed = GetLayout().Names.ContainsKey(name);
+		assert(!prescribed || IsAttribute(name));
 
-		return false;
+		return prescribed;
 	}
 
-	bool Attributed::IsAuxiliaryAttribute(const std::string& name) const
+	bool Attributed::IsAuxiliaryAttribute(std::string_view name) const
 	{
 		return IsAttribute(name) && !IsPrescribedAttribute(name);
 	}
 
-	Vector<Scope::EntryType*> Attributed::Attributes()
+	Scope::ListType Attributed::Attributes()
 	{
-		return mList;
+		ListType result(Size());
+		for (auto& entry : mMap)
+		{
+			result.PushBack(&entry);
+		}
+
+		return result;
 	}
 
-	Vector<const Scope::EntryType*> Attributed::Attributes() const
+	Scope::ConstListType Attributed::Attributes() const
 	{
-		Vector<const EntryType*> result(Size());
-		for (auto entry : mList)
+		ConstListType result(Size());
+		for (const auto& entry : mMap)
 		{
-			result.PushBack(entry);
+			result.PushBack(&entry);
 		}
 
 		return result;
 	}
 
-	Vector<Scope::EntryType*> Attributed::PrescribedAttributes()
+	Scope::ListType Attributed::PrescribedAttributes()
 	{
 		size_t count = GetPrescribedAttributeCount();
-		Vector<EntryType*> result(count);
+		ListType result(count);
 
 		for (size_t i = 0; i < count; ++i)
 		{
-			result.PushBack(mList[i]);
+			result.PushBack(&mMap.EntryAt(i));
 		}
 
 		return result;
 	}
 
-	Vector<const Scope::EntryType*> Attributed::PrescribedAttributes() const
+	Scope::ConstListType Attributed::PrescribedAttributes() const
 	{
 		size_t count = GetPrescribedAttributeCount();
-		Vector<const EntryType*> result(count);
+		ConstListType result(count);
 
 		for (size_t i = 0; i < count; ++i)
 		{
-			result.PushBack(mList[i]);
+			result.PushBack(&mMap.EntryAt(i));
 		}
 
 		return result;
 	}
 
-	Vector<Scope::EntryType*> Attributed::AuxiliaryAttributes()
+	Scope::ListType Attributed::AuxiliaryAttributes()
 	{
-		size_t count = mList.Size() - GetPrescribedAttributeCount();
-		Vector<EntryType*> result(count);
+		size_t count = mMap.Size() - GetPrescribedAttributeCount();
+		ListType result(count);
 
-		for (size_t i = GetPrescribedAttributeCount(); i < mList.Size(); ++i)
+		for (size_t i = GetPrescribedAttributeCount(); i < mMap.Size(); ++i)
 		{
-			result.PushBack(mList[i]);
+			result.PushBack(&mMap.EntryAt(i));
 		}
 
 		return result;
 	}
 
-	Vector<const Scope::EntryType*> Attributed::AuxiliaryAttributes() const
+	Scope::ConstListType Attributed::AuxiliaryAttributes() const
 	{
-		size_t count = mList.Size() - GetPrescribedAttributeCount();
-		Vector<const EntryType*> result(count);
+		size_t count = mMap.Size() - GetPrescribedAttributeCount();
+		ConstListType result(count);
 
-		for (size_t i = GetPrescribedAttributeCount(); i < mList.Size(); ++i)
+		for (size_t i = GetPrescribedAttributeCount(); i < mMap.Size(); ++i)
 		{
-			result.PushBack(mList[i]);
+			result.PushBack(&mMap.EntryAt(i));
 		}
 
 		return result;
@@ -211,13 +213,7 @@ namespace FieaGameEngine
 
 	void Attributed::ClearAuxiliaryAttributes()
 	{
-		auto auxBegin = std::next(mList.begin(), GetPrescribedAttributeCount());
-		for (auto it = auxBegin; it != mList.end(); ++it)
-		{
-			mMap.Remove((*it)->first);
-		}
-
-		mList.Remove(auxBegin, mList.end());
+		RemoveEntries(mMap.begin() + GetPrescribedAttributeCount(), mMap.end());
 	}
 
 	bool Attributed::Equals(const RTTI* other) const
@@ -236,76 +232,47 @@ namespace FieaGameEngine
 		return TypeName();
 	}
 
-	Vector<Signature> Attributed::GetSignatures() const
+	const TypeManager::TypeLayout& Attributed::GetLayout() const
 	{
-		size_t total = GetPrescribedAttributeCount() - 1;
-		Vector<Signature> signatures(total);
-
-		RTTI::IdType type = TypeIdInstance();
-		while (type != Attributed::TypeIdClass())
-		{
-			for (auto& signature : TypeManager::GetSignatures(type))
-			{
-				signatures.PushBack(signature);
-			}
-
-			auto[found, id] = TypeManager::FindBaseId(type);
-			assert(found);
-			type = id;
-		}
-
-		return signatures;
+		return TypeManager::GetLayout(TypeIdInstance());
 	}
 
 	size_t Attributed::GetPrescribedAttributeCount() const
 	{
-		RTTI::IdType type = TypeIdInstance();
-		size_t total = 1;
-		while (type != Attributed::TypeIdClass())
-		{
-			total += TypeManager::GetSignatureCount(type);
-
-			auto[found, id] = TypeManager::FindBaseId(type);
-			assert(found);
-			type = id;
-		}
-
-		return total;
+		return GetLayout().PrescribedCount;
 	}
 
 	void Attributed::Populate(RTTI::IdType type)
 	{
-		(*this)["this"s] = this;
+		const auto& layout = TypeManager::GetLayout(type);
+
+		// every entry comes from the type's prototype in one copy, only the storage is left to point at this object
+		CopyEntries(layout.Prototype);
+		(*this)[0] = this;
 
-		auto stack = TypeManager::GetInheritanceChain(type);
-		while (!stack.IsEmpty())
+		size_t i = 1;
+		for (const auto& signature : layout.Signatures)
 		{
-			const auto& signatures = TypeManager::GetSignatures(stack.Top());
-			for (const auto& signature : signatures)
+			if (signature.Type == Datum::DatumType::UNKNOWN)
 			{
-				if (signature.Type == Datum::DatumType::UNKNOWN)
-				{
-					throw std::exception("Unsupported type");
-				}
+				throw std::exception("Unsupported type");
+			}
 
-				// TODO: what to do if the header tool supplies a signature with an already present name AND the same type
+			// TODO: what to do if the header tool supplies a signature with an already present name AND the same type
+			assert(mMap.EntryAt(i).first == signature.Name);
 
-				Datum& datum = Append(signature.Name);
-				if (signature.Type != Datum::DatumType::TABLE)
-				{
-					datum.SetStorage(reinterpret_cast<std::uint8_t*>(this) + signature.Offset, signature.Size, signature.Type);
-				}
-				else
+			Datum& datum = (*this)[i++];
+			if (signature.Type != Datum::DatumType::TABLE)
+			{
+				datum.SetStorage(reinterpret_cast<std::uint8_t*>(this) + signature.Offset, signature.Size, signature.Type);
+			}
+			else
+			{
+				for (size_t j = 0; j < signature.Size; ++j)
 				{
-					datum.SetType(Datum::DatumType::TABLE);
-					for (size_t i = 0; i < signature.Size; ++i)
-					{
-						AppendScope(signature.Name);
-					}
+					AppendScope(signature.Name);
 				}
 			}
-
-			stack.Pop();
 		}
 	}
 
@@ -314,34 +281,24 @@ namespace FieaGameEngine
 		assert(Size() > 0 && (*this)[0].Type() == Datum::DatumType::POINTER);
 		(*this)[0] = this;
 
+		// update external storage pointers with the correct address
 		size_t i = 1;
-		auto stack = TypeManager::GetInheritanceChain(type);
-		while (!stack.IsEmpty())
+		for (const auto& signature : TypeManager::GetLayout(type).Signatures)
 		{
-			const auto& signatures = TypeManager::GetSignatures(stack.Top());
-			size_t count = signatures.Size();
+			assert(signature.Type != Datum::DatumType::UNKNOWN);
 
-			// update external storage pointers with the correct address
-			for (size_t j = 0; j < count; ++j)
+			assert(mMap.EntryAt(i).first == signature.Name);
+			assert(mMap.EntryAt(i).second.Type() == signature.Type);
+			if (signature.Type != Datum::DatumType::TABLE)
 			{
-				const auto& signature = signatures[j];
-				assert(signature.Type != Datum::DatumType::UNKNOWN);
-
-				assert(mList[i]->first == signature.Name);
-				assert(mList[i]->second.Type() == signature.Type);
-				if (signature.Type != Datum::DatumType::TABLE)
-				{
-					(*this)[i].SetStorage(reinterpret_cast<std::int8_t*>(this) + signature.Offset, signature.Size, signature.Type);
-				}
-
-				++i;
+				(*this)[i].SetStorage(reinterpret_cast<std::int8_t*>(this) + signature.Offset, signature.Size, signature.Type);
 			}
 
-			stack.Pop();
+			++i;
 		}
 	}
 
-	void Attributed::PrescribedNameGuard(const std::string& name)
+	void Attributed::PrescribedNameGuard(std::string_view name)
 	{
 		if (IsPrescribedAttribute(name))
 		{
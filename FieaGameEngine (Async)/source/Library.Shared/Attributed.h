@@ -2,6 +2,7 @@
 
 #include "Scope.h"
 #include "Signature.h"
+#include "TypeManager.h"
 
 namespace FieaGameEngine
 {
@@ -66,6 +67,14 @@ namespace FieaGameEngine
 		/// <returns>datum mapped to the added or existing attribute</returns>
 		Datum& AppendAuxiliaryAttribute(const std::string& name);
 
+		/// <summary>
+		/// Adds an attribute (entry) to this scope
+		/// </summary>
+		/// <exception cref="std::exception">thrown if the name is the name of a prescribed attribute</exception>
+		/// <param name="name">name for the new attribute</param>
+		/// <returns>datum mapped to the added or existing attribute</returns>
+		Datum& AppendAuxiliaryAttribute(Atom name);
+
 		/// <summary>
 		/// 
 		/// </summary>
@@ -93,7 +102,7 @@ namespace FieaGameEngine
 		/// </summary>
 		/// <param name="name">name</param>
 		/// <returns>true if present, false otherwise</returns>
-		bool IsAttribute(const std::string& name) const;
+		bool IsAttribute(std::string_view name) const;
 
 		/// <summary>
 		/// determines if the given name is the name of a prescribed attribute in this scope
@@ -101,7 +110,7 @@ namespace FieaGameEngine
 		/// </summary>
 		/// <param name="name">name</param>
 		/// <returns>true if prescribed, false otherwise</returns>
-		bool IsPrescribedAttribute(const std::string& name) const;
+		bool IsPrescribedAttribute(std::string_view name) const;
 
 		/// <summary>
 		/// determines if the given name is the name of a auxiliary attribute in this scope
@@ -110,43 +119,43 @@ namespace FieaGameEngine
 		/// </summary>
 		/// <param name="name">name</param>
 		/// <returns>true if auxiliary, false otherwise</returns>
-		bool IsAuxiliaryAttribute(const std::string& name) const;
+		bool IsAuxiliaryAttribute(std::string_view name) const;
 
 		/// <summary>
 		/// gets all the attributes (entries) of this scope
 		/// </summary>
 		/// <returns>vector of pointer to entries of this scope</returns>
-		Vector<EntryType*> Attributes();
+		ListType Attributes();
 
 		/// <summary>
 		/// gets all the attributes (entries) of this scope
 		/// </summary>
 		/// <returns>vector of pointer to entries of this scope</returns>
-		Vector<const EntryType*> Attributes() const;
+		ConstListType Attributes() const;
 
 		/// <summary>
 		/// gets the prescribed attributes (entries) of this scope
 		/// </summary>
 		/// <returns>vector of pointer to entries of this scope</returns>
-		Vector<EntryType*> PrescribedAttributes();
+		ListType PrescribedAttributes();
 
 		/// <summary>
 		/// gets the prescribed attributes (entries) of this scope
 		/// </summary>
 		/// <returns>vector of pointer to entries of this scope</returns>
-		Vector<const EntryType*> PrescribedAttributes() const;
+		ConstListType PrescribedAttributes() const;
 
 		/// <summary>
 		/// gets the auxiliary attributes (entries) of this scope
 		/// </summary>
 		/// <returns>vector of pointer to entries of this scope</returns>
-		Vector<EntryType*> AuxiliaryAttributes();
+		ListType AuxiliaryAttributes();
 
 		/// <summary>
 		/// gets the auxiliary attributes (entries) of this scope
 		/// </summary>
 		/// <returns>vector of pointer to entries of this scope</returns>
-		Vector<const EntryType*> AuxiliaryAttributes() const;
+		ConstListType AuxiliaryAttributes() const;
 
 		/// <summary>
 		/// removes all the entries in this scope
@@ -185,11 +194,10 @@ namespace FieaGameEngine
 
 	private:
 		/// <summary>
-		/// gets the signatures for the given class
+		/// gets the layout of prescribed attributes of this object's type
 		/// </summary>
-		/// <param name="type">class type</param>
-		/// <returns>vector of signatures</returns>
-		Vector<Signature> GetSignatures() const;
+		/// <returns>layout kept by the type manager</returns>
+		const TypeManager::TypeLayout& GetLayout() const;
 
 		/// <summary>
 		/// gets the number of prescribed attributes for this attributed object
@@ -209,6 +217,6 @@ namespace FieaGameEngine
 		/// <param name="type">class type</param>
 		void UpdatePrescribedAttributes(RTTI::IdType type);
 
-		void PrescribedNameGuard(const std::string& name);
+		void PrescribedNameGuard(std::string_view name);
 	};
 }
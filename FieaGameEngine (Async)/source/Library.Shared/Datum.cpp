@@ -1,13 +1,175 @@
 #include "pch.h"
 #include <glm/gtx/string_cast.hpp>
 #include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <charconv>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
 #include <functional>
+#include <iterator>
 #include <string>
+#include <string_view>
+#include <system_error>
 #include "RTTI.h"
 #include "Datum.h"
 
 namespace FieaGameEngine
 {
+	namespace
+	{
+		/// <summary>
+		/// Reads tokens off the front of a string without copying it. Whitespace before every token is
+		/// skipped and anything after the last one is ignored, as with std::stof and the sscanf formats
+		/// </summary>
+		class TextReader final
+		{
+		public:
+			explicit TextReader(std::string_view text) :
+				mCursor(text.data()), mEnd(text.data() + text.size())
+			{
+			}
+
+			/// <summary>
+			/// Consumes an exact piece of text
+			/// </summary>
+			/// <exception cref="std::exception">Thrown if the text is not next</exception>
+			void Expect(std::string_view token)
+			{
+				SkipWhitespace();
+				if (static_cast<size_t>(mEnd - mCursor) < token.size() || std::string_view(mCursor, token.size()) != token)
+				{
+					throw std::exception("Malformed string.");
+				}
+
+				mCursor += token.size();
+			}
+
+			/// <summary>
+			/// Consumes a number, with an optional sign
+			/// </summary>
+			/// <exception cref="std::exception">Thrown if there is no number next or it does not fit the type</exception>
+			template <typename T>
+			T Read()
+			{
+				SkipWhitespace();
+
+				// from_chars takes a minus sign only
+				if (mEnd - mCursor > 1 && *mCursor == '+' && mCursor[1] != '-')
+				{
+					++mCursor;
+				}
+
+				T value{};
+				mCursor = Parse(value);
+
+				return value;
+			}
+
+		private:
+			/// <summary>
+			/// Parses the number at the cursor, returning where it ends
+			/// </summary>
+			template <typename T>
+			const char* Parse(T& value) const
+			{
+				const auto [end, error] = std::from_chars(mCursor, mEnd, value);
+				if (error == std::errc::result_out_of_range)
+				{
+					throw std::exception("Number out of range.");
+				}
+				else if (error != std::errc())
+				{
+					throw std::exception("Malformed string.");
+				}
+
+				return end;
+			}
+
+#if !defined(__cpp_lib_to_chars)
+			/// <summary>
+			/// The v141 STL only has the integer overloads of from_chars. Floats go through strtof instead,
+			/// on a null terminated copy of the token that lives on the stack unless the token is unusually long
+			/// </summary>
+			const char* Parse(float& value) const
+			{
+				// strtof skips whitespace of its own, from_chars does not
+				if (mCursor == mEnd || std::isspace(static_cast<unsigned char>(*mCursor)))
+				{
+					throw std::exception("Malformed string.");
+				}
+
+				const char* tokenEnd = mCursor;
+				while (tokenEnd != mEnd && *tokenEnd != ',' && *tokenEnd != ')' && !std::isspace(static_cast<unsigned char>(*tokenEnd)))
+				{
+					++tokenEnd;
+				}
+
+				const size_t length = static_cast<size_t>(tokenEnd - mCursor);
+				char buffer[64];
+				std::string longToken;
+				const char* token = buffer;
+				if (length < std::size(buffer))
+				{
+					std::memcpy(buffer, mCursor, length);
+					buffer[length] = '\0';
+				}
+				else
+				{
+					longToken.assign(mCursor, length);
+					token = longToken.c_str();
+				}
+
+				char* end;
+				errno = 0;
+				value = std::strtof(token, &end);
+				if (end == token)
+				{
+					throw std::exception("Malformed string.");
+				}
+
+				// strtof also flags results that lose precision as subnormals, only overflow and underflow to zero count
+				if (errno == ERANGE && (std::isinf(value) || value == 0.0f))
+				{
+					throw std::exception("Number out of range.");
+				}
+
+				return mCursor + (end - token);
+			}
+#endif
+
+			void SkipWhitespace()
+			{
+				while (mCursor != mEnd && std::isspace(static_cast<unsigned char>(*mCursor)))
+				{
+					++mCursor;
+				}
+			}
+
+			const char* mCursor;
+			const char* mEnd;
+		};
+
+		/// <summary>
+		/// Reads the "x, y, z, w)" that follows the opening of a vector or a matrix column
+		/// </summary>
+		void ReadComponents(TextReader& reader, glm::vec4& vector)
+		{
+			for (glm::length_t i = 0; i < 4; ++i)
+			{
+				if (i > 0)
+				{
+					reader.Expect(",");
+				}
+
+				vector[i] = reader.Read<float>();
+			}
+
+			reader.Expect(")");
+		}
+	}
+
 	template <>
 	inline void Datum::CreateDefault<std::int32_t>(size_t index)
 	{
@@ -86,37 +248,37 @@ namespace FieaGameEngine
 	}
 
 	template <>
-	inline void Datum::SetFromString<std::int32_t>(const std::string& string, size_t index)
+	inline void Datum::SetFromString<std::int32_t>(std::string_view string, size_t index)
 	{
-		mStorage.Integer[index] = std::stoi(string);
+		mStorage.Integer[index] = StringToInteger(string);
 	}
 
 	template <>
-	inline void Datum::SetFromString<float>(const std::string& string, size_t index)
+	inline void Datum::SetFromString<float>(std::string_view string, size_t index)
 	{
-		mStorage.Float[index] = std::stof(string);
+		mStorage.Float[index] = StringToFloat(string);
 	}
 
 	template <>
-	inline void Datum::SetFromString<glm::vec4>(const std::string& string, size_t index)
+	inline void Datum::SetFromString<glm::vec4>(std::string_view string, size_t index)
 	{
 		mStorage.Vector[index] = StringToVector(string);
 	}
 
 	template <>
-	inline void Datum::SetFromString<glm::mat4>(const std::string& string, size_t index)
+	inline void Datum::SetFromString<glm::mat4>(std::string_view string, size_t index)
 	{
 		mStorage.Matrix[index] = StringToMatrix(string);
 	}
 
 	template <>
-	inline void Datum::SetFromString<std::string>(const std::string& string, size_t index)
+	inline void Datum::SetFromString<std::string>(std::string_view string, size_t index)
 	{
 		mStorage.String[index] = string;
 	}
 
 	template <>
-	inline void Datum::SetFromString<RTTI*>(const std::string&, size_t)
+	inline void Datum::SetFromString<RTTI*>(std::string_view, size_t)
 	{
 		throw std::exception("Cannot set pointers from strings.");
 	}
@@ -266,13 +428,9 @@ namespace FieaGameEngine
 		}
 	}
 
-	Datum::Datum(Datum&& other) :
-		mStorage(std::move(other.mStorage)), mType(other.mType), mSize(other.mSize), mCapacity(other.mCapacity), mOwnsStorage(other.mOwnsStorage)
+	Datum::Datum(Datum&& other)
 	{
-		other.mStorage.Integer = nullptr;
-		other.mSize = 0;
-		other.mCapacity = 0;
-		other.mOwnsStorage = true;
+		Steal(other);
 	}
 
 	Datum& Datum::operator=(const Datum& other)
@@ -306,17 +464,7 @@ namespace FieaGameEngine
 		if (this != &other)
 		{
 			Destroy();
-
-			mStorage = other.mStorage;
-			mType = other.mType;
-			mSize = other.mSize;
-			mCapacity = other.mCapacity;
-			mOwnsStorage = other.mOwnsStorage;
-
-			other.mStorage.Integer = nullptr;
-			other.mSize = 0;
-			other.mCapacity = 0;
-			other.mOwnsStorage = true;
+			Steal(other);
 		}
 
 		return *this;
@@ -913,7 +1061,7 @@ namespace FieaGameEngine
 		new (mStorage.Table + index)Scope*(&value);
 	}
 
-	void Datum::SetFromString(const std::string& string, size_t index)
+	void Datum::SetFromString(std::string_view string, size_t index)
 	{
 		IndexGuard(index);
 
@@ -922,6 +1070,26 @@ namespace FieaGameEngine
 		std::invoke(func, this, string, index);
 	}
 
+	Datum::SetFromStringFunc Datum::PrepareSetFromStrings(size_t index, size_t count)
+	{
+		UnknownTypeGuard();
+
+		if (mType == DatumType::POINTER || mType == DatumType::TABLE)
+		{
+			throw std::exception("Cannot set pointers from strings.");
+		}
+
+		if (index + count > mSize)
+		{
+			ExternalStorageGuard();
+			Resize(index + count);
+		}
+
+		auto func = sSetFromStringFuncs[TypeOffset()];
+		assert(func != nullptr);
+		return func;
+	}
+
 	void Datum::SetStorage(std::int32_t* data, size_t size)
 	{
 		return SetStorage(data, size, DatumType::INTEGER);
@@ -1431,7 +1599,23 @@ namespace FieaGameEngine
 
 		if (capacity > mCapacity)
 		{
-			mStorage.Wildcard = std::realloc(mStorage.Wildcard, sTypeSizes[TypeOffset()] * capacity);
+			const size_t typeSize = sTypeSizes[TypeOffset()];
+			if ((mStorage.Wildcard == nullptr || IsInline()) && FitsInline(capacity))
+			{
+				mStorage.Wildcard = mInline;
+			}
+			else if (IsInline())
+			{
+				// outgrew the inline buffer, only trivially copyable values are ever kept there
+				void* buffer = std::malloc(typeSize * capacity);
+				std::memcpy(buffer, mInline, typeSize * mSize);
+				mStorage.Wildcard = buffer;
+			}
+			else
+			{
+				mStorage.Wildcard = std::realloc(mStorage.Wildcard, typeSize * capacity);
+			}
+
 			mCapacity = capacity;
 		}
 	}
@@ -1443,7 +1627,22 @@ namespace FieaGameEngine
 
 		if (mCapacity > mSize)
 		{
-			mStorage.Wildcard = std::realloc(mStorage.Wildcard, sTypeSizes[TypeOffset()] * mSize);
+			const size_t typeSize = sTypeSizes[TypeOffset()];
+			if (IsInline())
+			{
+				// nothing to give back
+			}
+			else if (FitsInline(mSize))
+			{
+				std::memcpy(mInline, mStorage.Wildcard, typeSize * mSize);
+				free(mStorage.Wildcard);
+				mStorage.Wildcard = mInline;
+			}
+			else
+			{
+				mStorage.Wildcard = std::realloc(mStorage.Wildcard, typeSize * mSize);
+			}
+
 			mCapacity = mSize;
 		}
 	}
@@ -1530,6 +1729,11 @@ namespace FieaGameEngine
 		return mOwnsStorage;
 	}
 
+	bool Datum::IsInline() const
+	{
+		return mStorage.Wildcard == mInline;
+	}
+
 	std::string Datum::ToString(size_t index) const
 	{
 		IndexGuard(index);
@@ -1563,6 +1767,33 @@ namespace FieaGameEngine
 		mOwnsStorage = false;
 	}
 
+	inline bool Datum::FitsInline(size_t capacity) const
+	{
+		static_assert(alignof(glm::vec4) <= alignof(DatumStorage), "Vectors need more alignment than the inline buffer has.");
+
+		return mType != DatumType::STRING && sTypeSizes[TypeOffset()] * capacity <= InlineBytes;
+	}
+
+	void Datum::Steal(Datum& other)
+	{
+		mStorage = other.mStorage;
+		mType = other.mType;
+		mSize = other.mSize;
+		mCapacity = other.mCapacity;
+		mOwnsStorage = other.mOwnsStorage;
+
+		if (other.IsInline())
+		{
+			std::memcpy(mInline, other.mInline, InlineBytes);
+			mStorage.Wildcard = mInline;
+		}
+
+		other.mStorage.Integer = nullptr;
+		other.mSize = 0;
+		other.mCapacity = 0;
+		other.mOwnsStorage = true;
+	}
+
 	void Datum::DeepCopy(const Datum& other)
 	{
 		assert(mType != DatumType::UNKNOWN);
@@ -1575,7 +1806,11 @@ namespace FieaGameEngine
 	{
 		if (mOwnsStorage && mType != DatumType::UNKNOWN)
 		{
-			free(mStorage.Wildcard);
+			if (!IsInline())
+			{
+				free(mStorage.Wildcard);
+			}
+
 			mStorage.Wildcard = nullptr;
 			mCapacity = 0;
 		}
@@ -1638,31 +1873,46 @@ namespace FieaGameEngine
 		}
 	}
 
-	glm::vec4 Datum::StringToVector(const std::string& string) const
+	std::int32_t Datum::StringToInteger(std::string_view string)
 	{
-		glm::vec4 vector;
-		int result = sscanf_s(string.c_str(), " vec4( %f , %f , %f , %f ) ", &vector[0], &vector[1], &vector[2], &vector[3]);
+		return TextReader(string).Read<std::int32_t>();
+	}
 
-		if (result != 4)
-		{
-			throw std::exception("Malformed string.");
-		}
+	float Datum::StringToFloat(std::string_view string)
+	{
+		return TextReader(string).Read<float>();
+	}
+
+	glm::vec4 Datum::StringToVector(std::string_view string)
+	{
+		TextReader reader(string);
+		reader.Expect("vec4(");
+
+		glm::vec4 vector;
+		ReadComponents(reader, vector);
 
 		return vector;
 	}
 
-	glm::mat4 Datum::StringToMatrix(const std::string& string) const
+	glm::mat4 Datum::StringToMatrix(std::string_view string)
 	{
-		glm::mat4 matrix;
-		int result = sscanf_s(string.c_str(), " mat4x4( ( %f , %f , %f , %f ) , ( %f , %f , %f , %f ) , ( %f , %f , %f , %f ) , ( %f , %f , %f , %f ) ) ",
-			&matrix[0][0], &matrix[0][1], &matrix[0][2], &matrix[0][3], &matrix[1][0], &matrix[1][1], &matrix[1][2], &matrix[1][3],
-			&matrix[2][0], &matrix[2][1], &matrix[2][2], &matrix[2][3], &matrix[3][0], &matrix[3][1], &matrix[3][2], &matrix[3][3]);
+		TextReader reader(string);
+		reader.Expect("mat4x4(");
 
-		if (result != 16)
+		glm::mat4 matrix;
+		for (glm::length_t column = 0; column < 4; ++column)
 		{
-			throw std::exception("Malformed string.");
+			if (column > 0)
+			{
+				reader.Expect(",");
+			}
+
+			reader.Expect("(");
+			ReadComponents(reader, matrix[column]);
 		}
 
+		reader.Expect(")");
+
 		return matrix;
 	}
 
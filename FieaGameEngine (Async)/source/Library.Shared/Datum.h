@@ -3,6 +3,8 @@
 #include <glm/fwd.hpp>
 #include <cstddef>
 #include <cstdint>
+#include <string_view>
+#include "Span.h"
 
 namespace FieaGameEngine
 {
@@ -10,7 +12,9 @@ namespace FieaGameEngine
 	class Scope;
 
 	/// <summary>
-	/// Core class for representing a piece of data in the engine
+	/// Core class for representing a piece of data in the engine.
+	/// A few small values, up to 16 bytes of integers, floats, a vector or pointers, are kept inside
+	/// the datum itself, it only takes a heap buffer once they outgrow that
 	/// </summary>
 	class Datum final
 	{
@@ -717,13 +721,26 @@ namespace FieaGameEngine
 		void Set(RTTI* value, size_t index = 0);
 
 		/// <summary>
-		/// sets the element at the given index to the value parsed from the given string
+		/// sets the element at the given index to the value parsed from the given string.
+		/// Vectors and matrices are read in the glm::to_string format, numbers parse without allocating
 		/// </summary>
-		/// <exception cref="std::exception">thrown if storage is external</exception>
 		/// <exception cref="std::exception">thrown if index is out of range</exception>
+		/// <exception cref="std::exception">thrown if malformed string</exception>
 		/// <param name="string">string to parse</param>
 		/// <param name="index">index of element</param>
-		void SetFromString(const std::string& string, size_t index = 0);
+		void SetFromString(std::string_view string, size_t index = 0);
+
+		/// <summary>
+		/// sets consecutive elements to the values parsed from a range of strings, looking the parser up once
+		/// for all of them. A datum owning its storage grows to fit the range, external storage has to hold it
+		/// </summary>
+		/// <exception cref="std::exception">thrown if type not set, or it is a table or pointer</exception>
+		/// <exception cref="std::exception">thrown if storage is external and too small</exception>
+		/// <exception cref="std::exception">thrown if malformed string</exception>
+		/// <param name="strings">range of anything convertible to std::string_view</param>
+		/// <param name="index">index of the element set from the first string</param>
+		template <typename TRange>
+		void SetFromStrings(const TRange& strings, size_t index = 0);
 
 		/// <summary>
 		/// sets this datum to point to an external buffer of data
@@ -1070,6 +1087,51 @@ namespace FieaGameEngine
 		template <typename T>
 		const T& Get(size_t index = 0) const;
 
+		/// <summary>
+		/// gets the element at the given index without checking the type or the index,
+		/// both are only asserted in debug builds
+		/// </summary>
+		/// <param name="index">index</param>
+		/// <returns>reference to the value</returns>
+		template <typename T>
+		T& GetUnchecked(size_t index = 0);
+
+		/// <summary>
+		/// gets the element at the given index without checking the type or the index,
+		/// both are only asserted in debug builds
+		/// </summary>
+		/// <param name="index">index</param>
+		/// <returns>reference to the value</returns>
+		template <typename T>
+		const T& GetUnchecked(size_t index = 0) const;
+
+		/// <summary>
+		/// gets all the elements as a contiguous typed view, checking the type once for the whole loop.
+		/// The view lasts until the datum grows, shrinks or changes storage
+		/// </summary>
+		/// <exception cref="std::exception">thrown if types differ</exception>
+		/// <returns>view over the elements, empty if the datum is</returns>
+		template <typename T>
+		Span<T> AsSpan();
+
+		/// <summary>
+		/// gets all the elements as a contiguous read only view, checking the type once for the whole loop.
+		/// The view lasts until the datum grows, shrinks or changes storage
+		/// </summary>
+		/// <exception cref="std::exception">thrown if types differ</exception>
+		/// <returns>view over the elements, empty if the datum is</returns>
+		template <typename T>
+		Span<const T> AsSpan() const;
+
+		/// <summary>
+		/// gets all the elements as a contiguous read only view, checking the type once for the whole loop.
+		/// The view lasts until the datum grows, shrinks or changes storage
+		/// </summary>
+		/// <exception cref="std::exception">thrown if types differ</exception>
+		/// <returns>view over the elements, empty if the datum is</returns>
+		template <typename T>
+		Span<const T> AsConstSpan() const;
+
 		/// <summary>
 		/// gets the first element in the datum
 		/// </summary>
@@ -1172,6 +1234,12 @@ namespace FieaGameEngine
 		/// <returns>true if storage is internal, false if external</returns>
 		bool OwnsStorage() const;
 
+		/// <summary>
+		/// whether or not the values of this datum are kept inside it rather than in a heap buffer
+		/// </summary>
+		/// <returns>true if storage is inline, false if on the heap or external</returns>
+		bool IsInline() const;
+
 		/// <summary>
 		/// gets a string representation of the element at the given index
 		/// </summary>
@@ -1197,15 +1265,30 @@ namespace FieaGameEngine
 		};
 
 		/// <summary>
-		/// storage of the datum
+		/// bytes of values the datum can hold without a heap buffer
+		/// </summary>
+		static constexpr size_t InlineBytes = 16;
+
+		/// <summary>
+		/// storage of the datum, points at mInline while the values fit there
 		/// </summary>
 		DatumStorage mStorage;
 
+		/// <summary>
+		/// inline buffer for small values, strings never use it since they cannot be moved bytewise
+		/// </summary>
+		alignas(DatumStorage) std::byte mInline[InlineBytes];
+
 		/// <summary>
 		/// type of the datum
 		/// </summary>
 		DatumType mType = DatumType::UNKNOWN;
 
+		/// <summary>
+		/// whether or not the datum is internal storage or external
+		/// </summary>
+		bool mOwnsStorage = true;
+
 		/// <summary>
 		/// size of the datum
 		/// </summary>
@@ -1216,11 +1299,6 @@ namespace FieaGameEngine
 		/// </summary>
 		size_t mCapacity = 0;
 
-		/// <summary>
-		/// whether or not the datum is internal storage or external
-		/// </summary>
-		bool mOwnsStorage = true;
-
 		/// <summary>
 		/// sets the storage to the given buffer according to the given type
 		/// </summary>
@@ -1229,6 +1307,19 @@ namespace FieaGameEngine
 		/// <param name="type">type of data</param>
 		void SetStorage(void* data, size_t size, DatumType type);
 
+		/// <summary>
+		/// whether or not the given number of values of the current type fit in the inline buffer
+		/// </summary>
+		/// <param name="capacity">number of values</param>
+		/// <returns>true if they fit, false otherwise</returns>
+		bool FitsInline(size_t capacity) const;
+
+		/// <summary>
+		/// takes the values of a datum being moved from, copying them over if they are inline
+		/// </summary>
+		/// <param name="other">datum being moved from, left empty</param>
+		void Steal(Datum& other);
+
 		/// <summary>
 		/// deep copies given datum into this datum
 		/// </summary>
@@ -1273,13 +1364,29 @@ namespace FieaGameEngine
 		/// <param name="type">intended type</param>
 		void PushBackPreCheck(DatumType type);
 
+		/// <summary>
+		/// integer parsed from the start of given string, like std::stoi
+		/// </summary>
+		/// <exception cref="std::exception">thrown if malformed string or out of range</exception>
+		/// <param name="string">string</param>
+		/// <returns>integer</returns>
+		static std::int32_t StringToInteger(std::string_view string);
+
+		/// <summary>
+		/// float parsed from the start of given string, like std::stof
+		/// </summary>
+		/// <exception cref="std::exception">thrown if malformed string or out of range</exception>
+		/// <param name="string">string</param>
+		/// <returns>float</returns>
+		static float StringToFloat(std::string_view string);
+
 		/// <summary>
 		/// vector parsed from given string
 		/// </summary>
 		/// <exception cref="std::exception">thrown if malformed string</exception>
 		/// <param name="string">string</param>
 		/// <returns>vector</returns>
-		glm::vec4 StringToVector(const std::string& string) const;
+		static glm::vec4 StringToVector(std::string_view string);
 
 		/// <summary>
 		/// matrix parsed from given string
@@ -1287,7 +1394,7 @@ namespace FieaGameEngine
 		/// <exception cref="std::exception">thrown if malformed string</exception>
 		/// <param name="string">string</param>
 		/// <returns>matrix</returns>
-		glm::mat4 StringToMatrix(const std::string& string) const;
+		static glm::mat4 StringToMatrix(std::string_view string);
 		
 		Datum(Scope& value);
 		Datum& operator=(Scope& value);
@@ -1321,17 +1428,32 @@ namespace FieaGameEngine
 		template <typename T>
 		void CreateDefault(size_t index);
 
+		/// <summary>
+		/// gets the datum type that holds values of the given C++ type
+		/// </summary>
+		/// <returns>datum type</returns>
+		template <typename T>
+		static constexpr DatumType TypeOf();
+
 		using ToStringFunc = std::string(Datum::*)(size_t) const;
 		static const ToStringFunc sToStringFuncs[sTypeCount];
 
 		template <typename T>
 		std::string ToString(size_t index) const;
 
-		using SetFromStringFunc = void(Datum::*)(const std::string&, size_t);
+		using SetFromStringFunc = void(Datum::*)(std::string_view, size_t);
 		static const SetFromStringFunc sSetFromStringFuncs[sTypeCount];
 
 		template <typename T>
-		void SetFromString(const std::string& string, size_t index);
+		void SetFromString(std::string_view string, size_t index);
+
+		/// <summary>
+		/// makes room for a batch of strings and gets the parser for the type
+		/// </summary>
+		/// <param name="index">index of the first element set</param>
+		/// <param name="count">number of elements set</param>
+		/// <returns>parser for the type</returns>
+		SetFromStringFunc PrepareSetFromStrings(size_t index, size_t count);
 	};
 }
 
@@ -1,4 +1,7 @@
 #include "Datum.h"
+#include <cassert>
+#include <functional>
+#include <iterator>
 #pragma warning(push)
 #pragma warning(disable: 4201)
 #include <glm/glm.hpp>
@@ -6,6 +9,55 @@
 
 namespace FieaGameEngine
 {
+	template <typename T>
+	constexpr Datum::DatumType Datum::TypeOf()
+	{
+		static_assert(false, "Unsupported type.");
+		return DatumType::UNKNOWN;
+	}
+
+	template <>
+	constexpr Datum::DatumType Datum::TypeOf<std::int32_t>()
+	{
+		return DatumType::INTEGER;
+	}
+
+	template <>
+	constexpr Datum::DatumType Datum::TypeOf<float>()
+	{
+		return DatumType::FLOAT;
+	}
+
+	template <>
+	constexpr Datum::DatumType Datum::TypeOf<glm::vec4>()
+	{
+		return DatumType::VECTOR;
+	}
+
+	template <>
+	constexpr Datum::DatumType Datum::TypeOf<glm::mat4x4>()
+	{
+		return DatumType::MATRIX;
+	}
+
+	template <>
+	constexpr Datum::DatumType Datum::TypeOf<std::string>()
+	{
+		return DatumType::STRING;
+	}
+
+	template <>
+	constexpr Datum::DatumType Datum::TypeOf<RTTI*>()
+	{
+		return DatumType::POINTER;
+	}
+
+	template <>
+	constexpr Datum::DatumType Datum::TypeOf<Scope*>()
+	{
+		return DatumType::TABLE;
+	}
+
 	template <typename T>
 	T& Datum::Get(size_t index)
 	{
@@ -81,6 +133,41 @@ namespace FieaGameEngine
 		return mStorage.Table[index];
 	}
 
+	template <typename T>
+	inline T& Datum::GetUnchecked(size_t index)
+	{
+		assert(mType == TypeOf<T>());
+		assert(index < mSize);
+
+		return static_cast<T*>(mStorage.Wildcard)[index];
+	}
+
+	template <typename T>
+	inline const T& Datum::GetUnchecked(size_t index) const
+	{
+		return const_cast<Datum*>(this)->GetUnchecked<T>(index);
+	}
+
+	template <typename T>
+	inline Span<T> Datum::AsSpan()
+	{
+		TypeGuard(TypeOf<T>());
+
+		return Span<T>(static_cast<T*>(mStorage.Wildcard), mSize);
+	}
+
+	template <typename T>
+	inline Span<const T> Datum::AsSpan() const
+	{
+		return const_cast<Datum*>(this)->AsSpan<T>();
+	}
+
+	template <typename T>
+	inline Span<const T> Datum::AsConstSpan() const
+	{
+		return AsSpan<T>();
+	}
+
 	template <typename T>
 	inline T& Datum::Front()
 	{
@@ -127,11 +214,23 @@ namespace FieaGameEngine
 	}
 
 	template <typename T>
-	void SetFromString(const std::string& string, size_t index)
+	inline void Datum::SetFromString(std::string_view, size_t)
 	{
 		static_assert(false, "Unsupported type.");
 	}
 
+	template <typename TRange>
+	inline void Datum::SetFromStrings(const TRange& strings, size_t index)
+	{
+		const size_t count = static_cast<size_t>(std::distance(std::begin(strings), std::end(strings)));
+		auto func = PrepareSetFromStrings(index, count);
+
+		for (const auto& string : strings)
+		{
+			std::invoke(func, this, std::string_view(string), index++);
+		}
+	}
+
 	template <typename T>
 	inline T& Datum::Iterator::Get() const
 	{
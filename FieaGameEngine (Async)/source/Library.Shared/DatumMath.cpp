@@ -0,0 +1,600 @@
+#include "pch.h"
+#include "DatumMath.h"
+#include <atomic>
+#include <cmath>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define FIEA_DATUM_MATH_X86
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#endif
+
+// MSVC takes any intrinsic anywhere, gcc and clang want the functions using them marked
+#if defined(FIEA_DATUM_MATH_X86) && (defined(__GNUC__) || defined(__clang__))
+#define FIEA_TARGET_SSE41 __attribute__((target("sse4.1")))
+#define FIEA_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define FIEA_TARGET_SSE41
+#define FIEA_TARGET_AVX2
+#endif
+
+namespace FieaGameEngine
+{
+	namespace
+	{
+		/// <summary>
+		/// One set of kernels, all of them work on plain float arrays. Values may be written over their
+		/// inputs: every element is read before its result is stored
+		/// </summary>
+		struct Kernels final
+		{
+			DatumMath::InstructionSet Set;
+			void(*Axpy)(float a, const float* x, float* y, size_t count);
+			void(*Scale)(float* values, size_t count, float scale);
+			void(*Clamp)(float* values, size_t count, float min, float max);
+			void(*Lerp)(const float* from, const float* to, float t, float* result, size_t count);
+			void(*Dot)(const float* left, const float* right, float* result, size_t vectorCount);
+			void(*Length)(const float* vectors, float* result, size_t vectorCount);
+			void(*Transform)(const float* matrix, const float* vectors, float* result, size_t vectorCount);
+		};
+
+		// Scalar
+
+		void AxpyScalar(float a, const float* x, float* y, size_t count)
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				y[i] += a * x[i];
+			}
+		}
+
+		void ScaleScalar(float* values, size_t count, float scale)
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				values[i] *= scale;
+			}
+		}
+
+		void ClampScalar(float* values, size_t count, float min, float max)
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				values[i] = std::min(std::max(values[i], min), max);
+			}
+		}
+
+		void LerpScalar(const float* from, const float* to, float t, float* result, size_t count)
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				result[i] = from[i] + (to[i] - from[i]) * t;
+			}
+		}
+
+		void DotScalar(const float* left, const float* right, float* result, size_t vectorCount)
+		{
+			for (size_t i = 0; i < vectorCount; ++i, left += 4, right += 4)
+			{
+				result[i] = (left[0] * right[0] + left[1] * right[1]) + (left[2] * right[2] + left[3] * right[3]);
+			}
+		}
+
+		void LengthScalar(const float* vectors, float* result, size_t vectorCount)
+		{
+			for (size_t i = 0; i < vectorCount; ++i, vectors += 4)
+			{
+				result[i] = std::sqrt((vectors[0] * vectors[0] + vectors[1] * vectors[1]) + (vectors[2] * vectors[2] + vectors[3] * vectors[3]));
+			}
+		}
+
+		void TransformScalar(const float* matrix, const float* vectors, float* result, size_t vectorCount)
+		{
+			for (size_t i = 0; i < vectorCount; ++i, vectors += 4, result += 4)
+			{
+				const float x = vectors[0], y = vectors[1], z = vectors[2], w = vectors[3];
+				for (size_t row = 0; row < 4; ++row)
+				{
+					// same order glm adds the columns in
+					result[row] = (matrix[row] * x + matrix[4 + row] * y) + (matrix[8 + row] * z + matrix[12 + row] * w);
+				}
+			}
+		}
+
+		const Kernels sScalarKernels = { DatumMath::InstructionSet::Scalar,
+			AxpyScalar, ScaleScalar, ClampScalar, LerpScalar, DotScalar, LengthScalar, TransformScalar };
+
+#if defined(FIEA_DATUM_MATH_X86)
+		// SSE4.1, four floats or one vector at a time
+
+		FIEA_TARGET_SSE41 void AxpySSE41(float a, const float* x, float* y, size_t count)
+		{
+			const __m128 scale = _mm_set1_ps(a);
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				_mm_storeu_ps(y + i, _mm_add_ps(_mm_loadu_ps(y + i), _mm_mul_ps(scale, _mm_loadu_ps(x + i))));
+			}
+
+			AxpyScalar(a, x + i, y + i, count - i);
+		}
+
+		FIEA_TARGET_SSE41 void ScaleSSE41(float* values, size_t count, float scale)
+		{
+			const __m128 factor = _mm_set1_ps(scale);
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				_mm_storeu_ps(values + i, _mm_mul_ps(_mm_loadu_ps(values + i), factor));
+			}
+
+			ScaleScalar(values + i, count - i, scale);
+		}
+
+		FIEA_TARGET_SSE41 void ClampSSE41(float* values, size_t count, float min, float max)
+		{
+			const __m128 low = _mm_set1_ps(min);
+			const __m128 high = _mm_set1_ps(max);
+			size_t i = 0;
+			// min and max hand back their second operand when either is NaN, the value goes last
+			// so a NaN comes through as it does in ClampScalar
+			for (; i + 4 <= count; i += 4)
+			{
+				_mm_storeu_ps(values + i, _mm_min_ps(high, _mm_max_ps(low, _mm_loadu_ps(values + i))));
+			}
+
+			ClampScalar(values + i, count - i, min, max);
+		}
+
+		FIEA_TARGET_SSE41 void LerpSSE41(const float* from, const float* to, float t, float* result, size_t count)
+		{
+			const __m128 factor = _mm_set1_ps(t);
+			size_t i = 0;
+			for (; i + 4 <= count; i += 4)
+			{
+				const __m128 start = _mm_loadu_ps(from + i);
+				_mm_storeu_ps(result + i, _mm_add_ps(start, _mm_mul_ps(_mm_sub_ps(_mm_loadu_ps(to + i), start), factor)));
+			}
+
+			LerpScalar(from + i, to + i, t, result + i, count - i);
+		}
+
+		/// <summary>
+		/// Sums the components of four vectors, one sum per lane
+		/// </summary>
+		FIEA_TARGET_SSE41 inline __m128 HorizontalSums(__m128 a, __m128 b, __m128 c, __m128 d)
+		{
+			return _mm_hadd_ps(_mm_hadd_ps(a, b), _mm_hadd_ps(c, d));
+		}
+
+		FIEA_TARGET_SSE41 void DotSSE41(const float* left, const float* right, float* result, size_t vectorCount)
+		{
+			size_t i = 0;
+			for (; i + 4 <= vectorCount; i += 4, left += 16, right += 16)
+			{
+				_mm_storeu_ps(result + i, HorizontalSums(
+					_mm_mul_ps(_mm_loadu_ps(left), _mm_loadu_ps(right)),
+					_mm_mul_ps(_mm_loadu_ps(left + 4), _mm_loadu_ps(right + 4)),
+					_mm_mul_ps(_mm_loadu_ps(left + 8), _mm_loadu_ps(right + 8)),
+					_mm_mul_ps(_mm_loadu_ps(left + 12), _mm_loadu_ps(right + 12))));
+			}
+
+			for (; i < vectorCount; ++i, left += 4, right += 4)
+			{
+				_mm_store_ss(result + i, _mm_dp_ps(_mm_loadu_ps(left), _mm_loadu_ps(right), 0xF1));
+			}
+		}
+
+		FIEA_TARGET_SSE41 void LengthSSE41(const float* vectors, float* result, size_t vectorCount)
+		{
+			size_t i = 0;
+			for (; i + 4 <= vectorCount; i += 4, vectors += 16)
+			{
+				const __m128 a = _mm_loadu_ps(vectors);
+				const __m128 b = _mm_loadu_ps(vectors + 4);
+				const __m128 c = _mm_loadu_ps(vectors + 8);
+				const __m128 d = _mm_loadu_ps(vectors + 12);
+				_mm_storeu_ps(result + i, _mm_sqrt_ps(HorizontalSums(_mm_mul_ps(a, a), _mm_mul_ps(b, b), _mm_mul_ps(c, c), _mm_mul_ps(d, d))));
+			}
+
+			for (; i < vectorCount; ++i, vectors += 4)
+			{
+				const __m128 vector = _mm_loadu_ps(vectors);
+				_mm_store_ss(result + i, _mm_sqrt_ss(_mm_dp_ps(vector, vector, 0xF1)));
+			}
+		}
+
+		FIEA_TARGET_SSE41 void TransformSSE41(const float* matrix, const float* vectors, float* result, size_t vectorCount)
+		{
+			const __m128 column0 = _mm_loadu_ps(matrix);
+			const __m128 column1 = _mm_loadu_ps(matrix + 4);
+			const __m128 column2 = _mm_loadu_ps(matrix + 8);
+			const __m128 column3 = _mm_loadu_ps(matrix + 12);
+
+			for (size_t i = 0; i < vectorCount; ++i, vectors += 4, result += 4)
+			{
+				const __m128 vector = _mm_loadu_ps(vectors);
+				const __m128 xy = _mm_add_ps(
+					_mm_mul_ps(column0, _mm_shuffle_ps(vector, vector, _MM_SHUFFLE(0, 0, 0, 0))),
+					_mm_mul_ps(column1, _mm_shuffle_ps(vector, vector, _MM_SHUFFLE(1, 1, 1, 1))));
+				const __m128 zw = _mm_add_ps(
+					_mm_mul_ps(column2, _mm_shuffle_ps(vector, vector, _MM_SHUFFLE(2, 2, 2, 2))),
+					_mm_mul_ps(column3, _mm_shuffle_ps(vector, vector, _MM_SHUFFLE(3, 3, 3, 3))));
+				_mm_storeu_ps(result, _mm_add_ps(xy, zw));
+			}
+		}
+
+		const Kernels sSSE41Kernels = { DatumMath::InstructionSet::SSE41,
+			AxpySSE41, ScaleSSE41, ClampSSE41, LerpSSE41, DotSSE41, LengthSSE41, TransformSSE41 };
+
+		// AVX2, eight floats or two vectors at a time
+
+		FIEA_TARGET_AVX2 void AxpyAVX2(float a, const float* x, float* y, size_t count)
+		{
+			const __m256 scale = _mm256_set1_ps(a);
+			size_t i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				_mm256_storeu_ps(y + i, _mm256_add_ps(_mm256_loadu_ps(y + i), _mm256_mul_ps(scale, _mm256_loadu_ps(x + i))));
+			}
+
+			AxpyScalar(a, x + i, y + i, count - i);
+		}
+
+		FIEA_TARGET_AVX2 void ScaleAVX2(float* values, size_t count, float scale)
+		{
+			const __m256 factor = _mm256_set1_ps(scale);
+			size_t i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				_mm256_storeu_ps(values + i, _mm256_mul_ps(_mm256_loadu_ps(values + i), factor));
+			}
+
+			ScaleScalar(values + i, count - i, scale);
+		}
+
+		FIEA_TARGET_AVX2 void ClampAVX2(float* values, size_t count, float min, float max)
+		{
+			const __m256 low = _mm256_set1_ps(min);
+			const __m256 high = _mm256_set1_ps(max);
+			size_t i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				_mm256_storeu_ps(values + i, _mm256_min_ps(high, _mm256_max_ps(low, _mm256_loadu_ps(values + i))));
+			}
+
+			ClampScalar(values + i, count - i, min, max);
+		}
+
+		FIEA_TARGET_AVX2 void LerpAVX2(const float* from, const float* to, float t, float* result, size_t count)
+		{
+			const __m256 factor = _mm256_set1_ps(t);
+			size_t i = 0;
+			for (; i + 8 <= count; i += 8)
+			{
+				const __m256 start = _mm256_loadu_ps(from + i);
+				_mm256_storeu_ps(result + i, _mm256_add_ps(start, _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(to + i), start), factor)));
+			}
+
+			LerpScalar(from + i, to + i, t, result + i, count - i);
+		}
+
+		/// <summary>
+		/// Sums the components of eight vectors, two per register, and stores the sums in order
+		/// </summary>
+		FIEA_TARGET_AVX2 inline __m256 HorizontalSums(__m256 a, __m256 b, __m256 c, __m256 d)
+		{
+			// the low half ends up with the sums of vectors 0 2 4 6, the high half with 1 3 5 7
+			const __m256 sums = _mm256_hadd_ps(_mm256_hadd_ps(a, b), _mm256_hadd_ps(c, d));
+			const __m128 even = _mm256_castps256_ps128(sums);
+			const __m128 odd = _mm256_extractf128_ps(sums, 1);
+
+			return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_unpacklo_ps(even, odd)), _mm_unpackhi_ps(even, odd), 1);
+		}
+
+		FIEA_TARGET_AVX2 void DotAVX2(const float* left, const float* right, float* result, size_t vectorCount)
+		{
+			size_t i = 0;
+			for (; i + 8 <= vectorCount; i += 8, left += 32, right += 32)
+			{
+				_mm256_storeu_ps(result + i, HorizontalSums(
+					_mm256_mul_ps(_mm256_loadu_ps(left), _mm256_loadu_ps(right)),
+					_mm256_mul_ps(_mm256_loadu_ps(left + 8), _mm256_loadu_ps(right + 8)),
+					_mm256_mul_ps(_mm256_loadu_ps(left + 16), _mm256_loadu_ps(right + 16)),
+					_mm256_mul_ps(_mm256_loadu_ps(left + 24), _mm256_loadu_ps(right + 24))));
+			}
+
+			_mm256_zeroupper();
+			DotSSE41(left, right, result + i, vectorCount - i);
+		}
+
+		FIEA_TARGET_AVX2 void LengthAVX2(const float* vectors, float* result, size_t vectorCount)
+		{
+			size_t i = 0;
+			for (; i + 8 <= vectorCount; i += 8, vectors += 32)
+			{
+				const __m256 a = _mm256_loadu_ps(vectors);
+				const __m256 b = _mm256_loadu_ps(vectors + 8);
+				const __m256 c = _mm256_loadu_ps(vectors + 16);
+				const __m256 d = _mm256_loadu_ps(vectors + 24);
+				_mm256_storeu_ps(result + i, _mm256_sqrt_ps(HorizontalSums(_mm256_mul_ps(a, a), _mm256_mul_ps(b, b), _mm256_mul_ps(c, c), _mm256_mul_ps(d, d))));
+			}
+
+			_mm256_zeroupper();
+			LengthSSE41(vectors, result + i, vectorCount - i);
+		}
+
+		FIEA_TARGET_AVX2 void TransformAVX2(const float* matrix, const float* vectors, float* result, size_t vectorCount)
+		{
+			// every column in both halves, each half transforms a vector of its own
+			const __m256 column0 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(matrix));
+			const __m256 column1 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(matrix + 4));
+			const __m256 column2 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(matrix + 8));
+			const __m256 column3 = _mm256_broadcast_ps(reinterpret_cast<const __m128*>(matrix + 12));
+
+			size_t i = 0;
+			for (; i + 2 <= vectorCount; i += 2, vectors += 8, result += 8)
+			{
+				const __m256 pair = _mm256_loadu_ps(vectors);
+				const __m256 xy = _mm256_add_ps(
+					_mm256_mul_ps(column0, _mm256_permute_ps(pair, _MM_SHUFFLE(0, 0, 0, 0))),
+					_mm256_mul_ps(column1, _mm256_permute_ps(pair, _MM_SHUFFLE(1, 1, 1, 1))));
+				const __m256 zw = _mm256_add_ps(
+					_mm256_mul_ps(column2, _mm256_permute_ps(pair, _MM_SHUFFLE(2, 2, 2, 2))),
+					_mm256_mul_ps(column3, _mm256_permute_ps(pair, _MM_SHUFFLE(3, 3, 3, 3))));
+				_mm256_storeu_ps(result, _mm256_add_ps(xy, zw));
+			}
+
+			_mm256_zeroupper();
+			TransformSSE41(matrix, vectors, result, vectorCount - i);
+		}
+
+		const Kernels sAVX2Kernels = { DatumMath::InstructionSet::AVX2,
+			AxpyAVX2, ScaleAVX2, ClampAVX2, LerpAVX2, DotAVX2, LengthAVX2, TransformAVX2 };
+#endif
+
+		/// <summary>
+		/// Asks the CPU, and for AVX the operating system, which instruction sets can run
+		/// </summary>
+		DatumMath::InstructionSet DetectInstructionSet()
+		{
+#if defined(FIEA_DATUM_MATH_X86) && defined(_MSC_VER)
+			int info[4];
+			__cpuid(info, 0);
+			const int maxLeaf = info[0];
+
+			__cpuid(info, 1);
+			const bool sse41 = (info[2] & (1 << 19)) != 0;
+			const bool osxsave = (info[2] & (1 << 27)) != 0;
+			const bool avx = (info[2] & (1 << 28)) != 0;
+
+			// the operating system saves the ymm registers on context switches
+			const bool avxEnabled = osxsave && avx && (_xgetbv(0) & 6) == 6;
+
+			bool avx2 = false;
+			if (maxLeaf >= 7)
+			{
+				__cpuidex(info, 7, 0);
+				avx2 = (info[1] & (1 << 5)) != 0;
+			}
+
+			if (avxEnabled && avx2)
+			{
+				return DatumMath::InstructionSet::AVX2;
+			}
+
+			return sse41 ? DatumMath::InstructionSet::SSE41 : DatumMath::InstructionSet::Scalar;
+#elif defined(FIEA_DATUM_MATH_X86)
+			__builtin_cpu_init();
+			if (__builtin_cpu_supports("avx2"))
+			{
+				return DatumMath::InstructionSet::AVX2;
+			}
+
+			return __builtin_cpu_supports("sse4.1") ? DatumMath::InstructionSet::SSE41 : DatumMath::InstructionSet::Scalar;
+#else
+			return DatumMath::InstructionSet::Scalar;
+#endif
+		}
+
+		const Kernels& KernelsFor(DatumMath::InstructionSet set)
+		{
+			switch (set)
+			{
+#if defined(FIEA_DATUM_MATH_X86)
+			case DatumMath::InstructionSet::AVX2:
+				return sAVX2Kernels;
+			case DatumMath::InstructionSet::SSE41:
+				return sSSE41Kernels;
+#endif
+			default:
+				return sScalarKernels;
+			}
+		}
+
+		/// <summary>
+		/// Kernels in use, the best supported ones until told otherwise
+		/// </summary>
+		std::atomic<const Kernels*>& CurrentKernels()
+		{
+			static std::atomic<const Kernels*> kernels(&KernelsFor(DatumMath::GetSupportedInstructionSet()));
+			return kernels;
+		}
+
+		const Kernels& Current()
+		{
+			return *CurrentKernels().load(std::memory_order_relaxed);
+		}
+
+		/// <summary>
+		/// Gets the number of floats each value of a type is made of
+		/// </summary>
+		size_t FloatsPerValue(Datum::DatumType type)
+		{
+			switch (type)
+			{
+			case Datum::DatumType::FLOAT:
+				return 1;
+			case Datum::DatumType::VECTOR:
+				return 4;
+			case Datum::DatumType::MATRIX:
+				return 16;
+			default:
+				throw std::exception("Type error.");
+			}
+		}
+
+		float* Floats(Datum& datum)
+		{
+			switch (datum.Type())
+			{
+			case Datum::DatumType::FLOAT:
+				return datum.AsSpan<float>().data();
+			case Datum::DatumType::VECTOR:
+				return reinterpret_cast<float*>(datum.AsSpan<glm::vec4>().data());
+			case Datum::DatumType::MATRIX:
+				return reinterpret_cast<float*>(datum.AsSpan<glm::mat4>().data());
+			default:
+				throw std::exception("Type error.");
+			}
+		}
+
+		const float* Floats(const Datum& datum)
+		{
+			return Floats(const_cast<Datum&>(datum));
+		}
+
+		void ExpectType(const Datum& datum, Datum::DatumType type)
+		{
+			if (datum.Type() != type)
+			{
+				throw std::exception("Type error.");
+			}
+		}
+
+		void ExpectSameShape(const Datum& left, const Datum& right)
+		{
+			if (left.Type() != right.Type())
+			{
+				throw std::exception("Type error.");
+			}
+
+			if (left.Size() != right.Size())
+			{
+				throw std::exception("Size mismatch.");
+			}
+		}
+
+		/// <summary>
+		/// Gives a result datum its type if it has none and the size it has to hold
+		/// </summary>
+		/// <exception cref="std::exception">Thrown if it has another type, or it is external and of another size</exception>
+		void PrepareResult(Datum& result, Datum::DatumType type, size_t size)
+		{
+			if (result.Type() == Datum::DatumType::UNKNOWN)
+			{
+				result.SetType(type);
+			}
+
+			ExpectType(result, type);
+
+			if (result.Size() != size)
+			{
+				if (!result.OwnsStorage())
+				{
+					throw std::exception("Size mismatch.");
+				}
+
+				result.Resize(size);
+			}
+		}
+	}
+
+	DatumMath::InstructionSet DatumMath::GetSupportedInstructionSet()
+	{
+		static const InstructionSet supported = DetectInstructionSet();
+		return supported;
+	}
+
+	DatumMath::InstructionSet DatumMath::GetInstructionSet()
+	{
+		return Current().Set;
+	}
+
+	void DatumMath::SetInstructionSet(InstructionSet set)
+	{
+		if (set > GetSupportedInstructionSet())
+		{
+			throw std::exception("Instruction set not supported.");
+		}
+
+		CurrentKernels().store(&KernelsFor(set), std::memory_order_relaxed);
+	}
+
+	void DatumMath::Axpy(float a, const Datum& x, Datum& y)
+	{
+		ExpectSameShape(x, y);
+		const size_t count = x.Size() * FloatsPerValue(x.Type());
+
+		Current().Axpy(a, Floats(x), Floats(y), count);
+	}
+
+	void DatumMath::Scale(Datum& values, float scale)
+	{
+		const size_t count = values.Size() * FloatsPerValue(values.Type());
+
+		Current().Scale(Floats(values), count, scale);
+	}
+
+	void DatumMath::Clamp(Datum& values, float min, float max)
+	{
+		const size_t count = values.Size() * FloatsPerValue(values.Type());
+
+		Current().Clamp(Floats(values), count, min, max);
+	}
+
+	void DatumMath::Lerp(const Datum& from, const Datum& to, float t, Datum& result)
+	{
+		ExpectSameShape(from, to);
+		const size_t count = from.Size() * FloatsPerValue(from.Type());
+		PrepareResult(result, from.Type(), from.Size());
+
+		Current().Lerp(Floats(from), Floats(to), t, Floats(result), count);
+	}
+
+	void DatumMath::Dot(const Datum& left, const Datum& right, Datum& result)
+	{
+		ExpectType(left, Datum::DatumType::VECTOR);
+		ExpectSameShape(left, right);
+		PrepareResult(result, Datum::DatumType::FLOAT, left.Size());
+
+		Current().Dot(Floats(left), Floats(right), Floats(result), left.Size());
+	}
+
+	void DatumMath::Length(const Datum& vectors, Datum& result)
+	{
+		ExpectType(vectors, Datum::DatumType::VECTOR);
+		PrepareResult(result, Datum::DatumType::FLOAT, vectors.Size());
+
+		Current().Length(Floats(vectors), Floats(result), vectors.Size());
+	}
+
+	void DatumMath::Transform(const glm::mat4& matrix, const Datum& vectors, Datum& result)
+	{
+		ExpectType(vectors, Datum::DatumType::VECTOR);
+		PrepareResult(result, Datum::DatumType::VECTOR, vectors.Size());
+
+		Current().Transform(&matrix[0][0], Floats(vectors), Floats(result), vectors.Size());
+	}
+
+	void DatumMath::Multiply(const glm::mat4& matrix, const Datum& matrices, Datum& result)
+	{
+		ExpectType(matrices, Datum::DatumType::MATRIX);
+		PrepareResult(result, Datum::DatumType::MATRIX, matrices.Size());
+
+		// each column of a product is the left matrix times that column
+		Current().Transform(&matrix[0][0], Floats(matrices), Floats(result), matrices.Size() * 4);
+	}
+}
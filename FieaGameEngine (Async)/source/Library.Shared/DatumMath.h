@@ -0,0 +1,122 @@
+#pragma once
+
+/// \file DatumMath.h
+/// \brief Definition of DatumMath class
+
+#include <glm/fwd.hpp>
+#include "Datum.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Math over whole FLOAT, VECTOR and MATRIX datums, one call per array instead of one Get per element.
+	/// The kernels come in scalar, SSE4.1 and AVX2 flavors, the best one the CPU supports is picked the
+	/// first time any of them runs. Results may be written back into one of the inputs, datums that own their
+	/// storage are resized to fit the result, external ones must already have the right size
+	/// </summary>
+	class DatumMath final
+	{
+	public:
+		/// <summary>
+		/// Instruction sets the kernels are written for, from the slowest to the fastest
+		/// </summary>
+		enum class InstructionSet
+		{
+			Scalar,
+			SSE41,
+			AVX2
+		};
+
+		DatumMath() = delete;
+
+		/// <summary>
+		/// Gets the fastest instruction set this CPU and operating system can run
+		/// </summary>
+		/// <returns>Instruction set</returns>
+		static InstructionSet GetSupportedInstructionSet();
+
+		/// <summary>
+		/// Gets the instruction set the kernels currently run with
+		/// </summary>
+		/// <returns>Instruction set</returns>
+		static InstructionSet GetInstructionSet();
+
+		/// <summary>
+		/// Makes the kernels run with the given instruction set, to compare them or to rule one out
+		/// </summary>
+		/// <exception cref="std::exception">Thrown if the CPU does not support it</exception>
+		/// <param name="set">Instruction set</param>
+		static void SetInstructionSet(InstructionSet set);
+
+		/// <summary>
+		/// Adds a scaled array to another one, y += a * x
+		/// </summary>
+		/// <exception cref="std::exception">Thrown if the types or the sizes differ, or the type is not FLOAT, VECTOR or MATRIX</exception>
+		/// <param name="a">Scale</param>
+		/// <param name="x">Array added</param>
+		/// <param name="y">Array added to</param>
+		static void Axpy(float a, const Datum& x, Datum& y);
+
+		/// <summary>
+		/// Scales every component of an array
+		/// </summary>
+		/// <exception cref="std::exception">Thrown if the type is not FLOAT, VECTOR or MATRIX</exception>
+		/// <param name="values">Array</param>
+		/// <param name="scale">Scale</param>
+		static void Scale(Datum& values, float scale);
+
+		/// <summary>
+		/// Clamps every component of an array to a range, NaN components stay NaN
+		/// </summary>
+		/// <exception cref="std::exception">Thrown if the type is not FLOAT, VECTOR or MATRIX</exception>
+		/// <param name="values">Array</param>
+		/// <param name="min">Lowest value</param>
+		/// <param name="max">Highest value</param>
+		static void Clamp(Datum& values, float min, float max);
+
+		/// <summary>
+		/// Interpolates linearly between two arrays, result = from + (to - from) * t
+		/// </summary>
+		/// <exception cref="std::exception">Thrown if the types or the sizes differ, or the type is not FLOAT, VECTOR or MATRIX</exception>
+		/// <param name="from">Values at t = 0</param>
+		/// <param name="to">Values at t = 1</param>
+		/// <param name="t">Interpolation factor</param>
+		/// <param name="result">Interpolated values, of the same type</param>
+		static void Lerp(const Datum& from, const Datum& to, float t, Datum& result);
+
+		/// <summary>
+		/// Computes the dot product of each pair of vectors
+		/// </summary>
+		/// <exception cref="std::exception">Thrown if the sizes differ or the inputs are not VECTOR</exception>
+		/// <param name="left">Vectors</param>
+		/// <param name="right">Vectors</param>
+		/// <param name="result">FLOAT datum with one product per pair</param>
+		static void Dot(const Datum& left, const Datum& right, Datum& result);
+
+		/// <summary>
+		/// Computes the length of each vector
+		/// </summary>
+		/// <exception cref="std::exception">Thrown if the input is not VECTOR</exception>
+		/// <param name="vectors">Vectors</param>
+		/// <param name="result">FLOAT datum with one length per vector</param>
+		static void Length(const Datum& vectors, Datum& result);
+
+		/// <summary>
+		/// Transforms each vector by a matrix, result = matrix * vector
+		/// </summary>
+		/// <exception cref="std::exception">Thrown if the input is not VECTOR</exception>
+		/// <param name="matrix">Transform</param>
+		/// <param name="vectors">Vectors</param>
+		/// <param name="result">VECTOR datum with the transformed vectors</param>
+		static void Transform(const glm::mat4& matrix, const Datum& vectors, Datum& result);
+
+		/// <summary>
+		/// Multiplies a matrix by each matrix of an array, result = matrix * matrices
+		/// </summary>
+		/// <exception cref="std::exception">Thrown if the input is not MATRIX</exception>
+		/// <param name="matrix">Left hand matrix</param>
+		/// <param name="matrices">Right hand matrices</param>
+		/// <param name="result">MATRIX datum with the products</param>
+		static void Multiply(const glm::mat4& matrix, const Datum& matrices, Datum& result);
+	};
+}
@@ -2,6 +2,7 @@
 
 #include "RTTI.h"
 #include <string>
+#include <string_view>
 
 namespace FieaGameEngine
 {
@@ -28,6 +29,21 @@ namespace FieaGameEngine
 		bool operator()(const char* left, const char* right) const;
 	};
 
+	/// <summary>
+	/// Transparent, compares std::string_view and C strings against std::string keys
+	/// so maps keyed by strings can be searched without building one
+	/// </summary>
+	template <>
+	class DefaultComparator<std::string> final
+	{
+	public:
+		using is_transparent = void;
+
+		bool operator()(const std::string& left, const std::string& right) const;
+		bool operator()(std::string_view left, const std::string& right) const;
+		bool operator()(const char* left, const std::string& right) const;
+	};
+
 	template <>
 	class DefaultComparator<IJsonParseHelper*> final
 	{
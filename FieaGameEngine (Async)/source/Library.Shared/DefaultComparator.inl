@@ -18,6 +18,21 @@ namespace FieaGameEngine
 		return DefaultComparator<char*>()(left, right);
 	}
 
+	inline bool DefaultComparator<std::string>::operator()(const std::string& left, const std::string& right) const
+	{
+		return left == right;
+	}
+
+	inline bool DefaultComparator<std::string>::operator()(std::string_view left, const std::string& right) const
+	{
+		return left == right;
+	}
+
+	inline bool DefaultComparator<std::string>::operator()(const char* left, const std::string& right) const
+	{
+		return right == left;
+	}
+
 	inline bool DefaultComparator<IJsonParseHelper*>::operator()(const RTTI* left, const RTTI* right) const
 	{
 		if (left == nullptr)
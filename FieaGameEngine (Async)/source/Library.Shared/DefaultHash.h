@@ -2,14 +2,40 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
 
 namespace FieaGameEngine
 {
+	/// <summary>
+	/// Scrambles a 64 bit value so every input bit affects every output bit
+	/// </summary>
+	/// <param name="value">Value to mix</param>
+	/// <returns>Mixed value</returns>
+	std::uint64_t MixHash(std::uint64_t value);
+
+	/// <summary>
+	/// Hashes a range of bytes eight at a time
+	/// </summary>
+	/// <param name="data">First byte of the range</param>
+	/// <param name="length">Number of bytes</param>
+	/// <returns>Well mixed 64 bit hash of the bytes</returns>
+	std::uint64_t HashBytes(const void* data, size_t length);
+
+	/// <summary>
+	/// Hashes integral, enum and pointer keys with MixHash, any other key by its bytes.
+	/// Every default hash declares is_avalanching: its low bits are as good as its high bits,
+	/// so containers may pick buckets by masking instead of modulo
+	/// </summary>
 	template <typename TKey>
 	class DefaultHash final
 	{
 	public:
+		using is_avalanching = void;
+
 		size_t operator()(const TKey& key) const;
 	};
 
@@ -17,6 +43,8 @@ namespace FieaGameEngine
 	class DefaultHash<char*> final
 	{
 	public:
+		using is_avalanching = void;
+
 		size_t operator()(const char* key) const;
 	};
 
@@ -24,35 +52,80 @@ namespace FieaGameEngine
 	class DefaultHash<const char*> final
 	{
 	public:
+		using is_avalanching = void;
+
 		size_t operator()(const char* key) const;
 	};
 
+	template <>
+	class DefaultHash<std::string_view> final
+	{
+	public:
+		using is_avalanching = void;
+
+		size_t operator()(std::string_view key) const;
+	};
+
+	/// <summary>
+	/// Transparent, hashes std::string_view and C strings the same way as
+	/// std::string so maps keyed by strings can be searched without building one
+	/// </summary>
 	template <>
 	class DefaultHash<std::string> final
 	{
 	public:
+		using is_transparent = void;
+		using is_avalanching = void;
+
 		size_t operator()(const std::string& key) const;
+		size_t operator()(std::string_view key) const;
+		size_t operator()(const char* key) const;
 	};
 
+	/// <summary>
+	/// Transparent, hashes std::string_view and C strings the same way as
+	/// std::string so maps keyed by strings can be searched without building one
+	/// </summary>
 	template <>
 	class DefaultHash<const std::string> final
 	{
 	public:
+		using is_transparent = void;
+		using is_avalanching = void;
+
 		size_t operator()(const std::string& key) const;
+		size_t operator()(std::string_view key) const;
+		size_t operator()(const char* key) const;
 	};
 
-	template <>
-	class DefaultHash<int> final
+	/// <summary>
+	/// Tells if a hash functor declares is_avalanching, that is, if all of its bits are well mixed
+	/// </summary>
+	template <typename THashFunctor, typename = void>
+	struct IsAvalanchingHash : std::false_type
 	{
-	public:
-		size_t operator()(const int& key) const;
 	};
 
-	template <>
-	class DefaultHash<const int> final
+	template <typename THashFunctor>
+	struct IsAvalanchingHash<THashFunctor, std::void_t<typename THashFunctor::is_avalanching>> : std::true_type
+	{
+	};
+
+	/// <summary>
+	/// Tells if a map with the given hash functor and key comparator can look up a TLookup
+	/// without converting it to the key type: both have to declare is_transparent
+	/// and the hash functor has to accept a TLookup
+	/// </summary>
+	template <typename THashFunctor, typename TKeyComparator, typename TLookup, typename = void>
+	struct IsTransparentKey : std::false_type
+	{
+	};
+
+	template <typename THashFunctor, typename TKeyComparator, typename TLookup>
+	struct IsTransparentKey<THashFunctor, TKeyComparator, TLookup,
+		std::void_t<typename THashFunctor::is_transparent, typename TKeyComparator::is_transparent,
+		decltype(std::declval<const THashFunctor&>()(std::declval<const TLookup&>()))>> : std::true_type
 	{
-	public:
-		size_t operator()(const int& key) const;
 	};
 }
 
@@ -2,65 +2,108 @@
 
 namespace FieaGameEngine
 {
-	template <typename TKey>
-	size_t DefaultHash<TKey>::operator()(const TKey& key) const
+	inline std::uint64_t MixHash(std::uint64_t value)
+	{
+		// splitmix64 finalizer
+		value ^= value >> 30;
+		value *= 0xBF58476D1CE4E5B9ULL;
+		value ^= value >> 27;
+		value *= 0x94D049BB133111EBULL;
+		value ^= value >> 31;
+
+		return value;
+	}
+
+	inline std::uint64_t HashBytes(const void* data, size_t length)
 	{
 		/*
-		* Hash algorithm taken from: http://www.partow.net
-		* Author: Arash Partow
+		* xxHash64 style round per word, see https://github.com/Cyan4973/xxHash
 		*/
 
-		std::uint32_t hash = 0xAAAAAAAA;
-		std::uint32_t i = 0;
-		size_t length = sizeof(TKey);
-		const std::uint8_t* bytes = reinterpret_cast<const std::uint8_t*>(&key);
+		const std::uint64_t prime1 = 0x9E3779B185EBCA87ULL;
+		const std::uint64_t prime2 = 0xC2B2AE3D27D4EB4FULL;
 
-		for (; i < length; ++bytes, ++i)
+		const std::uint8_t* bytes = static_cast<const std::uint8_t*>(data);
+		std::uint64_t hash = 0x27D4EB2F165667C5ULL ^ (static_cast<std::uint64_t>(length) * prime1);
+
+		for (; length >= sizeof(std::uint64_t); bytes += sizeof(std::uint64_t), length -= sizeof(std::uint64_t))
 		{
-			hash ^= ((i & 1) == 0) ? ((hash << 7) ^ (*bytes) * (hash >> 3)) :
-				(~((hash << 11) + ((*bytes) ^ (hash >> 5))));
+			std::uint64_t word;
+			std::memcpy(&word, bytes, sizeof(std::uint64_t));
+			hash ^= word * prime2;
+			hash = ((hash << 31) | (hash >> 33)) * prime1;
 		}
 
-		return static_cast<size_t>(hash);
+		if (length > 0)
+		{
+			std::uint64_t word = 0;
+			std::memcpy(&word, bytes, length);
+			hash ^= word * prime2;
+			hash = ((hash << 31) | (hash >> 33)) * prime1;
+		}
+
+		return MixHash(hash);
 	}
 
-	inline size_t DefaultHash<char*>::operator()(const char* key) const
+	template <typename TKey>
+	size_t DefaultHash<TKey>::operator()(const TKey& key) const
 	{
-		std::uint32_t hash = 5381;
-		std::uint32_t i = 0;
-		size_t length = std::strlen(key);
-
-		for (; i < length; ++key, ++i)
+		if constexpr (std::is_integral_v<TKey> || std::is_enum_v<TKey>)
+		{
+			return static_cast<size_t>(MixHash(static_cast<std::uint64_t>(key)));
+		}
+		else if constexpr (std::is_pointer_v<TKey>)
+		{
+			return static_cast<size_t>(MixHash(reinterpret_cast<std::uintptr_t>(key)));
+		}
+		else
 		{
-			hash = ((hash << 5) + hash) + (*key);
+			return static_cast<size_t>(HashBytes(&key, sizeof(TKey)));
 		}
+	}
 
-		return static_cast<size_t>(hash);
+	inline size_t DefaultHash<char*>::operator()(const char* key) const
+	{
+		return DefaultHash<std::string_view>()(key);
 	}
 
 	inline size_t DefaultHash<const char*>::operator()(const char* key) const
 	{
-		return DefaultHash<char*>()(key);
+		return DefaultHash<std::string_view>()(key);
+	}
+
+	inline size_t DefaultHash<std::string_view>::operator()(std::string_view key) const
+	{
+		return static_cast<size_t>(HashBytes(key.data(), key.size()));
 	}
 
 	inline size_t DefaultHash<std::string>::operator()(const std::string& key) const
 	{
-		return DefaultHash<char*>()(key.c_str());
+		return DefaultHash<std::string_view>()(key);
+	}
+
+	inline size_t DefaultHash<std::string>::operator()(std::string_view key) const
+	{
+		return DefaultHash<std::string_view>()(key);
+	}
+
+	inline size_t DefaultHash<std::string>::operator()(const char* key) const
+	{
+		return DefaultHash<std::string_view>()(key);
 	}
 
 	inline size_t DefaultHash<const std::string>::operator()(const std::string& key) const
 	{
-		return DefaultHash<char*>()(key.c_str());
+		return DefaultHash<std::string_view>()(key);
 	}
 
-	inline size_t DefaultHash<int>::operator()(const int& key) const
+	inline size_t DefaultHash<const std::string>::operator()(std::string_view key) const
 	{
-		size_t hash = key;
-		return hash;
+		return DefaultHash<std::string_view>()(key);
 	}
 
-	inline size_t DefaultHash<const int>::operator()(const int& key) const
+	inline size_t DefaultHash<const std::string>::operator()(const char* key) const
 	{
-		return DefaultHash<int>()(key);
+		return DefaultHash<std::string_view>()(key);
 	}
 }
@@ -12,9 +12,9 @@ namespace FieaGameEngine
 
 	const std::size_t Entity::ActionsIndex = 2;
 
-	Vector<Signature> Entity::Signatures()
+	SignatureListType Entity::Signatures()
 	{
-		return Vector<Signature>(
+		return SignatureListType(
 			{
 				{ "Name", Datum::DatumType::STRING, 1, offsetof(Entity, mName) },
 				{ ActionsKey, Datum::DatumType::TABLE, 0, 0 }
@@ -123,6 +123,6 @@ namespace FieaGameEngine
 
 	Entity::Entity(RTTI::IdType type, const std::string& name) : Attributed(type), mName(name)
 	{
-		assert(mList[ActionsIndex]->first == ActionsKey);
+		assert(mMap.EntryAt(ActionsIndex).first == ActionsKey);
 	}
 }
\ No newline at end of file
@@ -31,7 +31,7 @@ namespace FieaGameEngine
 		/// <summary>
 		/// prescribed attributes for this class
 		/// </summary>
-		static Vector<Signature> Signatures();
+		static SignatureListType Signatures();
 
 	public:
 		/// <summary>
@@ -7,7 +7,7 @@ namespace FieaGameEngine
 
 	const std::string EventMessageAttributed::SubtypeKey = "Subtype";
 
-	Vector<Signature> EventMessageAttributed::Signatures()
+	SignatureListType EventMessageAttributed::Signatures()
 	{
 		return {
 			{ SubtypeKey, Datum::DatumType::STRING, 1, offsetof(EventMessageAttributed, mSubtype) }
@@ -22,7 +22,7 @@ namespace FieaGameEngine
 		/// <summary>
 		/// signatures
 		/// </summary>
-		static Vector<Signature> Signatures();
+		static SignatureListType Signatures();
 
 	public:
 		/// <summary>
@@ -1,7 +1,7 @@
 #pragma once
 
 #include "RTTI.h"
-#include "vector.h"
+#include "SmallVector.h"
 #include <mutex>
 #include <set>
 #include <future>
@@ -77,6 +77,6 @@ namespace FieaGameEngine
 		/// <summary>
 		/// list of jobs of notifies
 		/// </summary>
-		Vector<std::future<void>> mJobs;
+		SmallVector<std::future<void>, 4> mJobs;
 	};
 }
@@ -52,11 +52,13 @@ namespace FieaGameEngine
 			std::lock_guard<std::mutex> lock(mPendingQueueMutex);
 
 			// move all expired events to the back of the list
-			auto expiredBegin = std::partition(mPendingQueue.begin(), mPendingQueue.end(),
+			const auto pending = mPendingQueue.AsSpan();
+			const auto expired = std::partition(pending.begin(), pending.end(),
 				[&gameTime](const QueueEntry& queued) { return !queued.IsExpired(gameTime.CurrentTime()); });
+			const auto expiredBegin = mPendingQueue.begin() + (expired - pending.begin());
 
 			// move all expired events from the pending queue to the expired queue
-			std::move(expiredBegin, mPendingQueue.end(), std::back_inserter(mExpiredQueue));
+			mExpiredQueue.Append(std::make_move_iterator(expiredBegin), std::make_move_iterator(mPendingQueue.end()));
 			mPendingQueue.Remove(expiredBegin, mPendingQueue.end());
 		}
 
@@ -1,7 +1,9 @@
 #pragma once
 
-#include "HashMap.h"
+#include "FlatHashMap.h"
+#include "FrozenHashMap.h"
 #include <string>
+#include <string_view>
 #include <gsl/gsl>
 #include <exception>
 
@@ -24,18 +26,30 @@ namespace FieaGameEngine
 		/// </summary>
 		/// <param name="name">class name</param>
 		/// <returns>the address of the factory if found, nullptr otherwise</returns>
-		static const Factory<T>* Find(const std::string& name);
+		static const Factory<T>* Find(std::string_view name);
 
 		/// <summary>
 		/// creates a new object of the given type using the corresponding factory if found
 		/// </summary>
 		/// <param name="name">class name</param>
 		/// <returns>new object of the given type</returns>
-		static gsl::owner<T*> Create(const std::string& name);
+		static gsl::owner<T*> Create(std::string_view name);
 
 		static std::size_t Size();
 		static bool IsEmpty();
 
+		/// <summary>
+		/// Builds a perfect hash of the registered factories once registration is done, so every
+		/// lookup is a single probe. Adding or removing a factory afterwards drops it again
+		/// </summary>
+		static void Freeze();
+
+		/// <summary>
+		/// Tells if lookups go through the perfect hash built by Freeze
+		/// </summary>
+		/// <returns>True if frozen and not empty, false otherwise</returns>
+		static bool IsFrozen();
+
 		/// <summary>
 		/// creates a new object of this factory's type
 		/// </summary>
@@ -63,12 +77,18 @@ namespace FieaGameEngine
 		static void Remove(const Factory& factory);
 
 	private:
-		using FactoryMap = HashMap<std::string, const Factory*>;
+		using FactoryMap = FlatHashMap<std::string, const Factory*>;
+		using FrozenFactoryMap = FrozenHashMap<std::string, const Factory*>;
 
 		/// <summary>
 		/// list of factories of this group
 		/// </summary>
 		static FactoryMap sFactories;
+
+		/// <summary>
+		/// the same factories as a perfect hash, empty unless frozen
+		/// </summary>
+		static FrozenFactoryMap sFrozenFactories;
 	};
 
 	/// <summary>
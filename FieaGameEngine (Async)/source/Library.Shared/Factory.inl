@@ -6,8 +6,17 @@ namespace FieaGameEngine
 	typename Factory<T>::FactoryMap Factory<T>::sFactories(16);
 
 	template <typename T>
-	const Factory<T>* Factory<T>::Find(const std::string& name)
+	typename Factory<T>::FrozenFactoryMap Factory<T>::sFrozenFactories;
+
+	template <typename T>
+	const Factory<T>* Factory<T>::Find(std::string_view name)
 	{
+		if (IsFrozen())
+		{
+			typename FrozenFactoryMap::ConstIterator frozen;
+			return sFrozenFactories.ContainsKey(name, frozen) ? (*frozen).second : nullptr;
+		}
+
 		typename FactoryMap::Iterator it;
 		if (sFactories.ContainsKey(name, it))
 		{
@@ -20,17 +29,11 @@ namespace FieaGameEngine
 	}
 
 	template <typename T>
-	gsl::owner<T*> Factory<T>::Create(const std::string& name)
+	gsl::owner<T*> Factory<T>::Create(std::string_view name)
 	{
-		typename FactoryMap::Iterator it;
-		if (sFactories.ContainsKey(name, it))
-		{
-			auto factory = (*it).second;
-			assert(factory != nullptr);
-			return factory->Create();
-		}
+		auto factory = Find(name);
 
-		return nullptr;
+		return factory != nullptr ? factory->Create() : nullptr;
 	}
 
 	template <typename T>
@@ -45,6 +48,18 @@ namespace FieaGameEngine
 		return Size() == std::size_t(0);
 	}
 
+	template <typename T>
+	void Factory<T>::Freeze()
+	{
+		sFrozenFactories = FrozenFactoryMap(sFactories.begin(), sFactories.end());
+	}
+
+	template <typename T>
+	inline bool Factory<T>::IsFrozen()
+	{
+		return !sFrozenFactories.IsEmpty();
+	}
+
 	template <typename T>
 	inline void Factory<T>::Add(const Factory& factory)
 	{
@@ -53,12 +68,14 @@ namespace FieaGameEngine
 			throw std::exception("Factory already present.");
 		}
 
+		sFrozenFactories = FrozenFactoryMap();
 		sFactories.Emplace(factory.ClassName(), &factory);
 	}
 
 	template <typename T>
 	inline void Factory<T>::Remove(const Factory& factory)
 	{
+		sFrozenFactories = FrozenFactoryMap();
 		sFactories.Remove(factory.ClassName());
 	}
 }
\ No newline at end of file
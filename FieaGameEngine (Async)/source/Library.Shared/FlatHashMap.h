@@ -0,0 +1,756 @@
+#pragma once
+
+#include <cstdlib>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <stdexcept>
+#include <initializer_list>
+#include <type_traits>
+#include <tuple>
+#include <cmath>
+#include "HashGroup.h"
+#include "DefaultHash.h"
+#include "DefaultComparator.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Map like container, stores key value pairs where the keys are unique.
+	/// Uses open addressing: every pair lives in one contiguous slot array and each slot
+	/// has a one byte control tag (empty, deleted or 7 bits of the key's hash), probing
+	/// compares a whole group of tags in one SIMD step so most lookups touch a single cache line
+	/// and compare at most one key
+	/// </summary>
+	template
+		<typename TKey,
+		typename TValue,
+		typename THashFunctor = DefaultHash<TKey>,
+		typename TKeyComparator = DefaultComparator<TKey>>
+	class FlatHashMap final
+	{
+	public:
+		using PairType = std::pair<const TKey, TValue>;
+
+	private:
+		using ControlType = HashGroup::ControlType;
+
+		template <typename TLookup>
+		using EnableIfTransparent = std::enable_if_t<IsTransparentKey<THashFunctor, TKeyComparator, TLookup>::value>;
+
+		/// <summary>
+		/// Number of control tags probed together, slots are always a multiple of this
+		/// </summary>
+		static constexpr size_t GroupWidth = HashGroup::Width;
+
+		/// <summary>
+		/// Control tag of a slot that was never used
+		/// </summary>
+		static constexpr ControlType Empty = HashGroup::Empty;
+
+		/// <summary>
+		/// Control tag of a slot whose pair was removed (tombstone)
+		/// </summary>
+		static constexpr ControlType Deleted = HashGroup::Deleted;
+
+	public:
+		/// <summary>
+		/// Allows to sequentally access the elements of this collection
+		/// </summary>
+		class Iterator final
+		{
+			/// <summary>
+			/// FlatHashMap needs access to Iterator private members
+			/// </summary>
+			friend FlatHashMap;
+
+		public:
+			/// <summary>
+			/// Default constructor
+			/// </summary>
+			Iterator() = default;
+
+			/// <summary>
+			/// Default copy constructor
+			/// </summary>
+			/// <param name="">Iterator</param>
+			Iterator(const Iterator&) = default;
+
+			/// <summary>
+			/// Default move constructor
+			/// </summary>
+			/// <param name="">Iterator</param>
+			Iterator(Iterator&&) = default;
+
+			/// <summary>
+			/// Default copy assignment operator
+			/// </summary>
+			/// <param name="">Iterator</param>
+			/// <returns>A reference to self</returns>
+			Iterator& operator=(const Iterator&) = default;
+
+			/// <summary>
+			/// Default move assignment operator
+			/// </summary>
+			/// <param name="">Iterator</param>
+			/// <returns>A reference to self</returns>
+			Iterator& operator=(Iterator&&) = default;
+
+			/// <summary>
+			/// Default destructor
+			/// </summary>
+			~Iterator() = default;
+
+			/// <summary>
+			/// Compares two iterators for equality
+			/// </summary>
+			/// <param name="other">The other iterator</param>
+			/// <returns>True if equal, false otherwise</returns>
+			bool operator==(const Iterator& other) const;
+
+			/// <summary>
+			/// Compares two iterators for inequality
+			/// </summary>
+			/// <param name="other">The other iterator</param>
+			/// <returns>True if not equal, false otherwise</returns>
+			bool operator!=(const Iterator& other) const;
+
+			/// <summary>
+			/// Compares two iterators for greater than
+			/// </summary>
+			/// <param name="other">Iterator</param>
+			/// <returns>True if this iterator is greater than the other</returns>
+			bool operator>(const Iterator& other) const;
+
+			/// <summary>
+			/// Compares two iterators for less than
+			/// </summary>
+			/// <param name="other">Iterator</param>
+			/// <returns>True if this iterator is less than the other</returns>
+			bool operator<(const Iterator& other) const;
+
+			/// <summary>
+			/// Makes self to point to next element in the collection
+			/// </summary>
+			/// <returns>Reference to self</returns>
+			Iterator& operator++();
+
+			/// <summary>
+			/// Makes self to point to next element in the collection
+			/// </summary>
+			/// <param name="">Dummy param</param>
+			/// <returns>Reference to self</returns>
+			Iterator operator++(int);
+
+			/// <summary>
+			/// Extracts the value this iterator points to
+			/// </summary>
+			/// <exception cref="std::exception">Thrown if the iterator has no owner or is out of range</exception>
+			/// <returns>A reference to the value this iterator points to</returns>
+			PairType& operator*() const;
+
+			/// <summary>
+			/// Extracts the value this iterator points to
+			/// </summary>
+			/// <exception cref="std::exception">Thrown if the iterator has no owner or is out of range</exception>
+			/// <returns>A pointer to the value this iterator points to</returns>
+			PairType* operator->() const;
+
+		private:
+			/// <summary>
+			/// Constructs iterator with owner and slot
+			/// </summary>
+			/// <param name="owner">Owner for this iterator</param>
+			/// <param name="slot">Slot for this iterator</param>
+			explicit Iterator(const FlatHashMap& owner, size_t slot = 0);
+
+			/// <summary>
+			/// Owner of this iterator
+			/// </summary>
+			FlatHashMap* mOwner = nullptr;
+
+			/// <summary>
+			/// Slot of this iterator
+			/// </summary>
+			size_t mSlot = 0;
+		};
+
+		/// <summary>
+		/// Allows to sequentally access the elements of this collection
+		/// </summary>
+		class ConstIterator final
+		{
+			/// <summary>
+			/// FlatHashMap needs access to Iterator private members
+			/// </summary>
+			friend FlatHashMap;
+
+		public:
+			/// <summary>
+			/// Default constructor
+			/// </summary>
+			ConstIterator() = default;
+
+			/// <summary>
+			/// Default copy constructor
+			/// </summary>
+			/// <param name="">Iterator</param>
+			ConstIterator(const ConstIterator&) = default;
+
+			/// <summary>
+			/// Default move constructor
+			/// </summary>
+			/// <param name="">Iterator</param>
+			ConstIterator(ConstIterator&&) = default;
+
+			/// <summary>
+			/// Copy constructor for implicit conversion from iterator
+			/// </summary>
+			/// <param name="other">Iterator</param>
+			ConstIterator(const Iterator& other);
+
+			/// <summary>
+			/// Default copy assignment operator
+			/// </summary>
+			/// <param name="">Iterator</param>
+			/// <returns>A reference to self</returns>
+			ConstIterator& operator=(const ConstIterator&) = default;
+
+			/// <summary>
+			/// Default move assignment operator
+			/// </summary>
+			/// <param name="">Iterator</param>
+			/// <returns>A reference to self</returns>
+			ConstIterator& operator=(ConstIterator&&) = default;
+
+			/// <summary>
+			/// Copy assignment for implicit conversion from iterator
+			/// </summary>
+			/// <param name="other">Iterator</param>
+			/// <returns>Reference to self</returns>
+			ConstIterator& operator=(const Iterator& other);
+
+			/// <summary>
+			/// Default destructor
+			/// </summary>
+			~ConstIterator() = default;
+
+			/// <summary>
+			/// Compares two iterators for equality
+			/// </summary>
+			/// <param name="other">The other iterator</param>
+			/// <returns>True if equal, false otherwise</returns>
+			bool operator==(const ConstIterator& other) const;
+
+			/// <summary>
+			/// Compares two iterators for inequality
+			/// </summary>
+			/// <param name="other">The other iterator</param>
+			/// <returns>True if not equal, false otherwise</returns>
+			bool operator!=(const ConstIterator& other) const;
+
+			/// <summary>
+			/// Compares two iterators for greater than
+			/// </summary>
+			/// <param name="other">Iterator</param>
+			/// <returns>True if this iterator is greater than the other</returns>
+			bool operator>(const ConstIterator& other) const;
+
+			/// <summary>
+			/// Compares two iterators for less than
+			/// </summary>
+			/// <param name="other">Iterator</param>
+			/// <returns>True if this iterator is less than the other</returns>
+			bool operator<(const ConstIterator& other) const;
+
+			/// <summary>
+			/// Makes self to point to next element in the collection
+			/// </summary>
+			/// <returns>Reference to self</returns>
+			ConstIterator& operator++();
+
+			/// <summary>
+			/// Makes self to point to next element in the collection
+			/// </summary>
+			/// <param name="">Dummy param</param>
+			/// <returns>Reference to self</returns>
+			ConstIterator operator++(int);
+
+			/// <summary>
+			/// Extracts the value this iterator points to
+			/// </summary>
+			/// <exception cref="std::exception">Thrown if the iterator has no owner or is out of range</exception>
+			/// <returns>A reference to the value this iterator points to</returns>
+			const PairType& operator*() const;
+
+			/// <summary>
+			/// Extracts the value this iterator points to
+			/// </summary>
+			/// <exception cref="std::exception">Thrown if the iterator has no owner or is out of range</exception>
+			/// <returns>A pointer to the value this iterator points to</returns>
+			const PairType* operator->() const;
+
+		private:
+			/// <summary>
+			/// Constructs iterator with owner and slot
+			/// </summary>
+			/// <param name="owner">Owner for this iterator</param>
+			/// <param name="slot">Slot for this iterator</param>
+			explicit ConstIterator(const FlatHashMap& owner, size_t slot = 0);
+
+			/// <summary>
+			/// Owner of this iterator
+			/// </summary>
+			const FlatHashMap* mOwner = nullptr;
+
+			/// <summary>
+			/// Slot of this iterator
+			/// </summary>
+			size_t mSlot = 0;
+		};
+
+		/// <summary>
+		/// Constructs a map with at least the given number of slots,
+		/// the slot count is rounded up to a power of two
+		/// </summary>
+		/// <param name="bucketCount">Number of slots</param>
+		explicit FlatHashMap(size_t bucketCount = 16);
+
+		/// <summary>
+		/// Copy constructor
+		/// </summary>
+		/// <param name="other">Map</param>
+		FlatHashMap(const FlatHashMap& other);
+
+		/// <summary>
+		/// Move constructor
+		/// </summary>
+		/// <param name="other">Map</param>
+		FlatHashMap(FlatHashMap&& other);
+
+		/// <summary>
+		/// Initializer list constructor
+		/// </summary>
+		/// <param name="list">Initializer list</param>
+		FlatHashMap(std::initializer_list<PairType> list);
+
+		/// <summary>
+		/// Copy assignment
+		/// </summary>
+		/// <param name="other">Map</param>
+		/// <returns>Reference to self</returns>
+		FlatHashMap& operator=(const FlatHashMap& other);
+
+		/// <summary>
+		/// Move assignment
+		/// </summary>
+		/// <param name="other">Map</param>
+		/// <returns>Reference to self</returns>
+		FlatHashMap& operator=(FlatHashMap&& other);
+
+		/// <summary>
+		/// Initializer list assignment
+		/// </summary>
+		/// <param name="list">Initializer list</param>
+		/// <returns>Reference to self</returns>
+		FlatHashMap& operator=(std::initializer_list<PairType> list);
+
+		/// <summary>
+		/// Destructor
+		/// </summary>
+		~FlatHashMap();
+
+		/// <summary>
+		/// Gets the value mapped to the given key, if the key is not present,
+		/// it is added and the value is default constructed
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <returns>Reference to the value mapped to key</returns>
+		TValue& operator[](const TKey& key);
+
+		/// <summary>
+		/// Gets the value mapped to the given key, if the key is not present,
+		/// it is added and the value is default constructed
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <returns>Reference to the value mapped to key</returns>
+		TValue& operator[](TKey&& key);
+
+		/// <summary>
+		/// Gets a reference to the mapped value for the given key if found
+		/// </summary>
+		/// <exception cref="std::exception">Thrown if the key is not present</exception>
+		/// <param name="key">Key</param>
+		/// <returns>A reference to the mapped value for the given key if found</returns>
+		TValue& At(const TKey& key);
+
+		/// <summary>
+		/// Gets a reference to the mapped value for the given key if found
+		/// </summary>
+		/// <exception cref="std::exception">Thrown if the key is not present</exception>
+		/// <param name="key">Key</param>
+		/// <returns>A reference to the mapped value for the given key if found</returns>
+		const TValue& At(const TKey& key) const;
+
+		/// <summary>
+		/// Gets a reference to the mapped value for a key of another type, only available
+		/// when the hash functor and key comparator are transparent (e.g. std::string_view on std::string keys)
+		/// </summary>
+		/// <exception cref="std::exception">Thrown if the key is not present</exception>
+		/// <param name="key">Key</param>
+		/// <returns>A reference to the mapped value for the given key if found</returns>
+		template <typename TLookup, typename = EnableIfTransparent<TLookup>>
+		TValue& At(const TLookup& key);
+
+		/// <summary>
+		/// Gets a reference to the mapped value for a key of another type, only available
+		/// when the hash functor and key comparator are transparent (e.g. std::string_view on std::string keys)
+		/// </summary>
+		/// <exception cref="std::exception">Thrown if the key is not present</exception>
+		/// <param name="key">Key</param>
+		/// <returns>A reference to the mapped value for the given key if found</returns>
+		template <typename TLookup, typename = EnableIfTransparent<TLookup>>
+		const TValue& At(const TLookup& key) const;
+
+		/// <summary>
+		/// Adds a key value pair to the collection, if the given key is
+		/// already present then nothing is done
+		/// </summary>
+		/// <param name="pair">Key value pair</param>
+		/// <returns>Pair of iterator to the inserted or already present pair and bool true if inserted, false otherwise</returns>
+		std::pair<Iterator, bool> Insert(const PairType& pair);
+
+		/// <summary>
+		/// Adds a key value pair to the collection, if the given key is
+		/// already present then nothing is done
+		/// </summary>
+		/// <param name="pair">Key value pair</param>
+		/// <returns>Pair of iterator to the inserted or already present pair and bool true if inserted, false otherwise</returns>
+		std::pair<Iterator, bool> Insert(PairType&& pair);
+
+		/// <summary>
+		/// Constructs in place and adds the value to the collection,
+		/// if the key already present then nothing is done
+		/// </summary>
+		/// <param name="...args">Params to be forwarded to pair's constructor</param>
+		/// <returns>Pair of iterator to the inserted or already present pair and bool true if inserted, false otherwise</returns>
+		template <typename... Args>
+		std::pair<Iterator, bool> Emplace(Args&&... args);
+
+		/// <summary>
+		/// Looks for the given key in the collection
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <returns>Iterator to the value if found, end iterator otherwise</returns>
+		Iterator Find(const TKey& key);
+
+		/// <summary>
+		/// Looks for the given key in the collection
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <returns>Iterator to the value if found, end iterator otherwise</returns>
+		ConstIterator Find(const TKey& key) const;
+
+		/// <summary>
+		/// Looks for a key of another type without converting it to TKey, only available
+		/// when the hash functor and key comparator are transparent (e.g. std::string_view on std::string keys)
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <returns>Iterator to the value if found, end iterator otherwise</returns>
+		template <typename TLookup, typename = EnableIfTransparent<TLookup>>
+		Iterator Find(const TLookup& key);
+
+		/// <summary>
+		/// Looks for a key of another type without converting it to TKey, only available
+		/// when the hash functor and key comparator are transparent (e.g. std::string_view on std::string keys)
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <returns>Iterator to the value if found, end iterator otherwise</returns>
+		template <typename TLookup, typename = EnableIfTransparent<TLookup>>
+		ConstIterator Find(const TLookup& key) const;
+
+		/// <summary>
+		/// Removes the pair with the given key
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <returns>True if removed, false otherwise</returns>
+		bool Remove(const TKey& key);
+
+		/// <summary>
+		/// Removes the element the given iterator points to
+		/// </summary>
+		/// <param name="it">Iterator</param>
+		/// <returns>True if removed, false otherwise</returns>
+		bool Remove(const Iterator& it);
+
+		/// <summary>
+		/// Removes the elements in the given range (inclusive, exclusive)
+		/// </summary>
+		/// <exception cref="std::exception">Thrown if the iterators are not associated with this map or the range is invalid</exception>
+		/// <param name="first">First element in range</param>
+		/// <param name="last">Element following last removed element</param>
+		void Remove(const Iterator& first, const Iterator& last);
+
+		/// <summary>
+		/// Grows the number of slots to the number needed to accomodate at least count elements
+		/// without exceeding maximum load factor and rehashes the container. Never shrinks
+		/// </summary>
+		/// <param name="count">Number of elements</param>
+		void Reserve(size_t count);
+
+		/// <summary>
+		/// Sets the number of slots to at least bucket count (rounded up to a power of two and never
+		/// less than what the current elements need) and rehashes the container
+		/// </summary>
+		/// <param name="bucketCount">Number of slots</param>
+		void Rehash(size_t bucketCount);
+
+		/// <summary>
+		/// Checks if the given key is present in the collection
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <returns>True if present, false otherwise</returns>
+		bool ContainsKey(const TKey& key) const;
+
+		/// <summary>
+		/// Checks if the given key is present in the collection
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <param name="it">Iterator to output if found</param>
+		/// <returns>True if present, false otherwise</returns>
+		bool ContainsKey(const TKey& key, Iterator& out);
+
+		/// <summary>
+		/// Checks if the given key is present in the collection
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <param name="it">Iterator to output if found</param>
+		/// <returns>True if present, false otherwise</returns>
+		bool ContainsKey(const TKey& key, ConstIterator& out) const;
+
+		/// <summary>
+		/// Checks if a key of another type is present, only available when
+		/// the hash functor and key comparator are transparent
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <returns>True if present, false otherwise</returns>
+		template <typename TLookup, typename = EnableIfTransparent<TLookup>>
+		bool ContainsKey(const TLookup& key) const;
+
+		/// <summary>
+		/// Checks if a key of another type is present, only available when
+		/// the hash functor and key comparator are transparent
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <param name="it">Iterator to output if found</param>
+		/// <returns>True if present, false otherwise</returns>
+		template <typename TLookup, typename = EnableIfTransparent<TLookup>>
+		bool ContainsKey(const TLookup& key, Iterator& out);
+
+		/// <summary>
+		/// Checks if a key of another type is present, only available when
+		/// the hash functor and key comparator are transparent
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <param name="it">Iterator to output if found</param>
+		/// <returns>True if present, false otherwise</returns>
+		template <typename TLookup, typename = EnableIfTransparent<TLookup>>
+		bool ContainsKey(const TLookup& key, ConstIterator& out) const;
+
+		/// <summary>
+		/// Removes all key value pairs from the container, keeps the slots
+		/// </summary>
+		void Clear();
+
+		/// <summary>
+		/// Gets an iterator to the first element in the collection
+		/// </summary>
+		/// <returns>Iterator to the first element in the collection</returns>
+		Iterator begin();
+
+		/// <summary>
+		/// Gets an iterator to the first element in the collection
+		/// </summary>
+		/// <returns>Iterator to the first element in the collection</returns>
+		ConstIterator begin() const;
+
+		/// <summary>
+		/// Gets an iterator past the last element in the collection
+		/// </summary>
+		/// <returns>Iterator past the last element in the collection</returns>
+		Iterator end();
+
+		/// <summary>
+		/// Gets an iterator past the last element in the collection
+		/// </summary>
+		/// <returns>Iterator past the last element in the collection</returns>
+		ConstIterator end() const;
+
+		/// <summary>
+		/// Gets an iterator to the first element in the collection
+		/// </summary>
+		/// <returns>Iterator to the first element in the collection</returns>
+		ConstIterator cbegin() const;
+
+		/// <summary>
+		/// Gets an iterator past the last element in the collection
+		/// </summary>
+		/// <returns>Iterator past the last element in the collection</returns>
+		ConstIterator cend() const;
+
+		/// <summary>
+		/// Gets the current load factor
+		/// </summary>
+		/// <returns>The current load factor</returns>
+		float LoadFactor() const;
+
+		/// <summary>
+		/// Gets the current max load factor
+		/// </summary>
+		/// <returns>The current max load factor</returns>
+		float MaxLoadFactor() const;
+
+		/// <summary>
+		/// Sets the max load factor, which must lie in (0, 1)
+		/// </summary>
+		/// <exception cref="std::invalid_argument">Thrown if the max load factor is outside (0, 1)</exception>
+		/// <param name="maxLoadFactor">The new max load factor</param>
+		void MaxLoadFactor(float maxLoadFactor);
+
+		/// <summary>
+		/// Gets the size of the collection
+		/// </summary>
+		/// <returns>Size of the collection</returns>
+		size_t Size() const;
+
+		/// <summary>
+		/// Gets the number of slots of the collection
+		/// </summary>
+		/// <returns>The number of slots of the collection</returns>
+		size_t BucketCount() const;
+
+		/// <summary>
+		/// Gets the number of pairs stored in the given slot (zero or one)
+		/// </summary>
+		/// <param name="bucket">Slot</param>
+		/// <returns>Size of the slot</returns>
+		size_t BucketSize(size_t bucket) const;
+
+	private:
+		/// <summary>
+		/// Number of elements in the collection
+		/// </summary>
+		size_t mSize = 0;
+
+		/// <summary>
+		/// Number of slots, a power of two and a multiple of the group width
+		/// </summary>
+		size_t mCapacity = 0;
+
+		/// <summary>
+		/// Number of empty slots that can still be claimed before the table must grow
+		/// </summary>
+		size_t mGrowthLeft = 0;
+
+		/// <summary>
+		/// Contiguous slot storage, only slots with a full control tag are constructed
+		/// </summary>
+		PairType* mSlots = nullptr;
+
+		/// <summary>
+		/// One control tag per slot, lives in the same allocation right after the slots
+		/// </summary>
+		ControlType* mControl = nullptr;
+
+		/// <summary>
+		/// Hash functor
+		/// </summary>
+		THashFunctor mHashFunctor;
+
+		/// <summary>
+		/// Key comparator
+		/// </summary>
+		TKeyComparator mKeyComparator;
+
+		/// <summary>
+		/// Max load factor
+		/// </summary>
+		float mMaxLoadFactor = 0.875f;
+
+		/// <summary>
+		/// Hashes the given key, mixing the result first if the functor is not avalanching, so both the probe start and the tag are usable
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <returns>Mixed hash of the key</returns>
+		template <typename TLookup>
+		size_t Hash(const TLookup& key) const;
+
+		/// <summary>
+		/// Looks for the slot holding the given key
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <param name="hash">Mixed hash of the key</param>
+		/// <returns>Slot of the key if found, the slot count otherwise</returns>
+		template <typename TLookup>
+		size_t FindSlot(const TLookup& key, size_t hash) const;
+
+		/// <summary>
+		/// Looks for the first empty or deleted slot in the probe sequence of the given hash
+		/// </summary>
+		/// <param name="hash">Mixed hash</param>
+		/// <returns>Slot where a new pair with the given hash can be placed</returns>
+		size_t FindInsertSlot(size_t hash) const;
+
+		/// <summary>
+		/// Destroys the pair in the given slot and releases the slot
+		/// </summary>
+		/// <param name="slot">Slot</param>
+		void EraseSlot(size_t slot);
+
+		/// <summary>
+		/// Grows the table or purges deleted slots when no empty slot is left
+		/// </summary>
+		void Grow();
+
+		/// <summary>
+		/// Moves every pair into a freshly allocated table with the given slot count
+		/// </summary>
+		/// <param name="capacity">Number of slots, must be normalized</param>
+		void Resize(size_t capacity);
+
+		/// <summary>
+		/// Allocates slots and control tags for the given slot count, all tags start empty
+		/// </summary>
+		/// <param name="capacity">Number of slots, must be normalized</param>
+		void Allocate(size_t capacity);
+
+		/// <summary>
+		/// Destroys every pair and frees the storage
+		/// </summary>
+		void Destroy();
+
+		/// <summary>
+		/// Gets the first full slot at or after the given one
+		/// </summary>
+		/// <param name="slot">Slot</param>
+		/// <returns>First full slot, the slot count if none</returns>
+		size_t NextFullSlot(size_t slot) const;
+
+		/// <summary>
+		/// Number of slots that may be full at once for the given slot count
+		/// </summary>
+		/// <param name="capacity">Number of slots</param>
+		/// <returns>Maximum number of full slots</returns>
+		size_t MaxFullSlots(size_t capacity) const;
+
+		/// <summary>
+		/// Rounds the given slot count up to a power of two no smaller than the group width
+		/// </summary>
+		/// <param name="capacity">Number of slots</param>
+		/// <returns>Normalized slot count</returns>
+		static size_t NormalizeCapacity(size_t capacity);
+	};
+}
+
+#include "FlatHashMap.inl"
@@ -0,0 +1,862 @@
+#include "FlatHashMap.h"
+
+namespace FieaGameEngine
+{
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::FlatHashMap(size_t bucketCount)
+	{
+		Allocate(NormalizeCapacity(bucketCount));
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::FlatHashMap(const FlatHashMap& other) :
+		mHashFunctor(other.mHashFunctor), mKeyComparator(other.mKeyComparator), mMaxLoadFactor(other.mMaxLoadFactor)
+	{
+		Allocate(other.mCapacity);
+
+		for (size_t slot = 0; slot < mCapacity; ++slot)
+		{
+			if (other.mControl[slot] >= 0)
+			{
+				new (mSlots + slot) PairType(other.mSlots[slot]);
+			}
+		}
+
+		std::memcpy(mControl, other.mControl, mCapacity * sizeof(ControlType));
+		mSize = other.mSize;
+		mGrowthLeft = other.mGrowthLeft;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::FlatHashMap(FlatHashMap&& other) :
+		mSize(other.mSize), mCapacity(other.mCapacity), mGrowthLeft(other.mGrowthLeft), mSlots(other.mSlots), mControl(other.mControl),
+		mHashFunctor(std::move(other.mHashFunctor)), mKeyComparator(std::move(other.mKeyComparator)), mMaxLoadFactor(other.mMaxLoadFactor)
+	{
+		other.mSize = 0;
+		other.mCapacity = 0;
+		other.mGrowthLeft = 0;
+		other.mSlots = nullptr;
+		other.mControl = nullptr;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::FlatHashMap(std::initializer_list<PairType> list) :
+		FlatHashMap(list.size() * 2)
+	{
+		for (auto& pair : list)
+		{
+			Emplace(pair);
+		}
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>& FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::operator=(const FlatHashMap& other)
+	{
+		if (this != &other)
+		{
+			FlatHashMap copy(other);
+			*this = std::move(copy);
+		}
+
+		return *this;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>& FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::operator=(FlatHashMap&& other)
+	{
+		if (this != &other)
+		{
+			Destroy();
+
+			mSize = other.mSize;
+			mCapacity = other.mCapacity;
+			mGrowthLeft = other.mGrowthLeft;
+			mSlots = other.mSlots;
+			mControl = other.mControl;
+			mHashFunctor = std::move(other.mHashFunctor);
+			mKeyComparator = std::move(other.mKeyComparator);
+			mMaxLoadFactor = other.mMaxLoadFactor;
+
+			other.mSize = 0;
+			other.mCapacity = 0;
+			other.mGrowthLeft = 0;
+			other.mSlots = nullptr;
+			other.mControl = nullptr;
+		}
+
+		return *this;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>& FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::operator=(std::initializer_list<PairType> list)
+	{
+		Clear();
+
+		for (auto& pair : list)
+		{
+			Emplace(pair);
+		}
+
+		return *this;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::~FlatHashMap()
+	{
+		Destroy();
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	TValue& FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::operator[](const TKey& key)
+	{
+		auto[it, inserted] = Emplace(key, TValue());
+
+		return it->second;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	TValue& FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::operator[](TKey&& key)
+	{
+		auto[it, inserted] = Emplace(std::move(key), TValue());
+
+		return it->second;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	TValue& FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::At(const TKey& key)
+	{
+		const size_t slot = FindSlot(key, Hash(key));
+
+		if (slot == mCapacity)
+		{
+			throw std::exception("Key not found.");
+		}
+
+		return mSlots[slot].second;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	const TValue& FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::At(const TKey& key) const
+	{
+		const size_t slot = FindSlot(key, Hash(key));
+
+		if (slot == mCapacity)
+		{
+			throw std::exception("Key not found.");
+		}
+
+		return mSlots[slot].second;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	template <typename TLookup, typename>
+	TValue& FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::At(const TLookup& key)
+	{
+		const size_t slot = FindSlot(key, Hash(key));
+
+		if (slot == mCapacity)
+		{
+			throw std::exception("Key not found.");
+		}
+
+		return mSlots[slot].second;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	template <typename TLookup, typename>
+	const TValue& FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::At(const TLookup& key) const
+	{
+		const size_t slot = FindSlot(key, Hash(key));
+
+		if (slot == mCapacity)
+		{
+			throw std::exception("Key not found.");
+		}
+
+		return mSlots[slot].second;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	std::pair<typename FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Iterator, bool> FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Insert(const PairType& pair)
+	{
+		return Emplace(pair);
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	std::pair<typename FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Iterator, bool> FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Insert(PairType&& pair)
+	{
+		return Emplace(std::move(pair));
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	template <typename... Args>
+	std::pair<typename FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Iterator, bool> FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Emplace(Args&&... args)
+	{
+		PairType pair(std::forward<Args>(args)...);
+		const size_t hash = Hash(pair.first);
+
+		size_t slot = FindSlot(pair.first, hash);
+		if (slot != mCapacity)
+		{
+			return std::pair(Iterator(*this, slot), false);
+		}
+
+		while (mGrowthLeft == 0)
+		{
+			Grow();
+		}
+
+		slot = FindInsertSlot(hash);
+		if (mControl[slot] == Empty)
+		{
+			--mGrowthLeft;
+		}
+
+		new (mSlots + slot) PairType(std::move(pair));
+		mControl[slot] = static_cast<ControlType>(hash & 0x7F);
+		++mSize;
+
+		return std::pair(Iterator(*this, slot), true);
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	typename FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Iterator FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Find(const TKey& key)
+	{
+		return Iterator(*this, FindSlot(key, Hash(key)));
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	typename FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Find(const TKey& key) const
+	{
+		return ConstIterator(*this, FindSlot(key, Hash(key)));
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	template <typename TLookup, typename>
+	typename FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Iterator FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Find(const TLookup& key)
+	{
+		return Iterator(*this, FindSlot(key, Hash(key)));
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	template <typename TLookup, typename>
+	typename FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Find(const TLookup& key) const
+	{
+		return ConstIterator(*this, FindSlot(key, Hash(key)));
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	bool FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Remove(const TKey& key)
+	{
+		const size_t slot = FindSlot(key, Hash(key));
+
+		if (slot != mCapacity)
+		{
+			EraseSlot(slot);
+			return true;
+		}
+
+		return false;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	bool FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Remove(const Iterator& it)
+	{
+		if (it.mOwner == this && it.mSlot < mCapacity && mControl[it.mSlot] >= 0)
+		{
+			EraseSlot(it.mSlot);
+			return true;
+		}
+
+		return false;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	void FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Remove(const Iterator& first, const Iterator& last)
+	{
+		if (first.mOwner != this || last.mOwner != this)
+		{
+			throw std::exception("Iterators are not associated with this container.");
+		}
+
+		if (last < first)
+		{
+			throw std::exception("Invalid range.");
+		}
+
+		for (size_t slot = first.mSlot; slot < last.mSlot; ++slot)
+		{
+			if (mControl[slot] >= 0)
+			{
+				EraseSlot(slot);
+			}
+		}
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	void FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Reserve(size_t count)
+	{
+		// only ever grows, a map already big enough keeps its slots
+		const size_t bucketCount = static_cast<size_t>(std::ceil(static_cast<float>(count) / mMaxLoadFactor));
+		if (bucketCount > mCapacity)
+		{
+			Rehash(bucketCount);
+		}
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	void FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Rehash(size_t bucketCount)
+	{
+		size_t capacity = NormalizeCapacity(bucketCount);
+		while (MaxFullSlots(capacity) < mSize)
+		{
+			capacity *= 2;
+		}
+
+		Resize(capacity);
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	inline bool FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::ContainsKey(const TKey& key) const
+	{
+		return FindSlot(key, Hash(key)) != mCapacity;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	inline bool FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::ContainsKey(const TKey& key, Iterator& out)
+	{
+		out = Find(key);
+
+		return out.mSlot != mCapacity;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	inline bool FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::ContainsKey(const TKey& key, ConstIterator& out) const
+	{
+		out = Find(key);
+
+		return out.mSlot != mCapacity;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	template <typename TLookup, typename>
+	inline bool FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::ContainsKey(const TLookup& key) const
+	{
+		return FindSlot(key, Hash(key)) != mCapacity;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	template <typename TLookup, typename>
+	inline bool FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::ContainsKey(const TLookup& key, Iterator& out)
+	{
+		out = Find(key);
+
+		return out.mSlot != mCapacity;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	template <typename TLookup, typename>
+	inline bool FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::ContainsKey(const TLookup& key, ConstIterator& out) const
+	{
+		out = Find(key);
+
+		return out.mSlot != mCapacity;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	void FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Clear()
+	{
+		if (mSize > 0)
+		{
+			for (size_t slot = 0; slot < mCapacity; ++slot)
+			{
+				if (mControl[slot] >= 0)
+				{
+					mSlots[slot].~PairType();
+				}
+			}
+
+			mSize = 0;
+		}
+
+		if (mControl != nullptr)
+		{
+			std::memset(mControl, Empty, mCapacity * sizeof(ControlType));
+			mGrowthLeft = MaxFullSlots(mCapacity);
+		}
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	inline typename FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Iterator FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::begin()
+	{
+		return Iterator(*this, NextFullSlot(0));
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	inline typename FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::begin() const
+	{
+		return ConstIterator(*this, NextFullSlot(0));
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	inline typename FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Iterator FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::end()
+	{
+		return Iterator(*this, mCapacity);
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	inline typename FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::end() const
+	{
+		return ConstIterator(*this, mCapacity);
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	inline typename FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::cbegin() const
+	{
+		return ConstIterator(*this, NextFullSlot(0));
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	inline typename FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::cend() const
+	{
+		return ConstIterator(*this, mCapacity);
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	inline float FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::LoadFactor() const
+	{
+		return static_cast<float>(mSize) / static_cast<float>(mCapacity);
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	inline float FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::MaxLoadFactor() const
+	{
+		return mMaxLoadFactor;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	void FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::MaxLoadFactor(float maxLoadFactor)
+	{
+		if (maxLoadFactor <= 0.0f || maxLoadFactor >= 1.0f)
+		{
+			throw std::invalid_argument("Max load factor must be between 0 and 1.");
+		}
+
+		mMaxLoadFactor = maxLoadFactor;
+		Rehash(mCapacity);
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	inline size_t FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Size() const
+	{
+		return mSize;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	inline size_t FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::BucketCount() const
+	{
+		return mCapacity;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	inline size_t FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::BucketSize(size_t bucket) const
+	{
+		return (bucket < mCapacity && mControl[bucket] >= 0) ? 1 : 0;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	template <typename TLookup>
+	inline size_t FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Hash(const TLookup& key) const
+	{
+		size_t hash = mHashFunctor(key);
+
+		// the tag takes the low 7 bits and the probe start the remaining ones, so a functor
+		// that does not promise well mixed bits gets every bit spread first
+		if constexpr (IsAvalanchingHash<THashFunctor>::value)
+		{
+			return hash;
+		}
+		else if constexpr (sizeof(size_t) == 8)
+		{
+			hash *= static_cast<size_t>(0x9E3779B97F4A7C15ULL);
+			return hash ^ (hash >> 32);
+		}
+		else
+		{
+			hash *= static_cast<size_t>(0x9E3779B9U);
+			return hash ^ (hash >> 16);
+		}
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	template <typename TLookup>
+	size_t FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::FindSlot(const TLookup& key, size_t hash) const
+	{
+		if (mSize == 0)
+		{
+			return mCapacity;
+		}
+
+		const ControlType tag = static_cast<ControlType>(hash & 0x7F);
+		const size_t groupMask = (mCapacity / GroupWidth) - 1;
+		size_t group = (hash >> 7) & groupMask;
+
+		for (size_t probe = 1; probe <= groupMask + 1; ++probe)
+		{
+			const HashGroup control(mControl + group * GroupWidth);
+
+			for (std::uint32_t match = control.Match(tag); match != 0; match &= match - 1)
+			{
+				const size_t slot = group * GroupWidth + HashGroup::LowestBit(match);
+				if (mKeyComparator(key, mSlots[slot].first))
+				{
+					return slot;
+				}
+			}
+
+			if (control.MatchEmpty() != 0)
+			{
+				break;
+			}
+
+			group = (group + probe) & groupMask;
+		}
+
+		return mCapacity;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	size_t FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::FindInsertSlot(size_t hash) const
+	{
+		const size_t groupMask = (mCapacity / GroupWidth) - 1;
+		size_t group = (hash >> 7) & groupMask;
+
+		for (size_t probe = 1; ; ++probe)
+		{
+			const std::uint32_t match = HashGroup(mControl + group * GroupWidth).MatchEmptyOrDeleted();
+			if (match != 0)
+			{
+				return group * GroupWidth + HashGroup::LowestBit(match);
+			}
+
+			group = (group + probe) & groupMask;
+		}
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	void FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::EraseSlot(size_t slot)
+	{
+		mSlots[slot].~PairType();
+		--mSize;
+
+		// a group that still has an empty tag ends every probe sequence passing through it,
+		// so the slot can go back to empty instead of leaving a tombstone
+		if (HashGroup(mControl + (slot & ~(GroupWidth - 1))).MatchEmpty() != 0)
+		{
+			mControl[slot] = Empty;
+			++mGrowthLeft;
+		}
+		else
+		{
+			mControl[slot] = Deleted;
+		}
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	void FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Grow()
+	{
+		// if tombstones hold most of the used slots, rebuilding in place is enough
+		if (mSize * 2 < MaxFullSlots(mCapacity))
+		{
+			Resize(mCapacity);
+		}
+		else
+		{
+			Resize(mCapacity > 0 ? mCapacity * 2 : GroupWidth);
+		}
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	void FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Resize(size_t capacity)
+	{
+		PairType* oldSlots = mSlots;
+		ControlType* oldControl = mControl;
+		const size_t oldCapacity = mCapacity;
+		const size_t size = mSize;
+
+		Allocate(capacity);
+
+		for (size_t slot = 0; slot < oldCapacity; ++slot)
+		{
+			if (oldControl[slot] >= 0)
+			{
+				const size_t hash = Hash(oldSlots[slot].first);
+				const size_t newSlot = FindInsertSlot(hash);
+
+				new (mSlots + newSlot) PairType(std::move(oldSlots[slot]));
+				mControl[newSlot] = static_cast<ControlType>(hash & 0x7F);
+				oldSlots[slot].~PairType();
+			}
+		}
+
+		mSize = size;
+		mGrowthLeft = MaxFullSlots(mCapacity) - mSize;
+		free(oldSlots);
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	void FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Allocate(size_t capacity)
+	{
+		// slots and tags share one block, tags go right after the slots
+		void* memory = malloc(capacity * (sizeof(PairType) + sizeof(ControlType)));
+		if (memory == nullptr)
+		{
+			throw std::exception("Unable to allocate memory.");
+		}
+
+		mSlots = static_cast<PairType*>(memory);
+		mControl = reinterpret_cast<ControlType*>(mSlots + capacity);
+		mCapacity = capacity;
+		mSize = 0;
+		mGrowthLeft = MaxFullSlots(capacity);
+
+		std::memset(mControl, Empty, capacity * sizeof(ControlType));
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	void FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Destroy()
+	{
+		if (mSlots != nullptr)
+		{
+			Clear();
+			free(mSlots);
+
+			mSlots = nullptr;
+			mControl = nullptr;
+			mCapacity = 0;
+			mGrowthLeft = 0;
+		}
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	inline size_t FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::NextFullSlot(size_t slot) const
+	{
+		while (slot < mCapacity && mControl[slot] < 0)
+		{
+			++slot;
+		}
+
+		return slot;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	inline size_t FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::MaxFullSlots(size_t capacity) const
+	{
+		return static_cast<size_t>(static_cast<float>(capacity) * mMaxLoadFactor);
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	inline size_t FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::NormalizeCapacity(size_t capacity)
+	{
+		size_t normalized = GroupWidth;
+		while (normalized < capacity)
+		{
+			normalized *= 2;
+		}
+
+		return normalized;
+	}
+
+	// Iterator
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Iterator::Iterator(const FlatHashMap& owner, size_t slot) :
+		mOwner(const_cast<FlatHashMap*>(&owner)), mSlot(slot)
+	{
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	inline bool FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Iterator::operator==(const Iterator& other) const
+	{
+		return !operator!=(other);
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	inline bool FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Iterator::operator!=(const Iterator& other) const
+	{
+		return (mOwner != other.mOwner) || (mSlot != other.mSlot);
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	bool FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Iterator::operator>(const Iterator& other) const
+	{
+		if (mOwner != other.mOwner)
+		{
+			throw std::exception("Iterators have different owners.");
+		}
+
+		return mSlot > other.mSlot;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	bool FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Iterator::operator<(const Iterator& other) const
+	{
+		if (mOwner != other.mOwner)
+		{
+			throw std::exception("Iterators have different owners.");
+		}
+
+		return mSlot < other.mSlot;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	typename FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Iterator& FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Iterator::operator++()
+	{
+		if (mOwner == nullptr)
+		{
+			throw std::exception("Unassociated iterator.");
+		}
+
+		if (mSlot < mOwner->mCapacity)
+		{
+			mSlot = mOwner->NextFullSlot(mSlot + 1);
+		}
+
+		return *this;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	typename FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Iterator FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Iterator::operator++(int)
+	{
+		Iterator temp = *this;
+		operator++();
+
+		return temp;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	typename FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::PairType& FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Iterator::operator*() const
+	{
+		if (mOwner == nullptr)
+		{
+			throw std::exception("Unassociated iterator.");
+		}
+
+		if (mSlot >= mOwner->mCapacity || mOwner->mControl[mSlot] < 0)
+		{
+			throw std::exception("Iterator out of range.");
+		}
+
+		return mOwner->mSlots[mSlot];
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	typename FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::PairType* FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Iterator::operator->() const
+	{
+		return &operator*();
+	}
+
+	// ConstIterator
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator::ConstIterator(const FlatHashMap& owner, size_t slot) :
+		mOwner(&owner), mSlot(slot)
+	{
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator::ConstIterator(const Iterator& other) :
+		mOwner(other.mOwner), mSlot(other.mSlot)
+	{
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	typename FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator& FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator::operator=(const Iterator& other)
+	{
+		mOwner = other.mOwner;
+		mSlot = other.mSlot;
+
+		return *this;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	inline bool FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator::operator==(const ConstIterator& other) const
+	{
+		return !operator!=(other);
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	inline bool FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator::operator!=(const ConstIterator& other) const
+	{
+		return (mOwner != other.mOwner) || (mSlot != other.mSlot);
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	bool FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator::operator>(const ConstIterator& other) const
+	{
+		if (mOwner != other.mOwner)
+		{
+			throw std::exception("Iterators have different owners.");
+		}
+
+		return mSlot > other.mSlot;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	bool FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator::operator<(const ConstIterator& other) const
+	{
+		if (mOwner != other.mOwner)
+		{
+			throw std::exception("Iterators have different owners.");
+		}
+
+		return mSlot < other.mSlot;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	typename FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator& FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator::operator++()
+	{
+		if (mOwner == nullptr)
+		{
+			throw std::exception("Unassociated iterator.");
+		}
+
+		if (mSlot < mOwner->mCapacity)
+		{
+			mSlot = mOwner->NextFullSlot(mSlot + 1);
+		}
+
+		return *this;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	typename FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator::operator++(int)
+	{
+		ConstIterator temp = *this;
+		operator++();
+
+		return temp;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	const typename FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::PairType& FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator::operator*() const
+	{
+		if (mOwner == nullptr)
+		{
+			throw std::exception("Unassociated iterator.");
+		}
+
+		if (mSlot >= mOwner->mCapacity || mOwner->mControl[mSlot] < 0)
+		{
+			throw std::exception("Iterator out of range.");
+		}
+
+		return mOwner->mSlots[mSlot];
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	const typename FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::PairType* FlatHashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator::operator->() const
+	{
+		return &operator*();
+	}
+}
@@ -0,0 +1,320 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <initializer_list>
+#include <type_traits>
+#include <utility>
+#include "DefaultHash.h"
+#include "DefaultComparator.h"
+#include "vector.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Read only map built once from a finished set of unique keys, for registries that are filled at startup
+	/// and only searched afterwards. Keys are placed with a minimal perfect hash (hash and displace): the hash
+	/// picks a bucket, the bucket's displacement seed picks the slot, and every slot holds exactly one pair.
+	/// A lookup is one seed read, one slot probe and one key comparison, hit or miss.
+	/// Keys whose full hashes collide cannot be separated by any seed, all but one of them go to a short
+	/// overflow past the perfect hash slots, which a lookup scans only when its probe misses.
+	/// Values may be changed in place, keys can never be added or removed
+	/// </summary>
+	template
+		<typename TKey,
+		typename TValue,
+		typename THashFunctor = DefaultHash<TKey>,
+		typename TKeyComparator = DefaultComparator<TKey>>
+	class FrozenHashMap final
+	{
+	public:
+		using PairType = std::pair<const TKey, TValue>;
+
+	private:
+		using EntryListType = Vector<PairType>;
+
+		template <typename TLookup>
+		using EnableIfTransparent = std::enable_if_t<IsTransparentKey<THashFunctor, TKeyComparator, TLookup>::value>;
+
+		/// <summary>
+		/// Most keys per bucket on average, the bucket count is the power of two that keeps to it.
+		/// Bigger buckets mean fewer seeds but a longer build
+		/// </summary>
+		static constexpr size_t BucketLoad = 4;
+
+		/// <summary>
+		/// Seeds tried on a bucket before the build gives up
+		/// </summary>
+		static constexpr std::int32_t MaxSeed = 1 << 20;
+
+	public:
+		/// <summary>
+		/// Pairs are laid out in slot order, so iterating is walking a plain array
+		/// </summary>
+		using Iterator = typename EntryListType::Iterator;
+		using ConstIterator = typename EntryListType::ConstIterator;
+
+		/// <summary>
+		/// Creates an empty map
+		/// </summary>
+		FrozenHashMap() = default;
+
+		/// <summary>
+		/// Builds the map from the given pairs
+		/// </summary>
+		/// <exception cref="std::exception">Thrown if two pairs have the same key</exception>
+		/// <param name="list">Key value pairs</param>
+		FrozenHashMap(std::initializer_list<PairType> list);
+
+		/// <summary>
+		/// Builds the map from a range of pairs, such as the contents of a HashMap or FlatHashMap
+		/// </summary>
+		/// <exception cref="std::exception">Thrown if two pairs have the same key</exception>
+		/// <param name="first">Iterator to the first pair</param>
+		/// <param name="last">Iterator past the last pair</param>
+		template <typename TInputIterator>
+		FrozenHashMap(TInputIterator first, TInputIterator last);
+
+		FrozenHashMap(const FrozenHashMap&) = default;
+		FrozenHashMap(FrozenHashMap&&) = default;
+		FrozenHashMap& operator=(const FrozenHashMap&) = default;
+		FrozenHashMap& operator=(FrozenHashMap&&) = default;
+		~FrozenHashMap() = default;
+
+		/// <summary>
+		/// Gets a reference to the mapped value for the given key if found
+		/// </summary>
+		/// <exception cref="std::exception">Thrown if the key is not present</exception>
+		/// <param name="key">Key</param>
+		/// <returns>A reference to the mapped value for the given key if found</returns>
+		TValue& At(const TKey& key);
+
+		/// <summary>
+		/// Gets a reference to the mapped value for the given key if found
+		/// </summary>
+		/// <exception cref="std::exception">Thrown if the key is not present</exception>
+		/// <param name="key">Key</param>
+		/// <returns>A reference to the mapped value for the given key if found</returns>
+		const TValue& At(const TKey& key) const;
+
+		/// <summary>
+		/// Gets a reference to the mapped value for a key of another type, only available
+		/// when the hash functor and key comparator are transparent (e.g. std::string_view on std::string keys)
+		/// </summary>
+		/// <exception cref="std::exception">Thrown if the key is not present</exception>
+		/// <param name="key">Key</param>
+		/// <returns>A reference to the mapped value for the given key if found</returns>
+		template <typename TLookup, typename = EnableIfTransparent<TLookup>>
+		TValue& At(const TLookup& key);
+
+		/// <summary>
+		/// Gets a reference to the mapped value for a key of another type, only available
+		/// when the hash functor and key comparator are transparent (e.g. std::string_view on std::string keys)
+		/// </summary>
+		/// <exception cref="std::exception">Thrown if the key is not present</exception>
+		/// <param name="key">Key</param>
+		/// <returns>A reference to the mapped value for the given key if found</returns>
+		template <typename TLookup, typename = EnableIfTransparent<TLookup>>
+		const TValue& At(const TLookup& key) const;
+
+		/// <summary>
+		/// Looks for the given key in the collection
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <returns>Iterator to the value if found, end iterator otherwise</returns>
+		Iterator Find(const TKey& key);
+
+		/// <summary>
+		/// Looks for the given key in the collection
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <returns>Iterator to the value if found, end iterator otherwise</returns>
+		ConstIterator Find(const TKey& key) const;
+
+		/// <summary>
+		/// Looks for a key of another type without converting it to TKey, only available
+		/// when the hash functor and key comparator are transparent (e.g. std::string_view on std::string keys)
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <returns>Iterator to the value if found, end iterator otherwise</returns>
+		template <typename TLookup, typename = EnableIfTransparent<TLookup>>
+		Iterator Find(const TLookup& key);
+
+		/// <summary>
+		/// Looks for a key of another type without converting it to TKey, only available
+		/// when the hash functor and key comparator are transparent (e.g. std::string_view on std::string keys)
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <returns>Iterator to the value if found, end iterator otherwise</returns>
+		template <typename TLookup, typename = EnableIfTransparent<TLookup>>
+		ConstIterator Find(const TLookup& key) const;
+
+		/// <summary>
+		/// Checks if the given key is present in the collection
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <returns>True if present, false otherwise</returns>
+		bool ContainsKey(const TKey& key) const;
+
+		/// <summary>
+		/// Checks if the given key is present in the collection
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <param name="it">Iterator to output if found</param>
+		/// <returns>True if present, false otherwise</returns>
+		bool ContainsKey(const TKey& key, Iterator& out);
+
+		/// <summary>
+		/// Checks if the given key is present in the collection
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <param name="it">Iterator to output if found</param>
+		/// <returns>True if present, false otherwise</returns>
+		bool ContainsKey(const TKey& key, ConstIterator& out) const;
+
+		/// <summary>
+		/// Checks if a key of another type is present, only available when
+		/// the hash functor and key comparator are transparent
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <returns>True if present, false otherwise</returns>
+		template <typename TLookup, typename = EnableIfTransparent<TLookup>>
+		bool ContainsKey(const TLookup& key) const;
+
+		/// <summary>
+		/// Checks if a key of another type is present, only available when
+		/// the hash functor and key comparator are transparent
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <param name="it">Iterator to output if found</param>
+		/// <returns>True if present, false otherwise</returns>
+		template <typename TLookup, typename = EnableIfTransparent<TLookup>>
+		bool ContainsKey(const TLookup& key, Iterator& out);
+
+		/// <summary>
+		/// Checks if a key of another type is present, only available when
+		/// the hash functor and key comparator are transparent
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <param name="it">Iterator to output if found</param>
+		/// <returns>True if present, false otherwise</returns>
+		template <typename TLookup, typename = EnableIfTransparent<TLookup>>
+		bool ContainsKey(const TLookup& key, ConstIterator& out) const;
+
+		/// <summary>
+		/// Gets the number of elements in the collection
+		/// </summary>
+		/// <returns>Number of elements in the collection</returns>
+		size_t Size() const;
+
+		/// <summary>
+		/// Checks if the collection is empty
+		/// </summary>
+		/// <returns>True if empty, false otherwise</returns>
+		bool IsEmpty() const;
+
+		/// <summary>
+		/// Gets the number of displacement seeds, one per bucket
+		/// </summary>
+		/// <returns>Number of buckets</returns>
+		size_t BucketCount() const;
+
+		/// <summary>
+		/// Gets an iterator to the first element in the collection
+		/// </summary>
+		/// <returns>Iterator to the first element</returns>
+		Iterator begin();
+
+		/// <summary>
+		/// Gets an iterator to the first element in the collection
+		/// </summary>
+		/// <returns>Iterator to the first element</returns>
+		ConstIterator begin() const;
+
+		/// <summary>
+		/// Gets an iterator past the last element in the collection
+		/// </summary>
+		/// <returns>Iterator past the last element</returns>
+		Iterator end();
+
+		/// <summary>
+		/// Gets an iterator past the last element in the collection
+		/// </summary>
+		/// <returns>Iterator past the last element</returns>
+		ConstIterator end() const;
+
+		/// <summary>
+		/// Gets an iterator to the first element in the collection
+		/// </summary>
+		/// <returns>Iterator to the first element</returns>
+		ConstIterator cbegin() const;
+
+		/// <summary>
+		/// Gets an iterator past the last element in the collection
+		/// </summary>
+		/// <returns>Iterator past the last element</returns>
+		ConstIterator cend() const;
+
+	private:
+		/// <summary>
+		/// Pairs in slot order
+		/// </summary>
+		EntryListType mEntries;
+
+		/// <summary>
+		/// One seed per bucket: a negative seed is the slot of a single key bucket encoded as -(slot + 1),
+		/// any other seed is mixed into the hash of the bucket's keys to pick their slots
+		/// </summary>
+		Vector<std::int32_t> mSeeds;
+
+		/// <summary>
+		/// Full hashes of the overflow pairs, the last ones in mEntries, in the same order
+		/// </summary>
+		Vector<size_t> mOverflowHashes;
+
+		/// <summary>
+		/// Hash functor
+		/// </summary>
+		FIEA_NO_UNIQUE_ADDRESS THashFunctor mHashFunctor;
+
+		/// <summary>
+		/// Key comparator
+		/// </summary>
+		FIEA_NO_UNIQUE_ADDRESS TKeyComparator mKeyComparator;
+
+		/// <summary>
+		/// Places the given pairs, every key gets its own slot
+		/// </summary>
+		/// <exception cref="std::exception">Thrown if two pairs have the same key or no seed separates the keys of a bucket</exception>
+		/// <param name="pairs">Pairs to place, moved from</param>
+		void Build(EntryListType& pairs);
+
+		/// <summary>
+		/// Hashes the given key, mixing the result first if the functor is not avalanching
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <returns>Mixed hash of the key</returns>
+		template <typename TLookup>
+		size_t Hash(const TLookup& key) const;
+
+		/// <summary>
+		/// Gets the slot a hash lands on with the given displacement seed
+		/// </summary>
+		/// <param name="hash">Mixed hash</param>
+		/// <param name="seed">Non negative seed</param>
+		/// <param name="slotCount">Number of slots, below 2^32</param>
+		/// <returns>Slot</returns>
+		static size_t Displace(size_t hash, std::int32_t seed, size_t slotCount);
+
+		/// <summary>
+		/// Looks for the slot holding the given key
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <returns>Slot of the key if found, the size otherwise</returns>
+		template <typename TLookup>
+		size_t FindSlot(const TLookup& key) const;
+	};
+}
+
+#include "FrozenHashMap.inl"
@@ -0,0 +1,438 @@
+#include "FrozenHashMap.h"
+#include <algorithm>
+
+namespace FieaGameEngine
+{
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	inline FrozenHashMap<TKey, TValue, THashFunctor, TKeyComparator>::FrozenHashMap(std::initializer_list<PairType> list) :
+		FrozenHashMap(list.begin(), list.end())
+	{
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	template <typename TInputIterator>
+	FrozenHashMap<TKey, TValue, THashFunctor, TKeyComparator>::FrozenHashMap(TInputIterator first, TInputIterator last)
+	{
+		EntryListType pairs;
+		pairs.Append(first, last);
+		Build(pairs);
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	TValue& FrozenHashMap<TKey, TValue, THashFunctor, TKeyComparator>::At(const TKey& key)
+	{
+		const size_t slot = FindSlot(key);
+
+		if (slot == mEntries.Size())
+		{
+			throw std::exception("Key not found.");
+		}
+
+		return mEntries[slot].second;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	const TValue& FrozenHashMap<TKey, TValue, THashFunctor, TKeyComparator>::At(const TKey& key) const
+	{
+		const size_t slot = FindSlot(key);
+
+		if (slot == mEntries.Size())
+		{
+			throw std::exception("Key not found.");
+		}
+
+		return mEntries[slot].second;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	template <typename TLookup, typename>
+	TValue& FrozenHashMap<TKey, TValue, THashFunctor, TKeyComparator>::At(const TLookup& key)
+	{
+		const size_t slot = FindSlot(key);
+
+		if (slot == mEntries.Size())
+		{
+			throw std::exception("Key not found.");
+		}
+
+		return mEntries[slot].second;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	template <typename TLookup, typename>
+	const TValue& FrozenHashMap<TKey, TValue, THashFunctor, TKeyComparator>::At(const TLookup& key) const
+	{
+		const size_t slot = FindSlot(key);
+
+		if (slot == mEntries.Size())
+		{
+			throw std::exception("Key not found.");
+		}
+
+		return mEntries[slot].second;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	inline typename FrozenHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Iterator FrozenHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Find(const TKey& key)
+	{
+		return mEntries.begin() + FindSlot(key);
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	inline typename FrozenHashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator FrozenHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Find(const TKey& key) const
+	{
+		return mEntries.begin() + FindSlot(key);
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	template <typename TLookup, typename>
+	inline typename FrozenHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Iterator FrozenHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Find(const TLookup& key)
+	{
+		return mEntries.begin() + FindSlot(key);
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	template <typename TLookup, typename>
+	inline typename FrozenHashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator FrozenHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Find(const TLookup& key) const
+	{
+		return mEntries.begin() + FindSlot(key);
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	inline bool FrozenHashMap<TKey, TValue, THashFunctor, TKeyComparator>::ContainsKey(const TKey& key) const
+	{
+		return FindSlot(key) != mEntries.Size();
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	inline bool FrozenHashMap<TKey, TValue, THashFunctor, TKeyComparator>::ContainsKey(const TKey& key, Iterator& out)
+	{
+		out = Find(key);
+		return out != end();
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	inline bool FrozenHashMap<TKey, TValue, THashFunctor, TKeyComparator>::ContainsKey(const TKey& key, ConstIterator& out) const
+	{
+		out = Find(key);
+		return out != end();
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	template <typename TLookup, typename>
+	inline bool FrozenHashMap<TKey, TValue, THashFunctor, TKeyComparator>::ContainsKey(const TLookup& key) const
+	{
+		return FindSlot(key) != mEntries.Size();
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	template <typename TLookup, typename>
+	inline bool FrozenHashMap<TKey, TValue, THashFunctor, TKeyComparator>::ContainsKey(const TLookup& key, Iterator& out)
+	{
+		out = Find(key);
+		return out != end();
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	template <typename TLookup, typename>
+	inline bool FrozenHashMap<TKey, TValue, THashFunctor, TKeyComparator>::ContainsKey(const TLookup& key, ConstIterator& out) const
+	{
+		out = Find(key);
+		return out != end();
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	inline size_t FrozenHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Size() const
+	{
+		return mEntries.Size();
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	inline bool FrozenHashMap<TKey, TValue, THashFunctor, TKeyComparator>::IsEmpty() const
+	{
+		return mEntries.IsEmpty();
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	inline size_t FrozenHashMap<TKey, TValue, THashFunctor, TKeyComparator>::BucketCount() const
+	{
+		return mSeeds.Size();
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	inline typename FrozenHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Iterator FrozenHashMap<TKey, TValue, THashFunctor, TKeyComparator>::begin()
+	{
+		return mEntries.begin();
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	inline typename FrozenHashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator FrozenHashMap<TKey, TValue, THashFunctor, TKeyComparator>::begin() const
+	{
+		return mEntries.begin();
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	inline typename FrozenHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Iterator FrozenHashMap<TKey, TValue, THashFunctor, TKeyComparator>::end()
+	{
+		return mEntries.end();
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	inline typename FrozenHashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator FrozenHashMap<TKey, TValue, THashFunctor, TKeyComparator>::end() const
+	{
+		return mEntries.end();
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	inline typename FrozenHashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator FrozenHashMap<TKey, TValue, THashFunctor, TKeyComparator>::cbegin() const
+	{
+		return mEntries.cbegin();
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	inline typename FrozenHashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator FrozenHashMap<TKey, TValue, THashFunctor, TKeyComparator>::cend() const
+	{
+		return mEntries.cend();
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	void FrozenHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Build(EntryListType& pairs)
+	{
+		const size_t count = pairs.Size();
+		if (count == 0)
+		{
+			return;
+		}
+
+		Vector<size_t> hashes(count);
+		for (const PairType& pair : pairs)
+		{
+			hashes.PushBack(Hash(pair.first));
+		}
+
+		// keys with the same full hash land on the same slot whatever the seed, so all but the first
+		// of them are set aside in the overflow, past the slots of the perfect hash
+		Vector<size_t> byHash(count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			byHash.PushBack(i);
+		}
+
+		const auto byHashSpan = byHash.AsSpan();
+		std::sort(byHashSpan.begin(), byHashSpan.end(), [&hashes](size_t left, size_t right)
+		{
+			return hashes[left] < hashes[right] || (hashes[left] == hashes[right] && left < right);
+		});
+
+		Vector<size_t> primary(count);
+		Vector<size_t> overflow;
+		for (size_t run = 0; run < count; )
+		{
+			size_t runEnd = run + 1;
+			while (runEnd < count && hashes[byHash[runEnd]] == hashes[byHash[run]])
+			{
+				for (size_t i = run; i < runEnd; ++i)
+				{
+					if (mKeyComparator(pairs[byHash[runEnd]].first, pairs[byHash[i]].first))
+					{
+						throw std::exception("Duplicate key.");
+					}
+				}
+
+				overflow.PushBack(byHash[runEnd]);
+				++runEnd;
+			}
+
+			primary.PushBack(byHash[run]);
+			run = runEnd;
+		}
+
+		const size_t slotCount = primary.Size();
+
+		// a power of two, so a lookup picks the bucket with a mask instead of a division
+		size_t bucketCount = 1;
+		while (bucketCount * BucketLoad < slotCount)
+		{
+			bucketCount <<= 1;
+		}
+
+		const size_t bucketMask = bucketCount - 1;
+
+		// counting sort of the keys by bucket
+		Vector<size_t> bucketStart;
+		bucketStart.EmplaceBackN(bucketCount + 1, size_t(0));
+		for (size_t key : primary)
+		{
+			++bucketStart[(hashes[key] & bucketMask) + 1];
+		}
+
+		for (size_t bucket = 0; bucket < bucketCount; ++bucket)
+		{
+			bucketStart[bucket + 1] += bucketStart[bucket];
+		}
+
+		Vector<size_t> members;
+		members.EmplaceBackN(slotCount, size_t(0));
+		{
+			Vector<size_t> next(bucketStart);
+			for (size_t key : primary)
+			{
+				members[next[hashes[key] & bucketMask]++] = key;
+			}
+		}
+
+		// biggest buckets first, while most of the slots are still free
+		Vector<size_t> order(bucketCount);
+		for (size_t bucket = 0; bucket < bucketCount; ++bucket)
+		{
+			order.PushBack(bucket);
+		}
+
+		const auto orderSpan = order.AsSpan();
+		std::sort(orderSpan.begin(), orderSpan.end(), [&bucketStart](size_t left, size_t right)
+		{
+			return bucketStart[left + 1] - bucketStart[left] > bucketStart[right + 1] - bucketStart[right];
+		});
+
+		mSeeds.EmplaceBackN(bucketCount, std::int32_t(0));
+		Vector<size_t> slotOf;
+		slotOf.EmplaceBackN(count, count);
+		Vector<std::uint8_t> taken;
+		taken.EmplaceBackN(slotCount, std::uint8_t(0));
+		size_t freeSlot = 0;
+
+		for (size_t bucket : order)
+		{
+			const size_t first = bucketStart[bucket];
+			const size_t size = bucketStart[bucket + 1] - first;
+			if (size == 0)
+			{
+				break;
+			}
+
+			if (size == 1)
+			{
+				// a lone key needs no seed search, it takes the next free slot directly
+				while (taken[freeSlot] != 0)
+				{
+					++freeSlot;
+				}
+
+				taken[freeSlot] = 1;
+				slotOf[members[first]] = freeSlot;
+				mSeeds[bucket] = -static_cast<std::int32_t>(freeSlot) - 1;
+				continue;
+			}
+
+			for (std::int32_t seed = 0; ; ++seed)
+			{
+				if (seed == MaxSeed)
+				{
+					throw std::exception("No displacement seed separates the keys of a bucket.");
+				}
+
+				size_t placed = 0;
+				for (; placed < size; ++placed)
+				{
+					const size_t slot = Displace(hashes[members[first + placed]], seed, slotCount);
+					if (taken[slot] != 0)
+					{
+						break;
+					}
+
+					taken[slot] = 1;
+					slotOf[members[first + placed]] = slot;
+				}
+
+				if (placed == size)
+				{
+					mSeeds[bucket] = seed;
+					break;
+				}
+
+				for (size_t i = 0; i < placed; ++i)
+				{
+					taken[slotOf[members[first + i]]] = 0;
+				}
+			}
+		}
+
+		mOverflowHashes.Reserve(overflow.Size());
+		for (size_t i = 0; i < overflow.Size(); ++i)
+		{
+			slotOf[overflow[i]] = slotCount + i;
+			mOverflowHashes.PushBack(hashes[overflow[i]]);
+		}
+
+		Vector<size_t> keyAt;
+		keyAt.EmplaceBackN(count, size_t(0));
+		for (size_t i = 0; i < count; ++i)
+		{
+			keyAt[slotOf[i]] = i;
+		}
+
+		mEntries.Reserve(count);
+		for (size_t slot = 0; slot < count; ++slot)
+		{
+			mEntries.EmplaceBack(std::move(pairs[keyAt[slot]]));
+		}
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	template <typename TLookup>
+	inline size_t FrozenHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Hash(const TLookup& key) const
+	{
+		const size_t hash = mHashFunctor(key);
+
+		if constexpr (IsAvalanchingHash<THashFunctor>::value)
+		{
+			return hash;
+		}
+		else
+		{
+			return static_cast<size_t>(MixHash(hash));
+		}
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	inline size_t FrozenHashMap<TKey, TValue, THashFunctor, TKeyComparator>::Displace(size_t hash, std::int32_t seed, size_t slotCount)
+	{
+		// the bucket comes from the low bits of the hash, the slot from the high bits of a seeded multiply,
+		// scaled into the slot count with another multiply rather than a division
+		const std::uint64_t mixed = (static_cast<std::uint64_t>(hash) ^ (static_cast<std::uint64_t>(seed) * 0x9E3779B97F4A7C15ULL)) * 0xBF58476D1CE4E5B9ULL;
+
+		return static_cast<size_t>(((mixed >> 32) * static_cast<std::uint64_t>(slotCount)) >> 32);
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	template <typename TLookup>
+	inline size_t FrozenHashMap<TKey, TValue, THashFunctor, TKeyComparator>::FindSlot(const TLookup& key) const
+	{
+		const size_t count = mEntries.Size();
+		if (count == 0)
+		{
+			return 0;
+		}
+
+		const size_t slotCount = count - mOverflowHashes.Size();
+		const size_t hash = Hash(key);
+		const std::int32_t seed = mSeeds[hash & (mSeeds.Size() - 1)];
+		const size_t slot = seed < 0 ? static_cast<size_t>(-(seed + 1)) : Displace(hash, seed, slotCount);
+
+		if (mKeyComparator(key, mEntries[slot].first))
+		{
+			return slot;
+		}
+
+		// only keys sharing a full hash with another key live here, the list is empty for any decent hash
+		for (size_t i = 0; i < mOverflowHashes.Size(); ++i)
+		{
+			if (mOverflowHashes[i] == hash && mKeyComparator(key, mEntries[slotCount + i].first))
+			{
+				return slotCount + i;
+			}
+		}
+
+		return count;
+	}
+}
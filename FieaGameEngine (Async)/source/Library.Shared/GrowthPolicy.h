@@ -0,0 +1,137 @@
+#pragma once
+
+/// \file GrowthPolicy.h
+/// \brief Definition of the capacity growth policies of Vector
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include "Utility.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Growth policy multiplying the capacity by DefaultIncrementMultiplier plus one, which is what
+	/// Vector always did. Any policy given to Vector is called with the current size and capacity
+	/// and returns a capacity greater than the current one. Empty policies take no room in the vector
+	/// and are called directly, so growth costs no indirect call
+	/// </summary>
+	class GeometricGrowth final
+	{
+	public:
+		/// <summary>
+		/// Computes the next capacity
+		/// </summary>
+		/// <param name="size">Current number of elements</param>
+		/// <param name="capacity">Current capacity</param>
+		/// <returns>The new capacity</returns>
+		size_t operator()(size_t size, size_t capacity) const;
+	};
+
+	/// <summary>
+	/// Growth policy adding the same number of elements every time, for vectors whose final
+	/// size is roughly known and should not overshoot it by much
+	/// </summary>
+	template <size_t Step>
+	class FixedStepGrowth final
+	{
+		static_assert(Step > 0, "A fixed step growth needs a step of at least one element.");
+
+	public:
+		/// <summary>
+		/// Computes the next capacity
+		/// </summary>
+		/// <param name="size">Current number of elements</param>
+		/// <param name="capacity">Current capacity</param>
+		/// <returns>The current capacity plus Step</returns>
+		size_t operator()(size_t size, size_t capacity) const;
+	};
+
+	/// <summary>
+	/// Growth policy doubling the capacity, what SmallVector grows by once it leaves its inline storage
+	/// </summary>
+	class DoublingGrowth final
+	{
+	public:
+		/// <summary>
+		/// Computes the next capacity
+		/// </summary>
+		/// <param name="size">Current number of elements</param>
+		/// <param name="capacity">Current capacity</param>
+		/// <returns>Twice the current capacity, one if it is zero</returns>
+		size_t operator()(size_t size, size_t capacity) const;
+	};
+
+	/// <summary>
+	/// Growth policy keeping the capacity a power of two, so it can be used as a mask
+	/// </summary>
+	class PowerOfTwoGrowth final
+	{
+	public:
+		/// <summary>
+		/// Computes the next capacity
+		/// </summary>
+		/// <param name="size">Current number of elements</param>
+		/// <param name="capacity">Current capacity</param>
+		/// <returns>The smallest power of two greater than the current capacity</returns>
+		size_t operator()(size_t size, size_t capacity) const;
+	};
+
+	/// <summary>
+	/// Growth policy for vectors that must never reallocate once reserved, so pointers to their
+	/// elements stay valid. Running out of room throws instead
+	/// </summary>
+	class NoGrowth final
+	{
+	public:
+		/// <summary>
+		/// Always throws
+		/// </summary>
+		/// <param name="size">Current number of elements</param>
+		/// <param name="capacity">Current capacity</param>
+		/// <returns>Never returns</returns>
+		size_t operator()(size_t size, size_t capacity) const;
+	};
+
+	/// <summary>
+	/// Growth policy calling a strategy chosen at run time, the way every Vector used to.
+	/// It pays for a std::function in every vector and an indirect call on every growth
+	/// </summary>
+	class CallbackGrowth final
+	{
+	public:
+		/// <summary>
+		/// Signature of the strategies
+		/// </summary>
+		using CallbackType = std::function<size_t(size_t, size_t)>;
+
+		/// <summary>
+		/// Creates a policy calling the given strategy
+		/// </summary>
+		/// <param name="callback">Strategy taking the size and capacity and returning the new capacity</param>
+		template <typename TCallback, typename = std::enable_if_t<!std::is_same_v<std::decay_t<TCallback>, CallbackGrowth>>>
+		CallbackGrowth(TCallback&& callback);
+
+		/// <summary>
+		/// Creates a policy calling GeometricGrowth
+		/// </summary>
+		CallbackGrowth();
+
+		/// <summary>
+		/// Computes the next capacity
+		/// </summary>
+		/// <param name="size">Current number of elements</param>
+		/// <param name="capacity">Current capacity</param>
+		/// <returns>Whatever the strategy returns</returns>
+		size_t operator()(size_t size, size_t capacity) const;
+
+	private:
+		/// <summary>
+		/// The strategy
+		/// </summary>
+		CallbackType mCallback;
+	};
+}
+
+#include "GrowthPolicy.inl"
@@ -0,0 +1,56 @@
+/// \file GrowthPolicy.inl
+/// \brief Implementation of the capacity growth policies of Vector
+
+#include "GrowthPolicy.h"
+#include <exception>
+
+namespace FieaGameEngine
+{
+	inline size_t GeometricGrowth::operator()(size_t, size_t capacity) const
+	{
+		return static_cast<size_t>((capacity * DefaultIncrementMultiplier) + 1);
+	}
+
+	template <size_t Step>
+	inline size_t FixedStepGrowth<Step>::operator()(size_t, size_t capacity) const
+	{
+		return capacity + Step;
+	}
+
+	inline size_t DoublingGrowth::operator()(size_t, size_t capacity) const
+	{
+		return capacity > 0 ? capacity * 2 : 1;
+	}
+
+	inline size_t PowerOfTwoGrowth::operator()(size_t, size_t capacity) const
+	{
+		size_t newCapacity = 1;
+		while (newCapacity <= capacity)
+		{
+			newCapacity <<= 1;
+		}
+
+		return newCapacity;
+	}
+
+	inline size_t NoGrowth::operator()(size_t, size_t) const
+	{
+		throw std::exception("This vector cannot grow past its reserved capacity.");
+	}
+
+	template <typename TCallback, typename>
+	inline CallbackGrowth::CallbackGrowth(TCallback&& callback) :
+		mCallback(std::forward<TCallback>(callback))
+	{
+	}
+
+	inline CallbackGrowth::CallbackGrowth() :
+		mCallback(GeometricGrowth())
+	{
+	}
+
+	inline size_t CallbackGrowth::operator()(size_t size, size_t capacity) const
+	{
+		return mCallback(size, capacity);
+	}
+}
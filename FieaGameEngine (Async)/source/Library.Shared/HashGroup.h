@@ -0,0 +1,122 @@
+#pragma once
+
+/// \file HashGroup.h
+/// \brief Definition of HashGroup class
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__AVX2__)
+#define FIEA_HASH_GROUP_AVX2
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define FIEA_HASH_GROUP_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// A run of one byte control tags probed together by the open addressing containers.
+	/// Compares the whole run against a tag in one step with SSE2 (16 tags) or AVX2 (32 tags)
+	/// when the target supports them, and falls back to eight tags per word otherwise
+	/// </summary>
+	class HashGroup final
+	{
+	public:
+		using ControlType = std::int8_t;
+
+		/// <summary>
+		/// Number of tags in a group
+		/// </summary>
+#if defined(FIEA_HASH_GROUP_AVX2)
+		static constexpr size_t Width = 32;
+#else
+		static constexpr size_t Width = 16;
+#endif
+
+		/// <summary>
+		/// Tag of a slot that was never used
+		/// </summary>
+		static constexpr ControlType Empty = -128;
+
+		/// <summary>
+		/// Tag of a slot whose element was removed (tombstone)
+		/// </summary>
+		static constexpr ControlType Deleted = -2;
+
+		/// <summary>
+		/// Loads a group of tags, the tags do not need any particular alignment
+		/// </summary>
+		/// <param name="tags">First tag of the group</param>
+		explicit HashGroup(const ControlType* tags);
+
+		/// <summary>
+		/// Builds a bit mask of the tags equal to the given one
+		/// </summary>
+		/// <param name="tag">Tag to look for, must be a full tag (0 to 127)</param>
+		/// <returns>Bit i is set if tag i matched, the fallback may also flag a tag right after a match</returns>
+		std::uint32_t Match(ControlType tag) const;
+
+		/// <summary>
+		/// Builds a bit mask of the empty tags
+		/// </summary>
+		/// <returns>Bit i is set if tag i is empty</returns>
+		std::uint32_t MatchEmpty() const;
+
+		/// <summary>
+		/// Builds a bit mask of the empty or deleted tags
+		/// </summary>
+		/// <returns>Bit i is set if tag i is not full</returns>
+		std::uint32_t MatchEmptyOrDeleted() const;
+
+		/// <summary>
+		/// Gets the index of the lowest set bit of a non zero mask
+		/// </summary>
+		/// <param name="mask">Mask</param>
+		/// <returns>Index of the lowest set bit</returns>
+		static size_t LowestBit(std::uint32_t mask);
+
+	private:
+#if defined(FIEA_HASH_GROUP_AVX2)
+		/// <summary>
+		/// The tags of this group
+		/// </summary>
+		__m256i mTags;
+#elif defined(FIEA_HASH_GROUP_SSE2)
+		/// <summary>
+		/// The tags of this group
+		/// </summary>
+		__m128i mTags;
+#else
+		/// <summary>
+		/// Low bit of every byte in a word of tags
+		/// </summary>
+		static constexpr std::uint64_t Lsbs = 0x0101010101010101ULL;
+
+		/// <summary>
+		/// High bit of every byte in a word of tags
+		/// </summary>
+		static constexpr std::uint64_t Msbs = 0x8080808080808080ULL;
+
+		/// <summary>
+		/// Packs the high bit of each byte of a word into an eight bit mask
+		/// </summary>
+		/// <param name="highBits">Word with only byte high bits set</param>
+		/// <returns>Bit i is set if byte i had its high bit set</returns>
+		static std::uint32_t Compress(std::uint64_t highBits);
+
+		/// <summary>
+		/// The tags of this group, eight per word
+		/// </summary>
+		std::uint64_t mTags[Width / sizeof(std::uint64_t)];
+#endif
+	};
+}
+
+#include "HashGroup.inl"
@@ -0,0 +1,124 @@
+#include "HashGroup.h"
+
+namespace FieaGameEngine
+{
+#if defined(FIEA_HASH_GROUP_AVX2)
+
+	inline HashGroup::HashGroup(const ControlType* tags) :
+		mTags(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(tags)))
+	{
+	}
+
+	inline std::uint32_t HashGroup::Match(ControlType tag) const
+	{
+		return static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(mTags, _mm256_set1_epi8(tag))));
+	}
+
+	inline std::uint32_t HashGroup::MatchEmpty() const
+	{
+		return static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(mTags, _mm256_set1_epi8(Empty))));
+	}
+
+	inline std::uint32_t HashGroup::MatchEmptyOrDeleted() const
+	{
+		// full tags are the only ones with the high bit clear
+		return static_cast<std::uint32_t>(_mm256_movemask_epi8(mTags));
+	}
+
+#elif defined(FIEA_HASH_GROUP_SSE2)
+
+	inline HashGroup::HashGroup(const ControlType* tags) :
+		mTags(_mm_loadu_si128(reinterpret_cast<const __m128i*>(tags)))
+	{
+	}
+
+	inline std::uint32_t HashGroup::Match(ControlType tag) const
+	{
+		return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(mTags, _mm_set1_epi8(tag))));
+	}
+
+	inline std::uint32_t HashGroup::MatchEmpty() const
+	{
+		return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(mTags, _mm_set1_epi8(Empty))));
+	}
+
+	inline std::uint32_t HashGroup::MatchEmptyOrDeleted() const
+	{
+		// full tags are the only ones with the high bit clear
+		return static_cast<std::uint32_t>(_mm_movemask_epi8(mTags));
+	}
+
+#else
+
+	inline HashGroup::HashGroup(const ControlType* tags)
+	{
+		std::memcpy(mTags, tags, Width);
+	}
+
+	inline std::uint32_t HashGroup::Match(ControlType tag) const
+	{
+		// classic zero byte test, it may flag the byte right above a real match too,
+		// which is harmless since every candidate gets its key compared
+		const std::uint64_t pattern = Lsbs * static_cast<std::uint8_t>(tag);
+
+		std::uint32_t mask = 0;
+		for (size_t i = 0; i < Width / sizeof(std::uint64_t); ++i)
+		{
+			const std::uint64_t word = mTags[i] ^ pattern;
+			mask |= Compress((word - Lsbs) & ~word & Msbs) << (i * sizeof(std::uint64_t));
+		}
+
+		return mask;
+	}
+
+	inline std::uint32_t HashGroup::MatchEmpty() const
+	{
+		// empty is the only tag with the high bit set and bit one clear
+		std::uint32_t mask = 0;
+		for (size_t i = 0; i < Width / sizeof(std::uint64_t); ++i)
+		{
+			mask |= Compress(mTags[i] & ~(mTags[i] << 6) & Msbs) << (i * sizeof(std::uint64_t));
+		}
+
+		return mask;
+	}
+
+	inline std::uint32_t HashGroup::MatchEmptyOrDeleted() const
+	{
+		std::uint32_t mask = 0;
+		for (size_t i = 0; i < Width / sizeof(std::uint64_t); ++i)
+		{
+			mask |= Compress(mTags[i] & Msbs) << (i * sizeof(std::uint64_t));
+		}
+
+		return mask;
+	}
+
+	inline std::uint32_t HashGroup::Compress(std::uint64_t highBits)
+	{
+		// gathers the high bit of every byte into the low eight bits
+		return static_cast<std::uint32_t>(((highBits >> 7) * 0x0102040810204080ULL) >> 56);
+	}
+
+#endif
+
+	inline size_t HashGroup::LowestBit(std::uint32_t mask)
+	{
+#if defined(_MSC_VER)
+		unsigned long index;
+		_BitScanForward(&index, mask);
+		return index;
+#elif defined(__GNUC__)
+		return static_cast<size_t>(__builtin_ctz(mask));
+#else
+		size_t index = 0;
+		while ((mask & 1U) == 0)
+		{
+			mask >>= 1;
+			++index;
+		}
+
+		return index;
+#endif
+	}
+}
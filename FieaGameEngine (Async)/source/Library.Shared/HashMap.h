@@ -2,7 +2,9 @@
 
 #include <cstddef>
 #include <exception>
+#include <stdexcept>
 #include <initializer_list>
+#include <type_traits>
 #include <tuple>
 #include <cmath>
 #include "vector.h"
@@ -13,26 +15,50 @@
 namespace FieaGameEngine
 {
 	/// <summary>
-	/// Map like container, stores key value pairs where the keys are unique
+	/// Map like container, stores key value pairs where the keys are unique.
+	/// Grows by itself once an insertion takes the load factor past the max load factor, the
+	/// entries are then moved to the bigger bucket array a few buckets per insertion so no
+	/// single insertion pays for a whole rehash. Each insertion moves enough buckets for the growth
+	/// to be done before the insertion that starts the next one, about 1 / max load factor buckets
+	/// right after a doubling and never fewer than two. Entries are spliced between chains, never
+	/// copied, so pointers to the pairs stay valid for as long as they are in the map.
+	/// Chain entries come from the slab pools by default, see SlabAllocator
 	/// </summary>
 	template 
 		<typename TKey, 
 		typename TValue, 
 		typename THashFunctor = DefaultHash<TKey>, 
-		typename TKeyComparator = DefaultComparator<TKey>>
+		typename TKeyComparator = DefaultComparator<TKey>,
+		typename TAllocator = SlabAllocator<>>
 	class HashMap final
 	{
 	public:
 		using PairType = std::pair<const TKey, TValue>;
 
 	private:
-		using ChainType = SList<PairType>;
-		using BucketType = Vector<ChainType>;
+		/// <summary>
+		/// What a chain stores: the pair plus the full hash of its key, so rehashing never
+		/// calls the hash functor again and lookups only compare keys when the hashes match
+		/// </summary>
+		struct ChainEntry final
+		{
+			template <typename... Args>
+			explicit ChainEntry(size_t hash, Args&&... args);
+
+			PairType Pair;
+			size_t Hash;
+		};
+
+		using ChainType = SList<ChainEntry, TAllocator>;
+		using BucketType = Vector<ChainType, DefaultComparator<ChainType>, TAllocator>;
 		using BucketIterator = typename BucketType::Iterator;
 		using BucketConstIterator = typename BucketType::ConstIterator;
 		using ChainIterator = typename ChainType::Iterator;
 		using ChainConstIterator = typename ChainType::ConstIterator;
 
+		template <typename TLookup>
+		using EnableIfTransparent = std::enable_if_t<IsTransparentKey<THashFunctor, TKeyComparator, TLookup>::value>;
+
 	public:
 		/// <summary>
 		/// Allows to sequentally access the elements of this collection
@@ -315,10 +341,12 @@ namespace FieaGameEngine
 		};
 
 		/// <summary>
-		/// Constructs hashmap with the given number of buckets
+		/// Constructs hashmap with the given number of buckets, rounded up to a power of two
+		/// when the hash functor is avalanching
 		/// </summary>
 		/// <param name="bucketCount">Number of buckets</param>
-		explicit HashMap(size_t bucketCount = 16);
+		/// <param name="allocator">Allocator for the buckets and the chain entries</param>
+		explicit HashMap(size_t bucketCount = 16, const TAllocator& allocator = TAllocator());
 
 		/// <summary>
 		/// Default copy constructor
@@ -339,11 +367,11 @@ namespace FieaGameEngine
 		HashMap(std::initializer_list<PairType> list);
 
 		/// <summary>
-		/// Default copy assignment
+		/// Copy assignment, the map keeps its own allocator
 		/// </summary>
-		/// <param name="map"></param>
+		/// <param name="other">Map</param>
 		/// <returns>Reference to self</returns>
-		HashMap& operator=(const HashMap&) = default;
+		HashMap& operator=(const HashMap& other);
 
 		/// <summary>
 		/// Move assignment
@@ -396,6 +424,26 @@ namespace FieaGameEngine
 		/// <returns>A reference to the mapped value for the given key if found</returns>
 		const TValue& At(const TKey& key) const;
 
+		/// <summary>
+		/// Gets a reference to the mapped value for a key of another type, only available
+		/// when the hash functor and key comparator are transparent (e.g. std::string_view on std::string keys)
+		/// </summary>
+		/// <exception cref="std::exception">Thrown if the key is not present</exception>
+		/// <param name="key">Key</param>
+		/// <returns>A reference to the mapped value for the given key if found</returns>
+		template <typename TLookup, typename = EnableIfTransparent<TLookup>>
+		TValue& At(const TLookup& key);
+
+		/// <summary>
+		/// Gets a reference to the mapped value for a key of another type, only available
+		/// when the hash functor and key comparator are transparent (e.g. std::string_view on std::string keys)
+		/// </summary>
+		/// <exception cref="std::exception">Thrown if the key is not present</exception>
+		/// <param name="key">Key</param>
+		/// <returns>A reference to the mapped value for the given key if found</returns>
+		template <typename TLookup, typename = EnableIfTransparent<TLookup>>
+		const TValue& At(const TLookup& key) const;
+
 		/// <summary>
 		/// Adds a key value pair to the collection, if the given key is
 		/// already present then nothing is done
@@ -435,6 +483,24 @@ namespace FieaGameEngine
 		/// <returns>Iterator to the value if found, end iterator otherwise</returns>
 		ConstIterator Find(const TKey& key) const;
 
+		/// <summary>
+		/// Looks for a key of another type without converting it to TKey, only available
+		/// when the hash functor and key comparator are transparent (e.g. std::string_view on std::string keys)
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <returns>Iterator to the value if found, end iterator otherwise</returns>
+		template <typename TLookup, typename = EnableIfTransparent<TLookup>>
+		Iterator Find(const TLookup& key);
+
+		/// <summary>
+		/// Looks for a key of another type without converting it to TKey, only available
+		/// when the hash functor and key comparator are transparent (e.g. std::string_view on std::string keys)
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <returns>Iterator to the value if found, end iterator otherwise</returns>
+		template <typename TLookup, typename = EnableIfTransparent<TLookup>>
+		ConstIterator Find(const TLookup& key) const;
+
 		/// <summary>
 		/// Removes the pair with the given key
 		/// </summary>
@@ -457,14 +523,15 @@ namespace FieaGameEngine
 
 		/// <summary>
 		/// Sets the number of buckets to the number needed to accomodate at least count elements 
-		/// without exceeding maximum load factor and rehashes the container
+		/// without exceeding maximum load factor and rehashes the container. Never shrinks the buckets
 		/// </summary>
 		/// <param name="count">Number of elements</param>
 		void Reserve(size_t count);
 
 		/// <summary>
 		/// Sets the number of buckets to bucket count and rehashes the container,
-		/// puts all current elements in their new appropiate bucket
+		/// puts all current elements in their new appropiate bucket, finishing any growth in progress.
+		/// The bucket count is rounded up to a power of two when the hash functor is avalanching
 		/// </summary>
 		/// <param name="bucketCount">Number of buckets</param>
 		void Rehash(size_t bucketCount);
@@ -492,6 +559,35 @@ namespace FieaGameEngine
 		/// <returns>True if present, false otherwise</returns>
 		bool ContainsKey(const TKey& key, ConstIterator& out) const;
 
+		/// <summary>
+		/// Checks if a key of another type is present, only available when
+		/// the hash functor and key comparator are transparent
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <returns>True if present, false otherwise</returns>
+		template <typename TLookup, typename = EnableIfTransparent<TLookup>>
+		bool ContainsKey(const TLookup& key) const;
+
+		/// <summary>
+		/// Checks if a key of another type is present, only available when
+		/// the hash functor and key comparator are transparent
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <param name="it">Iterator to output if found</param>
+		/// <returns>True if present, false otherwise</returns>
+		template <typename TLookup, typename = EnableIfTransparent<TLookup>>
+		bool ContainsKey(const TLookup& key, Iterator& out);
+
+		/// <summary>
+		/// Checks if a key of another type is present, only available when
+		/// the hash functor and key comparator are transparent
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <param name="it">Iterator to output if found</param>
+		/// <returns>True if present, false otherwise</returns>
+		template <typename TLookup, typename = EnableIfTransparent<TLookup>>
+		bool ContainsKey(const TLookup& key, ConstIterator& out) const;
+
 		/// <summary>
 		/// Removes all key value pairs from the container
 		/// </summary>
@@ -548,6 +644,7 @@ namespace FieaGameEngine
 		/// <summary>
 		/// Sets the max load factor
 		/// </summary>
+		/// <exception cref="std::invalid_argument">Thrown if the factor is not positive and finite</exception>
 		/// <param name="maxLoadFactor">The new max load factor</param>
 		void MaxLoadFactor(float maxLoadFactor);
 
@@ -570,6 +667,18 @@ namespace FieaGameEngine
 		/// <returns>Size of the bucket</returns>
 		size_t BucketSize(size_t bucket) const;
 
+		/// <summary>
+		/// Tells if entries are still being moved from the previous, smaller bucket array
+		/// </summary>
+		/// <returns>True while a growth is in progress, false otherwise</returns>
+		bool IsRehashing() const;
+
+		/// <summary>
+		/// Gets the allocator used for the buckets and the chain entries
+		/// </summary>
+		/// <returns>The allocator</returns>
+		const TAllocator& GetAllocator() const;
+
 	private:
 		/// <summary>
 		/// Number of elements in the collection
@@ -581,6 +690,16 @@ namespace FieaGameEngine
 		/// </summary>
 		BucketType mBuckets;
 
+		/// <summary>
+		/// Buckets the map is growing out of, empty unless a growth is in progress
+		/// </summary>
+		BucketType mOldBuckets;
+
+		/// <summary>
+		/// Old buckets below this one have already been moved to the new buckets
+		/// </summary>
+		size_t mMigratedBuckets = 0;
+
 		/// <summary>
 		/// Hash functor
 		/// </summary>
@@ -591,25 +710,125 @@ namespace FieaGameEngine
 		/// </summary>
 		TKeyComparator mKeyComparator;
 
+		/// <summary>
+		/// Allocator for the buckets and the chain entries
+		/// </summary>
+		TAllocator mAllocator;
+
 		/// <summary>
 		/// Max load factor
 		/// </summary>
 		float mMaxLoadFactor = 1.0f;
 
 		/// <summary>
-		/// Assigns a bucket to the given key
+		/// Fewest old buckets moved to the new buckets by an insertion during a growth,
+		/// twice the minimum needed to finish before the next growth at a max load factor of one
+		/// </summary>
+		static constexpr size_t MigrationStep = 2;
+
+		/// <summary>
+		/// Avalanching hashes are well mixed in their low bits, so buckets are picked by masking
+		/// and bucket counts are kept to powers of two. Any other hash goes through modulo
+		/// </summary>
+		static constexpr bool MasksBuckets = IsAvalanchingHash<THashFunctor>::value;
+
+		/// <summary>
+		/// Looks for the given key, shared by the TKey and transparent lookups
 		/// </summary>
 		/// <param name="key">Key</param>
-		/// <returns>Bucket of the key</returns>
-		size_t Hash(const TKey& key) const;
+		/// <param name="hash">Full hash of the key</param>
+		/// <returns>Iterator to the value if found, end iterator otherwise</returns>
+		template <typename TLookup>
+		Iterator FindKey(const TLookup& key, size_t hash);
+
+		/// <summary>
+		/// Looks for the given key, shared by the TKey and transparent lookups
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <param name="hash">Full hash of the key</param>
+		/// <returns>Iterator to the value if found, end iterator otherwise</returns>
+		template <typename TLookup>
+		ConstIterator FindKey(const TLookup& key, size_t hash) const;
+
+		/// <summary>
+		/// Hashes the given key
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <returns>Full hash of the key</returns>
+		template <typename TLookup>
+		size_t Hash(const TLookup& key) const;
+
+		/// <summary>
+		/// Assigns a bucket to the given hash
+		/// </summary>
+		/// <param name="hash">Full hash of a key</param>
+		/// <param name="bucketCount">Number of buckets to choose from</param>
+		/// <returns>Bucket of the hash</returns>
+		static size_t Bucket(size_t hash, size_t bucketCount);
+
+		/// <summary>
+		/// Adjusts a requested bucket count to the ones Bucket supports
+		/// </summary>
+		/// <param name="bucketCount">Requested number of buckets</param>
+		/// <returns>Next power of two if buckets are masked, the same count otherwise</returns>
+		static size_t ValidBucketCount(size_t bucketCount);
+
+		/// <summary>
+		/// Gets a chain by its position in iteration order: the old buckets still
+		/// waiting to be moved come first, then the current buckets
+		/// </summary>
+		/// <param name="index">Position of the chain</param>
+		/// <returns>Reference to the chain</returns>
+		ChainType& Chain(size_t index);
+
+		/// <summary>
+		/// Gets a chain by its position in iteration order: the old buckets still
+		/// waiting to be moved come first, then the current buckets
+		/// </summary>
+		/// <param name="index">Position of the chain</param>
+		/// <returns>Reference to the chain</returns>
+		const ChainType& Chain(size_t index) const;
+
+		/// <summary>
+		/// Gets the number of chains, old and current buckets together
+		/// </summary>
+		/// <returns>Number of chains</returns>
+		size_t ChainCount() const;
+
+		/// <summary>
+		/// Creates the given number of empty chains, all of them using this map's allocator
+		/// </summary>
+		/// <param name="bucketCount">Number of buckets</param>
+		/// <returns>The new buckets</returns>
+		BucketType CreateBuckets(size_t bucketCount) const;
+
+		/// <summary>
+		/// Starts moving the entries to a bucket array twice as big
+		/// </summary>
+		void Grow();
+
+		/// <summary>
+		/// Moves the entries of up to the given number of old buckets to the current buckets
+		/// </summary>
+		/// <param name="bucketCount">Maximum number of old buckets to move</param>
+		void Migrate(size_t bucketCount);
+
+		/// <summary>
+		/// Gets the number of old buckets the next insertion has to move for the growth in progress
+		/// to be done before the insertion that starts the next growth. Spreads the remaining buckets
+		/// over the insertions left below the max load factor, so a lower factor moves more per insertion
+		/// </summary>
+		/// <returns>Number of old buckets to move, at least MigrationStep</returns>
+		size_t MigrationQuota() const;
 
 		/// <summary>
-		/// Compares two keys
+		/// Compares a key against one stored in the map
 		/// </summary>
-		/// <param name="first">First key</param>
-		/// <param name="second">Second key</param>
+		/// <param name="first">Key</param>
+		/// <param name="second">Stored key</param>
 		/// <returns>True if the keys are equal, false otherwise</returns>
-		bool KeyEqual(const TKey& first, const TKey& second) const;
+		template <typename TLookup>
+		bool KeyEqual(const TLookup& first, const TKey& second) const;
 	};
 }
 
@@ -2,22 +2,24 @@
 
 namespace FieaGameEngine
 {
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	HashMap<TKey, TValue, THashFunctor, TKeyComparator>::HashMap(size_t bucketCount) :
-		mBuckets(bucketCount)
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::HashMap(size_t bucketCount, const TAllocator& allocator) :
+		mBuckets(allocator), mOldBuckets(allocator), mAllocator(allocator)
 	{
-		mBuckets.Resize(bucketCount);
+		mBuckets = CreateBuckets(ValidBucketCount(bucketCount));
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	HashMap<TKey, TValue, THashFunctor, TKeyComparator>::HashMap(HashMap&& other) :
-		mSize(other.mSize), mBuckets(std::move(other.mBuckets)), mHashFunctor(std::move(other.mHashFunctor)), mKeyComparator(std::move(other.mKeyComparator))
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::HashMap(HashMap&& other) :
+		mSize(other.mSize), mBuckets(std::move(other.mBuckets)), mOldBuckets(std::move(other.mOldBuckets)), mMigratedBuckets(other.mMigratedBuckets),
+		mHashFunctor(std::move(other.mHashFunctor)), mKeyComparator(std::move(other.mKeyComparator)), mAllocator(other.mAllocator), mMaxLoadFactor(other.mMaxLoadFactor)
 	{
 		other.mSize = 0;
+		other.mMigratedBuckets = 0;
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	HashMap<TKey, TValue, THashFunctor, TKeyComparator>::HashMap(std::initializer_list<PairType> list) :
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::HashMap(std::initializer_list<PairType> list) :
 		HashMap(list.size() * 2)
 	{
 		for (auto& pair : list)
@@ -26,8 +28,34 @@ namespace FieaGameEngine
 		}
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	HashMap<TKey, TValue, THashFunctor, TKeyComparator>& HashMap<TKey, TValue, THashFunctor, TKeyComparator>::operator=(HashMap&& other)
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>& HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::operator=(const HashMap& other)
+	{
+		if (this != &other)
+		{
+			Clear();
+
+			// entries are copied straight into this map's chains, so they come from its own allocator
+			mBuckets = CreateBuckets(other.BucketCount());
+			for (size_t i = 0; i < other.ChainCount(); ++i)
+			{
+				for (const auto& entry : other.Chain(i))
+				{
+					mBuckets[Bucket(entry.Hash, BucketCount())].PushBack(entry);
+				}
+			}
+
+			mSize = other.mSize;
+			mHashFunctor = other.mHashFunctor;
+			mKeyComparator = other.mKeyComparator;
+			mMaxLoadFactor = other.mMaxLoadFactor;
+		}
+
+		return *this;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>& HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::operator=(HashMap&& other)
 	{
 		if (this != &other)
 		{
@@ -38,17 +66,22 @@ namespace FieaGameEngine
 
 			mSize = other.mSize;
 			mBuckets = std::move(other.mBuckets);
+			mOldBuckets = std::move(other.mOldBuckets);
+			mMigratedBuckets = other.mMigratedBuckets;
 			mHashFunctor = std::move(other.mHashFunctor);
 			mKeyComparator = std::move(other.mKeyComparator);
+			mAllocator = other.mAllocator;
+			mMaxLoadFactor = other.mMaxLoadFactor;
 
 			other.mSize = 0;
+			other.mMigratedBuckets = 0;
 		}
 
 		return *this;
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	HashMap<TKey, TValue, THashFunctor, TKeyComparator>& HashMap<TKey, TValue, THashFunctor, TKeyComparator>::operator=(std::initializer_list<PairType> list)
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>& HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::operator=(std::initializer_list<PairType> list)
 	{
 		if (mSize > 0)
 		{
@@ -63,24 +96,51 @@ namespace FieaGameEngine
 		return *this;
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	TValue& HashMap<TKey, TValue, THashFunctor, TKeyComparator>::operator[](const TKey& key)
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	TValue& HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::operator[](const TKey& key)
 	{
 		auto[it, inserted] = Emplace(key, TValue());
 
 		return it->second;
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	TValue& HashMap<TKey, TValue, THashFunctor, TKeyComparator>::operator[](TKey&& key)
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	TValue& HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::operator[](TKey&& key)
 	{
 		auto[it, inserted] = Emplace(std::move(key), TValue());
 
 		return it->second;
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	TValue& HashMap<TKey, TValue, THashFunctor, TKeyComparator>::At(const TKey& key)
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	TValue& HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::At(const TKey& key)
+	{
+		Iterator it = Find(key);
+
+		if (it == end())
+		{
+			throw std::exception("Key not found.");
+		}
+
+		return it->second;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	const TValue& HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::At(const TKey& key) const
+	{
+		ConstIterator it = Find(key);
+
+		if (it == end())
+		{
+			throw std::exception("Key not found.");
+		}
+
+		return it->second;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	template <typename TLookup, typename>
+	TValue& HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::At(const TLookup& key)
 	{
 		Iterator it = Find(key);
 
@@ -92,8 +152,9 @@ namespace FieaGameEngine
 		return it->second;
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	const TValue& HashMap<TKey, TValue, THashFunctor, TKeyComparator>::At(const TKey& key) const
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	template <typename TLookup, typename>
+	const TValue& HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::At(const TLookup& key) const
 	{
 		ConstIterator it = Find(key);
 
@@ -105,83 +166,88 @@ namespace FieaGameEngine
 		return it->second;
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	std::pair<typename HashMap<TKey, TValue, THashFunctor, TKeyComparator>::Iterator, bool> HashMap<TKey, TValue, THashFunctor, TKeyComparator>::Insert(const PairType& pair)
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	std::pair<typename HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Iterator, bool> HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Insert(const PairType& pair)
 	{
 		return Emplace(pair);
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	std::pair<typename HashMap<TKey, TValue, THashFunctor, TKeyComparator>::Iterator, bool> HashMap<TKey, TValue, THashFunctor, TKeyComparator>::Insert(PairType&& pair)
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	std::pair<typename HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Iterator, bool> HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Insert(PairType&& pair)
 	{
 		return Emplace(std::move(pair));
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
 	template <typename... Args>
-	std::pair<typename HashMap<TKey, TValue, THashFunctor, TKeyComparator>::Iterator, bool> HashMap<TKey, TValue, THashFunctor, TKeyComparator>::Emplace(Args&&... args)
+	std::pair<typename HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Iterator, bool> HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Emplace(Args&&... args)
 	{
+		if (IsRehashing())
+		{
+			Migrate(MigrationQuota());
+		}
+
 		PairType pair(std::forward<Args>(args)...);
-		Iterator it = Find(pair.first);
+		const size_t hash = Hash(pair.first);
+		Iterator it = FindKey(pair.first, hash);
 
 		bool inserted = false;
 		if (it == end())
 		{
-			const size_t bucket = Hash(pair.first);
-			ChainIterator chainIterator = mBuckets[bucket].PushBack(std::move(pair));
+			if (static_cast<float>(mSize + 1) > static_cast<float>(BucketCount()) * mMaxLoadFactor)
+			{
+				Grow();
+			}
+
+			const size_t bucket = Bucket(hash, BucketCount());
+			ChainIterator chainIterator = mBuckets[bucket].EmplaceBack(hash, std::move(pair));
 			++mSize;
-			it = Iterator(*this, bucket, chainIterator);
+			it = Iterator(*this, mOldBuckets.Size() + bucket, chainIterator);
 			inserted = true;
 		}
 
 		return std::pair(it, inserted);
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	typename HashMap<TKey, TValue, THashFunctor, TKeyComparator>::Iterator HashMap<TKey, TValue, THashFunctor, TKeyComparator>::Find(const TKey& key)
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline typename HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Iterator HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Find(const TKey& key)
 	{
-		const size_t bucket = Hash(key);
-
-		for (ChainIterator it = mBuckets[bucket].begin(); it != mBuckets[bucket].end(); ++it)
-		{
-			if (KeyEqual(key, it->first))
-			{
-				return Iterator(*this, bucket, it);
-			}
-		}
-
-		return end();
+		return FindKey(key, Hash(key));
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	typename HashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator HashMap<TKey, TValue, THashFunctor, TKeyComparator>::Find(const TKey& key) const
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline typename HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ConstIterator HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Find(const TKey& key) const
 	{
-		const size_t bucket = Hash(key);
+		return FindKey(key, Hash(key));
+	}
 
-		for (ChainConstIterator it = mBuckets[bucket].begin(); it != mBuckets[bucket].end(); ++it)
-		{
-			if (KeyEqual(key, it->first))
-			{
-				return ConstIterator(*this, bucket, it);
-			}
-		}
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	template <typename TLookup, typename>
+	inline typename HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Iterator HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Find(const TLookup& key)
+	{
+		return FindKey(key, Hash(key));
+	}
 
-		return end();
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	template <typename TLookup, typename>
+	inline typename HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ConstIterator HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Find(const TLookup& key) const
+	{
+		return FindKey(key, Hash(key));
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	bool HashMap<TKey, TValue, THashFunctor, TKeyComparator>::Remove(const TKey& key)
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	bool HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Remove(const TKey& key)
 	{
 		Iterator it = Find(key);
 		return Remove(it);
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	bool HashMap<TKey, TValue, THashFunctor, TKeyComparator>::Remove(const Iterator& it)
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	bool HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Remove(const Iterator& it)
 	{
 		if (it.mOwner == this && it != end())
 		{
-			mBuckets[it.mBucket].Remove(it.mChainIterator);
+			Chain(it.mBucket).Remove(it.mChainIterator);
 			--mSize;
 			return true;
 		}
@@ -189,8 +255,8 @@ namespace FieaGameEngine
 		return false;
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	void HashMap<TKey, TValue, THashFunctor, TKeyComparator>::Remove(const Iterator& first, const Iterator& last)
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	void HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Remove(const Iterator& first, const Iterator& last)
 	{
 		if (first.mOwner != this || last.mOwner != this)
 		{
@@ -206,205 +272,444 @@ namespace FieaGameEngine
 		ChainIterator chainIt = first.mChainIterator;
 		while (bucket < last.mBucket)
 		{
-			mSize -= mBuckets[bucket].Remove(chainIt, mBuckets[bucket].end());
+			mSize -= Chain(bucket).Remove(chainIt, Chain(bucket).end());
 
 			++bucket;
-			if (bucket < BucketCount())
+			if (bucket < ChainCount())
 			{
-				chainIt = mBuckets[bucket].begin();
+				chainIt = Chain(bucket).begin();
 			}
 		}
 
-		if (bucket < BucketCount())
+		if (bucket < ChainCount())
 		{
-			mSize -= mBuckets[bucket].Remove(chainIt, last.mChainIterator);
+			mSize -= Chain(bucket).Remove(chainIt, last.mChainIterator);
 		}
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	void HashMap<TKey, TValue, THashFunctor, TKeyComparator>::Reserve(size_t count)
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	void HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Reserve(size_t count)
 	{
-		Rehash(static_cast<size_t>(std::ceil(count / mMaxLoadFactor)));
+		// only ever grows, a map already big enough keeps its buckets
+		const size_t bucketCount = static_cast<size_t>(std::ceil(count / mMaxLoadFactor));
+		if (bucketCount > BucketCount())
+		{
+			Rehash(bucketCount);
+		}
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	void HashMap<TKey, TValue, THashFunctor, TKeyComparator>::Rehash(size_t bucketCount)
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	void HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Rehash(size_t bucketCount)
 	{
-		BucketType newTable;
-		newTable.Resize(bucketCount);
+		bucketCount = ValidBucketCount(bucketCount);
+		BucketType newTable = CreateBuckets(bucketCount);
 
-		for (auto& pair : *this)
+		// the cached hashes are enough to place every entry, keys are never hashed again
+		for (size_t i = 0; i < ChainCount(); ++i)
 		{
-			const size_t bucket = mHashFunctor(pair.first) % bucketCount;
-			newTable[bucket].EmplaceBack(std::move(pair));
+			ChainType& chain = Chain(i);
+			while (!chain.IsEmpty())
+			{
+				newTable[Bucket(chain.Front().Hash, bucketCount)].SpliceBack(chain);
+			}
 		}
 
 		mBuckets = std::move(newTable);
+		mOldBuckets = BucketType(mAllocator);
+		mMigratedBuckets = 0;
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	inline bool HashMap<TKey, TValue, THashFunctor, TKeyComparator>::ContainsKey(const TKey& key) const
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline bool HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ContainsKey(const TKey& key) const
 	{
 		return Find(key) != end();
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	inline bool HashMap<TKey, TValue, THashFunctor, TKeyComparator>::ContainsKey(const TKey& key, Iterator& out)
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline bool HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ContainsKey(const TKey& key, Iterator& out)
 	{
 		out = Find(key);
 
 		return out != end();
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	inline bool HashMap<TKey, TValue, THashFunctor, TKeyComparator>::ContainsKey(const TKey& key, ConstIterator& out) const
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline bool HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ContainsKey(const TKey& key, ConstIterator& out) const
 	{
 		out = Find(key);
 
 		return out != end();
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	void HashMap<TKey, TValue, THashFunctor, TKeyComparator>::Clear()
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	template <typename TLookup, typename>
+	inline bool HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ContainsKey(const TLookup& key) const
+	{
+		return Find(key) != end();
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	template <typename TLookup, typename>
+	inline bool HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ContainsKey(const TLookup& key, Iterator& out)
+	{
+		out = Find(key);
+
+		return out != end();
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	template <typename TLookup, typename>
+	inline bool HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ContainsKey(const TLookup& key, ConstIterator& out) const
+	{
+		out = Find(key);
+
+		return out != end();
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	void HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Clear()
 	{
 		for (auto& chain : mBuckets)
 		{
 			chain.Clear();
 		}
 
+		mOldBuckets = BucketType(mAllocator);
+		mMigratedBuckets = 0;
 		mSize = 0;
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	typename HashMap<TKey, TValue, THashFunctor, TKeyComparator>::Iterator HashMap<TKey, TValue, THashFunctor, TKeyComparator>::begin()
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	typename HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Iterator HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::begin()
 	{
-		for (size_t i = 0; i < mBuckets.Size(); ++i)
+		for (size_t i = 0; i < ChainCount(); ++i)
 		{
-			if (!mBuckets[i].IsEmpty())
+			if (!Chain(i).IsEmpty())
 			{
-				return Iterator(*this, i, mBuckets[i].begin());
+				return Iterator(*this, i, Chain(i).begin());
 			}
 		}
 
 		return end();
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	typename HashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator HashMap<TKey, TValue, THashFunctor, TKeyComparator>::begin() const
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	typename HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ConstIterator HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::begin() const
 	{
-		for (size_t i = 0; i < mBuckets.Size(); ++i)
+		for (size_t i = 0; i < ChainCount(); ++i)
 		{
-			if (!mBuckets[i].IsEmpty())
+			if (!Chain(i).IsEmpty())
 			{
-				return ConstIterator(*this, i, mBuckets[i].begin());
+				return ConstIterator(*this, i, Chain(i).begin());
 			}
 		}
 
 		return end();
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	inline typename HashMap<TKey, TValue, THashFunctor, TKeyComparator>::Iterator HashMap<TKey, TValue, THashFunctor, TKeyComparator>::end()
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline typename HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Iterator HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::end()
 	{
-		return Iterator(*this, BucketCount());
+		return Iterator(*this, ChainCount());
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	inline typename HashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator HashMap<TKey, TValue, THashFunctor, TKeyComparator>::end() const
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline typename HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ConstIterator HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::end() const
 	{
-		return ConstIterator(*this, BucketCount());
+		return ConstIterator(*this, ChainCount());
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	typename HashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator HashMap<TKey, TValue, THashFunctor, TKeyComparator>::cbegin() const
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	typename HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ConstIterator HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::cbegin() const
 	{
-		for (size_t i = 0; i < mBuckets.Size(); ++i)
+		for (size_t i = 0; i < ChainCount(); ++i)
 		{
-			if (!mBuckets[i].IsEmpty())
+			if (!Chain(i).IsEmpty())
 			{
-				return ConstIterator(*this, i, mBuckets[i].begin());
+				return ConstIterator(*this, i, Chain(i).begin());
 			}
 		}
 
-		return ConstIterator(*this, BucketCount());
+		return ConstIterator(*this, ChainCount());
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	inline typename HashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator HashMap<TKey, TValue, THashFunctor, TKeyComparator>::cend() const
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline typename HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ConstIterator HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::cend() const
 	{
-		return ConstIterator(*this, BucketCount());
+		return ConstIterator(*this, ChainCount());
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	inline float FieaGameEngine::HashMap<TKey, TValue, THashFunctor, TKeyComparator>::LoadFactor() const
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline float FieaGameEngine::HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::LoadFactor() const
 	{
 		return static_cast<float>(mSize) / BucketCount();
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	inline float HashMap<TKey, TValue, THashFunctor, TKeyComparator>::MaxLoadFactor() const
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline float HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::MaxLoadFactor() const
 	{
 		return mMaxLoadFactor;
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	inline void HashMap<TKey, TValue, THashFunctor, TKeyComparator>::MaxLoadFactor(float maxLoadFactor)
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline void HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::MaxLoadFactor(float maxLoadFactor)
 	{
+		// anything else makes every insertion grow the buckets
+		if (!(maxLoadFactor > 0.0f) || !std::isfinite(maxLoadFactor))
+		{
+			throw std::invalid_argument("Max load factor must be positive and finite.");
+		}
+
 		mMaxLoadFactor = maxLoadFactor;
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	inline size_t HashMap<TKey, TValue, THashFunctor, TKeyComparator>::Size() const
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline size_t HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Size() const
 	{
 		return mSize;
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	inline size_t FieaGameEngine::HashMap<TKey, TValue, THashFunctor, TKeyComparator>::BucketCount() const
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline size_t FieaGameEngine::HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::BucketCount() const
 	{
 		return mBuckets.Size();
 	}
 
-	template<typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	inline size_t HashMap<TKey, TValue, THashFunctor, TKeyComparator>::BucketSize(size_t bucket) const
+	template<typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline size_t HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::BucketSize(size_t bucket) const
 	{
 		return mBuckets[bucket].Size();
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	inline size_t HashMap<TKey, TValue, THashFunctor, TKeyComparator>::Hash(const TKey& key) const
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline bool HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::IsRehashing() const
+	{
+		return !mOldBuckets.IsEmpty();
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline const TAllocator& HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::GetAllocator() const
+	{
+		return mAllocator;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	template <typename TLookup>
+	typename HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Iterator HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::FindKey(const TLookup& key, size_t hash)
+	{
+		// an entry is in the current buckets, or in its old bucket if that one has not been moved yet
+		size_t chains[] = { mOldBuckets.Size() + Bucket(hash, BucketCount()), ChainCount() };
+		if (IsRehashing() && Bucket(hash, mOldBuckets.Size()) >= mMigratedBuckets)
+		{
+			chains[1] = Bucket(hash, mOldBuckets.Size());
+		}
+
+		for (size_t chain : chains)
+		{
+			if (chain == ChainCount())
+			{
+				break;
+			}
+
+			for (ChainIterator it = Chain(chain).begin(); it != Chain(chain).end(); ++it)
+			{
+				if ((*it).Hash == hash && KeyEqual(key, (*it).Pair.first))
+				{
+					return Iterator(*this, chain, it);
+				}
+			}
+		}
+
+		return end();
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	template <typename TLookup>
+	typename HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ConstIterator HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::FindKey(const TLookup& key, size_t hash) const
+	{
+		// an entry is in the current buckets, or in its old bucket if that one has not been moved yet
+		size_t chains[] = { mOldBuckets.Size() + Bucket(hash, BucketCount()), ChainCount() };
+		if (IsRehashing() && Bucket(hash, mOldBuckets.Size()) >= mMigratedBuckets)
+		{
+			chains[1] = Bucket(hash, mOldBuckets.Size());
+		}
+
+		for (size_t chain : chains)
+		{
+			if (chain == ChainCount())
+			{
+				break;
+			}
+
+			for (ChainConstIterator it = Chain(chain).begin(); it != Chain(chain).end(); ++it)
+			{
+				if ((*it).Hash == hash && KeyEqual(key, (*it).Pair.first))
+				{
+					return ConstIterator(*this, chain, it);
+				}
+			}
+		}
+
+		return end();
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	template <typename TLookup>
+	inline size_t HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Hash(const TLookup& key) const
 	{
-		return mHashFunctor(key) % BucketCount();
+		return mHashFunctor(key);
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	inline bool HashMap<TKey, TValue, THashFunctor, TKeyComparator>::KeyEqual(const TKey& first, const TKey& second) const
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline size_t HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Bucket(size_t hash, size_t bucketCount)
+	{
+		if constexpr (MasksBuckets)
+		{
+			return hash & (bucketCount - 1);
+		}
+		else
+		{
+			return hash % bucketCount;
+		}
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline size_t HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ValidBucketCount(size_t bucketCount)
+	{
+		if constexpr (MasksBuckets)
+		{
+			size_t powerOfTwo = 1;
+			while (powerOfTwo < bucketCount)
+			{
+				powerOfTwo <<= 1;
+			}
+
+			return powerOfTwo;
+		}
+		else
+		{
+			return bucketCount;
+		}
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline typename HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ChainType& HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Chain(size_t index)
+	{
+		return index < mOldBuckets.Size() ? mOldBuckets[index] : mBuckets[index - mOldBuckets.Size()];
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline const typename HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ChainType& HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Chain(size_t index) const
+	{
+		return index < mOldBuckets.Size() ? mOldBuckets[index] : mBuckets[index - mOldBuckets.Size()];
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline size_t HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ChainCount() const
+	{
+		return mOldBuckets.Size() + mBuckets.Size();
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	typename HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::BucketType HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::CreateBuckets(size_t bucketCount) const
+	{
+		BucketType buckets(mAllocator, bucketCount);
+		for (size_t i = 0; i < bucketCount; ++i)
+		{
+			buckets.EmplaceBack(mAllocator);
+		}
+
+		return buckets;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	void HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Grow()
+	{
+		// insertions keep up with the load factor, so only lowering it mid growth leaves one to finish here
+		if (IsRehashing())
+		{
+			Migrate(mOldBuckets.Size());
+		}
+
+		const size_t bucketCount = BucketCount() > 0 ? BucketCount() * 2 : 1;
+		mOldBuckets = std::move(mBuckets);
+		mBuckets = CreateBuckets(bucketCount);
+		mMigratedBuckets = 0;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	void HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Migrate(size_t bucketCount)
+	{
+		for (; bucketCount > 0 && mMigratedBuckets < mOldBuckets.Size(); --bucketCount, ++mMigratedBuckets)
+		{
+			ChainType& chain = mOldBuckets[mMigratedBuckets];
+			while (!chain.IsEmpty())
+			{
+				mBuckets[Bucket(chain.Front().Hash, BucketCount())].SpliceBack(chain);
+			}
+		}
+
+		if (mMigratedBuckets == mOldBuckets.Size())
+		{
+			mOldBuckets = BucketType(mAllocator);
+			mMigratedBuckets = 0;
+		}
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	size_t HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::MigrationQuota() const
+	{
+		const size_t remaining = mOldBuckets.Size() - mMigratedBuckets;
+		const float threshold = static_cast<float>(BucketCount()) * mMaxLoadFactor;
+		if (static_cast<float>(mSize + remaining) <= threshold)
+		{
+			return MigrationStep;
+		}
+
+		// insertions left before the one that grows the buckets again, the last of them moves the last bucket
+		const size_t growthSize = static_cast<size_t>(threshold);
+		const size_t insertions = growthSize > mSize ? growthSize - mSize : 1;
+		const size_t quota = (remaining + insertions - 1) / insertions;
+
+		return quota > MigrationStep ? quota : MigrationStep;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	template <typename TLookup>
+	inline bool HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::KeyEqual(const TLookup& first, const TKey& second) const
 	{
 		return mKeyComparator(first, second);
 	}
 
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	template <typename... Args>
+	inline HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ChainEntry::ChainEntry(size_t hash, Args&&... args) :
+		Pair(std::forward<Args>(args)...), Hash(hash)
+	{
+	}
+
 	// Iterator
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	HashMap<TKey, TValue, THashFunctor, TKeyComparator>::Iterator::Iterator(const HashMap& owner, size_t bucket, const ChainIterator& chainIterator) :
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Iterator::Iterator(const HashMap& owner, size_t bucket, const ChainIterator& chainIterator) :
 		mOwner(const_cast<HashMap*>(&owner)), mBucket(bucket), mChainIterator(chainIterator)
 	{
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	inline bool HashMap<TKey, TValue, THashFunctor, TKeyComparator>::Iterator::operator==(const Iterator& other) const
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline bool HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Iterator::operator==(const Iterator& other) const
 	{
 		return !operator!=(other);
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	inline bool HashMap<TKey, TValue, THashFunctor, TKeyComparator>::Iterator::operator!=(const Iterator& other) const
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline bool HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Iterator::operator!=(const Iterator& other) const
 	{
 		return (mOwner != other.mOwner) || (mBucket != other.mBucket) || (mChainIterator != other.mChainIterator);
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	bool HashMap<TKey, TValue, THashFunctor, TKeyComparator>::Iterator::operator>(const Iterator& other) const
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	bool HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Iterator::operator>(const Iterator& other) const
 	{
 		if (mOwner != other.mOwner)
 		{
@@ -414,8 +719,8 @@ namespace FieaGameEngine
 		return (mBucket > other.mBucket) || (mBucket == other.mBucket && mChainIterator > other.mChainIterator);
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	bool HashMap<TKey, TValue, THashFunctor, TKeyComparator>::Iterator::operator<(const Iterator& other) const
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	bool HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Iterator::operator<(const Iterator& other) const
 	{
 		if (mOwner != other.mOwner)
 		{
@@ -425,8 +730,8 @@ namespace FieaGameEngine
 		return (mBucket < other.mBucket) || (mBucket == other.mBucket && mChainIterator < other.mChainIterator);
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	typename HashMap<TKey, TValue, THashFunctor, TKeyComparator>::Iterator& HashMap<TKey, TValue, THashFunctor, TKeyComparator>::Iterator::operator++()
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	typename HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Iterator& HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Iterator::operator++()
 	{
 		if (mOwner == nullptr)
 		{
@@ -434,21 +739,21 @@ namespace FieaGameEngine
 		}
 
 		++mChainIterator;
-		if (mChainIterator == mOwner->mBuckets[mBucket].end())
+		if (mChainIterator == mOwner->Chain(mBucket).end())
 		{
-			if (mBucket < mOwner->BucketCount())
+			if (mBucket < mOwner->ChainCount())
 			{
 				++mBucket;
-				for (; mBucket < mOwner->BucketCount(); ++mBucket)
+				for (; mBucket < mOwner->ChainCount(); ++mBucket)
 				{
-					if (!mOwner->mBuckets[mBucket].IsEmpty())
+					if (!mOwner->Chain(mBucket).IsEmpty())
 					{
-						mChainIterator = mOwner->mBuckets[mBucket].begin();
+						mChainIterator = mOwner->Chain(mBucket).begin();
 						return *this;
 					}
 				}
 
-				if (mBucket == mOwner->BucketCount())
+				if (mBucket == mOwner->ChainCount())
 				{
 					mChainIterator = ChainIterator();
 				}
@@ -458,8 +763,8 @@ namespace FieaGameEngine
 		return *this;
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	typename HashMap<TKey, TValue, THashFunctor, TKeyComparator>::Iterator HashMap<TKey, TValue, THashFunctor, TKeyComparator>::Iterator::operator++(int)
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	typename HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Iterator HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Iterator::operator++(int)
 	{
 		Iterator temp = *this;
 		operator++();
@@ -467,52 +772,52 @@ namespace FieaGameEngine
 		return temp;
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	typename HashMap<TKey, TValue, THashFunctor, TKeyComparator>::PairType& HashMap<TKey, TValue, THashFunctor, TKeyComparator>::Iterator::operator*() const
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	typename HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::PairType& HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Iterator::operator*() const
 	{
 		if (mOwner == nullptr)
 		{
 			throw std::exception("Unassociated iterator.");
 		}
 
-		return *mChainIterator;
+		return (*mChainIterator).Pair;
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	typename HashMap<TKey, TValue, THashFunctor, TKeyComparator>::PairType* HashMap<TKey, TValue, THashFunctor, TKeyComparator>::Iterator::operator->() const
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	typename HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::PairType* HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Iterator::operator->() const
 	{
 		if (mOwner == nullptr)
 		{
 			throw std::exception("Unassociated iterator.");
 		}
 
-		return &(*mChainIterator);
+		return &(*mChainIterator).Pair;
 	}
 
 	// ConstIterator
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	HashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator::ConstIterator(const HashMap& owner, size_t bucket, const ChainConstIterator& chainConstIterator) :
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ConstIterator::ConstIterator(const HashMap& owner, size_t bucket, const ChainConstIterator& chainConstIterator) :
 		mOwner(const_cast<HashMap*>(&owner)), mBucket(bucket), mChainIterator(chainConstIterator)
 	{
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	HashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator::ConstIterator(const Iterator& other) :
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ConstIterator::ConstIterator(const Iterator& other) :
 		mOwner(other.mOwner), mBucket(other.mBucket), mChainIterator(other.mChainIterator)
 	{
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	HashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator::ConstIterator(Iterator&& other) :
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ConstIterator::ConstIterator(Iterator&& other) :
 		mOwner(other.mOwner), mBucket(other.mBucket), mChainIterator(std::move(other.mChainIterator))
 	{
 		other.mOwner = nullptr;
 		other.mBucket = 0;
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	typename HashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator& HashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator::operator=(const Iterator& other)
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	typename HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ConstIterator& HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ConstIterator::operator=(const Iterator& other)
 	{
 		mOwner = other.mOwner;
 		mBucket = other.mBucket;
@@ -522,8 +827,8 @@ namespace FieaGameEngine
 		other.mBucket = 0;
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	typename HashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator& HashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator::operator=(Iterator&& other)
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	typename HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ConstIterator& HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ConstIterator::operator=(Iterator&& other)
 	{
 		mOwner = other.mOwner;
 		mBucket = other.mBucket;
@@ -533,20 +838,20 @@ namespace FieaGameEngine
 		other.mBucket = 0;
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	inline bool HashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator::operator==(const ConstIterator& other) const
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline bool HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ConstIterator::operator==(const ConstIterator& other) const
 	{
 		return !operator!=(other);
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	inline bool HashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator::operator!=(const ConstIterator& other) const
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline bool HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ConstIterator::operator!=(const ConstIterator& other) const
 	{
 		return (mOwner != other.mOwner) || (mBucket != other.mBucket) || (mChainIterator != other.mChainIterator);
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	bool HashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator::operator>(const ConstIterator& other) const
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	bool HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ConstIterator::operator>(const ConstIterator& other) const
 	{
 		if (mOwner != other.mOwner)
 		{
@@ -556,8 +861,8 @@ namespace FieaGameEngine
 		return (mBucket > other.mBucket) || (mBucket == other.mBucket && mChainIterator > other.mChainIterator);
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	bool HashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator::operator<(const ConstIterator& other) const
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	bool HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ConstIterator::operator<(const ConstIterator& other) const
 	{
 		if (mOwner != other.mOwner)
 		{
@@ -567,8 +872,8 @@ namespace FieaGameEngine
 		return (mBucket < other.mBucket) || (mBucket == other.mBucket && mChainIterator < other.mChainIterator);
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	typename HashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator& HashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator::operator++()
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	typename HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ConstIterator& HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ConstIterator::operator++()
 	{
 		if (mOwner == nullptr)
 		{
@@ -576,21 +881,21 @@ namespace FieaGameEngine
 		}
 
 		++mChainIterator;
-		if (mChainIterator == mOwner->mBuckets[mBucket].end())
+		if (mChainIterator == mOwner->Chain(mBucket).end())
 		{
-			if (mBucket < mOwner->BucketCount())
+			if (mBucket < mOwner->ChainCount())
 			{
 				++mBucket;
-				for (; mBucket < mOwner->BucketCount(); ++mBucket)
+				for (; mBucket < mOwner->ChainCount(); ++mBucket)
 				{
-					if (!mOwner->mBuckets[mBucket].IsEmpty())
+					if (!mOwner->Chain(mBucket).IsEmpty())
 					{
-						mChainIterator = mOwner->mBuckets[mBucket].begin();
+						mChainIterator = mOwner->Chain(mBucket).begin();
 						return *this;
 					}
 				}
 
-				if (mBucket == mOwner->BucketCount())
+				if (mBucket == mOwner->ChainCount())
 				{
 					mChainIterator = ChainConstIterator();
 				}
@@ -600,8 +905,8 @@ namespace FieaGameEngine
 		return *this;
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	typename HashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator HashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator::operator++(int)
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	typename HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ConstIterator HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ConstIterator::operator++(int)
 	{
 		ConstIterator temp = *this;
 		operator++();
@@ -609,25 +914,25 @@ namespace FieaGameEngine
 		return temp;
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	const typename HashMap<TKey, TValue, THashFunctor, TKeyComparator>::PairType& HashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator::operator*() const
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	const typename HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::PairType& HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ConstIterator::operator*() const
 	{
 		if (mOwner == nullptr)
 		{
 			throw std::exception("Unassociated iterator.");
 		}
 
-		return *mChainIterator;
+		return (*mChainIterator).Pair;
 	}
 
-	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator>
-	const typename HashMap<TKey, TValue, THashFunctor, TKeyComparator>::PairType* HashMap<TKey, TValue, THashFunctor, TKeyComparator>::ConstIterator::operator->() const
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	const typename HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::PairType* HashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ConstIterator::operator->() const
 	{
 		if (mOwner == nullptr)
 		{
 			throw std::exception("Unassociated iterator.");
 		}
 
-		return &(*mChainIterator);
+		return &(*mChainIterator).Pair;
 	}
 }
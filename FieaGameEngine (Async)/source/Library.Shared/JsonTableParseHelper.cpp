@@ -1,5 +1,6 @@
 #include "pch.h"
 #include <string>
+#include <string_view>
 #include "JsonTableParseHelper.h"
 #include "Scope.h"
 #include "Factory.h"
@@ -10,7 +11,7 @@ namespace FieaGameEngine
 {
 	RTTI_DEFINITIONS(JsonTableParseHelper)
 
-	const HashMap<std::string, Datum::DatumType> JsonTableParseHelper::sDataTypes = 
+	const FrozenHashMap<std::string, Datum::DatumType> JsonTableParseHelper::sDataTypes =
 	{
 		{ "integer", Datum::DatumType::INTEGER },
 		{ "float", Datum::DatumType::FLOAT },
@@ -50,7 +51,13 @@ namespace FieaGameEngine
 			// set the type of the datum
 			else if (name == "type")
 			{
-				Datum::DatumType type = sDataTypes.At(value.asString());
+				// look the type name up in place instead of copying it out of the value,
+				// anything but a string leaves an empty name which is not a valid type
+				const char* begin = nullptr;
+				const char* end = nullptr;
+				value.getString(&begin, &end);
+
+				Datum::DatumType type = sDataTypes.At(std::string_view(begin, static_cast<size_t>(end - begin)));
 				StackFrame& frame = mStack.Top();
 				frame.Table[frame.Name].SetType(type);
 			}
@@ -82,6 +89,9 @@ namespace FieaGameEngine
 					{
 						frame.Table.AppendScope(frame.Name);
 					}
+
+					// the class names this element only, the next one in the array names its own or is a plain scope
+					frame.ClassName.clear();
 				}
 
 				// add/set value
@@ -174,7 +184,17 @@ namespace FieaGameEngine
 			datum.Resize(datum.Size() + 1);
 		}
 
-		datum.SetFromString(value.asString(), index);
+		// parse the characters where the value keeps them, only other kinds of values get converted to a string
+		const char* begin = nullptr;
+		const char* end = nullptr;
+		if (value.getString(&begin, &end))
+		{
+			datum.SetFromString(std::string_view(begin, static_cast<size_t>(end - begin)), index);
+		}
+		else
+		{
+			datum.SetFromString(value.asString(), index);
+		}
 	}
 
 
@@ -4,6 +4,7 @@
 #include "JsonParseMaster.h"
 #include "Stack.h"
 #include "HashMap.h"
+#include "FrozenHashMap.h"
 #include "Datum.h"
 
 namespace FieaGameEngine
@@ -61,9 +62,9 @@ namespace FieaGameEngine
 
 	private:
 		/// <summary>
-		/// stack of frames to correctly parse nested values
+		/// stack of frames to correctly parse nested values, usual nesting depths fit inline
 		/// </summary>
-		Stack<StackFrame> mStack;
+		Stack<StackFrame, 8> mStack;
 
 		/// <summary>
 		/// sets the parsed value as integer at the given index
@@ -102,7 +103,7 @@ namespace FieaGameEngine
 		/// <summary>
 		/// map of grammar data types to datum types
 		/// </summary>
-		static const HashMap<std::string, Datum::DatumType> sDataTypes;
+		static const FrozenHashMap<std::string, Datum::DatumType> sDataTypes;
 
 		using ValueSetter = void (JsonTableParseHelper::*)(Scope&, const std::string&, const Json::Value&, size_t);
 		static const ValueSetter sValueSetters[static_cast<size_t>(Datum::DatumType::LAST) + 1];
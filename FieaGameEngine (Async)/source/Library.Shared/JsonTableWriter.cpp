@@ -0,0 +1,198 @@
+#include "pch.h"
+#include "JsonTableWriter.h"
+#include <cmath>
+#include <fstream>
+#include <iterator>
+#include <string_view>
+#include "Scope.h"
+#include "Datum.h"
+
+using namespace std::literals::string_view_literals;
+
+namespace FieaGameEngine
+{
+	namespace
+	{
+		/// <summary>
+		/// Grammar names of the datum types, empty for the ones without a text form
+		/// </summary>
+		const std::string_view sTypeNames[] =
+		{
+			""sv,
+			"integer"sv,
+			"float"sv,
+			"vector"sv,
+			"matrix"sv,
+			"string"sv,
+			""sv,
+			"table"sv
+		};
+
+		static_assert(std::size(sTypeNames) == static_cast<size_t>(Datum::DatumType::LAST) + 1, "One name per datum type.");
+
+		/// <summary>
+		/// Whether every float component of a datum is finite, JSON has no literal for inf or nan
+		/// </summary>
+		template <typename T>
+		bool AllFinite(const Datum& datum)
+		{
+			for (const T& value : datum.AsConstSpan<T>())
+			{
+				const float* components = reinterpret_cast<const float*>(&value);
+				for (size_t i = 0; i < sizeof(T) / sizeof(float); ++i)
+				{
+					if (!std::isfinite(components[i]))
+					{
+						return false;
+					}
+				}
+			}
+
+			return true;
+		}
+	}
+
+	void JsonTableWriter::Write(const Scope& scope, TextWriter& writer)
+	{
+		writer.Write('{');
+
+		bool first = true;
+		for (size_t i = 0; i < scope.Size(); ++i)
+		{
+			const Datum& datum = scope[i];
+			const std::string_view type = sTypeNames[static_cast<size_t>(datum.Type())];
+			if (type.empty())
+			{
+				continue;
+			}
+
+			if (!first)
+			{
+				writer.Write(',');
+			}
+			first = false;
+
+			writer.WriteQuoted(scope.NameAt(i).View());
+			writer.Write(R"(:{"type":")"sv).Write(type).Write(R"(","value":)"sv);
+
+			if (datum.Type() == Datum::DatumType::TABLE)
+			{
+				WriteScopes(datum, writer);
+			}
+			else
+			{
+				WriteValues(datum, writer);
+			}
+
+			writer.Write('}');
+		}
+
+		writer.Write('}');
+	}
+
+	std::string JsonTableWriter::ToString(const Scope& scope)
+	{
+		std::string json;
+		TextWriter writer(json);
+		Write(scope, writer);
+
+		return json;
+	}
+
+	void JsonTableWriter::WriteToFile(const Scope& scope, const std::string& filename)
+	{
+		std::ofstream fileStream(filename, std::ios::binary | std::ios::trunc);
+		if (!fileStream.good())
+		{
+			throw std::exception("Error opening file.");
+		}
+
+		TextWriter writer(fileStream);
+		Write(scope, writer);
+	}
+
+	void JsonTableWriter::WriteValues(const Datum& datum, TextWriter& writer)
+	{
+		bool finite = true;
+		switch (datum.Type())
+		{
+		case Datum::DatumType::FLOAT:
+			finite = AllFinite<float>(datum);
+			break;
+		case Datum::DatumType::VECTOR:
+			finite = AllFinite<glm::vec4>(datum);
+			break;
+		case Datum::DatumType::MATRIX:
+			finite = AllFinite<glm::mat4>(datum);
+			break;
+		default:
+			break;
+		}
+
+		if (!finite)
+		{
+			throw std::exception("Non-finite values have no JSON form.");
+		}
+
+		const size_t size = datum.Size();
+		if (size != 1)
+		{
+			writer.Write('[');
+		}
+
+		for (size_t i = 0; i < size; ++i)
+		{
+			if (i > 0)
+			{
+				writer.Write(',');
+			}
+
+			switch (datum.Type())
+			{
+			case Datum::DatumType::INTEGER:
+			case Datum::DatumType::FLOAT:
+				writer.Write(datum, i);
+				break;
+			case Datum::DatumType::STRING:
+				writer.WriteQuoted(datum.GetUnchecked<std::string>(i));
+				break;
+			default:
+				// vectors and matrices never hold anything that needs escaping
+				writer.Write('"').Write(datum, i).Write('"');
+				break;
+			}
+		}
+
+		if (size != 1)
+		{
+			writer.Write(']');
+		}
+	}
+
+	void JsonTableWriter::WriteScopes(const Datum& datum, TextWriter& writer)
+	{
+		writer.Write('[');
+
+		const auto scopes = datum.AsConstSpan<Scope*>();
+		for (size_t i = 0; i < scopes.size(); ++i)
+		{
+			if (i > 0)
+			{
+				writer.Write(',');
+			}
+
+			writer.Write(R"({"type":"table",)"sv);
+
+			if (scopes[i]->TypeIdInstance() != Scope::TypeIdClass())
+			{
+				writer.Write(R"("class":")"sv).Write(scopes[i]->TypeNameInstance()).Write(R"(",)"sv);
+			}
+
+			writer.Write(R"("value":)"sv);
+			Write(*scopes[i], writer);
+			writer.Write('}');
+		}
+
+		writer.Write(']');
+	}
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+/// \file JsonTableWriter.h
+/// \brief Definition of JsonTableWriter class
+
+#include <string>
+#include "TextWriter.h"
+
+namespace FieaGameEngine
+{
+	class Scope;
+	class Datum;
+
+	/// <summary>
+	/// Writes scopes in the grammar JsonTableParseHelper reads:
+	/// { "Health": { "type": "integer", "value": 100 }, "Items": { "type": "table", "value": [ { "type": "table", "class": "Item", "value": { ... } } ] } }
+	/// Nested scopes of any type but Scope carry their class, so the factories can create them again on load.
+	/// Pointers, "this" among them, and datums without a type have no text form and are left out
+	/// </summary>
+	class JsonTableWriter final
+	{
+	public:
+		JsonTableWriter() = delete;
+
+		/// <summary>
+		/// Writes a scope and everything nested in it
+		/// </summary>
+		/// <exception cref="std::exception">Thrown if a float, vector or matrix holds an infinity or NaN</exception>
+		/// <param name="scope">Scope</param>
+		/// <param name="writer">Writer to append the JSON to</param>
+		static void Write(const Scope& scope, TextWriter& writer);
+
+		/// <summary>
+		/// Writes a scope into a new string
+		/// </summary>
+		/// <exception cref="std::exception">Thrown if a float, vector or matrix holds an infinity or NaN</exception>
+		/// <param name="scope">Scope</param>
+		/// <returns>JSON text</returns>
+		static std::string ToString(const Scope& scope);
+
+		/// <summary>
+		/// Writes a scope into a file, replacing it
+		/// </summary>
+		/// <exception cref="std::exception">Thrown if the file cannot be opened, or if a float, vector or matrix holds an infinity or NaN</exception>
+		/// <param name="scope">Scope</param>
+		/// <param name="filename">Path of the file</param>
+		static void WriteToFile(const Scope& scope, const std::string& filename);
+
+	private:
+		/// <summary>
+		/// Writes the value of a datum with a text form, bare if it holds one element and as an array otherwise.
+		/// Checks every component before writing any, so a rejected datum leaves nothing of itself behind
+		/// </summary>
+		/// <exception cref="std::exception">Thrown if a float, vector or matrix holds an infinity or NaN</exception>
+		static void WriteValues(const Datum& datum, TextWriter& writer);
+
+		/// <summary>
+		/// Writes the nested scopes of a table datum as an array
+		/// </summary>
+		static void WriteScopes(const Datum& datum, TextWriter& writer);
+	};
+}
@@ -0,0 +1,447 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <initializer_list>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include "Allocator.h"
+#include "DefaultHash.h"
+#include "DefaultComparator.h"
+#include "vector.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Map like container that remembers the order its keys were added in.
+	/// The pairs live contiguously in insertion order, next to them a small open addressing index of
+	/// 32 bit slots maps hashes to positions: the low 24 bits of a slot hold the position of a pair plus one,
+	/// the high 8 bits a fragment of its hash, so probing only compares keys whose fragment matches.
+	/// Looking a pair up by position is plain array indexing.
+	/// Adding a pair may move the others, so references to them only last until the next insertion
+	/// </summary>
+	template
+		<typename TKey,
+		typename TValue,
+		typename THashFunctor = DefaultHash<TKey>,
+		typename TKeyComparator = DefaultComparator<TKey>,
+		typename TAllocator = DefaultAllocator>
+	class OrderedHashMap final
+	{
+	public:
+		using PairType = std::pair<const TKey, TValue>;
+
+	private:
+		using EntryListType = Vector<PairType, DefaultComparator<PairType>, TAllocator>;
+		using SlotType = std::uint32_t;
+		using IndexType = Vector<SlotType, DefaultComparator<SlotType>, TAllocator>;
+
+		template <typename TLookup>
+		using EnableIfTransparent = std::enable_if_t<IsTransparentKey<THashFunctor, TKeyComparator, TLookup>::value>;
+
+		/// <summary>
+		/// Bits of a slot holding the position of its pair, the rest hold the hash fragment
+		/// </summary>
+		static constexpr size_t PositionBits = 24;
+
+		/// <summary>
+		/// Mask of the position bits of a slot
+		/// </summary>
+		static constexpr SlotType PositionMask = (SlotType(1) << PositionBits) - 1;
+
+		/// <summary>
+		/// Slot that points at no pair
+		/// </summary>
+		static constexpr SlotType Empty = 0;
+
+		/// <summary>
+		/// Fewest slots of a non empty index
+		/// </summary>
+		static constexpr size_t MinSlotCount = 8;
+
+	public:
+		/// <summary>
+		/// Most pairs the map can hold, positions are stored plus one in the position bits
+		/// </summary>
+		static constexpr size_t MaxSize = PositionMask - 1;
+
+		/// <summary>
+		/// Pairs are iterated in insertion order, the iterators are the ones of the underlying vector
+		/// </summary>
+		using Iterator = typename EntryListType::Iterator;
+		using ConstIterator = typename EntryListType::ConstIterator;
+
+		/// <summary>
+		/// Creates an empty map with room for the given number of pairs
+		/// </summary>
+		/// <param name="capacity">Number of pairs to reserve room for</param>
+		/// <param name="allocator">Allocator of the pairs and the index</param>
+		explicit OrderedHashMap(size_t capacity = 0, const TAllocator& allocator = TAllocator());
+
+		/// <summary>
+		/// Creates a map with the given pairs, in the given order. Repeated keys keep their first value
+		/// </summary>
+		/// <param name="list">Key value pairs</param>
+		OrderedHashMap(std::initializer_list<PairType> list);
+
+		OrderedHashMap(const OrderedHashMap&) = default;
+		OrderedHashMap(OrderedHashMap&&) = default;
+		OrderedHashMap& operator=(const OrderedHashMap&) = default;
+		OrderedHashMap& operator=(OrderedHashMap&&) = default;
+		~OrderedHashMap() = default;
+
+		/// <summary>
+		/// Replaces the contents of the map with the given pairs
+		/// </summary>
+		/// <param name="list">Key value pairs</param>
+		/// <returns>Reference to self</returns>
+		OrderedHashMap& operator=(std::initializer_list<PairType> list);
+
+		/// <summary>
+		/// Gets a reference to the mapped value for the given key, adding a default constructed value if not present
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <returns>A reference to the mapped value for the given key</returns>
+		TValue& operator[](const TKey& key);
+
+		/// <summary>
+		/// Gets a reference to the mapped value for the given key, adding a default constructed value if not present
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <returns>A reference to the mapped value for the given key</returns>
+		TValue& operator[](TKey&& key);
+
+		/// <summary>
+		/// Gets a reference to the mapped value for the given key if found
+		/// </summary>
+		/// <exception cref="std::exception">Thrown if the key is not present</exception>
+		/// <param name="key">Key</param>
+		/// <returns>A reference to the mapped value for the given key if found</returns>
+		TValue& At(const TKey& key);
+
+		/// <summary>
+		/// Gets a reference to the mapped value for the given key if found
+		/// </summary>
+		/// <exception cref="std::exception">Thrown if the key is not present</exception>
+		/// <param name="key">Key</param>
+		/// <returns>A reference to the mapped value for the given key if found</returns>
+		const TValue& At(const TKey& key) const;
+
+		/// <summary>
+		/// Gets a reference to the mapped value for a key of another type, only available
+		/// when the hash functor and key comparator are transparent (e.g. std::string_view on std::string keys)
+		/// </summary>
+		/// <exception cref="std::exception">Thrown if the key is not present</exception>
+		/// <param name="key">Key</param>
+		/// <returns>A reference to the mapped value for the given key if found</returns>
+		template <typename TLookup, typename = EnableIfTransparent<TLookup>>
+		TValue& At(const TLookup& key);
+
+		/// <summary>
+		/// Gets a reference to the mapped value for a key of another type, only available
+		/// when the hash functor and key comparator are transparent (e.g. std::string_view on std::string keys)
+		/// </summary>
+		/// <exception cref="std::exception">Thrown if the key is not present</exception>
+		/// <param name="key">Key</param>
+		/// <returns>A reference to the mapped value for the given key if found</returns>
+		template <typename TLookup, typename = EnableIfTransparent<TLookup>>
+		const TValue& At(const TLookup& key) const;
+
+		/// <summary>
+		/// Gets the pair at the given position in insertion order
+		/// </summary>
+		/// <exception cref="std::exception">Thrown if the position is out of range</exception>
+		/// <param name="index">Position</param>
+		/// <returns>Reference to the pair</returns>
+		PairType& EntryAt(size_t index);
+
+		/// <summary>
+		/// Gets the pair at the given position in insertion order
+		/// </summary>
+		/// <exception cref="std::exception">Thrown if the position is out of range</exception>
+		/// <param name="index">Position</param>
+		/// <returns>Reference to the pair</returns>
+		const PairType& EntryAt(size_t index) const;
+
+		/// <summary>
+		/// Adds a copy of the given pair at the end if its key is not present
+		/// </summary>
+		/// <exception cref="std::exception">Thrown if the map already holds MaxSize pairs</exception>
+		/// <param name="pair">Key value pair</param>
+		/// <returns>Iterator to the pair with the given key and whether it was added</returns>
+		std::pair<Iterator, bool> Insert(const PairType& pair);
+
+		/// <summary>
+		/// Moves the given pair to the end if its key is not present
+		/// </summary>
+		/// <exception cref="std::exception">Thrown if the map already holds MaxSize pairs</exception>
+		/// <param name="pair">Key value pair</param>
+		/// <returns>Iterator to the pair with the given key and whether it was added</returns>
+		std::pair<Iterator, bool> Insert(PairType&& pair);
+
+		/// <summary>
+		/// Builds a pair from the given arguments and adds it at the end if its key is not present
+		/// </summary>
+		/// <exception cref="std::exception">Thrown if the map already holds MaxSize pairs</exception>
+		/// <param name="args">Arguments of the pair constructor</param>
+		/// <returns>Iterator to the pair with the given key and whether it was added</returns>
+		template <typename... Args>
+		std::pair<Iterator, bool> Emplace(Args&&... args);
+
+		/// <summary>
+		/// Looks for the given key in the collection
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <returns>Iterator to the value if found, end iterator otherwise</returns>
+		Iterator Find(const TKey& key);
+
+		/// <summary>
+		/// Looks for the given key in the collection
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <returns>Iterator to the value if found, end iterator otherwise</returns>
+		ConstIterator Find(const TKey& key) const;
+
+		/// <summary>
+		/// Looks for a key of another type without converting it to TKey, only available
+		/// when the hash functor and key comparator are transparent (e.g. std::string_view on std::string keys)
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <returns>Iterator to the value if found, end iterator otherwise</returns>
+		template <typename TLookup, typename = EnableIfTransparent<TLookup>>
+		Iterator Find(const TLookup& key);
+
+		/// <summary>
+		/// Looks for a key of another type without converting it to TKey, only available
+		/// when the hash functor and key comparator are transparent (e.g. std::string_view on std::string keys)
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <returns>Iterator to the value if found, end iterator otherwise</returns>
+		template <typename TLookup, typename = EnableIfTransparent<TLookup>>
+		ConstIterator Find(const TLookup& key) const;
+
+		/// <summary>
+		/// Removes the pair with the given key, the pairs after it move down one position
+		/// and the index is rebuilt, so removing is linear in the size
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <returns>True if a pair was removed, false otherwise</returns>
+		bool Remove(const TKey& key);
+
+		/// <summary>
+		/// Removes the pair the given iterator points to, the pairs after it move down one position
+		/// </summary>
+		/// <param name="it">Iterator</param>
+		/// <returns>True if a pair was removed, false otherwise</returns>
+		bool Remove(const Iterator& it);
+
+		/// <summary>
+		/// Removes the pairs in the given range, the pairs after it move down.
+		/// Only the keys of the removed pairs and of their clusters are hashed again
+		/// </summary>
+		/// <exception cref="std::exception">Thrown if the iterators are not associated with this container or the range is invalid</exception>
+		/// <param name="first">Iterator to the first pair to remove</param>
+		/// <param name="last">Iterator past the last pair to remove</param>
+		void Remove(const Iterator& first, const Iterator& last);
+
+		/// <summary>
+		/// Makes room for the given number of pairs in both the pairs and the index
+		/// </summary>
+		/// <param name="count">Number of pairs</param>
+		void Reserve(size_t count);
+
+		/// <summary>
+		/// Checks if the given key is present in the collection
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <returns>True if present, false otherwise</returns>
+		bool ContainsKey(const TKey& key) const;
+
+		/// <summary>
+		/// Checks if the given key is present in the collection
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <param name="out">Iterator to output if found</param>
+		/// <returns>True if present, false otherwise</returns>
+		bool ContainsKey(const TKey& key, Iterator& out);
+
+		/// <summary>
+		/// Checks if the given key is present in the collection
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <param name="out">Iterator to output if found</param>
+		/// <returns>True if present, false otherwise</returns>
+		bool ContainsKey(const TKey& key, ConstIterator& out) const;
+
+		/// <summary>
+		/// Checks if a key of another type is present, only available when
+		/// the hash functor and key comparator are transparent
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <returns>True if present, false otherwise</returns>
+		template <typename TLookup, typename = EnableIfTransparent<TLookup>>
+		bool ContainsKey(const TLookup& key) const;
+
+		/// <summary>
+		/// Checks if a key of another type is present, only available when
+		/// the hash functor and key comparator are transparent
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <param name="out">Iterator to output if found</param>
+		/// <returns>True if present, false otherwise</returns>
+		template <typename TLookup, typename = EnableIfTransparent<TLookup>>
+		bool ContainsKey(const TLookup& key, Iterator& out);
+
+		/// <summary>
+		/// Checks if a key of another type is present, only available when
+		/// the hash functor and key comparator are transparent
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <param name="out">Iterator to output if found</param>
+		/// <returns>True if present, false otherwise</returns>
+		template <typename TLookup, typename = EnableIfTransparent<TLookup>>
+		bool ContainsKey(const TLookup& key, ConstIterator& out) const;
+
+		/// <summary>
+		/// Removes all the pairs, keeping the storage
+		/// </summary>
+		void Clear();
+
+		/// <summary>
+		/// Gets the number of elements in the collection
+		/// </summary>
+		/// <returns>Number of elements in the collection</returns>
+		size_t Size() const;
+
+		/// <summary>
+		/// Checks if the collection is empty
+		/// </summary>
+		/// <returns>True if empty, false otherwise</returns>
+		bool IsEmpty() const;
+
+		/// <summary>
+		/// Gets the number of pairs that fit before the pairs have to move
+		/// </summary>
+		/// <returns>Capacity of the pair storage</returns>
+		size_t Capacity() const;
+
+		/// <summary>
+		/// Gets the number of slots of the index
+		/// </summary>
+		/// <returns>Number of slots</returns>
+		size_t BucketCount() const;
+
+		/// <summary>
+		/// Gets an iterator to the first element in the collection
+		/// </summary>
+		/// <returns>Iterator to the first element</returns>
+		Iterator begin();
+
+		/// <summary>
+		/// Gets an iterator to the first element in the collection
+		/// </summary>
+		/// <returns>Iterator to the first element</returns>
+		ConstIterator begin() const;
+
+		/// <summary>
+		/// Gets an iterator past the last element in the collection
+		/// </summary>
+		/// <returns>Iterator past the last element</returns>
+		Iterator end();
+
+		/// <summary>
+		/// Gets an iterator past the last element in the collection
+		/// </summary>
+		/// <returns>Iterator past the last element</returns>
+		ConstIterator end() const;
+
+		/// <summary>
+		/// Gets an iterator to the first element in the collection
+		/// </summary>
+		/// <returns>Iterator to the first element</returns>
+		ConstIterator cbegin() const;
+
+		/// <summary>
+		/// Gets an iterator past the last element in the collection
+		/// </summary>
+		/// <returns>Iterator past the last element</returns>
+		ConstIterator cend() const;
+
+	private:
+		/// <summary>
+		/// Pairs in insertion order
+		/// </summary>
+		EntryListType mEntries;
+
+		/// <summary>
+		/// Open addressing index over the pairs, a power of two number of slots at most three quarters full
+		/// </summary>
+		IndexType mIndex;
+
+		/// <summary>
+		/// Hash functor
+		/// </summary>
+		FIEA_NO_UNIQUE_ADDRESS THashFunctor mHashFunctor;
+
+		/// <summary>
+		/// Key comparator
+		/// </summary>
+		FIEA_NO_UNIQUE_ADDRESS TKeyComparator mKeyComparator;
+
+		/// <summary>
+		/// Hashes the given key, mixing the result first if the functor is not avalanching,
+		/// so both the probe start and the fragment are usable
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <returns>Mixed hash of the key</returns>
+		template <typename TLookup>
+		size_t Hash(const TLookup& key) const;
+
+		/// <summary>
+		/// Gets the hash fragment of a slot, already shifted into place
+		/// </summary>
+		/// <param name="hash">Mixed hash</param>
+		/// <returns>Fragment bits of the slot</returns>
+		static SlotType Fragment(size_t hash);
+
+		/// <summary>
+		/// Looks for the position of the pair with the given key
+		/// </summary>
+		/// <param name="key">Key</param>
+		/// <param name="hash">Mixed hash of the key</param>
+		/// <returns>Position of the pair if found, the size otherwise</returns>
+		template <typename TLookup>
+		size_t FindPosition(const TLookup& key, size_t hash) const;
+
+		/// <summary>
+		/// Points the first free slot in the probe sequence of the given hash at a pair
+		/// </summary>
+		/// <param name="position">Position of the pair</param>
+		/// <param name="hash">Mixed hash of its key</param>
+		void Link(size_t position, size_t hash);
+
+		/// <summary>
+		/// Empties the slot pointing at a pair, moving back the slots after it in the cluster
+		/// </summary>
+		/// <param name="position">Position of the pair, still in place</param>
+		/// <param name="hash">Mixed hash of its key</param>
+		void Unlink(size_t position, size_t hash);
+
+		/// <summary>
+		/// Rebuilds the index with the given number of slots from the pairs
+		/// </summary>
+		/// <param name="slotCount">Number of slots, a power of two</param>
+		void Reindex(size_t slotCount);
+
+		/// <summary>
+		/// Gets the smallest index that holds the given number of pairs
+		/// </summary>
+		/// <param name="count">Number of pairs</param>
+		/// <returns>Number of slots, zero for no pairs</returns>
+		static size_t SlotCountFor(size_t count);
+	};
+}
+
+#include "OrderedHashMap.inl"
@@ -0,0 +1,511 @@
+#include "OrderedHashMap.h"
+#include <algorithm>
+
+namespace FieaGameEngine
+{
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::OrderedHashMap(size_t capacity, const TAllocator& allocator) :
+		mEntries(allocator, capacity), mIndex(allocator)
+	{
+		if (capacity > 0)
+		{
+			Reindex(SlotCountFor(capacity));
+		}
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::OrderedHashMap(std::initializer_list<PairType> list) :
+		OrderedHashMap(list.size())
+	{
+		for (const auto& pair : list)
+		{
+			Insert(pair);
+		}
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>& OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::operator=(std::initializer_list<PairType> list)
+	{
+		Clear();
+		Reserve(list.size());
+
+		for (const auto& pair : list)
+		{
+			Insert(pair);
+		}
+
+		return *this;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline TValue& OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::operator[](const TKey& key)
+	{
+		const size_t position = FindPosition(key, Hash(key));
+
+		if (position != mEntries.Size())
+		{
+			return mEntries[position].second;
+		}
+
+		return (*Emplace(key, TValue()).first).second;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline TValue& OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::operator[](TKey&& key)
+	{
+		const size_t position = FindPosition(key, Hash(key));
+
+		if (position != mEntries.Size())
+		{
+			return mEntries[position].second;
+		}
+
+		return (*Emplace(std::move(key), TValue()).first).second;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	TValue& OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::At(const TKey& key)
+	{
+		const size_t position = FindPosition(key, Hash(key));
+
+		if (position == mEntries.Size())
+		{
+			throw std::exception("Key not found.");
+		}
+
+		return mEntries[position].second;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	const TValue& OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::At(const TKey& key) const
+	{
+		const size_t position = FindPosition(key, Hash(key));
+
+		if (position == mEntries.Size())
+		{
+			throw std::exception("Key not found.");
+		}
+
+		return mEntries[position].second;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	template <typename TLookup, typename>
+	TValue& OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::At(const TLookup& key)
+	{
+		const size_t position = FindPosition(key, Hash(key));
+
+		if (position == mEntries.Size())
+		{
+			throw std::exception("Key not found.");
+		}
+
+		return mEntries[position].second;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	template <typename TLookup, typename>
+	const TValue& OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::At(const TLookup& key) const
+	{
+		const size_t position = FindPosition(key, Hash(key));
+
+		if (position == mEntries.Size())
+		{
+			throw std::exception("Key not found.");
+		}
+
+		return mEntries[position].second;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline typename OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::PairType& OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::EntryAt(size_t index)
+	{
+		return mEntries[index];
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline const typename OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::PairType& OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::EntryAt(size_t index) const
+	{
+		return mEntries[index];
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline std::pair<typename OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Iterator, bool> OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Insert(const PairType& pair)
+	{
+		return Emplace(pair);
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline std::pair<typename OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Iterator, bool> OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Insert(PairType&& pair)
+	{
+		return Emplace(std::move(pair));
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	template <typename... Args>
+	std::pair<typename OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Iterator, bool> OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Emplace(Args&&... args)
+	{
+		// built up front so a present key leaves the pairs where they are
+		PairType pair(std::forward<Args>(args)...);
+		const size_t hash = Hash(pair.first);
+
+		const size_t position = FindPosition(pair.first, hash);
+		if (position != mEntries.Size())
+		{
+			return std::pair(mEntries.begin() + position, false);
+		}
+
+		if (mEntries.Size() == MaxSize)
+		{
+			throw std::exception("The map is full.");
+		}
+
+		const size_t slotCount = SlotCountFor(mEntries.Size() + 1);
+		if (slotCount > mIndex.Size())
+		{
+			Reindex(slotCount);
+		}
+
+		mEntries.EmplaceBack(std::move(pair));
+		Link(mEntries.Size() - 1, hash);
+
+		return std::pair(mEntries.end() - 1, true);
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline typename OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Iterator OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Find(const TKey& key)
+	{
+		return mEntries.begin() + FindPosition(key, Hash(key));
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline typename OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ConstIterator OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Find(const TKey& key) const
+	{
+		return mEntries.begin() + FindPosition(key, Hash(key));
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	template <typename TLookup, typename>
+	inline typename OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Iterator OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Find(const TLookup& key)
+	{
+		return mEntries.begin() + FindPosition(key, Hash(key));
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	template <typename TLookup, typename>
+	inline typename OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ConstIterator OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Find(const TLookup& key) const
+	{
+		return mEntries.begin() + FindPosition(key, Hash(key));
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	bool OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Remove(const TKey& key)
+	{
+		return Remove(Find(key));
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	bool OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Remove(const Iterator& it)
+	{
+		if (it == mEntries.end())
+		{
+			return false;
+		}
+
+		Remove(it, it + 1);
+
+		return true;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	void OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Remove(const Iterator& first, const Iterator& last)
+	{
+		const size_t from = static_cast<size_t>(first - mEntries.begin());
+		const size_t to = static_cast<size_t>(last - mEntries.begin());
+		if (from > to)
+		{
+			throw std::exception("Invalid range.");
+		}
+
+		const size_t count = to - from;
+		if (count == 0)
+		{
+			return;
+		}
+
+		// most of the map is going, building the index again is cheaper than mending it
+		if (count * 2 > mEntries.Size())
+		{
+			mEntries.Remove(first, last);
+			Reindex(mIndex.Size());
+			return;
+		}
+
+		for (size_t position = from; position < to; ++position)
+		{
+			Unlink(position, Hash(mEntries[position].first));
+		}
+
+		mEntries.Remove(first, last);
+
+		// the pairs past the range moved down, their slots only need their positions fixed
+		if (from < mEntries.Size())
+		{
+			for (SlotType& value : mIndex.AsSpan())
+			{
+				if (value != Empty && (value & PositionMask) > to)
+				{
+					value -= static_cast<SlotType>(count);
+				}
+			}
+		}
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	void OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Reserve(size_t count)
+	{
+		mEntries.Reserve(count);
+
+		const size_t slotCount = SlotCountFor(count);
+		if (slotCount > mIndex.Size())
+		{
+			Reindex(slotCount);
+		}
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline bool OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ContainsKey(const TKey& key) const
+	{
+		return FindPosition(key, Hash(key)) != mEntries.Size();
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline bool OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ContainsKey(const TKey& key, Iterator& out)
+	{
+		out = Find(key);
+		return out != end();
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline bool OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ContainsKey(const TKey& key, ConstIterator& out) const
+	{
+		out = Find(key);
+		return out != end();
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	template <typename TLookup, typename>
+	inline bool OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ContainsKey(const TLookup& key) const
+	{
+		return FindPosition(key, Hash(key)) != mEntries.Size();
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	template <typename TLookup, typename>
+	inline bool OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ContainsKey(const TLookup& key, Iterator& out)
+	{
+		out = Find(key);
+		return out != end();
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	template <typename TLookup, typename>
+	inline bool OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ContainsKey(const TLookup& key, ConstIterator& out) const
+	{
+		out = Find(key);
+		return out != end();
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	void OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Clear()
+	{
+		mEntries.Clear();
+		std::fill(mIndex.begin(), mIndex.end(), Empty);
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline size_t OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Size() const
+	{
+		return mEntries.Size();
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline bool OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::IsEmpty() const
+	{
+		return mEntries.IsEmpty();
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline size_t OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Capacity() const
+	{
+		return mEntries.Capacity();
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline size_t OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::BucketCount() const
+	{
+		return mIndex.Size();
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline typename OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Iterator OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::begin()
+	{
+		return mEntries.begin();
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline typename OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ConstIterator OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::begin() const
+	{
+		return mEntries.begin();
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline typename OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Iterator OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::end()
+	{
+		return mEntries.end();
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline typename OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ConstIterator OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::end() const
+	{
+		return mEntries.end();
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline typename OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ConstIterator OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::cbegin() const
+	{
+		return mEntries.cbegin();
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline typename OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::ConstIterator OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::cend() const
+	{
+		return mEntries.cend();
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	template <typename TLookup>
+	inline size_t OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Hash(const TLookup& key) const
+	{
+		const size_t hash = mHashFunctor(key);
+
+		if constexpr (IsAvalanchingHash<THashFunctor>::value)
+		{
+			return hash;
+		}
+		else
+		{
+			return static_cast<size_t>(MixHash(hash));
+		}
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline typename OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::SlotType OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Fragment(size_t hash)
+	{
+		// the probe start takes the low bits of the hash, the fragment the top ones
+		return static_cast<SlotType>(hash >> (std::numeric_limits<size_t>::digits - (std::numeric_limits<SlotType>::digits - PositionBits))) << PositionBits;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	template <typename TLookup>
+	size_t OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::FindPosition(const TLookup& key, size_t hash) const
+	{
+		const size_t slotCount = mIndex.Size();
+		if (slotCount == 0)
+		{
+			return mEntries.Size();
+		}
+
+		const size_t mask = slotCount - 1;
+		const SlotType fragment = Fragment(hash);
+
+		// the index is never more than three quarters full, so the probe always meets an empty slot
+		for (size_t slot = hash & mask; ; slot = (slot + 1) & mask)
+		{
+			const SlotType value = mIndex[slot];
+			if (value == Empty)
+			{
+				return mEntries.Size();
+			}
+
+			if ((value & ~PositionMask) == fragment)
+			{
+				const size_t position = (value & PositionMask) - 1;
+				if (mKeyComparator(key, mEntries[position].first))
+				{
+					return position;
+				}
+			}
+		}
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	void OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Link(size_t position, size_t hash)
+	{
+		const size_t mask = mIndex.Size() - 1;
+
+		size_t slot = hash & mask;
+		while (mIndex[slot] != Empty)
+		{
+			slot = (slot + 1) & mask;
+		}
+
+		mIndex[slot] = Fragment(hash) | static_cast<SlotType>(position + 1);
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	void OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Unlink(size_t position, size_t hash)
+	{
+		const size_t mask = mIndex.Size() - 1;
+		const SlotType target = Fragment(hash) | static_cast<SlotType>(position + 1);
+
+		size_t hole = hash & mask;
+		while (mIndex[hole] != target)
+		{
+			hole = (hole + 1) & mask;
+		}
+
+		// pull back every later slot of the cluster whose probe sequence passes the hole, so no probe stops short
+		for (size_t slot = (hole + 1) & mask; mIndex[slot] != Empty; slot = (slot + 1) & mask)
+		{
+			const size_t home = Hash(mEntries[(mIndex[slot] & PositionMask) - 1].first) & mask;
+			if (((slot - home) & mask) >= ((slot - hole) & mask))
+			{
+				mIndex[hole] = mIndex[slot];
+				hole = slot;
+			}
+		}
+
+		mIndex[hole] = Empty;
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	void OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::Reindex(size_t slotCount)
+	{
+		mIndex.Clear();
+		mIndex.Reserve(slotCount);
+		mIndex.EmplaceBackN(slotCount, Empty);
+
+		for (size_t position = 0; position < mEntries.Size(); ++position)
+		{
+			Link(position, Hash(mEntries[position].first));
+		}
+	}
+
+	template <typename TKey, typename TValue, typename THashFunctor, typename TKeyComparator, typename TAllocator>
+	inline size_t OrderedHashMap<TKey, TValue, THashFunctor, TKeyComparator, TAllocator>::SlotCountFor(size_t count)
+	{
+		if (count == 0)
+		{
+			return 0;
+		}
+
+		size_t slotCount = MinSlotCount;
+		while (slotCount / 4 * 3 < count)
+		{
+			slotCount <<= 1;
+		}
+
+		return slotCount;
+	}
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <cstddef>
 
 namespace FieaGameEngine
@@ -39,6 +40,11 @@ namespace FieaGameEngine
 			return (Is(T::TypeIdClass()) ? reinterpret_cast<T*>(const_cast<RTTI*>(this)) : nullptr);
 		}
 
+		virtual std::string_view TypeNameInstance() const
+		{
+			return "RTTI";
+		}
+
 		virtual std::string ToString() const
 		{
 			return "RTTI";
@@ -56,6 +62,7 @@ namespace FieaGameEngine
 			static IdType TypeIdClass() { return sRunTimeTypeId; }																						\
 			static IdType ParentTypeIdClass() { return ParentType::TypeIdClass(); }																		\
 			virtual IdType TypeIdInstance() const override { return TypeIdClass(); }																	\
+			virtual std::string_view TypeNameInstance() const override { return #Type; }																\
 			virtual FieaGameEngine::RTTI* QueryInterface(const IdType id) override																		\
             {																																			\
 				return (id == sRunTimeTypeId ? reinterpret_cast<FieaGameEngine::RTTI*>(this) : ParentType::QueryInterface(id));							\
@@ -5,9 +5,9 @@ namespace FieaGameEngine
 {
 	RTTI_DEFINITIONS(Reaction)
 
-	Vector<Signature> Reaction::Signatures()
+	SignatureListType Reaction::Signatures()
 	{
-		return Vector<Signature>();
+		return SignatureListType();
 	}
 
 	void Reaction::Update(WorldState&)
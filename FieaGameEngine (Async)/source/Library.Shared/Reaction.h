@@ -17,7 +17,7 @@ namespace FieaGameEngine
 		/// <summary>
 		/// signatures
 		/// </summary>
-		static Vector<Signature> Signatures();
+		static SignatureListType Signatures();
 
 	public:
 		/// <summary>
@@ -12,7 +12,7 @@ namespace FieaGameEngine
 
 	const std::size_t ReactionAttributed::SubtypeKeyIndex = 3;
 
-	Vector<Signature> ReactionAttributed::Signatures()
+	SignatureListType ReactionAttributed::Signatures()
 	{
 		return {
 			{ SubtypeKey, Datum::DatumType::STRING, 1, offsetof(ReactionAttributed, mSubtype) }
@@ -21,19 +21,19 @@ namespace FieaGameEngine
 
 	ReactionAttributed::ReactionAttributed(const std::string& subtype, const std::string& name) : Reaction(TypeIdClass(), name), mSubtype(subtype)
 	{
-		assert(mList[SubtypeKeyIndex]->first == SubtypeKey);
+		assert(mMap.EntryAt(SubtypeKeyIndex).first == SubtypeKey);
 		Event<EventMessageAttributed>::Subscribe(*this);
 	}
 
 	ReactionAttributed::ReactionAttributed(const ReactionAttributed& other) : Reaction(other), mSubtype(other.mSubtype)
 	{
-		assert(mList[SubtypeKeyIndex]->first == SubtypeKey);
+		assert(mMap.EntryAt(SubtypeKeyIndex).first == SubtypeKey);
 		Event<EventMessageAttributed>::Subscribe(*this);
 	}
 
 	ReactionAttributed::ReactionAttributed(ReactionAttributed&& other) : Reaction(std::move(other)), mSubtype(std::move(mSubtype))
 	{
-		assert(mList[SubtypeKeyIndex]->first == SubtypeKey);
+		assert(mMap.EntryAt(SubtypeKeyIndex).first == SubtypeKey);
 		Event<EventMessageAttributed>::Subscribe(*this);
 	}
 
@@ -27,7 +27,7 @@ namespace FieaGameEngine
 		/// signatures
 		/// </summary>
 		/// <returns>signatures</returns>
-		static Vector<Signature> Signatures();
+		static SignatureListType Signatures();
 
 	public:
 		/// <summary>
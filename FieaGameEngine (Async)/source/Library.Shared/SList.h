@@ -6,6 +6,9 @@
 #include <cstddef>
 #include <exception>
 #include <initializer_list>
+#include "Allocator.h"
+#include "SlabAllocator.h"
+#include "TriviallyRelocatable.h"
 
 /// <summary>
 /// Contains all the classes and structures related to the Game Engine library
@@ -13,9 +16,10 @@
 namespace FieaGameEngine
 {
 	/// <summary>
-	/// Collection of singly linked elements, where every element has a pointer to the next one
+	/// Collection of singly linked elements, where every element has a pointer to the next one.
+	/// Nodes are allocated with TAllocator, by default from the shared slab pools, see SlabAllocator
 	/// </summary>
-	template <typename T>
+	template <typename T, typename TAllocator = SlabAllocator<>>
 	class SList final
 	{
 	private:
@@ -344,6 +348,12 @@ namespace FieaGameEngine
 		/// </summary>
 		SList() = default;
 
+		/// <summary>
+		/// Constructs an empty SList whose nodes are allocated with the given allocator
+		/// </summary>
+		/// <param name="allocator">Allocator for the nodes</param>
+		explicit SList(const TAllocator& allocator);
+
 		/// <summary>
 		/// Copy constructor, deep-copies input list into this list
 		/// </summary>
@@ -351,7 +361,7 @@ namespace FieaGameEngine
 		SList(const SList& other);
 
 		/// <summary>
-		/// Move constructor
+		/// Move constructor, takes the nodes along with the allocator that owns them
 		/// </summary>
 		/// <param name="other">List to be moved</param>
 		SList(SList&& other);
@@ -428,6 +438,15 @@ namespace FieaGameEngine
 		template <typename... Args>
 		Iterator EmplaceBack(Args&&... args);
 
+		/// <summary>
+		/// Moves the first node of the given list to the back of this list,
+		/// the element itself is not copied nor moved so pointers to it stay valid
+		/// </summary>
+		/// <exception cref="std::exception">Thrown if the given list is empty or uses a different allocator</exception>
+		/// <param name="other">List to take the node from</param>
+		/// <returns>An iterator that points to the spliced element</returns>
+		Iterator SpliceBack(SList& other);
+
 		/// <summary>
 		/// Removes the last element of the list
 		/// </summary>
@@ -579,6 +598,12 @@ namespace FieaGameEngine
 		/// <returns>An iterator pointing past the last element in the vector</returns>
 		ConstIterator cend() const;
 
+		/// <summary>
+		/// Gets the allocator the nodes are allocated with
+		/// </summary>
+		/// <returns>The allocator of this list</returns>
+		const TAllocator& GetAllocator() const;
+
 	private:
 		/// <summary>
 		/// Pointer to the first element of the list
@@ -595,11 +620,40 @@ namespace FieaGameEngine
 		/// </summary>
 		size_t mSize = 0;
 
+		/// <summary>
+		/// Where the nodes come from
+		/// </summary>
+		TAllocator mAllocator;
+
 		/// <summary>
 		/// Performs a deep copy of the input list into this list
 		/// </summary>
 		/// <param name="other">The list to be copied</param>
 		void DeepCopy(const SList& other);
+
+		/// <summary>
+		/// Allocates and constructs a node
+		/// </summary>
+		/// <param name="next">Node after the new one</param>
+		/// <param name="args">Arguments for the constructor of the element</param>
+		/// <returns>Pointer to the new node</returns>
+		template <typename... Args>
+		Node* CreateNode(Node* next, Args&&... args);
+
+		/// <summary>
+		/// Destroys a node and releases its memory
+		/// </summary>
+		/// <param name="node">Node to destroy</param>
+		void DestroyNode(Node* node);
+	};
+
+	/// <summary>
+	/// Nodes only point forward to other nodes, never back to the list, so a list can be moved by its bytes
+	/// as long as its allocator can
+	/// </summary>
+	template <typename T, typename TAllocator>
+	struct IsTriviallyRelocatable<SList<T, TAllocator>> : IsTriviallyRelocatable<TAllocator>
+	{
 	};
 }
 
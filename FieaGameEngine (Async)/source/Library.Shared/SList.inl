@@ -6,23 +6,30 @@
 namespace FieaGameEngine
 {
 #pragma region SList
-	template <typename T>
-	SList<T>::SList(const SList& other)
+	template <typename T, typename TAllocator>
+	SList<T, TAllocator>::SList(const TAllocator& allocator) :
+		mAllocator(allocator)
+	{
+	}
+
+	template <typename T, typename TAllocator>
+	SList<T, TAllocator>::SList(const SList& other) :
+		mAllocator(other.mAllocator)
 	{
 		DeepCopy(other);
 	}
 
-	template <typename T>
-	SList<T>::SList(SList&& other) :
-		mSize(other.mSize), mFront(other.mFront), mBack(other.mBack)
+	template <typename T, typename TAllocator>
+	SList<T, TAllocator>::SList(SList&& other) :
+		mFront(other.mFront), mBack(other.mBack), mSize(other.mSize), mAllocator(other.mAllocator)
 	{
 		other.mSize = 0;
 		other.mFront = nullptr;
 		other.mBack = nullptr;
 	}
 
-	template <typename T>
-	SList<T>::SList(std::initializer_list<T> list)
+	template <typename T, typename TAllocator>
+	SList<T, TAllocator>::SList(std::initializer_list<T> list)
 	{
 		for (const auto& item : list)
 		{
@@ -30,14 +37,14 @@ namespace FieaGameEngine
 		}
 	}
 
-	template <typename T>
-	SList<T>::~SList()
+	template <typename T, typename TAllocator>
+	SList<T, TAllocator>::~SList()
 	{
 		Clear();
 	}
 
-	template <typename T>
-	SList<T>& SList<T>::operator=(const SList& other)
+	template <typename T, typename TAllocator>
+	SList<T, TAllocator>& SList<T, TAllocator>::operator=(const SList& other)
 	{
 		if (this != &other)
 		{
@@ -52,8 +59,8 @@ namespace FieaGameEngine
 		return *this;
 	}
 
-	template <typename T>
-	SList<T>& SList<T>::operator=(SList&& other)
+	template <typename T, typename TAllocator>
+	SList<T, TAllocator>& SList<T, TAllocator>::operator=(SList&& other)
 	{
 		if (this != &other)
 		{
@@ -65,6 +72,7 @@ namespace FieaGameEngine
 			mSize = other.mSize;
 			mFront = other.mFront;
 			mBack = other.mBack;
+			mAllocator = other.mAllocator;
 
 			other.mSize = 0;
 			other.mFront = nullptr;
@@ -74,8 +82,8 @@ namespace FieaGameEngine
 		return *this;
 	}
 
-	template <typename T>
-	SList<T>& SList<T>::operator=(std::initializer_list<T> other)
+	template <typename T, typename TAllocator>
+	SList<T, TAllocator>& SList<T, TAllocator>::operator=(std::initializer_list<T> other)
 	{
 		if (mSize > 0)
 		{
@@ -90,23 +98,23 @@ namespace FieaGameEngine
 		return *this;
 	}
 
-	template <typename T>
-	typename SList<T>::Iterator SList<T>::PushFront(const T& item)
+	template <typename T, typename TAllocator>
+	typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::PushFront(const T& item)
 	{
 		return EmplaceFront(item);
 	}
 
-	template <typename T>
-	typename SList<T>::Iterator SList<T>::PushFront(T&& item)
+	template <typename T, typename TAllocator>
+	typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::PushFront(T&& item)
 	{
 		return EmplaceFront(std::move(item));
 	}
 
-	template <typename T>
+	template <typename T, typename TAllocator>
 	template <typename ...Args>
-	typename SList<T>::Iterator SList<T>::EmplaceFront(Args&&... args)
+	typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::EmplaceFront(Args&&... args)
 	{
-		mFront = new Node(mFront, std::forward<Args>(args)...);
+		mFront = CreateNode(mFront, std::forward<Args>(args)...);
 
 		if (mBack == nullptr)
 		{
@@ -118,8 +126,8 @@ namespace FieaGameEngine
 		return begin();
 	}
 
-	template <typename T>
-	void SList<T>::PopFront()
+	template <typename T, typename TAllocator>
+	void SList<T, TAllocator>::PopFront()
 	{
 		if (mSize == 0)
 		{
@@ -127,7 +135,7 @@ namespace FieaGameEngine
 		}
 
 		Node* node = mFront->Next;
-		delete mFront;
+		DestroyNode(mFront);
 		mFront = node;
 
 		if (mSize == 1)
@@ -138,23 +146,23 @@ namespace FieaGameEngine
 		--mSize;
 	}
 
-	template <typename T>
-	typename SList<T>::Iterator SList<T>::PushBack(const T& item)
+	template <typename T, typename TAllocator>
+	typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::PushBack(const T& item)
 	{
 		return EmplaceBack(item);
 	}
 
-	template <typename T>
-	typename SList<T>::Iterator SList<T>::PushBack(T&& item)
+	template <typename T, typename TAllocator>
+	typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::PushBack(T&& item)
 	{
 		return EmplaceBack(std::move(item));
 	}
 
-	template <typename T>
+	template <typename T, typename TAllocator>
 	template <typename... Args>
-	typename SList<T>::Iterator SList<T>::EmplaceBack(Args&&... args)
+	typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::EmplaceBack(Args&&... args)
 	{
-		Node* node = new Node(nullptr, std::forward<Args>(args)...);
+		Node* node = CreateNode(nullptr, std::forward<Args>(args)...);
 
 		if (mSize == 0)
 		{
@@ -171,8 +179,46 @@ namespace FieaGameEngine
 		return Iterator(*this, mBack);
 	}
 
-	template <typename T>
-	void SList<T>::PopBack()
+	template <typename T, typename TAllocator>
+	typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::SpliceBack(SList& other)
+	{
+		if (other.mSize == 0)
+		{
+			throw std::exception("List is empty.");
+		}
+
+		if (!(mAllocator == other.mAllocator))
+		{
+			throw std::exception("Lists use different allocators.");
+		}
+
+		Node* node = other.mFront;
+		other.mFront = node->Next;
+		--other.mSize;
+
+		if (other.mSize == 0)
+		{
+			other.mBack = nullptr;
+		}
+
+		node->Next = nullptr;
+		if (mSize == 0)
+		{
+			mFront = node;
+		}
+		else
+		{
+			mBack->Next = node;
+		}
+
+		mBack = node;
+		++mSize;
+
+		return Iterator(*this, mBack);
+	}
+
+	template <typename T, typename TAllocator>
+	void SList<T, TAllocator>::PopBack()
 	{
 		if (mSize == 0)
 		{
@@ -181,7 +227,7 @@ namespace FieaGameEngine
 
 		if (mSize == 1)
 		{
-			delete mBack;
+			DestroyNode(mBack);
 			mBack = nullptr;
 			mFront = nullptr;
 		}
@@ -194,7 +240,7 @@ namespace FieaGameEngine
 				currentNode = currentNode->Next;
 			}
 
-			delete mBack;
+			DestroyNode(mBack);
 			mBack = currentNode;
 			currentNode->Next = nullptr;
 		}
@@ -202,15 +248,15 @@ namespace FieaGameEngine
 		--mSize;
 	}
 
-	template <typename T>
-	typename SList<T>::Iterator SList<T>::InsertAfter(const Iterator& it, const T& data)
+	template <typename T, typename TAllocator>
+	typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::InsertAfter(const Iterator& it, const T& data)
 	{
 		if (this != it.mOwner || it.mNode == nullptr)
 		{
 			throw std::exception("Invalid iterator.");
 		}
 
-		Node* node = new Node(data, it.mNode->Next);
+		Node* node = CreateNode(it.mNode->Next, data);
 		it.mNode->Next = node;
 
 		if (mBack == it.mNode)
@@ -223,8 +269,8 @@ namespace FieaGameEngine
 		return Iterator(*this, node);
 	}
 
-	template <typename T>
-	bool SList<T>::Find(const T& data, Iterator& out)
+	template <typename T, typename TAllocator>
+	bool SList<T, TAllocator>::Find(const T& data, Iterator& out)
 	{
 		for (Iterator it = begin(); it != end(); ++it)
 		{
@@ -239,8 +285,8 @@ namespace FieaGameEngine
 		return false;
 	}
 
-	template <typename T>
-	bool SList<T>::Find(const T& data, ConstIterator& out) const
+	template <typename T, typename TAllocator>
+	bool SList<T, TAllocator>::Find(const T& data, ConstIterator& out) const
 	{
 		for (ConstIterator it = begin(); it != end(); ++it)
 		{
@@ -255,8 +301,8 @@ namespace FieaGameEngine
 		return false;
 	}
 
-	template <typename T>
-	typename SList<T>::Iterator SList<T>::Find(const T& data)
+	template <typename T, typename TAllocator>
+	typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::Find(const T& data)
 	{
 		Iterator it;
 		Find(data, it);
@@ -264,8 +310,8 @@ namespace FieaGameEngine
 		return it;
 	}
 
-	template <typename T>
-	typename SList<T>::ConstIterator SList<T>::Find(const T& data) const
+	template <typename T, typename TAllocator>
+	typename SList<T, TAllocator>::ConstIterator SList<T, TAllocator>::Find(const T& data) const
 	{
 		ConstIterator it;
 		Find(data, it);
@@ -273,8 +319,8 @@ namespace FieaGameEngine
 		return it;
 	}
 
-	template <typename T>
-	bool SList<T>::Remove(const T& data)
+	template <typename T, typename TAllocator>
+	bool SList<T, TAllocator>::Remove(const T& data)
 	{
 		Iterator it;
 		const bool found = Find(data, it);
@@ -287,8 +333,8 @@ namespace FieaGameEngine
 		return false;
 	}
 
-	template <typename T>
-	bool SList<T>::Remove(const Iterator& it)
+	template <typename T, typename TAllocator>
+	bool SList<T, TAllocator>::Remove(const Iterator& it)
 	{
 		if (it.mOwner != this)
 		{
@@ -314,7 +360,7 @@ namespace FieaGameEngine
 					mBack = it.mNode;
 				}
 
-				delete nodeToDelete;
+				DestroyNode(nodeToDelete);
 				--mSize;
 			}
 
@@ -324,8 +370,8 @@ namespace FieaGameEngine
 		return found;
 	}
 
-	template <typename T>
-	size_t SList<T>::Remove(const Iterator& first, const Iterator& last)
+	template <typename T, typename TAllocator>
+	size_t SList<T, TAllocator>::Remove(const Iterator& first, const Iterator& last)
 	{
 		if (first.mOwner != this || last.mOwner != this)
 		{
@@ -345,7 +391,7 @@ namespace FieaGameEngine
 			++it;
 			while (it < last)
 			{
-				delete (it++).mNode;
+				DestroyNode((it++).mNode);
 				--mSize;
 			}
 
@@ -361,14 +407,14 @@ namespace FieaGameEngine
 					mBack = first.mNode;
 				}
 
-				delete nodeToDelete;
+				DestroyNode(nodeToDelete);
 				--mSize;
 			}
 			else
 			{
 				if (mSize == 1)
 				{
-					delete first.mNode;
+					DestroyNode(first.mNode);
 					--mSize;
 					mFront = nullptr;
 					mBack = nullptr;
@@ -381,7 +427,7 @@ namespace FieaGameEngine
 						currentNode = currentNode->Next;
 					}
 
-					delete first.mNode;
+					DestroyNode(first.mNode);
 					--mSize;
 					currentNode->Next = nullptr;
 					mBack = currentNode;
@@ -392,8 +438,8 @@ namespace FieaGameEngine
 		return lastSize - mSize;
 	}
 
-	template <typename T>
-	void SList<T>::Clear()
+	template <typename T, typename TAllocator>
+	void SList<T, TAllocator>::Clear()
 	{
 		while (mSize > 0)
 		{
@@ -401,14 +447,14 @@ namespace FieaGameEngine
 		}
 	}
 
-	template <typename T>
-	inline bool SList<T>::IsEmpty() const
+	template <typename T, typename TAllocator>
+	inline bool SList<T, TAllocator>::IsEmpty() const
 	{
 		return mSize == 0;
 	}
 
-	template <typename T>
-	inline T& SList<T>::Front()
+	template <typename T, typename TAllocator>
+	inline T& SList<T, TAllocator>::Front()
 	{
 		if (mSize == 0)
 		{
@@ -418,14 +464,14 @@ namespace FieaGameEngine
 		return mFront->Data;
 	}
 
-	template <typename T>
-	inline const T& SList<T>::Front() const
+	template <typename T, typename TAllocator>
+	inline const T& SList<T, TAllocator>::Front() const
 	{
 		return const_cast<SList*>(this)->Front();
 	}
 
-	template <typename T>
-	inline T& SList<T>::Back()
+	template <typename T, typename TAllocator>
+	inline T& SList<T, TAllocator>::Back()
 	{
 		if (mSize == 0)
 		{
@@ -435,20 +481,49 @@ namespace FieaGameEngine
 		return mBack->Data;
 	}
 
-	template <typename T>
-	inline const T& SList<T>::Back() const
+	template <typename T, typename TAllocator>
+	inline const T& SList<T, TAllocator>::Back() const
 	{
 		return const_cast<SList*>(this)->Back();
 	}
 
-	template <typename T>
-	inline size_t SList<T>::Size() const
+	template <typename T, typename TAllocator>
+	inline size_t SList<T, TAllocator>::Size() const
 	{
 		return mSize;
 	}
 
-	template <typename T>
-	void SList<T>::DeepCopy(const SList<T>& rhs)
+	template <typename T, typename TAllocator>
+	inline const TAllocator& SList<T, TAllocator>::GetAllocator() const
+	{
+		return mAllocator;
+	}
+
+	template <typename T, typename TAllocator>
+	template <typename... Args>
+	inline typename SList<T, TAllocator>::Node* SList<T, TAllocator>::CreateNode(Node* next, Args&&... args)
+	{
+		void* memory = mAllocator.Allocate(sizeof(Node), alignof(Node));
+		try
+		{
+			return new (memory)Node(next, std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			mAllocator.Deallocate(memory, sizeof(Node), alignof(Node));
+			throw;
+		}
+	}
+
+	template <typename T, typename TAllocator>
+	inline void SList<T, TAllocator>::DestroyNode(Node* node)
+	{
+		node->~Node();
+		mAllocator.Deallocate(node, sizeof(Node), alignof(Node));
+	}
+
+	template <typename T, typename TAllocator>
+	void SList<T, TAllocator>::DeepCopy(const SList<T, TAllocator>& rhs)
 	{
 		for (const auto& data : rhs)
 		{
@@ -456,63 +531,63 @@ namespace FieaGameEngine
 		}
 	}
 
-	template <typename T>
-	inline typename SList<T>::Iterator SList<T>::begin()
+	template <typename T, typename TAllocator>
+	inline typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::begin()
 	{
 		return Iterator(*this, mFront);
 	}
 
-	template <typename T>
-	inline typename SList<T>::ConstIterator SList<T>::begin() const
+	template <typename T, typename TAllocator>
+	inline typename SList<T, TAllocator>::ConstIterator SList<T, TAllocator>::begin() const
 	{
 		return ConstIterator(*this, mFront);
 	}
 
-	template <typename T>
-	inline typename SList<T>::Iterator SList<T>::end()
+	template <typename T, typename TAllocator>
+	inline typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::end()
 	{
 		return Iterator(*this);
 	}
 
-	template <typename T>
-	inline typename SList<T>::ConstIterator SList<T>::end() const
+	template <typename T, typename TAllocator>
+	inline typename SList<T, TAllocator>::ConstIterator SList<T, TAllocator>::end() const
 	{
 		return ConstIterator(*this);
 	}
 
-	template <typename T>
-	inline typename SList<T>::ConstIterator SList<T>::cbegin() const
+	template <typename T, typename TAllocator>
+	inline typename SList<T, TAllocator>::ConstIterator SList<T, TAllocator>::cbegin() const
 	{
 		return ConstIterator(*this, mFront);
 	}
 
-	template <typename T>
-	inline typename SList<T>::ConstIterator SList<T>::cend() const
+	template <typename T, typename TAllocator>
+	inline typename SList<T, TAllocator>::ConstIterator SList<T, TAllocator>::cend() const
 	{
 		return ConstIterator(*this);
 	}
 #pragma endregion SList
 #pragma region Iterator
-	template <typename T>
-	SList<T>::Iterator::Iterator(const SList<T>& owner, Node* node) :
+	template <typename T, typename TAllocator>
+	SList<T, TAllocator>::Iterator::Iterator(const SList<T, TAllocator>& owner, Node* node) :
 		mOwner(&owner), mNode(node)
 	{
 	}
 
-	template <typename T>
-	inline bool SList<T>::Iterator::operator==(const Iterator& rhs) const
+	template <typename T, typename TAllocator>
+	inline bool SList<T, TAllocator>::Iterator::operator==(const Iterator& rhs) const
 	{
 		return !operator!=(rhs);
 	}
 
-	template <typename T>
-	inline bool SList<T>::Iterator::operator!=(const Iterator& rhs) const
+	template <typename T, typename TAllocator>
+	inline bool SList<T, TAllocator>::Iterator::operator!=(const Iterator& rhs) const
 	{
 		return (mOwner != rhs.mOwner) || (mNode != rhs.mNode);
 	}
 
-	template <typename T>
-	bool SList<T>::Iterator::operator>(const Iterator& other) const
+	template <typename T, typename TAllocator>
+	bool SList<T, TAllocator>::Iterator::operator>(const Iterator& other) const
 	{
 		if (mOwner != other.mOwner)
 		{
@@ -543,8 +618,8 @@ namespace FieaGameEngine
 		return false;
 	}
 
-	template <typename T>
-	bool SList<T>::Iterator::operator<(const Iterator& other) const
+	template <typename T, typename TAllocator>
+	bool SList<T, TAllocator>::Iterator::operator<(const Iterator& other) const
 	{
 		if (mOwner != other.mOwner)
 		{
@@ -575,8 +650,8 @@ namespace FieaGameEngine
 		return false;
 	}
 
-	template <typename T>
-	inline typename SList<T>::Iterator& SList<T>::Iterator::operator++()
+	template <typename T, typename TAllocator>
+	inline typename SList<T, TAllocator>::Iterator& SList<T, TAllocator>::Iterator::operator++()
 	{
 		if (mOwner == nullptr)
 		{
@@ -591,8 +666,8 @@ namespace FieaGameEngine
 		return *this;
 	}
 
-	template <typename T>
-	inline typename SList<T>::Iterator SList<T>::Iterator::operator++(int)
+	template <typename T, typename TAllocator>
+	inline typename SList<T, TAllocator>::Iterator SList<T, TAllocator>::Iterator::operator++(int)
 	{
 		Iterator temp = *this;
 		operator++();
@@ -600,8 +675,8 @@ namespace FieaGameEngine
 		return temp;
 	}
 
-	template<typename T>
-	inline typename T& SList<T>::Iterator::operator*() const
+	template<typename T, typename TAllocator>
+	inline typename T& SList<T, TAllocator>::Iterator::operator*() const
 	{
 		if (mOwner == nullptr)
 		{
@@ -616,8 +691,8 @@ namespace FieaGameEngine
 		return mNode->Data;
 	}
 
-	template<typename T>
-	inline typename T* SList<T>::Iterator::operator->() const
+	template<typename T, typename TAllocator>
+	inline typename T* SList<T, TAllocator>::Iterator::operator->() const
 	{
 		if (mOwner == nullptr)
 		{
@@ -633,28 +708,28 @@ namespace FieaGameEngine
 	}
 #pragma endregion Iterator
 #pragma region ConstIterator
-	template <typename T>
-	SList<T>::ConstIterator::ConstIterator(const SList<T>& owner, Node* node) :
+	template <typename T, typename TAllocator>
+	SList<T, TAllocator>::ConstIterator::ConstIterator(const SList<T, TAllocator>& owner, Node* node) :
 		mOwner(&owner), mNode(node)
 	{
 	}
 
-	template <typename T>
-	SList<T>::ConstIterator::ConstIterator(const Iterator& other) :
+	template <typename T, typename TAllocator>
+	SList<T, TAllocator>::ConstIterator::ConstIterator(const Iterator& other) :
 		mOwner(other.mOwner), mNode(other.mNode)
 	{
 	}
 
-	template <typename T>
-	SList<T>::ConstIterator::ConstIterator(Iterator&& other) :
+	template <typename T, typename TAllocator>
+	SList<T, TAllocator>::ConstIterator::ConstIterator(Iterator&& other) :
 		mOwner(other.mOwner), mNode(other.mNode)
 	{
 		other.mOwner = nullptr;
 		other.mNode = nullptr;
 	}
 
-	template <typename T>
-	typename SList<T>::ConstIterator& SList<T>::ConstIterator::operator=(const Iterator& other)
+	template <typename T, typename TAllocator>
+	typename SList<T, TAllocator>::ConstIterator& SList<T, TAllocator>::ConstIterator::operator=(const Iterator& other)
 	{
 		mOwner = other.mOwner;
 		mNode = other.mNode;
@@ -662,8 +737,8 @@ namespace FieaGameEngine
 		return *this;
 	}
 
-	template <typename T>
-	typename SList<T>::ConstIterator& SList<T>::ConstIterator::operator=(Iterator&& other)
+	template <typename T, typename TAllocator>
+	typename SList<T, TAllocator>::ConstIterator& SList<T, TAllocator>::ConstIterator::operator=(Iterator&& other)
 	{
 		mOwner = other.mOwner;
 		mNode = other.mNode;
@@ -674,20 +749,20 @@ namespace FieaGameEngine
 		return *this;
 	}
 
-	template <typename T>
-	inline typename bool SList<T>::ConstIterator::operator==(const ConstIterator& rhs) const
+	template <typename T, typename TAllocator>
+	inline typename bool SList<T, TAllocator>::ConstIterator::operator==(const ConstIterator& rhs) const
 	{
 		return !operator!=(rhs);
 	}
 
-	template <typename T>
-	inline typename bool SList<T>::ConstIterator::operator!=(const ConstIterator& rhs) const
+	template <typename T, typename TAllocator>
+	inline typename bool SList<T, TAllocator>::ConstIterator::operator!=(const ConstIterator& rhs) const
 	{
 		return (mOwner != rhs.mOwner) || (mNode != rhs.mNode);
 	}
 
-	template <typename T>
-	bool SList<T>::ConstIterator::operator>(const ConstIterator& other) const
+	template <typename T, typename TAllocator>
+	bool SList<T, TAllocator>::ConstIterator::operator>(const ConstIterator& other) const
 	{
 		if (mOwner != other.mOwner)
 		{
@@ -718,8 +793,8 @@ namespace FieaGameEngine
 		return false;
 	}
 
-	template <typename T>
-	bool SList<T>::ConstIterator::operator<(const ConstIterator& other) const
+	template <typename T, typename TAllocator>
+	bool SList<T, TAllocator>::ConstIterator::operator<(const ConstIterator& other) const
 	{
 		if (mOwner != other.mOwner)
 		{
@@ -750,8 +825,8 @@ namespace FieaGameEngine
 		return false;
 	}
 
-	template <typename T>
-	typename SList<T>::ConstIterator& SList<T>::ConstIterator::operator++()
+	template <typename T, typename TAllocator>
+	typename SList<T, TAllocator>::ConstIterator& SList<T, TAllocator>::ConstIterator::operator++()
 	{
 		if (mOwner == nullptr)
 		{
@@ -766,8 +841,8 @@ namespace FieaGameEngine
 		return *this;
 	}
 
-	template <typename T>
-	inline typename SList<T>::ConstIterator SList<T>::ConstIterator::operator++(int)
+	template <typename T, typename TAllocator>
+	inline typename SList<T, TAllocator>::ConstIterator SList<T, TAllocator>::ConstIterator::operator++(int)
 	{
 		ConstIterator temp = *this;
 		operator++();
@@ -775,8 +850,8 @@ namespace FieaGameEngine
 		return temp;
 	}
 
-	template <typename T>
-	typename const T& SList<T>::ConstIterator::operator*() const
+	template <typename T, typename TAllocator>
+	typename const T& SList<T, TAllocator>::ConstIterator::operator*() const
 	{
 		if (mOwner == nullptr)
 		{
@@ -791,8 +866,8 @@ namespace FieaGameEngine
 		return mNode->Data;
 	}
 
-	template <typename T>
-	typename const T* SList<T>::ConstIterator::operator->() const
+	template <typename T, typename TAllocator>
+	typename const T* SList<T, TAllocator>::ConstIterator::operator->() const
 	{
 		if (mOwner == nullptr)
 		{
@@ -808,27 +883,27 @@ namespace FieaGameEngine
 	}
 #pragma endregion ConstIterator
 #pragma region Node
-	template <typename T>
-	SList<T>::Node::Node(const T& data, Node* next) :
+	template <typename T, typename TAllocator>
+	SList<T, TAllocator>::Node::Node(const T& data, Node* next) :
 		Node(next, data)
 	{
 	}
 
-	template <typename T>
-	SList<T>::Node::Node(T&& data, Node* next) :
+	template <typename T, typename TAllocator>
+	SList<T, TAllocator>::Node::Node(T&& data, Node* next) :
 		Node(next, std::move(data))
 	{
 	}
 
-	template <typename T>
+	template <typename T, typename TAllocator>
 	template <typename... Args>
-	SList<T>::Node::Node(Node* next, Args&&... args) :
+	SList<T, TAllocator>::Node::Node(Node* next, Args&&... args) :
 		Data(std::forward<Args>(args)...), Next(next)
 	{
 	}
 
-	template <typename T>
-	inline void SList<T>::Node::SetData(const T& data)
+	template <typename T, typename TAllocator>
+	inline void SList<T, TAllocator>::Node::SetData(const T& data)
 	{
 		Data = data;
 	}
@@ -1,27 +1,34 @@
 #include "pch.h"
+#include <algorithm>
 #include <cstddef>
 #include <string>
 #include <exception>
+#include <limits>
 #include "Scope.h"
 
 namespace FieaGameEngine
 {
 	RTTI_DEFINITIONS(Scope)
 
+	std::atomic<std::uint64_t> Scope::sGeneration = 0;
+
 	Scope::Scope(size_t capacity) :
-		mMap(capacity), mList(capacity)
+		mMap(capacity)
 	{		
 	}
 
 	Scope::Scope(const Scope& other) :
-		mMap(other.mMap.BucketCount()), mList(other.mList.Capacity())
+		mMap(other.mMap.Size())
 	{
 		DeepCopy(other);
 	}
 
 	Scope::Scope(Scope&& other) : 
-		mMap(std::move(other.mMap)), mList(std::move(other.mList)), mParent(other.mParent)
+		mMap(std::move(other.mMap)), mParent(other.mParent), mNameFilter(other.mNameFilter)
 	{
+		other.mNameFilter = 0;
+		other.Touch();
+
 		Reparent(std::move(other));
 	}
 
@@ -45,8 +52,12 @@ namespace FieaGameEngine
 			DeleteChildren();
 
 			mMap = std::move(other.mMap);
-			mList = std::move(other.mList);
 			mParent = other.mParent;
+			mNameFilter = other.mNameFilter;
+			Touch();
+
+			other.mNameFilter = 0;
+			other.Touch();
 
 			Reparent(std::move(other));
 		}
@@ -61,14 +72,14 @@ namespace FieaGameEngine
 
 	bool Scope::operator==(const Scope& other) const
 	{
-		if (mList.Size() != other.mList.Size())
+		if (mMap.Size() != other.mMap.Size())
 		{
 			return false;
 		}
 
-		for (size_t i = 0; i < mList.Size(); ++i)
+		for (size_t i = 0; i < mMap.Size(); ++i)
 		{
-			if (*mList[i] != *other.mList[i])
+			if (mMap.EntryAt(i) != other.mMap.EntryAt(i))
 			{
 				return false;
 			}
@@ -92,76 +103,111 @@ namespace FieaGameEngine
 		return Append(std::move(name));
 	}
 
+	Datum& Scope::operator[](Atom name)
+	{
+		return Append(name);
+	}
+
 	Datum& Scope::operator[](size_t index)
 	{
-		return mList[index]->second;
+		return mMap.EntryAt(index).second;
 	}
 
 	const Datum& Scope::operator[](size_t index) const
 	{
-		return mList[index]->second;
+		return mMap.EntryAt(index).second;
+	}
+
+	Datum& Scope::At(std::string_view name)
+	{
+		return mMap.At(name);
+	}
+
+	const Datum& Scope::At(std::string_view name) const
+	{
+		return mMap.At(name);
 	}
 
-	Datum& Scope::At(const std::string& name)
+	Datum& Scope::At(Atom name)
 	{
 		return mMap.At(name);
 	}
 
-	const Datum& Scope::At(const std::string& name) const
+	const Datum& Scope::At(Atom name) const
 	{
 		return mMap.At(name);
 	}
 
 	Datum& Scope::At(size_t index)
 	{
-		return mList[index]->second;
+		return mMap.EntryAt(index).second;
 	}
 
 	const Datum& Scope::At(size_t index) const
 	{
-		return mList[index]->second;
+		return mMap.EntryAt(index).second;
+	}
+
+	Atom Scope::NameAt(size_t index) const
+	{
+		return mMap.EntryAt(index).first;
 	}
 
 	Datum& Scope::Append(const std::string& name)
 	{
-		EmptyNameGuard(name);
+		bool inserted;
+		return Append(name, inserted);
+	}
 
-		auto[it, inserted] = mMap.Emplace(name, Datum());
+	Datum& Scope::Append(std::string&& name)
+	{
+		EmptyNameGuard(name);
 
-		if (inserted)
+		// only a new entry needs the name interned
+		MapIterator it;
+		if (!mMap.ContainsKey(name, it))
 		{
-			mList.PushBack(&(*it));
+			it = mMap.Emplace(Atom(name), Datum()).first;
+			Inserted((*it).first);
 		}
 
 		return (*it).second;
 	}
 
-	Datum& Scope::Append(std::string&& name)
+	Datum& Scope::Append(Atom name)
 	{
-		EmptyNameGuard(name);
+		bool inserted;
+		return Append(name, inserted);
+	}
 
-		auto[it, inserted] = mMap.Emplace(std::move(name), Datum());
+	Datum& Scope::Append(const std::string& name, bool& inserted)
+	{
+		EmptyNameGuard(name);
 
+		// only a new entry needs the name interned
+		MapIterator it;
+		inserted = !mMap.ContainsKey(name, it);
 		if (inserted)
 		{
-			mList.PushBack(&(*it));
+			it = mMap.Emplace(Atom(name), Datum()).first;
+			Inserted((*it).first);
 		}
 
 		return (*it).second;
 	}
 
-	Datum& Scope::Append(const std::string& name, bool& inserted)
+	Datum& Scope::Append(Atom name, bool& inserted)
 	{
 		EmptyNameGuard(name);
 
-		auto[it, mapInserted] = mMap.Emplace(name, Datum());
-
-		if (mapInserted)
+		MapIterator it;
+		inserted = !mMap.ContainsKey(name, it);
+		if (inserted)
 		{
-			mList.PushBack(&(*it));
+			it = mMap.Emplace(name, Datum()).first;
+			Inserted(name);
 		}
 
-		inserted = mapInserted;
 		return (*it).second;
 	}
 
@@ -169,11 +215,10 @@ namespace FieaGameEngine
 	{
 		EmptyNameGuard(name);
 
-		auto[it, inserted] = mMap.Emplace(name, datum);
-
+		auto [it, inserted] = mMap.Emplace(Atom(name), datum);
 		if (inserted)
 		{
-			mList.PushBack(&(*it));
+			Inserted((*it).first);
 		}
 
 		return (*it).second;
@@ -183,11 +228,10 @@ namespace FieaGameEngine
 	{
 		EmptyNameGuard(pair.first);
 
-		auto[it, inserted] = mMap.Emplace(pair);
-
+		auto [it, inserted] = mMap.Emplace(pair);
 		if (inserted)
 		{
-			mList.PushBack(&(*it));
+			Inserted((*it).first);
 		}
 
 		return (*it).second;
@@ -197,11 +241,10 @@ namespace FieaGameEngine
 	{
 		EmptyNameGuard(pair.first);
 
-		auto[it, inserted] = mMap.Emplace(std::move(pair));
-
+		auto [it, inserted] = mMap.Emplace(std::move(pair));
 		if (inserted)
 		{
-			mList.PushBack(&(*it));
+			Inserted((*it).first);
 		}
 
 		return (*it).second;
@@ -209,40 +252,41 @@ namespace FieaGameEngine
 
 	Scope& Scope::AppendScope(const std::string& name)
 	{
-		Datum& datum = Append(name);
-		
-		if (datum.Type() != Datum::DatumType::UNKNOWN && datum.Type() != Datum::DatumType::TABLE)
-		{
-			throw std::exception("Cannot append Scope. Datum type is not Table.");
-		}
-
-		Scope* scope = new Scope();
-		scope->mParent = this;
-		datum.PushBack(*scope);
-
-		return *scope;
+		return PushChildScope(Append(name));
 	}
 
 	Scope& Scope::AppendScope(std::string&& name)
 	{
-		Datum& datum = Append(std::move(name));
+		return PushChildScope(Append(std::move(name)));
+	}
 
-		if (datum.Type() != Datum::DatumType::UNKNOWN && datum.Type() != Datum::DatumType::TABLE)
+	Scope& Scope::AppendScope(Atom name)
+	{
+		return PushChildScope(Append(name));
+	}
+
+	Datum* Scope::Find(std::string_view name)
+	{
+		MapIterator it;
+		if (mMap.ContainsKey(name, it))
 		{
-			throw std::exception("Cannot append Scope. Datum type is not Table.");
+			return &((*it).second);
 		}
 
-		Scope* scope = new Scope();
-		scope->mParent = this;
-		datum.PushBack(*scope);
+		return nullptr;
+	}
 
-		return *scope;
+	const Datum* Scope::Find(std::string_view name) const
+	{
+		return const_cast<Scope*>(this)->Find(name);
 	}
 
-	Datum* Scope::Find(const std::string& name)
+	Datum* Scope::Find(Atom name)
 	{
+		const std::uint64_t bits = NameFilterBits(name);
+
 		MapIterator it;
-		if (mMap.ContainsKey(name, it))
+		if ((mNameFilter & bits) == bits && mMap.ContainsKey(name, it))
 		{
 			return &((*it).second);
 		}
@@ -250,24 +294,23 @@ namespace FieaGameEngine
 		return nullptr;
 	}
 
-	const Datum* Scope::Find(const std::string& name) const
+	const Datum* Scope::Find(Atom name) const
 	{
 		return const_cast<Scope*>(this)->Find(name);
 	}
 
 	std::pair<Datum*, size_t> Scope::FindChildScope(const Scope* scope)
 	{
-		for (auto entry : mList)
+		for (auto& entry : mMap)
 		{
-			Datum& datum = entry->second;
+			Datum& datum = entry.second;
 			if (datum.Type() == Datum::DatumType::TABLE)
 			{
-				for (size_t i = 0; i < datum.Size(); ++i)
+				const auto children = datum.AsConstSpan<Scope*>();
+				const auto it = std::find(children.begin(), children.end(), scope);
+				if (it != children.end())
 				{
-					if (&datum[i] == scope)
-					{
-						return std::pair(&datum, i);
-					}
+					return std::pair(&datum, static_cast<size_t>(it - children.begin()));
 				}
 			}
 		}
@@ -280,23 +323,34 @@ namespace FieaGameEngine
 		return const_cast<Scope*>(this)->FindChildScope(scope);
 	}
 
-	Datum* Scope::Search(const std::string& name, Scope** scope)
+	Datum* Scope::Search(std::string_view name, Scope** scope)
 	{
-		// look for an entry with the given name
-		MapIterator it;
-		if (mMap.ContainsKey(name, it))
+		// every name in a scope is interned, one that is not cannot be anywhere up the hierarchy
+		return Search(Atom::Find(name), scope);
+	}
+
+	const Datum* Scope::Search(std::string_view name, Scope** scope) const
+	{
+		return const_cast<Scope*>(this)->Search(name, scope);
+	}
+
+	Datum* Scope::Search(Atom name, Scope** scope)
+	{
+		// look for an entry with the given name in this scope and then up the hierarchy,
+		// skipping the scopes whose name filter rules it out
+		const std::uint64_t bits = NameFilterBits(name);
+		for (Scope* current = this; current != nullptr; current = current->mParent)
 		{
-			if (scope != nullptr)
+			MapIterator it;
+			if ((current->mNameFilter & bits) == bits && current->mMap.ContainsKey(name, it))
 			{
-				*scope = this;
-			}
+				if (scope != nullptr)
+				{
+					*scope = current;
+				}
 
-			return &((*it).second);
-		}
-		else if (mParent != nullptr)
-		{
-			// recursively call parent search if not null
-			return mParent->Search(name, scope);
+				return &((*it).second);
+			}
 		}
 
 		if (scope != nullptr)
@@ -307,24 +361,65 @@ namespace FieaGameEngine
 		return nullptr;
 	}
 
-	const Datum* Scope::Search(const std::string& name, Scope** scope) const
+	const Datum* Scope::Search(Atom name, Scope** scope) const
 	{
 		return const_cast<Scope*>(this)->Search(name, scope);
 	}
 
+	Datum* Scope::Search(std::string_view name, SearchCache& cache)
+	{
+		if (cache.mName.IsEmpty())
+		{
+			// a name that was not interned is in no scope, and cannot be in one until the pool grows
+			if (cache.mAtomCount == Atom::Count() && cache.mMissedName == name)
+			{
+				return nullptr;
+			}
+		}
+		else if (cache.mOrigin == this && cache.mName == name && IsCurrent(cache))
+		{
+			return cache.mResult;
+		}
+
+		if (cache.mName.IsEmpty() || !(cache.mName == name))
+		{
+			// counted before looking, a string interned meanwhile makes the next search look again
+			const size_t atomCount = Atom::Count();
+			cache.mName = Atom::Find(name);
+			if (cache.mName.IsEmpty())
+			{
+				cache.mMissedName.assign(name.data(), name.size());
+				cache.mAtomCount = atomCount;
+				cache.mOrigin = nullptr;
+				cache.mOwner = nullptr;
+				cache.mResult = nullptr;
+
+				return nullptr;
+			}
+		}
+
+		// stamped before searching, any change from here on gets a newer generation
+		cache.mStamp = sGeneration.load(std::memory_order_relaxed);
+
+		Scope* owner;
+		cache.mResult = Search(cache.mName, &owner);
+		cache.mOrigin = this;
+		cache.mOwner = owner;
+
+		return cache.mResult;
+	}
+
 	std::string Scope::FindName(const Scope* scope) const
 	{
-		for (const auto entry : mList)
+		for (const auto& entry : mMap)
 		{
-			const Datum& datum = entry->second;
+			const Datum& datum = entry.second;
 			if (datum.Type() == Datum::DatumType::TABLE)
 			{
-				for (size_t i = 0; i < datum.Size(); ++i)
+				const auto children = datum.AsConstSpan<Scope*>();
+				if (std::find(children.begin(), children.end(), scope) != children.end())
 				{
-					if (&datum[i] == scope)
-					{
-						return entry->first;
-					}
+					return std::string(entry.first.View());
 				}
 			}
 		}
@@ -401,9 +496,9 @@ namespace FieaGameEngine
 
 	void Scope::DeleteChildren()
 	{
-		for (const auto& entry : mList)
+		for (auto& entry : mMap)
 		{
-			Datum& datum = entry->second;
+			Datum& datum = entry.second;
 			if (datum.Type() == Datum::DatumType::TABLE)
 			{
 				for (size_t i = 0; i < datum.Size(); ++i)
@@ -420,8 +515,9 @@ namespace FieaGameEngine
 
 	void Scope::ClearContainers()
 	{
-		mList.Clear();
 		mMap.Clear();
+		mNameFilter = 0;
+		Touch();
 	}
 
 	void Scope::Emancipate()
@@ -430,6 +526,7 @@ namespace FieaGameEngine
 		{
 			mParent->RemoveChildScope(*this);
 			mParent = nullptr;
+			Touch();
 		}
 	}
 
@@ -440,6 +537,50 @@ namespace FieaGameEngine
 		ClearContainers();
 	}
 
+	void Scope::RemoveEntries(MapIterator first, MapIterator last)
+	{
+		// the child scopes of the removed entries go with them
+		for (auto it = first; it != last; ++it)
+		{
+			Datum& datum = (*it).second;
+			if (datum.Type() == Datum::DatumType::TABLE)
+			{
+				for (size_t i = 0; i < datum.Size(); ++i)
+				{
+					assert(datum[i].mParent == this);
+
+					datum[i].mParent = nullptr;
+					delete &(datum[i]);
+				}
+			}
+		}
+
+		mMap.Remove(first, last);
+
+		// bits cannot be taken out of a bloom filter, it is built again from the names left
+		mNameFilter = 0;
+		for (const auto& entry : mMap)
+		{
+			mNameFilter |= NameFilterBits(entry.first);
+		}
+
+		Touch();
+	}
+
+	void Scope::CopyEntries(const MapType& entries)
+	{
+		assert(mMap.IsEmpty());
+
+		mMap = entries;
+		for (const auto& entry : mMap)
+		{
+			assert(entry.second.Type() != Datum::DatumType::TABLE || entry.second.Size() == 0);
+			mNameFilter |= NameFilterBits(entry.first);
+		}
+
+		Touch();
+	}
+
 	void Scope::RemoveChildScope(Scope& scope)
 	{
 		auto[datum, index] = FindChildScope(&scope);
@@ -463,6 +604,7 @@ namespace FieaGameEngine
 	{
 		Emancipate();
 		mParent = &scope;
+		Touch();
 	}
 
 	void Scope::Reparent(Scope&& other)
@@ -479,28 +621,45 @@ namespace FieaGameEngine
 		}
 
 		// update the parent address of all children
-		for (auto entry : mList)
+		for (auto& entry : mMap)
 		{
-			Datum& datum = entry->second;
+			Datum& datum = entry.second;
 			if (datum.Type() == Datum::DatumType::TABLE)
 			{
 				for (size_t i = 0; i < datum.Size(); ++i)
 				{
 					datum[i].mParent = this;
+					datum[i].Touch();
 				}
 			}
 		}
 	}
 
+	Scope& Scope::PushChildScope(Datum& datum)
+	{
+		if (datum.Type() != Datum::DatumType::UNKNOWN && datum.Type() != Datum::DatumType::TABLE)
+		{
+			throw std::exception("Cannot append Scope. Datum type is not Table.");
+		}
+
+		Scope* scope = new Scope();
+		scope->mParent = this;
+		datum.PushBack(*scope);
+
+		return *scope;
+	}
+
 	void Scope::DeepCopy(const Scope& other)
 	{
-		for (auto entry : other.mList)
+		mMap.Reserve(other.mMap.Size());
+
+		for (const auto& entry : other.mMap)
 		{
 			// all insertions must return true for insertion,
 			// since we are deep copying this scope should be empty
-			auto[mapIterator, inserted] = mMap.Emplace(*entry);
+			auto[mapIterator, inserted] = mMap.Emplace(entry);
 			assert(inserted);
-			mList.PushBack(&(*mapIterator));
+			Inserted((*mapIterator).first);
 
 			// for each child table we must create a new table deep copying the other table
 			// and assigning its parent to this
@@ -518,7 +677,52 @@ namespace FieaGameEngine
 		}
 	}
 
-	inline void Scope::EmptyNameGuard(const std::string& name)
+	std::uint64_t Scope::NextGeneration()
+	{
+		return sGeneration.fetch_add(1, std::memory_order_relaxed) + 1;
+	}
+
+	inline std::uint64_t Scope::NameFilterBits(const Atom& name)
+	{
+		// the top twelve bits of the hash whatever its width, the map picks slots with the low ones
+		constexpr int HashBits = std::numeric_limits<size_t>::digits;
+		const size_t hash = name.Hash();
+		return (std::uint64_t(1) << ((hash >> (HashBits - 6)) & 63)) | (std::uint64_t(1) << ((hash >> (HashBits - 12)) & 63));
+	}
+
+	inline void Scope::Touch()
+	{
+		mGeneration = NextGeneration();
+	}
+
+	inline void Scope::Inserted(const Atom& name)
+	{
+		mNameFilter |= NameFilterBits(name);
+		Touch();
+	}
+
+	bool Scope::IsCurrent(const SearchCache& cache) const
+	{
+		// a scope whose generation is unchanged still has the same entries and the same parent,
+		// so walking up from the origin retraces the path of the cached search
+		for (const Scope* current = this; current != nullptr; current = current->mParent)
+		{
+			if (current->mGeneration > cache.mStamp)
+			{
+				return false;
+			}
+
+			if (current == cache.mOwner)
+			{
+				return true;
+			}
+		}
+
+		// reached the root, which is only right if the name was not found
+		return cache.mOwner == nullptr;
+	}
+
+	inline void Scope::EmptyNameGuard(std::string_view name)
 	{
 		if (name.empty())
 		{
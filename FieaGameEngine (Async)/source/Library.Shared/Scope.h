@@ -1,33 +1,93 @@
 #pragma once
 
-#include "HashMap.h"
-#include "vector.h"
+#include "OrderedHashMap.h"
+#include "Atom.h"
+#include "SmallVector.h"
 #include "Datum.h"
 #include "RTTI.h"
 #include <gsl/gsl>
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <string_view>
 
 namespace FieaGameEngine
 {
 	/// <summary>
-	/// Represents a scope that holds associations of data and names
+	/// Represents a scope that holds associations of data and names.
+	/// Entries are stored contiguously in insertion order, so appending an entry
+	/// may move the others: datum references only last until the next append.
+	/// Names are kept as atoms, looking one up by atom compares pointers instead of strings
 	/// </summary>
 	class Scope : public RTTI
 	{
 		RTTI_DECLARATIONS(Scope, RTTI)
 
 	protected:
-		using MapType = HashMap<std::string, Datum>;
+		using MapType = OrderedHashMap<Atom, Datum>;
 		using EntryType = MapType::PairType;
-		using ListType = Vector<EntryType*>;
+
+		/// <summary>
+		/// Number of entries a scope makes room for up front, most scopes never outgrow it
+		/// </summary>
+		static constexpr size_t InlineEntryCount = 12;
+
+		using ListType = SmallVector<EntryType*, InlineEntryCount>;
+		using ConstListType = SmallVector<const EntryType*, InlineEntryCount>;
 		using MapIterator = MapType::Iterator;
-		using ListIterator = ListType::Iterator;
 
 	public:
+		/// <summary>
+		/// Remembers where a name was last found from a scope. Every scope carries a generation that moves
+		/// forward whenever its entries or its parent change, so searching again through the same cache only
+		/// walks up the parents comparing generations, and looks the name up again only if one of them moved
+		/// </summary>
+		class SearchCache final
+		{
+			friend class Scope;
+
+		private:
+			/// <summary>
+			/// name searched last, empty if it was never interned
+			/// </summary>
+			Atom mName;
+
+			/// <summary>
+			/// scope the search started from
+			/// </summary>
+			const Scope* mOrigin = nullptr;
+
+			/// <summary>
+			/// scope the name was found in, nullptr if it was not found
+			/// </summary>
+			const Scope* mOwner = nullptr;
+
+			/// <summary>
+			/// result of the search
+			/// </summary>
+			Datum* mResult = nullptr;
+
+			/// <summary>
+			/// latest generation handed out when the search ran
+			/// </summary>
+			std::uint64_t mStamp = 0;
+
+			/// <summary>
+			/// name searched last when it was not interned, it stays missing until the atom pool grows
+			/// </summary>
+			std::string mMissedName;
+
+			/// <summary>
+			/// number of atoms in the pool when the missing name was looked for
+			/// </summary>
+			size_t mAtomCount = 0;
+		};
+
 		/// <summary>
 		/// Constructs an empty scope
 		/// </summary>
 		/// <param name="capacity">Initial capacity of entries for this scope</param>
-		explicit Scope(size_t capacity = 12);
+		explicit Scope(size_t capacity = InlineEntryCount);
 
 		/// <summary>
 		/// Copy constructor
@@ -90,6 +150,14 @@ namespace FieaGameEngine
 		/// <returns>reference to datum</returns>
 		Datum& operator[](std::string&& name);
 
+		/// <summary>
+		/// Returns the datum mapped to the given name.
+		/// Creates entry if not present already
+		/// </summary>
+		/// <param name="name">name of entry</param>
+		/// <returns>reference to datum</returns>
+		Datum& operator[](Atom name);
+
 		/// <summary>
 		/// Gets the datum at the given index considering order of insertion
 		/// </summary>
@@ -104,8 +172,10 @@ namespace FieaGameEngine
 		/// <returns>reference to datum</returns>
 		const Datum& operator[](size_t index) const;
 
-		Datum& At(const std::string& name);
-		const Datum& At(const std::string& name) const;
+		Datum& At(std::string_view name);
+		const Datum& At(std::string_view name) const;
+		Datum& At(Atom name);
+		const Datum& At(Atom name) const;
 
 		/// <summary>
 		/// Gets the datum at the given index considering order of insertion
@@ -121,6 +191,13 @@ namespace FieaGameEngine
 		/// <returns>reference to datum</returns>
 		const Datum& At(size_t index) const;
 
+		/// <summary>
+		/// Gets the name of the entry at the given index considering order of insertion
+		/// </summary>
+		/// <param name="index">index</param>
+		/// <returns>name</returns>
+		Atom NameAt(size_t index) const;
+
 		/// <summary>
 		/// Adds a new entry to the scope with the given name
 		/// and a default constructed datum, if not already present
@@ -137,7 +214,16 @@ namespace FieaGameEngine
 		/// <returns>reference to datum</returns>
 		Datum& Append(std::string&& name);
 
+		/// <summary>
+		/// Adds a new entry to the scope with the given name
+		/// and a default constructed datum, if not already present
+		/// </summary>
+		/// <param name="name">name</param>
+		/// <returns>reference to datum</returns>
+		Datum& Append(Atom name);
+
 		Datum& Append(const std::string& name, bool& inserted);
+		Datum& Append(Atom name, bool& inserted);
 
 		Datum& Append(const std::string& name, const Datum& datum);
 		Datum& Append(const EntryType& pair);
@@ -165,19 +251,44 @@ namespace FieaGameEngine
 		/// <returns>reference to scope</returns>
 		Scope& AppendScope(std::string&& name);
 
+		/// <summary>
+		/// Adds a new entry to this scope with the given name and
+		/// a datum of type table, a new scope is pushed to the just
+		/// created datum. If already present, a scope is pushed to
+		/// that datum if possible
+		/// </summary>
+		/// <exception cref="std::exception">thrown if the existing datum is not of type table</exception>
+		/// <param name="name">name</param>
+		/// <returns>reference to scope</returns>
+		Scope& AppendScope(Atom name);
+
 		/// <summary>
 		/// looks for an entry with the given name
 		/// </summary>
 		/// <param name="name">name</param>
 		/// <returns>if found, address of the datum, nullptr otherwise</returns>
-		Datum* Find(const std::string& name);
+		Datum* Find(std::string_view name);
 
 		/// <summary>
 		/// looks for an entry with the given name
 		/// </summary>
 		/// <param name="name">name</param>
 		/// <returns>if found, address of the datum, nullptr otherwise</returns>
-		const Datum* Find(const std::string& name) const;
+		const Datum* Find(std::string_view name) const;
+
+		/// <summary>
+		/// looks for an entry with the given name
+		/// </summary>
+		/// <param name="name">name</param>
+		/// <returns>if found, address of the datum, nullptr otherwise</returns>
+		Datum* Find(Atom name);
+
+		/// <summary>
+		/// looks for an entry with the given name
+		/// </summary>
+		/// <param name="name">name</param>
+		/// <returns>if found, address of the datum, nullptr otherwise</returns>
+		const Datum* Find(Atom name) const;
 
 		/// <summary>
 		/// looks for a scope within this scope
@@ -199,7 +310,23 @@ namespace FieaGameEngine
 		/// <param name="name">name</param>
 		/// <param name="scope">out parameter to store the address of the scope containing the name if found</param>
 		/// <returns>address of the datum mapped to the given name if found, nullptr otherwise</returns>
-		Datum* Search(const std::string& name, Scope** scope = nullptr);
+		Datum* Search(std::string_view name, Scope** scope = nullptr);
+
+		/// <summary>
+		/// looks for the closest entry with the given name in this scope and recursively up the hierarchy to the root
+		/// </summary>
+		/// <param name="name">name</param>
+		/// <param name="scope">out parameter to store the address of the scope containing the name if found</param>
+		/// <returns>address of the datum mapped to the given name if found, nullptr otherwise</returns>
+		const Datum* Search(std::string_view name, Scope** scope = nullptr) const;
+
+		/// <summary>
+		/// looks for the closest entry with the given name in this scope and recursively up the hierarchy to the root
+		/// </summary>
+		/// <param name="name">name</param>
+		/// <param name="scope">out parameter to store the address of the scope containing the name if found</param>
+		/// <returns>address of the datum mapped to the given name if found, nullptr otherwise</returns>
+		Datum* Search(Atom name, Scope** scope = nullptr);
 
 		/// <summary>
 		/// looks for the closest entry with the given name in this scope and recursively up the hierarchy to the root
@@ -207,7 +334,16 @@ namespace FieaGameEngine
 		/// <param name="name">name</param>
 		/// <param name="scope">out parameter to store the address of the scope containing the name if found</param>
 		/// <returns>address of the datum mapped to the given name if found, nullptr otherwise</returns>
-		const Datum* Search(const std::string& name, Scope** scope = nullptr) const;
+		const Datum* Search(Atom name, Scope** scope = nullptr) const;
+
+		/// <summary>
+		/// looks for the closest entry with the given name in this scope and up the hierarchy,
+		/// reusing the result of the last search through the same cache while nothing on the way has changed
+		/// </summary>
+		/// <param name="name">name</param>
+		/// <param name="cache">cache kept by the caller between searches</param>
+		/// <returns>address of the datum mapped to the given name if found, nullptr otherwise</returns>
+		Datum* Search(std::string_view name, SearchCache& cache);
 
 		/// <summary>
 		/// looks for the name of the entry that contains the given scope
@@ -270,15 +406,10 @@ namespace FieaGameEngine
 
 	protected:
 		/// <summary>
-		/// dictionary holding the entries
+		/// entries in insertion order, with a hashed index over them
 		/// </summary>
 		MapType mMap;
 
-		/// <summary>
-		/// vector holding the insertion order of the entries
-		/// </summary>
-		ListType mList;
-
 		/// <summary>
 		/// address of parent
 		/// </summary>
@@ -286,15 +417,77 @@ namespace FieaGameEngine
 
 		virtual gsl::owner<Scope*> Clone() const;
 		void _Clear();
+
+		/// <summary>
+		/// removes a range of entries and deletes the child scopes they hold,
+		/// derived scopes go through it so cached searches notice
+		/// </summary>
+		/// <param name="first">first entry to remove</param>
+		/// <param name="last">entry past the last one to remove</param>
+		void RemoveEntries(MapIterator first, MapIterator last);
+
+		/// <summary>
+		/// fills an empty scope with copies of prebuilt entries, which must not hold scopes.
+		/// The whole table is copied at once instead of appended one entry at a time
+		/// </summary>
+		/// <param name="entries">entries to copy</param>
+		void CopyEntries(const MapType& entries);
 	
 	private:
+		/// <summary>
+		/// latest generation handed out to any scope
+		/// </summary>
+		static std::atomic<std::uint64_t> sGeneration;
+
+		/// <summary>
+		/// generation of this scope, renewed whenever its entries or its parent change
+		/// </summary>
+		std::uint64_t mGeneration = NextGeneration();
+
+		/// <summary>
+		/// bloom filter of the names in this scope, two bits per name picked from its hash.
+		/// A search skips the scope without probing the map if one of the bits is missing
+		/// </summary>
+		std::uint64_t mNameFilter = 0;
+
+		/// <summary>
+		/// hands out a generation newer than every one before it
+		/// </summary>
+		/// <returns>generation</returns>
+		static std::uint64_t NextGeneration();
+
+		/// <summary>
+		/// gets the bits a name sets in the name filter
+		/// </summary>
+		/// <param name="name">name</param>
+		/// <returns>filter bits</returns>
+		static std::uint64_t NameFilterBits(const Atom& name);
+
+		/// <summary>
+		/// marks the entries or the parent of this scope as changed
+		/// </summary>
+		void Touch();
+
+		/// <summary>
+		/// records a new entry in the name filter and marks this scope as changed
+		/// </summary>
+		/// <param name="name">name of the entry</param>
+		void Inserted(const Atom& name);
+
+		/// <summary>
+		/// checks if a search cache still holds the result of searching from this scope
+		/// </summary>
+		/// <param name="cache">cache</param>
+		/// <returns>true if no scope between this one and the result has changed, false otherwise</returns>
+		bool IsCurrent(const SearchCache& cache) const;
+
 		/// <summary>
 		/// deletes all children scopes of this scope
 		/// </summary>
 		void DeleteChildren();
 
 		/// <summary>
-		/// clears the contents of both the list and dictionary
+		/// removes all the entries
 		/// </summary>
 		void ClearContainers();
 
@@ -317,6 +510,14 @@ namespace FieaGameEngine
 
 		void Reparent(Scope&& scope);
 
+		/// <summary>
+		/// pushes a new child scope to the given datum
+		/// </summary>
+		/// <exception cref="std::exception">thrown if the datum is not of type table</exception>
+		/// <param name="datum">datum of this scope</param>
+		/// <returns>reference to the new scope</returns>
+		Scope& PushChildScope(Datum& datum);
+
 		/// <summary>
 		/// deep copies the entries from the other scope to this
 		/// </summary>
@@ -327,7 +528,7 @@ namespace FieaGameEngine
 		/// guards against empty string names
 		/// </summary>
 		/// <param name="name">name</param>
-		void EmptyNameGuard(const std::string& name);
+		void EmptyNameGuard(std::string_view name);
 	};
 }
 
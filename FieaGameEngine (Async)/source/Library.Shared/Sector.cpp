@@ -12,9 +12,9 @@ namespace FieaGameEngine
 
 	const std::size_t Sector::EntitiesIndex = 2;
 
-	Vector<Signature> Sector::Signatures()
+	SignatureListType Sector::Signatures()
 	{
-		return Vector<Signature>(
+		return SignatureListType(
 			{
 				{ "Name", Datum::DatumType::STRING, 1, offsetof(Sector, mName) },
 				{ EntitiesKey, Datum::DatumType::TABLE, 0, 0 }
@@ -27,7 +27,7 @@ namespace FieaGameEngine
 
 	Sector::Sector(const std::string& name) : Attributed(TypeIdClass()), mName(name)
 	{
-		assert(mList[EntitiesIndex]->first == EntitiesKey);
+		assert(mMap.EntryAt(EntitiesIndex).first == EntitiesKey);
 	}
 
 	gsl::owner<Sector*> Sector::Clone() const
@@ -31,7 +31,7 @@ namespace FieaGameEngine
 		/// attributes of this sector
 		/// </summary>
 		/// <returns>attributes of this sector</returns>
-		static Vector<Signature> Signatures();
+		static SignatureListType Signatures();
 
 	public:
 		/// <summary>
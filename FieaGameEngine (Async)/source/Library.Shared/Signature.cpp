@@ -3,7 +3,7 @@
 
 namespace FieaGameEngine
 {
-	Signature::Signature(const std::string& name, Datum::DatumType type, size_t size, size_t offset) :
+	Signature::Signature(std::string_view name, Datum::DatumType type, size_t size, size_t offset) :
 		Name(name), Type(type), Size(size), Offset(offset)
 	{
 	}
@@ -1,6 +1,8 @@
 #pragma once
 
+#include "Atom.h"
 #include "Datum.h"
+#include "SmallVector.h"
 #include <string>
 
 namespace FieaGameEngine
@@ -8,16 +10,24 @@ namespace FieaGameEngine
 	struct Signature final
 	{
 	public:
-		const std::string Name;
+		/// <summary>
+		/// Interned once when the type registers, populating an instance appends the atom as is
+		/// </summary>
+		const Atom Name;
 		const Datum::DatumType Type;
 		const size_t Size;
 		const size_t Offset;
 
-		Signature(const std::string& name, Datum::DatumType type, size_t size, size_t offset);
+		Signature(std::string_view name, Datum::DatumType type, size_t size, size_t offset);
 		Signature(const Signature&) = default;
 		Signature(Signature&&) = default;
 		Signature& operator=(const Signature&) = default;
 		Signature& operator=(Signature&&) = default;
 		~Signature() = default;
 	};
+
+	/// <summary>
+	/// Signatures of a type, kept inline since types prescribe only a handful of attributes
+	/// </summary>
+	using SignatureListType = SmallVector<Signature, 8>;
 }
@@ -0,0 +1,399 @@
+#include "pch.h"
+#include "SlabAllocator.h"
+#include <cassert>
+#include <cstdint>
+#include <initializer_list>
+#include <new>
+
+#if defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#endif
+
+namespace FieaGameEngine
+{
+	// SlabStatistics
+
+	float SlabStatistics::Utilisation() const
+	{
+		return Capacity > 0 ? static_cast<float>(InUse) / static_cast<float>(Capacity) : 0.0f;
+	}
+
+	SlabStatistics& SlabStatistics::operator+=(const SlabStatistics& other)
+	{
+		Slabs += other.Slabs;
+		Capacity += other.Capacity;
+		InUse += other.InUse;
+
+		return *this;
+	}
+
+	// SlabPool
+
+	/// <summary>
+	/// Header at the start of every slab, the nodes follow it
+	/// </summary>
+	struct SlabPool::Slab final
+	{
+		/// <summary>
+		/// Pool the slab belongs to
+		/// </summary>
+		SlabPool* Owner;
+
+		/// <summary>
+		/// Neighbours in the owner's list of slabs with room
+		/// </summary>
+		Slab* Previous;
+		Slab* Next;
+
+		/// <summary>
+		/// Nodes given back to this slab, each one stores the next
+		/// </summary>
+		void* FreeList;
+
+		/// <summary>
+		/// Number of nodes handed out
+		/// </summary>
+		size_t Live;
+
+		/// <summary>
+		/// Number of nodes ever carved out, the ones past it have never been touched
+		/// </summary>
+		size_t Carved;
+	};
+
+	const size_t SlabPool::HeaderSize = (sizeof(Slab) + NodeAlignment - 1) / NodeAlignment * NodeAlignment;
+
+	namespace
+	{
+		void* AcquireSlab()
+		{
+#if defined(_WIN32)
+			// virtual memory comes in 64 KiB aligned granules, aligned heap blocks would waste a whole slab each
+			void* memory = VirtualAlloc(nullptr, SlabPool::SlabSize, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+			if (memory == nullptr)
+			{
+				throw std::bad_alloc();
+			}
+
+			return memory;
+#else
+			return ::operator new(SlabPool::SlabSize, std::align_val_t(SlabPool::SlabSize));
+#endif
+		}
+
+		void ReleaseSlab(void* memory)
+		{
+#if defined(_WIN32)
+			VirtualFree(memory, 0, MEM_RELEASE);
+#else
+			::operator delete(memory, std::align_val_t(SlabPool::SlabSize));
+#endif
+		}
+	}
+
+	SlabPool::SlabPool(size_t nodeSize) :
+		mNodeSize(nodeSize), mNodesPerSlab((SlabSize - HeaderSize) / nodeSize)
+	{
+	}
+
+	SlabPool::~SlabPool()
+	{
+		assert(mInUse == 0);
+		Trim();
+	}
+
+	void* SlabPool::Allocate()
+	{
+		if (mAvailable == nullptr)
+		{
+			if (mSpare != nullptr)
+			{
+				Link(mAvailable, *mSpare);
+				mSpare = nullptr;
+			}
+			else
+			{
+				void* memory = AcquireSlab();
+				Link(mAvailable, *new (memory)Slab{ this, nullptr, nullptr, nullptr, 0, 0 });
+				++mSlabCount;
+			}
+		}
+
+		Slab& slab = *mAvailable;
+		void* node;
+		if (slab.FreeList != nullptr)
+		{
+			node = slab.FreeList;
+			slab.FreeList = *static_cast<void**>(node);
+		}
+		else
+		{
+			node = reinterpret_cast<std::byte*>(&slab) + HeaderSize + slab.Carved * mNodeSize;
+			++slab.Carved;
+		}
+
+		++slab.Live;
+		++mInUse;
+
+		if (slab.FreeList == nullptr && slab.Carved == mNodesPerSlab)
+		{
+			Unlink(mAvailable, slab);
+			Link(mFull, slab);
+		}
+
+		return node;
+	}
+
+	void SlabPool::Deallocate(void* node)
+	{
+		Slab& slab = *reinterpret_cast<Slab*>(reinterpret_cast<std::uintptr_t>(node) & ~static_cast<std::uintptr_t>(SlabSize - 1));
+		const bool wasFull = slab.FreeList == nullptr && slab.Carved == mNodesPerSlab;
+
+		*static_cast<void**>(node) = slab.FreeList;
+		slab.FreeList = node;
+		--slab.Live;
+		--mInUse;
+
+		if (slab.Live == 0)
+		{
+			Unlink(wasFull ? mFull : mAvailable, slab);
+
+			// one empty slab is kept so a pool hovering around a slab boundary does not thrash
+			slab.FreeList = nullptr;
+			slab.Carved = 0;
+			if (mSpare == nullptr)
+			{
+				mSpare = &slab;
+			}
+			else
+			{
+				slab.~Slab();
+				ReleaseSlab(&slab);
+				--mSlabCount;
+			}
+		}
+		else if (wasFull)
+		{
+			Unlink(mFull, slab);
+			Link(mAvailable, slab);
+		}
+	}
+
+	void SlabPool::Trim()
+	{
+		if (mSpare != nullptr)
+		{
+			mSpare->~Slab();
+			ReleaseSlab(mSpare);
+			mSpare = nullptr;
+			--mSlabCount;
+		}
+	}
+
+	void SlabPool::MoveTo(SlabPool& other)
+	{
+		assert(other.mNodeSize == mNodeSize);
+
+		Trim();
+		for (Slab** list : { &mAvailable, &mFull })
+		{
+			while (*list != nullptr)
+			{
+				Slab& slab = **list;
+				Unlink(*list, slab);
+				slab.Owner = &other;
+				Link(list == &mAvailable ? other.mAvailable : other.mFull, slab);
+			}
+		}
+
+		other.mSlabCount += mSlabCount;
+		other.mInUse += mInUse;
+		mSlabCount = 0;
+		mInUse = 0;
+	}
+
+	SlabPool& SlabPool::Owner(void* node)
+	{
+		return *reinterpret_cast<Slab*>(reinterpret_cast<std::uintptr_t>(node) & ~static_cast<std::uintptr_t>(SlabSize - 1))->Owner;
+	}
+
+	size_t SlabPool::NodeSize() const
+	{
+		return mNodeSize;
+	}
+
+	SlabStatistics SlabPool::Statistics() const
+	{
+		SlabStatistics statistics;
+		statistics.Slabs = mSlabCount;
+		statistics.Capacity = mSlabCount * mNodesPerSlab;
+		statistics.InUse = mInUse;
+
+		return statistics;
+	}
+
+	void SlabPool::Link(Slab*& list, Slab& slab)
+	{
+		slab.Previous = nullptr;
+		slab.Next = list;
+		if (list != nullptr)
+		{
+			list->Previous = &slab;
+		}
+
+		list = &slab;
+	}
+
+	void SlabPool::Unlink(Slab*& list, Slab& slab)
+	{
+		if (slab.Previous != nullptr)
+		{
+			slab.Previous->Next = slab.Next;
+		}
+		else
+		{
+			list = slab.Next;
+		}
+
+		if (slab.Next != nullptr)
+		{
+			slab.Next->Previous = slab.Previous;
+		}
+
+		slab.Previous = nullptr;
+		slab.Next = nullptr;
+	}
+
+	// SlabPoolSet
+
+	SlabPoolSet::SlabPoolSet(bool synchronized) :
+		SlabPoolSet(synchronized, std::make_index_sequence<ClassCount>())
+	{
+	}
+
+	template <size_t... Classes>
+	SlabPoolSet::SlabPoolSet(bool synchronized, std::index_sequence<Classes...>) :
+		mPools{ SlabPool((Classes + 1) * SlabPool::NodeAlignment)... }, mSynchronized(synchronized)
+	{
+	}
+
+	SlabPoolSet::~SlabPoolSet()
+	{
+		SlabPoolSet& shared = Shared();
+		if (this == &shared)
+		{
+			return;
+		}
+
+		for (size_t i = 0; i < ClassCount; ++i)
+		{
+			if (mPools[i].Statistics().InUse > 0)
+			{
+				std::lock_guard<std::mutex> lock(shared.mMutexes[i]);
+				mPools[i].MoveTo(shared.mPools[i]);
+			}
+		}
+	}
+
+	bool SlabPoolSet::Handles(size_t bytes, size_t alignment)
+	{
+		return bytes > 0 && bytes <= MaxNodeSize && alignment <= SlabPool::NodeAlignment;
+	}
+
+	void* SlabPoolSet::Allocate(size_t bytes)
+	{
+		const size_t sizeClass = SizeClass(bytes);
+		if (mSynchronized)
+		{
+			std::lock_guard<std::mutex> lock(mMutexes[sizeClass]);
+			return mPools[sizeClass].Allocate();
+		}
+
+		return mPools[sizeClass].Allocate();
+	}
+
+	void SlabPoolSet::Deallocate(void* node, size_t bytes)
+	{
+		const size_t sizeClass = SizeClass(bytes);
+		SlabPool& pool = SlabPool::Owner(node);
+		if (&pool != &mPools[sizeClass] && this != &Shared())
+		{
+			// a thread local node that outlived its thread, its slab belongs to the shared set now
+			Shared().Deallocate(node, bytes);
+			return;
+		}
+
+		assert(&pool == &mPools[sizeClass]);
+		if (mSynchronized)
+		{
+			std::lock_guard<std::mutex> lock(mMutexes[sizeClass]);
+			pool.Deallocate(node);
+		}
+		else
+		{
+			pool.Deallocate(node);
+		}
+	}
+
+	void SlabPoolSet::Trim()
+	{
+		for (size_t i = 0; i < ClassCount; ++i)
+		{
+			if (mSynchronized)
+			{
+				std::lock_guard<std::mutex> lock(mMutexes[i]);
+				mPools[i].Trim();
+			}
+			else
+			{
+				mPools[i].Trim();
+			}
+		}
+	}
+
+	SlabStatistics SlabPoolSet::Statistics() const
+	{
+		SlabStatistics statistics;
+		for (size_t i = 0; i < ClassCount; ++i)
+		{
+			statistics += Statistics(mPools[i].NodeSize());
+		}
+
+		return statistics;
+	}
+
+	SlabStatistics SlabPoolSet::Statistics(size_t bytes) const
+	{
+		const size_t sizeClass = SizeClass(bytes);
+		if (mSynchronized)
+		{
+			std::lock_guard<std::mutex> lock(mMutexes[sizeClass]);
+			return mPools[sizeClass].Statistics();
+		}
+
+		return mPools[sizeClass].Statistics();
+	}
+
+	SlabPoolSet& SlabPoolSet::Shared()
+	{
+		// built in place and never destroyed
+		alignas(SlabPoolSet) static std::byte storage[sizeof(SlabPoolSet)];
+		static SlabPoolSet* pools = new (storage)SlabPoolSet(true);
+
+		return *pools;
+	}
+
+	SlabPoolSet& SlabPoolSet::Local()
+	{
+		thread_local SlabPoolSet pools(false);
+
+		return pools;
+	}
+
+	size_t SlabPoolSet::SizeClass(size_t bytes)
+	{
+		return (bytes - 1) / SlabPool::NodeAlignment;
+	}
+}
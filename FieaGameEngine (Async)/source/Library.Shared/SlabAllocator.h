@@ -0,0 +1,369 @@
+#pragma once
+
+/// \file SlabAllocator.h
+/// \brief Definition of the slab allocation policy for node based containers
+
+#include <cstddef>
+#include <mutex>
+#include <utility>
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Snapshot of how full the slabs of one or more pools are
+	/// </summary>
+	struct SlabStatistics final
+	{
+		/// <summary>
+		/// Number of slabs currently held, spares included
+		/// </summary>
+		size_t Slabs = 0;
+
+		/// <summary>
+		/// Number of nodes those slabs can hold
+		/// </summary>
+		size_t Capacity = 0;
+
+		/// <summary>
+		/// Number of nodes currently handed out
+		/// </summary>
+		size_t InUse = 0;
+
+		/// <summary>
+		/// Gets the fraction of the slab capacity in use
+		/// </summary>
+		/// <returns>Nodes in use over capacity, zero when there are no slabs</returns>
+		float Utilisation() const;
+
+		/// <summary>
+		/// Adds the counters of other pools to these
+		/// </summary>
+		/// <param name="other">Statistics to add</param>
+		/// <returns>Reference to self</returns>
+		SlabStatistics& operator+=(const SlabStatistics& other);
+	};
+
+	/// <summary>
+	/// Hands out nodes of a single size carved from slabs aligned to their own size, so the slab
+	/// of a node is found by masking its address. Freed nodes go on a free list in their slab.
+	/// When the last node of a slab is freed the slab is kept as a spare if there is none yet,
+	/// otherwise it goes back to the system. Not synchronized
+	/// </summary>
+	class SlabPool final
+	{
+	public:
+		/// <summary>
+		/// Size and alignment of every slab, the allocation granularity of the Windows virtual memory
+		/// </summary>
+		static constexpr size_t SlabSize = 65536;
+
+		/// <summary>
+		/// Alignment of every node, node sizes are multiples of it
+		/// </summary>
+		static constexpr size_t NodeAlignment = 16;
+
+		/// <summary>
+		/// Creates an empty pool, slabs are only taken on the first allocation
+		/// </summary>
+		/// <param name="nodeSize">Size of the nodes, a multiple of NodeAlignment</param>
+		explicit SlabPool(size_t nodeSize);
+
+		SlabPool(const SlabPool&) = delete;
+		SlabPool(SlabPool&&) = delete;
+		SlabPool& operator=(const SlabPool&) = delete;
+		SlabPool& operator=(SlabPool&&) = delete;
+
+		/// <summary>
+		/// Releases the spare slab. Every node must be back by now, or handed over with MoveTo
+		/// </summary>
+		~SlabPool();
+
+		/// <summary>
+		/// Takes a node from the first slab with room, taking a new slab if none has
+		/// </summary>
+		/// <returns>Pointer to the node</returns>
+		void* Allocate();
+
+		/// <summary>
+		/// Puts a node back on its slab's free list, releasing the slab if it becomes empty
+		/// </summary>
+		/// <param name="node">Node taken from this pool</param>
+		void Deallocate(void* node);
+
+		/// <summary>
+		/// Releases the spare slab, if any
+		/// </summary>
+		void Trim();
+
+		/// <summary>
+		/// Gives every slab with nodes in use to another pool, which takes those nodes back from then on.
+		/// The spare slab is released and this pool is left empty
+		/// </summary>
+		/// <param name="other">Pool with the same node size</param>
+		void MoveTo(SlabPool& other);
+
+		/// <summary>
+		/// Gets the pool a node was taken from
+		/// </summary>
+		/// <param name="node">Node taken from any pool</param>
+		/// <returns>Reference to the pool</returns>
+		static SlabPool& Owner(void* node);
+
+		/// <summary>
+		/// Gets the size of the nodes of this pool
+		/// </summary>
+		/// <returns>Size of the nodes</returns>
+		size_t NodeSize() const;
+
+		/// <summary>
+		/// Gets the counters of this pool
+		/// </summary>
+		/// <returns>Slabs, capacity and nodes in use</returns>
+		SlabStatistics Statistics() const;
+
+	private:
+		struct Slab;
+
+		/// <summary>
+		/// Size of the slab header rounded up to the node alignment, the first node starts there
+		/// </summary>
+		static const size_t HeaderSize;
+
+		/// <summary>
+		/// Adds a slab to the front of a list of slabs
+		/// </summary>
+		/// <param name="list">First slab of the list</param>
+		/// <param name="slab">Slab</param>
+		static void Link(Slab*& list, Slab& slab);
+
+		/// <summary>
+		/// Removes a slab from a list of slabs
+		/// </summary>
+		/// <param name="list">First slab of the list</param>
+		/// <param name="slab">Slab</param>
+		static void Unlink(Slab*& list, Slab& slab);
+
+		/// <summary>
+		/// Size of the nodes
+		/// </summary>
+		size_t mNodeSize;
+
+		/// <summary>
+		/// Number of nodes that fit in a slab after its header
+		/// </summary>
+		size_t mNodesPerSlab;
+
+		/// <summary>
+		/// Slabs with at least one free node
+		/// </summary>
+		Slab* mAvailable = nullptr;
+
+		/// <summary>
+		/// Slabs without a free node, only kept so MoveTo can reach them
+		/// </summary>
+		Slab* mFull = nullptr;
+
+		/// <summary>
+		/// Empty slab kept for the next time the pool runs out of room
+		/// </summary>
+		Slab* mSpare = nullptr;
+
+		/// <summary>
+		/// Number of slabs taken from the system, the spare included
+		/// </summary>
+		size_t mSlabCount = 0;
+
+		/// <summary>
+		/// Number of nodes handed out
+		/// </summary>
+		size_t mInUse = 0;
+	};
+
+	/// <summary>
+	/// One pool per node size class, from NodeAlignment up to MaxNodeSize bytes.
+	/// Nodes of the same type always land in the same pool
+	/// </summary>
+	class SlabPoolSet final
+	{
+	public:
+		/// <summary>
+		/// Largest node served from the pools, anything bigger goes to the heap
+		/// </summary>
+		static constexpr size_t MaxNodeSize = 256;
+
+		/// <summary>
+		/// Number of size classes
+		/// </summary>
+		static constexpr size_t ClassCount = MaxNodeSize / SlabPool::NodeAlignment;
+
+		/// <summary>
+		/// Creates the pools of every size class
+		/// </summary>
+		/// <param name="synchronized">Whether every pool is guarded by its own mutex</param>
+		explicit SlabPoolSet(bool synchronized);
+
+		SlabPoolSet(const SlabPoolSet&) = delete;
+		SlabPoolSet(SlabPoolSet&&) = delete;
+		SlabPoolSet& operator=(const SlabPoolSet&) = delete;
+		SlabPoolSet& operator=(SlabPoolSet&&) = delete;
+
+		/// <summary>
+		/// Moves the slabs with nodes still in use to the shared set, so the nodes a thread
+		/// leaves behind when it exits stay valid and can be released by any thread
+		/// </summary>
+		~SlabPoolSet();
+
+		/// <summary>
+		/// Tells if a block of the given size and alignment is served from the pools
+		/// </summary>
+		/// <param name="bytes">Size of the block</param>
+		/// <param name="alignment">Alignment of the block</param>
+		/// <returns>True if a pool serves it, false if it belongs on the heap</returns>
+		static bool Handles(size_t bytes, size_t alignment);
+
+		/// <summary>
+		/// Takes a node from the pool of the given size class
+		/// </summary>
+		/// <param name="bytes">Size of the node, see Handles</param>
+		/// <returns>Pointer to the node</returns>
+		void* Allocate(size_t bytes);
+
+		/// <summary>
+		/// Returns a node to the pool it was taken from, or to the shared set if its thread has exited
+		/// </summary>
+		/// <param name="node">Node</param>
+		/// <param name="bytes">Size the node was allocated with</param>
+		void Deallocate(void* node, size_t bytes);
+
+		/// <summary>
+		/// Releases the spare slab of every pool
+		/// </summary>
+		void Trim();
+
+		/// <summary>
+		/// Gets the counters of all the pools
+		/// </summary>
+		/// <returns>Sum of the counters of every pool</returns>
+		SlabStatistics Statistics() const;
+
+		/// <summary>
+		/// Gets the counters of the pool serving the given size
+		/// </summary>
+		/// <param name="bytes">Size of the nodes</param>
+		/// <returns>Counters of the pool</returns>
+		SlabStatistics Statistics(size_t bytes) const;
+
+		/// <summary>
+		/// Gets the set shared by every thread. It is never destroyed, so containers living in
+		/// static storage can still release their nodes during shutdown
+		/// </summary>
+		/// <returns>Reference to the shared set</returns>
+		static SlabPoolSet& Shared();
+
+		/// <summary>
+		/// Gets the set of the calling thread
+		/// </summary>
+		/// <returns>Reference to the thread's set</returns>
+		static SlabPoolSet& Local();
+
+	private:
+		template <size_t... Classes>
+		SlabPoolSet(bool synchronized, std::index_sequence<Classes...>);
+
+		/// <summary>
+		/// Gets the size class of a node size
+		/// </summary>
+		/// <param name="bytes">Size of the node</param>
+		/// <returns>Index of the pool</returns>
+		static size_t SizeClass(size_t bytes);
+
+		/// <summary>
+		/// Pools by size class
+		/// </summary>
+		SlabPool mPools[ClassCount];
+
+		/// <summary>
+		/// Guards of the pools, only used when synchronized
+		/// </summary>
+		mutable std::mutex mMutexes[ClassCount];
+
+		/// <summary>
+		/// Whether the pools are shared across threads
+		/// </summary>
+		bool mSynchronized;
+	};
+
+	/// <summary>
+	/// Allocation policy for node based containers. Small blocks are served from slabs of equally
+	/// sized nodes, which keeps a container's nodes packed together and turns most allocations
+	/// into a free list pop; bigger blocks go to the heap like DefaultAllocator.
+	/// The shared pools are guarded by a mutex per size class. With ThreadLocal every thread gets
+	/// its own unguarded pools, then nodes must be released by the thread that allocated them
+	/// while it runs. The nodes still in use when it exits move to the shared pools, after that
+	/// any thread may release them
+	/// </summary>
+	template <bool ThreadLocal = false>
+	class SlabAllocator final
+	{
+	public:
+		/// <summary>
+		/// Allocates a block of memory
+		/// </summary>
+		/// <param name="bytes">Size of the block</param>
+		/// <param name="alignment">Alignment of the block</param>
+		/// <returns>Pointer to the block</returns>
+		void* Allocate(size_t bytes, size_t alignment);
+
+		/// <summary>
+		/// Resizes a block of memory, keeping its contents. Only used for trivially relocatable elements
+		/// </summary>
+		/// <param name="memory">Block to resize, may be null</param>
+		/// <param name="bytes">Current size of the block</param>
+		/// <param name="newBytes">New size of the block, a zero size releases it</param>
+		/// <param name="alignment">Alignment of the block</param>
+		/// <returns>Pointer to the resized block, null if the new size is zero</returns>
+		void* Reallocate(void* memory, size_t bytes, size_t newBytes, size_t alignment);
+
+		/// <summary>
+		/// Releases a block of memory
+		/// </summary>
+		/// <param name="memory">Block to release, may be null</param>
+		/// <param name="bytes">Size of the block</param>
+		/// <param name="alignment">Alignment of the block</param>
+		void Deallocate(void* memory, size_t bytes, size_t alignment);
+
+		/// <summary>
+		/// The pools are global (or per thread), so all slab allocators of a kind are interchangeable
+		/// </summary>
+		/// <param name="other">Allocator to compare against</param>
+		/// <returns>Always true</returns>
+		bool operator==(const SlabAllocator& other) const;
+
+		/// <summary>
+		/// Gives the spare slabs of the pools this allocator takes nodes from back to the system
+		/// </summary>
+		static void Trim();
+
+		/// <summary>
+		/// Gets the counters of all the pools this allocator takes nodes from
+		/// </summary>
+		/// <returns>Sum of the counters of every pool</returns>
+		static SlabStatistics Statistics();
+
+		/// <summary>
+		/// Gets the counters of the pool serving nodes of the given size
+		/// </summary>
+		/// <param name="bytes">Size of the nodes</param>
+		/// <returns>Counters of the pool</returns>
+		static SlabStatistics Statistics(size_t bytes);
+
+	private:
+		/// <summary>
+		/// Gets the pools this allocator takes nodes from
+		/// </summary>
+		/// <returns>The shared set, or the calling thread's</returns>
+		static SlabPoolSet& Pools();
+	};
+}
+
+#include "SlabAllocator.inl"
@@ -0,0 +1,99 @@
+/// \file SlabAllocator.inl
+/// \brief Implementation of the slab allocation policy for node based containers
+
+#include "SlabAllocator.h"
+#include <cstdlib>
+#include <cstring>
+
+namespace FieaGameEngine
+{
+	template <bool ThreadLocal>
+	inline void* SlabAllocator<ThreadLocal>::Allocate(size_t bytes, size_t alignment)
+	{
+		return SlabPoolSet::Handles(bytes, alignment) ? Pools().Allocate(bytes) : malloc(bytes);
+	}
+
+	template <bool ThreadLocal>
+	void* SlabAllocator<ThreadLocal>::Reallocate(void* memory, size_t bytes, size_t newBytes, size_t alignment)
+	{
+		if (!SlabPoolSet::Handles(bytes, alignment) && !SlabPoolSet::Handles(newBytes, alignment))
+		{
+			if (newBytes == 0)
+			{
+				free(memory);
+				return nullptr;
+			}
+
+			return realloc(memory, newBytes);
+		}
+
+		// one side is a pool node, so the contents have to move
+		void* block = newBytes > 0 ? Allocate(newBytes, alignment) : nullptr;
+		if (memory != nullptr)
+		{
+			if (block != nullptr)
+			{
+				std::memcpy(block, memory, bytes < newBytes ? bytes : newBytes);
+			}
+
+			Deallocate(memory, bytes, alignment);
+		}
+
+		return block;
+	}
+
+	template <bool ThreadLocal>
+	inline void SlabAllocator<ThreadLocal>::Deallocate(void* memory, size_t bytes, size_t alignment)
+	{
+		if (memory == nullptr)
+		{
+			return;
+		}
+
+		if (SlabPoolSet::Handles(bytes, alignment))
+		{
+			Pools().Deallocate(memory, bytes);
+		}
+		else
+		{
+			free(memory);
+		}
+	}
+
+	template <bool ThreadLocal>
+	inline bool SlabAllocator<ThreadLocal>::operator==(const SlabAllocator&) const
+	{
+		return true;
+	}
+
+	template <bool ThreadLocal>
+	inline void SlabAllocator<ThreadLocal>::Trim()
+	{
+		Pools().Trim();
+	}
+
+	template <bool ThreadLocal>
+	inline SlabStatistics SlabAllocator<ThreadLocal>::Statistics()
+	{
+		return Pools().Statistics();
+	}
+
+	template <bool ThreadLocal>
+	inline SlabStatistics SlabAllocator<ThreadLocal>::Statistics(size_t bytes)
+	{
+		return Pools().Statistics(bytes);
+	}
+
+	template <bool ThreadLocal>
+	inline SlabPoolSet& SlabAllocator<ThreadLocal>::Pools()
+	{
+		if constexpr (ThreadLocal)
+		{
+			return SlabPoolSet::Local();
+		}
+		else
+		{
+			return SlabPoolSet::Shared();
+		}
+	}
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+/// \file SmallVector.h
+/// \brief Definition of SmallVector alias
+
+#include "vector.h"
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Vector that keeps up to N elements inside itself and only moves them to the heap
+	/// once it grows past that, so short lists cost no allocation at all.
+	/// Past N it doubles its capacity on every growth.
+	/// It is a Vector whose allocator has inline room, so both share every line of their implementation
+	/// </summary>
+	template <typename T, size_t N, typename TItemComparator = DefaultComparator<T>>
+	using SmallVector = Vector<T, TItemComparator, InlineAllocator<T, N>, DoublingGrowth>;
+}
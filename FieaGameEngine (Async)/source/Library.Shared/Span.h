@@ -0,0 +1,73 @@
+#pragma once
+
+/// \file Span.h
+/// \brief Definition of Span class
+
+#include <cstddef>
+#include <type_traits>
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Non owning view over a contiguous run of elements, a pointer and a count.
+	/// Iterates with plain pointers, so loops and algorithms over it pay for no checks.
+	/// It does not keep the elements alive, it lasts as long as the storage it was taken from
+	/// </summary>
+	template <typename T>
+	class Span final
+	{
+	public:
+		using value_type = std::remove_cv_t<T>;
+		using size_type = size_t;
+		using pointer = T*;
+		using reference = T&;
+		using iterator = T*;
+
+		/// <summary>
+		/// Default constructor, an empty view
+		/// </summary>
+		constexpr Span() noexcept = default;
+
+		/// <summary>
+		/// Constructor over size elements starting at data
+		/// </summary>
+		/// <param name="data">First element, may be null if size is zero</param>
+		/// <param name="size">Number of elements</param>
+		constexpr Span(T* data, size_t size) noexcept;
+
+		/// <summary>
+		/// Converts a view of mutable elements into a read only one
+		/// </summary>
+		/// <param name="other">View to convert</param>
+		template <typename U, typename = std::enable_if_t<std::is_convertible_v<U(*)[], T(*)[]>>>
+		constexpr Span(const Span<U>& other) noexcept;
+
+		/// <summary>
+		/// Gets the element at the given index, unchecked
+		/// </summary>
+		/// <param name="index">Index</param>
+		/// <returns>Reference to the element</returns>
+		constexpr T& operator[](size_t index) const noexcept;
+
+		/// <returns>Pointer to the first element</returns>
+		constexpr T* begin() const noexcept;
+
+		/// <returns>Pointer past the last element</returns>
+		constexpr T* end() const noexcept;
+
+		/// <returns>Pointer to the first element</returns>
+		constexpr T* data() const noexcept;
+
+		/// <returns>Number of elements</returns>
+		constexpr size_t size() const noexcept;
+
+		/// <returns>True if the view has no elements</returns>
+		constexpr bool empty() const noexcept;
+
+	private:
+		T* mData = nullptr;
+		size_t mSize = 0;
+	};
+}
+
+#include "Span.inl"
@@ -0,0 +1,56 @@
+/// \file Span.inl
+/// \brief Implementation of Span class
+
+#include "Span.h"
+
+namespace FieaGameEngine
+{
+	template <typename T>
+	inline constexpr Span<T>::Span(T* data, size_t size) noexcept :
+		mData(data), mSize(size)
+	{
+	}
+
+	template <typename T>
+	template <typename U, typename>
+	inline constexpr Span<T>::Span(const Span<U>& other) noexcept :
+		mData(other.data()), mSize(other.size())
+	{
+	}
+
+	template <typename T>
+	inline constexpr T& Span<T>::operator[](size_t index) const noexcept
+	{
+		return mData[index];
+	}
+
+	template <typename T>
+	inline constexpr T* Span<T>::begin() const noexcept
+	{
+		return mData;
+	}
+
+	template <typename T>
+	inline constexpr T* Span<T>::end() const noexcept
+	{
+		return mData + mSize;
+	}
+
+	template <typename T>
+	inline constexpr T* Span<T>::data() const noexcept
+	{
+		return mData;
+	}
+
+	template <typename T>
+	inline constexpr size_t Span<T>::size() const noexcept
+	{
+		return mSize;
+	}
+
+	template <typename T>
+	inline constexpr bool Span<T>::empty() const noexcept
+	{
+		return mSize == 0;
+	}
+}
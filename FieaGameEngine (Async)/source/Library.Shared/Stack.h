@@ -1,36 +1,111 @@
 #pragma once
 
-#include "SList.h"
+#include "vector.h"
+#include "SmallVector.h"
 #include <cstddef>
+#include <type_traits>
 
 namespace FieaGameEngine
 {
-	template <typename T>
+	/// <summary>
+	/// Last in first out adapter over contiguous storage. The top is the back of the storage, so
+	/// pushing only allocates when the capacity runs out and popping never gives memory back.
+	/// With an inline capacity the first InlineCapacity elements live inside the stack itself
+	/// </summary>
+	template <typename T, size_t InlineCapacity = 0>
 	class Stack final
 	{
 	public:
-		Stack() = default;
+		/// <summary>
+		/// Storage of the elements, bottom first
+		/// </summary>
+		using StorageType = std::conditional_t<InlineCapacity == 0, Vector<T>, SmallVector<T, InlineCapacity>>;
+
+		/// <summary>
+		/// Creates an empty stack
+		/// </summary>
+		/// <param name="capacity">Number of elements to reserve room for</param>
+		explicit Stack(size_t capacity = InlineCapacity);
+
 		Stack(const Stack&) = default;
 		Stack(Stack&&) = default;
 		Stack& operator=(const Stack&) = default;
 		Stack& operator=(Stack&&) = default;
 		~Stack() = default;
 
+		/// <summary>
+		/// Constructs an element on top of the stack
+		/// </summary>
+		/// <param name="...args">Arguments for the element's constructor</param>
 		template <typename... Args>
 		void Emplace(Args&&... args);
 
+		/// <summary>
+		/// Copies an element on top of the stack
+		/// </summary>
+		/// <param name="value">Element</param>
 		void Push(const T& value);
+
+		/// <summary>
+		/// Moves an element on top of the stack
+		/// </summary>
+		/// <param name="value">Element</param>
+		void Push(T&& value);
+
+		/// <summary>
+		/// Destroys the top element
+		/// </summary>
+		/// <exception cref="std::exception">Thrown if the stack is empty</exception>
 		void Pop();
+
+		/// <summary>
+		/// Destroys every element, the capacity is kept
+		/// </summary>
 		void Clear();
 
+		/// <summary>
+		/// Makes room for the given number of elements
+		/// </summary>
+		/// <param name="capacity">Number of elements</param>
+		void Reserve(size_t capacity);
+
+		/// <summary>
+		/// Gets the top element
+		/// </summary>
+		/// <exception cref="std::exception">Thrown if the stack is empty</exception>
+		/// <returns>Reference to the top element</returns>
 		T& Top();
+
+		/// <summary>
+		/// Gets the top element
+		/// </summary>
+		/// <exception cref="std::exception">Thrown if the stack is empty</exception>
+		/// <returns>Reference to the top element</returns>
 		const T& Top() const;
 
+		/// <summary>
+		/// Tells if the stack has no elements
+		/// </summary>
+		/// <returns>True if empty, false otherwise</returns>
 		bool IsEmpty() const;
+
+		/// <summary>
+		/// Gets the number of elements
+		/// </summary>
+		/// <returns>Number of elements</returns>
 		size_t Size() const;
 
+		/// <summary>
+		/// Gets the number of elements the stack holds before it has to allocate
+		/// </summary>
+		/// <returns>Capacity</returns>
+		size_t Capacity() const;
+
 	private:
-		SList<T> mList;
+		/// <summary>
+		/// Elements, the top is the last one
+		/// </summary>
+		StorageType mStorage;
 	};
 }
 
@@ -2,52 +2,76 @@
 
 namespace FieaGameEngine
 {
-	template <typename T>
+	template <typename T, size_t InlineCapacity>
+	inline Stack<T, InlineCapacity>::Stack(size_t capacity) :
+		mStorage(capacity)
+	{
+	}
+
+	template <typename T, size_t InlineCapacity>
 	template <typename... Args>
-	inline void Stack<T>::Emplace(Args&&... args)
+	inline void Stack<T, InlineCapacity>::Emplace(Args&&... args)
 	{
-		mList.EmplaceFront(std::forward<Args>(args)...);
+		mStorage.EmplaceBack(std::forward<Args>(args)...);
 	}
 
-	template <typename T>
-	inline void Stack<T>::Push(const T& value)
+	template <typename T, size_t InlineCapacity>
+	inline void Stack<T, InlineCapacity>::Push(const T& value)
 	{
 		Emplace(value);
 	}
 
-	template <typename T>
-	inline void Stack<T>::Pop()
+	template <typename T, size_t InlineCapacity>
+	inline void Stack<T, InlineCapacity>::Push(T&& value)
+	{
+		Emplace(std::move(value));
+	}
+
+	template <typename T, size_t InlineCapacity>
+	inline void Stack<T, InlineCapacity>::Pop()
+	{
+		mStorage.PopBack();
+	}
+
+	template <typename T, size_t InlineCapacity>
+	inline void Stack<T, InlineCapacity>::Clear()
+	{
+		mStorage.Clear();
+	}
+
+	template <typename T, size_t InlineCapacity>
+	inline void Stack<T, InlineCapacity>::Reserve(size_t capacity)
 	{
-		mList.PopFront();
+		mStorage.Reserve(capacity);
 	}
 
-	template <typename T>
-	inline void Stack<T>::Clear()
+	template <typename T, size_t InlineCapacity>
+	inline T& Stack<T, InlineCapacity>::Top()
 	{
-		mList.Clear();
+		return mStorage.Back();
 	}
 
-	template <typename T>
-	inline T& Stack<T>::Top()
+	template <typename T, size_t InlineCapacity>
+	inline const T& Stack<T, InlineCapacity>::Top() const
 	{
-		return mList.Front();
+		return mStorage.Back();
 	}
 
-	template <typename T>
-	inline const T& Stack<T>::Top() const
+	template <typename T, size_t InlineCapacity>
+	inline bool Stack<T, InlineCapacity>::IsEmpty() const
 	{
-		return mList.Front();
+		return mStorage.IsEmpty();
 	}
 
-	template <typename T>
-	inline bool Stack<T>::IsEmpty() const
+	template <typename T, size_t InlineCapacity>
+	inline size_t Stack<T, InlineCapacity>::Size() const
 	{
-		return mList.IsEmpty();
+		return mStorage.Size();
 	}
 
-	template <typename T>
-	inline size_t Stack<T>::Size() const
+	template <typename T, size_t InlineCapacity>
+	inline size_t Stack<T, InlineCapacity>::Capacity() const
 	{
-		return mList.Size();
+		return mStorage.Capacity();
 	}
 }
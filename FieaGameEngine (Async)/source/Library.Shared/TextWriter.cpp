@@ -0,0 +1,228 @@
+#include "pch.h"
+#include "TextWriter.h"
+#include <charconv>
+#include <cstdio>
+#include <cstdlib>
+#include <ostream>
+#include "Datum.h"
+
+namespace FieaGameEngine
+{
+	namespace
+	{
+		/// <summary>
+		/// Appends a float with the fewest digits that read back as the same float
+		/// </summary>
+		void AppendFloat(std::string& buffer, float value)
+		{
+			char digits[32];
+#if defined(__cpp_lib_to_chars)
+			const auto result = std::to_chars(digits, digits + sizeof(digits), value);
+			buffer.append(digits, result.ptr);
+#else
+			// the v141 STL has no floating point to_chars, nine significant digits always read back
+			// as the same float, so take the first precision up to that which does
+			int length = 0;
+			for (int precision = 6; precision <= 9; ++precision)
+			{
+				length = std::snprintf(digits, sizeof(digits), "%.*g", precision, value);
+				if (std::strtof(digits, nullptr) == value)
+				{
+					break;
+				}
+			}
+
+			buffer.append(digits, static_cast<size_t>(length));
+#endif
+		}
+	}
+
+	TextWriter::TextWriter(std::string& buffer) :
+		mBuffer(&buffer), mStart(buffer.size())
+	{
+	}
+
+	TextWriter::TextWriter(std::ostream& sink, size_t bufferSize) :
+		mBuffer(&mOwnBuffer), mSink(&sink), mBufferSize(bufferSize > 0 ? bufferSize : 1)
+	{
+		// a little extra room, so the value that fills the buffer fits without growing it
+		mOwnBuffer.reserve(mBufferSize + 512);
+	}
+
+	TextWriter::~TextWriter()
+	{
+		Flush();
+	}
+
+	TextWriter& TextWriter::Write(char character)
+	{
+		mBuffer->push_back(character);
+		Written();
+
+		return *this;
+	}
+
+	TextWriter& TextWriter::Write(std::string_view text)
+	{
+		mBuffer->append(text.data(), text.size());
+		Written();
+
+		return *this;
+	}
+
+	TextWriter& TextWriter::Write(std::int32_t value)
+	{
+		char digits[16];
+		const auto result = std::to_chars(digits, digits + sizeof(digits), value);
+		mBuffer->append(digits, result.ptr);
+		Written();
+
+		return *this;
+	}
+
+	TextWriter& TextWriter::Write(float value)
+	{
+		AppendFloat(*mBuffer, value);
+		Written();
+
+		return *this;
+	}
+
+	TextWriter& TextWriter::Write(const glm::vec4& value)
+	{
+		mBuffer->append("vec4(");
+		WriteComponents(value);
+		Written();
+
+		return *this;
+	}
+
+	TextWriter& TextWriter::Write(const glm::mat4& value)
+	{
+		mBuffer->append("mat4x4(");
+		for (glm::length_t column = 0; column < 4; ++column)
+		{
+			mBuffer->append(column > 0 ? ", (" : "(");
+			WriteComponents(value[column]);
+		}
+
+		mBuffer->push_back(')');
+		Written();
+
+		return *this;
+	}
+
+	TextWriter& TextWriter::Write(const Datum& datum, size_t index)
+	{
+		if (index >= datum.Size())
+		{
+			throw std::exception("Index out of range.");
+		}
+
+		switch (datum.Type())
+		{
+		case Datum::DatumType::INTEGER:
+			return Write(datum.GetUnchecked<std::int32_t>(index));
+		case Datum::DatumType::FLOAT:
+			return Write(datum.GetUnchecked<float>(index));
+		case Datum::DatumType::VECTOR:
+			return Write(datum.GetUnchecked<glm::vec4>(index));
+		case Datum::DatumType::MATRIX:
+			return Write(datum.GetUnchecked<glm::mat4>(index));
+		case Datum::DatumType::STRING:
+			return Write(std::string_view(datum.GetUnchecked<std::string>(index)));
+		default:
+			throw std::exception("No text form for this type.");
+		}
+	}
+
+	TextWriter& TextWriter::WriteQuoted(std::string_view text)
+	{
+		static const char hexDigits[] = "0123456789abcdef";
+
+		mBuffer->push_back('"');
+
+		// copy runs of plain characters at once, break them only for what needs escaping
+		size_t runStart = 0;
+		for (size_t i = 0; i < text.size(); ++i)
+		{
+			const unsigned char character = static_cast<unsigned char>(text[i]);
+			if (character >= 0x20 && character != '"' && character != '\\')
+			{
+				continue;
+			}
+
+			mBuffer->append(text.data() + runStart, i - runStart);
+			runStart = i + 1;
+
+			switch (character)
+			{
+			case '"':
+				mBuffer->append("\\\"");
+				break;
+			case '\\':
+				mBuffer->append("\\\\");
+				break;
+			case '\n':
+				mBuffer->append("\\n");
+				break;
+			case '\r':
+				mBuffer->append("\\r");
+				break;
+			case '\t':
+				mBuffer->append("\\t");
+				break;
+			default:
+			{
+				const char escape[] = { '\\', 'u', '0', '0', hexDigits[character >> 4], hexDigits[character & 0xF] };
+				mBuffer->append(escape, sizeof(escape));
+				break;
+			}
+			}
+		}
+
+		mBuffer->append(text.data() + runStart, text.size() - runStart);
+		mBuffer->push_back('"');
+		Written();
+
+		return *this;
+	}
+
+	void TextWriter::Flush()
+	{
+		if (mSink != nullptr && !mOwnBuffer.empty())
+		{
+			mSink->write(mOwnBuffer.data(), static_cast<std::streamsize>(mOwnBuffer.size()));
+			mFlushed += mOwnBuffer.size();
+			mOwnBuffer.clear();
+		}
+	}
+
+	size_t TextWriter::BytesWritten() const
+	{
+		return mFlushed + mBuffer->size() - mStart;
+	}
+
+	inline void TextWriter::Written()
+	{
+		if (mSink != nullptr && mOwnBuffer.size() >= mBufferSize)
+		{
+			Flush();
+		}
+	}
+
+	void TextWriter::WriteComponents(const glm::vec4& value)
+	{
+		for (glm::length_t i = 0; i < 4; ++i)
+		{
+			if (i > 0)
+			{
+				mBuffer->append(", ");
+			}
+
+			AppendFloat(*mBuffer, value[i]);
+		}
+
+		mBuffer->push_back(')');
+	}
+}
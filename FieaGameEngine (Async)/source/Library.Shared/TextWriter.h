@@ -0,0 +1,153 @@
+#pragma once
+
+/// \file TextWriter.h
+/// \brief Definition of TextWriter class
+
+#include <glm/fwd.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+
+namespace FieaGameEngine
+{
+	class Datum;
+
+	/// <summary>
+	/// Appends text to a growable buffer, either one the caller owns or its own, which it hands to an output
+	/// stream each time it fills up. Numbers are written with std::to_chars in their shortest exact form and
+	/// nothing is allocated per value, the buffer only grows. Vectors and matrices come out as "vec4(x, y, z, w)"
+	/// and "mat4x4((...), (...), (...), (...))", the glm::to_string layout Datum::SetFromString reads back
+	/// </summary>
+	class TextWriter final
+	{
+	public:
+		/// <summary>
+		/// Bytes buffered before they are handed to an output stream, unless told otherwise
+		/// </summary>
+		static constexpr size_t DefaultBufferSize = 64 * 1024;
+
+		/// <summary>
+		/// Creates a writer appending to a caller's buffer, which keeps whatever it already holds
+		/// </summary>
+		/// <param name="buffer">Buffer to append to, must outlive the writer</param>
+		explicit TextWriter(std::string& buffer);
+
+		/// <summary>
+		/// Creates a writer handing its text to an output stream a buffer at a time
+		/// </summary>
+		/// <param name="sink">Stream to write to, must outlive the writer</param>
+		/// <param name="bufferSize">Bytes buffered between writes to the stream</param>
+		explicit TextWriter(std::ostream& sink, size_t bufferSize = DefaultBufferSize);
+
+		TextWriter(const TextWriter&) = delete;
+		TextWriter(TextWriter&&) = delete;
+		TextWriter& operator=(const TextWriter&) = delete;
+		TextWriter& operator=(TextWriter&&) = delete;
+
+		/// <summary>
+		/// Hands what is left in the buffer to the stream, if writing to one
+		/// </summary>
+		~TextWriter();
+
+		/// <summary>
+		/// Appends a character
+		/// </summary>
+		/// <param name="character">Character</param>
+		/// <returns>This writer</returns>
+		TextWriter& Write(char character);
+
+		/// <summary>
+		/// Appends text as it is
+		/// </summary>
+		/// <param name="text">Text</param>
+		/// <returns>This writer</returns>
+		TextWriter& Write(std::string_view text);
+
+		/// <summary>
+		/// Appends an integer
+		/// </summary>
+		/// <param name="value">Integer</param>
+		/// <returns>This writer</returns>
+		TextWriter& Write(std::int32_t value);
+
+		/// <summary>
+		/// Appends a float, with the fewest digits that read back as the same float
+		/// </summary>
+		/// <param name="value">Float</param>
+		/// <returns>This writer</returns>
+		TextWriter& Write(float value);
+
+		/// <summary>
+		/// Appends a vector as "vec4(x, y, z, w)"
+		/// </summary>
+		/// <param name="value">Vector</param>
+		/// <returns>This writer</returns>
+		TextWriter& Write(const glm::vec4& value);
+
+		/// <summary>
+		/// Appends a matrix as "mat4x4((...), (...), (...), (...))", one vector per column
+		/// </summary>
+		/// <param name="value">Matrix</param>
+		/// <returns>This writer</returns>
+		TextWriter& Write(const glm::mat4& value);
+
+		/// <summary>
+		/// Appends an element of a datum as the text Datum::SetFromString reads
+		/// </summary>
+		/// <exception cref="std::exception">Thrown if the index is out of range, or the type has no text form</exception>
+		/// <param name="datum">Datum of integers, floats, vectors, matrices or strings</param>
+		/// <param name="index">Index of the element</param>
+		/// <returns>This writer</returns>
+		TextWriter& Write(const Datum& datum, size_t index = 0);
+
+		/// <summary>
+		/// Appends text as a quoted JSON string, escaping quotes, backslashes and control characters
+		/// </summary>
+		/// <param name="text">Text</param>
+		/// <returns>This writer</returns>
+		TextWriter& WriteQuoted(std::string_view text);
+
+		/// <summary>
+		/// Hands the buffered text to the stream, if writing to one
+		/// </summary>
+		void Flush();
+
+		/// <summary>
+		/// Gets the number of bytes written so far, flushed or not
+		/// </summary>
+		/// <returns>Number of bytes</returns>
+		size_t BytesWritten() const;
+
+	private:
+		/// <summary>
+		/// Flushes once the buffer of a stream writer is full
+		/// </summary>
+		void Written();
+
+		/// <summary>
+		/// Appends the components of a vector, separated by commas
+		/// </summary>
+		void WriteComponents(const glm::vec4& value);
+
+		/// <summary>
+		/// Buffer appended to, the caller's or mOwnBuffer
+		/// </summary>
+		std::string* mBuffer;
+
+		/// <summary>
+		/// Buffer of a writer handing its text to a stream
+		/// </summary>
+		std::string mOwnBuffer;
+
+		std::ostream* mSink = nullptr;
+		size_t mBufferSize = 0;
+
+		/// <summary>
+		/// Bytes already handed to the stream, and the size the caller's buffer had to begin with
+		/// </summary>
+		size_t mFlushed = 0;
+		size_t mStart = 0;
+	};
+}
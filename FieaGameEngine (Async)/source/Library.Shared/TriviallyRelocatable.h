@@ -0,0 +1,23 @@
+#pragma once
+
+/// \file TriviallyRelocatable.h
+/// \brief Definition of IsTriviallyRelocatable trait
+
+#include <type_traits>
+
+namespace FieaGameEngine
+{
+	/// <summary>
+	/// Tells if an object of type T can be moved to a new address by copying its bytes,
+	/// without running its move constructor and destructor. Containers use it to grow
+	/// their storage with realloc. True for trivially copyable types; specialize it to
+	/// opt in a type that owns resources but never points back into itself
+	/// </summary>
+	template <typename T>
+	struct IsTriviallyRelocatable : std::bool_constant<std::is_trivially_copyable_v<T>>
+	{
+	};
+
+	template <typename T>
+	constexpr bool IsTriviallyRelocatableV = IsTriviallyRelocatable<T>::value;
+}
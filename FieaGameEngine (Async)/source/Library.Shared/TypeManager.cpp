@@ -3,69 +3,183 @@
 
 namespace FieaGameEngine
 {
-	HashMap<RTTI::IdType, TypeManager::TypeRegistryEntry> TypeManager::sTypeRegistry(16);
+	TypeManager::TypeRegistryType TypeManager::sTypeRegistry(16);
+	TypeManager::FrozenTypeRegistryType TypeManager::sFrozenTypeRegistry;
 
-	void TypeManager::RegisterType(RTTI::IdType id, const Vector<Signature>& signatures, RTTI::IdType parentId)
+	void TypeManager::RegisterType(RTTI::IdType id, const SignatureListType& signatures, RTTI::IdType parentId)
 	{
+		Thaw();
 		sTypeRegistry.Emplace(id, TypeRegistryEntry(signatures, parentId));
+		BuildLayouts();
 	}
 
-	void TypeManager::RegisterType(RTTI::IdType id, Vector<Signature>&& signatures, RTTI::IdType parentId)
+	void TypeManager::RegisterType(RTTI::IdType id, SignatureListType&& signatures, RTTI::IdType parentId)
 	{
+		Thaw();
 		sTypeRegistry.Emplace(id, TypeRegistryEntry(std::move(signatures), parentId));
+		BuildLayouts();
 	}
 
 	void TypeManager::UnregisterType(RTTI::IdType id)
 	{
+		Thaw();
 		sTypeRegistry.Remove(id);
+		BuildLayouts();
 	}
 
-	const Vector<Signature>& TypeManager::GetSignatures(RTTI::IdType id)
+	const SignatureListType& TypeManager::GetSignatures(RTTI::IdType id)
 	{
-		return sTypeRegistry.At(id).Signatures;
+		const TypeRegistryEntry* entry = FindEntry(id);
+		if (entry == nullptr)
+		{
+			throw std::exception("Key not found.");
+		}
+
+		return entry->Signatures;
 	}
 
 	size_t TypeManager::GetSignatureCount(RTTI::IdType id)
 	{
-		return sTypeRegistry.At(id).Signatures.Size();
+		return GetSignatures(id).Size();
 	}
 
 	std::pair<bool, RTTI::IdType> TypeManager::FindBaseId(RTTI::IdType id)
 	{
-		TypeRegistryType::Iterator it;
-		if (sTypeRegistry.ContainsKey(id, it))
+		const TypeRegistryEntry* entry = FindEntry(id);
+		if (entry != nullptr)
 		{
-			return { true, (*it).second.BaseId };
+			return { true, entry->BaseId };
 		}
 
 		return { false, 0 };
 	}
 
-	Stack<RTTI::IdType> TypeManager::GetInheritanceChain(RTTI::IdType id)
+	TypeManager::InheritanceChainType TypeManager::GetInheritanceChain(RTTI::IdType id)
 	{
-		Stack<RTTI::IdType> stack;
+		InheritanceChainType stack;
 
-		TypeRegistryType::Iterator it;
-		while (sTypeRegistry.ContainsKey(id, it))
+		for (const TypeRegistryEntry* entry = FindEntry(id); entry != nullptr; entry = FindEntry(id))
 		{
 			stack.Push(id);
-			id = (*it).second.BaseId;
+			id = entry->BaseId;
 		}
 
 		return stack;
 	}
 
+	const TypeManager::TypeLayout& TypeManager::GetLayout(RTTI::IdType id)
+	{
+		const TypeRegistryEntry* entry = FindEntry(id);
+		if (entry != nullptr)
+		{
+			return entry->Layout;
+		}
+
+		static const TypeLayout unregistered = []
+		{
+			TypeLayout layout;
+			layout.Names = { { Atom("this"), 0 } };
+			layout.Prototype.Emplace(Atom("this"), Datum(Datum::DatumType::POINTER));
+			return layout;
+		}();
+
+		return unregistered;
+	}
+
 	void TypeManager::Clear()
 	{
+		Thaw();
 		sTypeRegistry.Clear();
 	}
 
-	TypeManager::TypeRegistryEntry::TypeRegistryEntry(const Vector<Signature>& signatures, RTTI::IdType baseId) : 
+	void TypeManager::Freeze()
+	{
+		Vector<FrozenTypeRegistryType::PairType> entries(sTypeRegistry.Size());
+		for (const auto& [id, entry] : sTypeRegistry)
+		{
+			entries.EmplaceBack(id, &entry);
+		}
+
+		sFrozenTypeRegistry = FrozenTypeRegistryType(entries.begin(), entries.end());
+	}
+
+	bool TypeManager::IsFrozen()
+	{
+		return !sFrozenTypeRegistry.IsEmpty();
+	}
+
+	const TypeManager::TypeRegistryEntry* TypeManager::FindEntry(RTTI::IdType id)
+	{
+		if (IsFrozen())
+		{
+			FrozenTypeRegistryType::ConstIterator frozen;
+			return sFrozenTypeRegistry.ContainsKey(id, frozen) ? (*frozen).second : nullptr;
+		}
+
+		TypeRegistryType::ConstIterator it;
+		return sTypeRegistry.ContainsKey(id, it) ? &(*it).second : nullptr;
+	}
+
+	void TypeManager::Thaw()
+	{
+		sFrozenTypeRegistry = FrozenTypeRegistryType();
+	}
+
+	void TypeManager::BuildLayouts()
+	{
+		static const Atom thisKey("this");
+
+		for (auto& [id, entry] : sTypeRegistry)
+		{
+			TypeLayout& layout = entry.Layout;
+
+			size_t count = 0;
+			for (const TypeRegistryEntry* ancestor = &entry; ancestor != nullptr; ancestor = FindEntry(ancestor->BaseId))
+			{
+				count += ancestor->Signatures.Size();
+			}
+
+			layout.Signatures.Clear();
+			layout.Signatures.Reserve(count);
+
+			FlatHashMap<Atom, size_t> names(count + 1);
+			names.Emplace(thisKey, 0);
+
+			layout.Prototype.Clear();
+			layout.Prototype.Reserve(count + 1);
+			layout.Prototype.Emplace(thisKey, Datum(Datum::DatumType::POINTER));
+
+			// the chain stops at the first ancestor that is not registered, Attributed itself never is
+			auto chain = GetInheritanceChain(id);
+			while (!chain.IsEmpty())
+			{
+				for (const Signature& signature : FindEntry(chain.Top())->Signatures)
+				{
+					// a name declared again further down, 'this' included, keeps the attribute it already has,
+					// so the signatures, the names and the prototype stay in step
+					if (!names.Emplace(signature.Name, layout.Signatures.Size() + 1).second)
+					{
+						continue;
+					}
+
+					layout.Signatures.PushBack(signature);
+					layout.Prototype.Emplace(signature.Name, Datum(signature.Type));
+				}
+
+				chain.Pop();
+			}
+
+			layout.PrescribedCount = layout.Signatures.Size() + 1;
+			layout.Names = FrozenHashMap<Atom, size_t>(names.begin(), names.end());
+		}
+	}
+
+	TypeManager::TypeRegistryEntry::TypeRegistryEntry(const SignatureListType& signatures, RTTI::IdType baseId) : 
 		Signatures(signatures), BaseId(baseId)
 	{
 	}
 
-	TypeManager::TypeRegistryEntry::TypeRegistryEntry(Vector<Signature>&& signatures, RTTI::IdType baseId) :
+	TypeManager::TypeRegistryEntry::TypeRegistryEntry(SignatureListType&& signatures, RTTI::IdType baseId) :
 		Signatures(std::move(signatures)), BaseId(std::move(baseId))
 	{
 	}
@@ -1,7 +1,9 @@
 #pragma once
 
 #include "RTTI.h"
-#include "HashMap.h"
+#include "FlatHashMap.h"
+#include "FrozenHashMap.h"
+#include "OrderedHashMap.h"
 #include "vector.h"
 #include "Stack.h"
 #include "Signature.h"
@@ -12,17 +14,52 @@ namespace FieaGameEngine
 {
 	class TypeManager
 	{
+	public:
+		/// <summary>
+		/// Prescribed attributes of a type and all of its registered ancestors, worked out whenever the
+		/// registry changes so instances never walk the hierarchy. Single inheritance puts every base at
+		/// the start of the object, so the offsets of inherited signatures are already absolute
+		/// </summary>
+		struct TypeLayout final
+		{
+			/// <summary>
+			/// Number of prescribed attributes, 'this' included
+			/// </summary>
+			size_t PrescribedCount = 1;
+
+			/// <summary>
+			/// Signatures of the whole hierarchy in the order they are populated, the root type first.
+			/// A name declared again by a derived type is left out, the first declaration keeps it
+			/// </summary>
+			SignatureListType Signatures;
+
+			/// <summary>
+			/// Index of every prescribed attribute by name, 'this' included
+			/// </summary>
+			FrozenHashMap<Atom, size_t> Names;
+
+			/// <summary>
+			/// Entries a new instance starts from, 'this' and an empty datum of the right type per attribute.
+			/// Copying it builds the whole table at once, the instance then points the datums at its members
+			/// </summary>
+			OrderedHashMap<Atom, Datum> Prototype;
+		};
+
 	private:
 		struct TypeRegistryEntry final
 		{
-			TypeRegistryEntry(const Vector<Signature>& signatures, RTTI::IdType baseId);
-			TypeRegistryEntry(Vector<Signature>&& signatures, RTTI::IdType baseId);
+			TypeRegistryEntry(const SignatureListType& signatures, RTTI::IdType baseId);
+			TypeRegistryEntry(SignatureListType&& signatures, RTTI::IdType baseId);
 
-			Vector<Signature> Signatures;
+			SignatureListType Signatures;
 			RTTI::IdType BaseId;
+			TypeLayout Layout;
 		};
 
 	public:
+		// deep enough for every hierarchy in the engine, so building a chain never allocates
+		using InheritanceChainType = Stack<RTTI::IdType, 8>;
+
 		TypeManager() = delete;
 		TypeManager(const TypeManager&) = delete;
 		TypeManager(TypeManager&&) = delete;
@@ -30,17 +67,36 @@ namespace FieaGameEngine
 		TypeManager& operator=(TypeManager&&) = delete;
 		~TypeManager() = default;
 
-		static void RegisterType(RTTI::IdType id, const Vector<Signature>& signatures, RTTI::IdType parentId);
-		static void RegisterType(RTTI::IdType id, Vector<Signature>&& signatures, RTTI::IdType parentId);
+		static void RegisterType(RTTI::IdType id, const SignatureListType& signatures, RTTI::IdType parentId);
+		static void RegisterType(RTTI::IdType id, SignatureListType&& signatures, RTTI::IdType parentId);
 		static void UnregisterType(RTTI::IdType id);
-		static const Vector<Signature>& GetSignatures(RTTI::IdType id);
+		static const SignatureListType& GetSignatures(RTTI::IdType id);
 		static size_t GetSignatureCount(RTTI::IdType id);
 		static std::pair<bool, RTTI::IdType> FindBaseId(RTTI::IdType id);
-		static Stack<RTTI::IdType> GetInheritanceChain(RTTI::IdType id);
+		static InheritanceChainType GetInheritanceChain(RTTI::IdType id);
+
+		// the layout of an unregistered type only holds 'this'
+		static const TypeLayout& GetLayout(RTTI::IdType id);
 		static void Clear();
 
+		// builds a perfect hash of the registry once every type is registered, registering
+		// or unregistering a type afterwards drops it again
+		static void Freeze();
+		static bool IsFrozen();
+
 	private:
-		using TypeRegistryType = HashMap<RTTI::IdType, TypeRegistryEntry>;
+		using TypeRegistryType = FlatHashMap<RTTI::IdType, TypeRegistryEntry>;
+		using FrozenTypeRegistryType = FrozenHashMap<RTTI::IdType, const TypeRegistryEntry*>;
+
+		static const TypeRegistryEntry* FindEntry(RTTI::IdType id);
+		static void Thaw();
+
+		// lays out every registered type again, ancestors may have come or gone
+		static void BuildLayouts();
+
 		static TypeRegistryType sTypeRegistry;
+
+		// points into sTypeRegistry, empty unless frozen
+		static FrozenTypeRegistryType sFrozenTypeRegistry;
 	};
 }
@@ -3,12 +3,19 @@
 namespace FieaGameEngine
 {
 	constexpr float DefaultIncrementMultiplier = 1.4f;
-
-	class DefaultIncrement final
-	{
-	public:
-		size_t operator()(size_t size, size_t capacity) const;
-	};
 }
 
+/// <summary>
+/// Lets empty policy members (comparators, allocators, growth policies) share the address of
+/// another member instead of taking a padded byte each. MSVC ignores the standard spelling, and
+/// its own only exists from VS2019 16.9, older toolsets such as v141 fall back to plain members
+/// </summary>
+#if defined(_MSC_VER) && _MSC_VER >= 1929
+#define FIEA_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#elif defined(_MSC_VER)
+#define FIEA_NO_UNIQUE_ADDRESS
+#else
+#define FIEA_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#endif
+
 #include "Utility.inl"
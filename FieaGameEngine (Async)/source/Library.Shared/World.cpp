@@ -10,9 +10,9 @@ namespace FieaGameEngine
 	const std::string World::SectorsKey = "Sectors";
 	const std::size_t World::SectorsIndex = 2;
 
-	Vector<Signature> World::Signatures()
+	SignatureListType World::Signatures()
 	{
-		return Vector<Signature>(
+		return SignatureListType(
 			{
 				{ "Name", Datum::DatumType::STRING, 1, offsetof(World, mName) },
 				{ SectorsKey, Datum::DatumType::TABLE, 0, 0 }
@@ -25,7 +25,7 @@ namespace FieaGameEngine
 
 	World::World(const std::shared_ptr<GameTime>& gameTime, const std::string& name) : Attributed(TypeIdClass()), mName(name), mWorldState(gameTime)
 	{
-		assert(mList[SectorsIndex]->first == SectorsKey);
+		assert(mMap.EntryAt(SectorsIndex).first == SectorsKey);
 	}
 
 	gsl::owner<World*> World::Clone() const
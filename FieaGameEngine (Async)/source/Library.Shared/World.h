@@ -33,7 +33,7 @@ namespace FieaGameEngine
 		/// attributes of this world
 		/// </summary>
 		/// <returns>attributes</returns>
-		static Vector<Signature> Signatures();
+		static SignatureListType Signatures();
 
 	public:
 		/// <summary>
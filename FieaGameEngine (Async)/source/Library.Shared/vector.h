@@ -7,17 +7,27 @@
 #include <cstddef>
 #include <cstring>
 #include <exception>
-#include <functional>
 #include <initializer_list>
+#include <iterator>
+#include <type_traits>
+#include "Allocator.h"
 #include "DefaultComparator.h"
+#include "GrowthPolicy.h"
+#include "Span.h"
+#include "TriviallyRelocatable.h"
 #include "Utility.h"
 
 namespace FieaGameEngine
 {
 	/// <summary>
-	/// Dynamic container of contiguously stored elements
+	/// Dynamic container of contiguously stored elements.
+	/// Growing relocates the elements with the allocator's Reallocate when IsTriviallyRelocatable
+	/// allows it and by move construction otherwise. Memory comes from TAllocator, see DefaultAllocator.
+	/// The next capacity comes from TGrowthPolicy, see GeometricGrowth.
+	/// With an allocator that has inline room, see InlineAllocator, the vector starts out in it,
+	/// never drops below its capacity and moves its elements one by one when that is where they are
 	/// </summary>
-	template <typename T, typename TItemComparator = DefaultComparator<T>>
+	template <typename T, typename TItemComparator = DefaultComparator<T>, typename TAllocator = DefaultAllocator, typename TGrowthPolicy = GeometricGrowth>
 	class Vector final
 	{
 	public:
@@ -43,7 +53,7 @@ namespace FieaGameEngine
 			using value_type = T;
 			using reference = T&;
 			using pointer = T*;
-			using iterator_category = std::forward_iterator_tag;
+			using iterator_category = std::random_access_iterator_tag;
 
 		public:
 			/// <summary>
@@ -143,6 +153,77 @@ namespace FieaGameEngine
 			/// <returns>A copy to this iterator before the increment</returns>
 			Iterator operator++(int);
 
+			/// <summary>
+			/// Makes this iterator point to the previous element in the vector
+			/// </summary>
+			/// <exception cref="std::exception">Thrown if the iterator has no owner or is at the beginning</exception>
+			/// <returns>A reference to this iterator</returns>
+			Iterator& operator--();
+
+			/// <summary>
+			/// Makes this iterator point to the previous element in the vector
+			/// </summary>
+			/// <exception cref="std::exception">Thrown if the iterator has no owner or is at the beginning</exception>
+			/// <param name="">Dummy parameter to differentiate functions</param>
+			/// <returns>A copy to this iterator before the decrement</returns>
+			Iterator operator--(int);
+
+			/// <summary>
+			/// Moves this iterator the given number of elements
+			/// </summary>
+			/// <exception cref="std::exception">Thrown if the iterator has no owner or would leave the vector</exception>
+			/// <param name="offset">Number of elements to move, negative moves backwards</param>
+			/// <returns>A reference to this iterator</returns>
+			Iterator& operator+=(difference_type offset);
+
+			/// <summary>
+			/// Moves this iterator back the given number of elements
+			/// </summary>
+			/// <exception cref="std::exception">Thrown if the iterator has no owner or would leave the vector</exception>
+			/// <param name="offset">Number of elements to move back, negative moves forward</param>
+			/// <returns>A reference to this iterator</returns>
+			Iterator& operator-=(difference_type offset);
+
+			/// <summary>
+			/// Gets an iterator the given number of elements away from this one
+			/// </summary>
+			/// <exception cref="std::exception">Thrown if the iterator has no owner or the result would leave the vector</exception>
+			/// <param name="offset">Number of elements to move, negative moves backwards</param>
+			/// <returns>The moved iterator</returns>
+			Iterator operator+(difference_type offset) const;
+
+			/// <summary>
+			/// Gets an iterator the given number of elements behind this one
+			/// </summary>
+			/// <exception cref="std::exception">Thrown if the iterator has no owner or the result would leave the vector</exception>
+			/// <param name="offset">Number of elements to move back, negative moves forward</param>
+			/// <returns>The moved iterator</returns>
+			Iterator operator-(difference_type offset) const;
+
+			/// <summary>
+			/// Gets the number of elements between two iterators
+			/// </summary>
+			/// <exception cref="std::exception">Thrown if the iterators have different owners</exception>
+			/// <param name="other">The other iterator</param>
+			/// <returns>How far this iterator is ahead of the other, negative if it is behind</returns>
+			difference_type operator-(const Iterator& other) const;
+
+			/// <summary>
+			/// Gets the value the given number of elements away from this iterator
+			/// </summary>
+			/// <exception cref="std::exception">Thrown if the iterator has no owner or the element is out of range</exception>
+			/// <param name="offset">Number of elements away from this iterator</param>
+			/// <returns>A reference to the value</returns>
+			T& operator[](difference_type offset) const;
+
+			/// <summary>
+			/// Gets an iterator the given number of elements away from the given one
+			/// </summary>
+			/// <param name="offset">Number of elements to move, negative moves backwards</param>
+			/// <param name="it">Iterator to start from</param>
+			/// <returns>The moved iterator</returns>
+			friend Iterator operator+(difference_type offset, const Iterator& it) { return it + offset; }
+
 			/// <summary>
 			/// Gets the value this iterator points to
 			/// </summary>
@@ -187,9 +268,9 @@ namespace FieaGameEngine
 			using size_type = std::size_t;
 			using difference_type = std::ptrdiff_t;
 			using value_type = T;
-			using reference = T&;
-			using pointer = T*;
-			using iterator_category = std::forward_iterator_tag;
+			using reference = const T&;
+			using pointer = const T*;
+			using iterator_category = std::random_access_iterator_tag;
 
 		public:
 			/// <summary>
@@ -302,6 +383,77 @@ namespace FieaGameEngine
 			/// <returns>A copy to this iterator before the increment</returns>
 			ConstIterator operator++(int);
 
+			/// <summary>
+			/// Makes this iterator point to the previous element in the vector
+			/// </summary>
+			/// <exception cref="std::exception">Thrown if the iterator has no owner or is at the beginning</exception>
+			/// <returns>A reference to this iterator</returns>
+			ConstIterator& operator--();
+
+			/// <summary>
+			/// Makes this iterator point to the previous element in the vector
+			/// </summary>
+			/// <exception cref="std::exception">Thrown if the iterator has no owner or is at the beginning</exception>
+			/// <param name="">Dummy parameter to differentiate functions</param>
+			/// <returns>A copy to this iterator before the decrement</returns>
+			ConstIterator operator--(int);
+
+			/// <summary>
+			/// Moves this iterator the given number of elements
+			/// </summary>
+			/// <exception cref="std::exception">Thrown if the iterator has no owner or would leave the vector</exception>
+			/// <param name="offset">Number of elements to move, negative moves backwards</param>
+			/// <returns>A reference to this iterator</returns>
+			ConstIterator& operator+=(difference_type offset);
+
+			/// <summary>
+			/// Moves this iterator back the given number of elements
+			/// </summary>
+			/// <exception cref="std::exception">Thrown if the iterator has no owner or would leave the vector</exception>
+			/// <param name="offset">Number of elements to move back, negative moves forward</param>
+			/// <returns>A reference to this iterator</returns>
+			ConstIterator& operator-=(difference_type offset);
+
+			/// <summary>
+			/// Gets an iterator the given number of elements away from this one
+			/// </summary>
+			/// <exception cref="std::exception">Thrown if the iterator has no owner or the result would leave the vector</exception>
+			/// <param name="offset">Number of elements to move, negative moves backwards</param>
+			/// <returns>The moved iterator</returns>
+			ConstIterator operator+(difference_type offset) const;
+
+			/// <summary>
+			/// Gets an iterator the given number of elements behind this one
+			/// </summary>
+			/// <exception cref="std::exception">Thrown if the iterator has no owner or the result would leave the vector</exception>
+			/// <param name="offset">Number of elements to move back, negative moves forward</param>
+			/// <returns>The moved iterator</returns>
+			ConstIterator operator-(difference_type offset) const;
+
+			/// <summary>
+			/// Gets the number of elements between two iterators
+			/// </summary>
+			/// <exception cref="std::exception">Thrown if the iterators have different owners</exception>
+			/// <param name="other">The other iterator</param>
+			/// <returns>How far this iterator is ahead of the other, negative if it is behind</returns>
+			difference_type operator-(const ConstIterator& other) const;
+
+			/// <summary>
+			/// Gets the value the given number of elements away from this iterator
+			/// </summary>
+			/// <exception cref="std::exception">Thrown if the iterator has no owner or the element is out of range</exception>
+			/// <param name="offset">Number of elements away from this iterator</param>
+			/// <returns>A reference to the value</returns>
+			const T& operator[](difference_type offset) const;
+
+			/// <summary>
+			/// Gets an iterator the given number of elements away from the given one
+			/// </summary>
+			/// <param name="offset">Number of elements to move, negative moves backwards</param>
+			/// <param name="it">Iterator to start from</param>
+			/// <returns>The moved iterator</returns>
+			friend ConstIterator operator+(difference_type offset, const ConstIterator& it) { return it + offset; }
+
 			/// <summary>
 			/// Gets the value this iterator points to
 			/// </summary>
@@ -337,11 +489,19 @@ namespace FieaGameEngine
 
 	public:
 		/// <summary>
-		/// Creates a vector with the given capacity and increment strategy
+		/// Creates a vector with the given capacity and growth policy
+		/// </summary>
+		/// <param name="capacity">The new capacity</param>
+		/// <param name="growthPolicy">The growth policy to use for this vector</param>
+		/// <param name="allocator">The allocator the elements are stored with</param>
+		explicit Vector(size_t capacity = 0, const TGrowthPolicy& growthPolicy = TGrowthPolicy(), const TAllocator& allocator = TAllocator());
+
+		/// <summary>
+		/// Creates a vector that stores its elements with the given allocator
 		/// </summary>
+		/// <param name="allocator">The allocator the elements are stored with</param>
 		/// <param name="capacity">The new capacity</param>
-		/// <param name="incrementCallback">The increment strategy to use for this vector</param>
-		explicit Vector(size_t capacity = 0, std::function<size_t(size_t, size_t)> incrementCallback = DefaultIncrement());
+		explicit Vector(const TAllocator& allocator, size_t capacity = 0);
 
 		/// <summary>
 		/// Deep copies the given vector into this
@@ -374,7 +534,7 @@ namespace FieaGameEngine
 		Vector& operator=(const Vector& other);
 
 		/// <summary>
-		/// Moves the given vector into this
+		/// Moves the given vector into this, along with its allocator
 		/// </summary>
 		/// <param name="other">The vector to be moved</param>
 		/// <returns>A reference to this vector</returns>
@@ -449,6 +609,60 @@ namespace FieaGameEngine
 		template <typename... Args>		
 		Iterator EmplaceBack(Args&&... args);
 
+		/// <summary>
+		/// Adds the given number of elements to the end of the list, growing at most once
+		/// </summary>
+		/// <exception cref="std::exception">Thrown if the growth policy fails to provide a valid new capacity</exception>
+		/// <param name="count">Number of elements to add</param>
+		/// <param name="...args">arguments for the constructor of every element, copied rather than forwarded</param>
+		/// <returns>Iterator pointing to the first added element, end if none was added</returns>
+		template <typename... Args>
+		Iterator EmplaceBackN(size_t count, const Args&... args);
+
+		/// <summary>
+		/// Inserts the elements of a range before the given position. The final size is computed up front,
+		/// so the vector grows at most once, and trivially copyable elements from contiguous ranges are memcpy'd
+		/// </summary>
+		/// <exception cref="std::exception">Thrown if the position is not owned by this vector, is past the end, or the growth policy fails to provide a valid new capacity</exception>
+		/// <param name="position">Iterator to the element the range goes before, end to append</param>
+		/// <param name="first">Iterator to the first element to insert</param>
+		/// <param name="last">Iterator past the last element to insert</param>
+		/// <returns>Iterator pointing to the first inserted element</returns>
+		template <typename TInputIterator>
+		Iterator Insert(const Iterator& position, TInputIterator first, TInputIterator last);
+
+		/// <summary>
+		/// Appends the elements of a range, see Insert
+		/// </summary>
+		/// <param name="first">Iterator to the first element to append</param>
+		/// <param name="last">Iterator past the last element to append</param>
+		/// <returns>Iterator pointing to the first appended element</returns>
+		template <typename TInputIterator>
+		Iterator Append(TInputIterator first, TInputIterator last);
+
+		/// <summary>
+		/// Appends the elements of a container or any other range with begin and end, see Insert
+		/// </summary>
+		/// <param name="range">The elements to append</param>
+		/// <returns>Iterator pointing to the first appended element</returns>
+		template <typename TRange>
+		Iterator Append(const TRange& range);
+
+		/// <summary>
+		/// Replaces the contents with the elements of a range, reserving exactly what it needs if it does not fit
+		/// </summary>
+		/// <param name="first">Iterator to the first element</param>
+		/// <param name="last">Iterator past the last element</param>
+		template <typename TInputIterator>
+		void Assign(TInputIterator first, TInputIterator last);
+
+		/// <summary>
+		/// Replaces the contents with the elements of a container or any other range with begin and end
+		/// </summary>
+		/// <param name="range">The elements to copy</param>
+		template <typename TRange>
+		void Assign(const TRange& range);
+
 		/// <summary>
 		/// Removes the last element of the vector
 		/// <exception cref="std::exception">Thrown if the vector is empty</exception>
@@ -509,7 +723,7 @@ namespace FieaGameEngine
 		/// <summary>
 		/// Removes the range of elements the given iterator range points to
 		/// </summary>
-		/// <exception cref="std::exception">Thrown if the given iterators are not owned by this vector or if the range is invalid</exception>
+		/// <exception cref="std::exception">Thrown if the given iterators are not owned by this vector or if the range is invalid or runs past the end</exception>
 		/// <param name="first">The iterator pointing to the first element to be removed</param>
 		/// <param name="last">The iterator pointing to the element following the last one to remove</param>
 		void Remove(const Iterator& first, const Iterator& last);
@@ -550,6 +764,25 @@ namespace FieaGameEngine
 		/// <returns>An iterator pointing past the last element in the vector</returns>
 		ConstIterator cend() const;
 
+		/// <summary>
+		/// Gets the elements as a Span, whose plain pointer iterators skip the checks of Iterator.
+		/// Meant for the standard algorithms, it is invalidated by anything that reallocates the vector
+		/// </summary>
+		/// <returns>view over the elements, empty if the vector is</returns>
+		Span<T> AsSpan();
+
+		/// <summary>
+		/// Gets the elements as a read only Span, whose plain pointer iterators skip the checks of ConstIterator
+		/// </summary>
+		/// <returns>view over the elements, empty if the vector is</returns>
+		Span<const T> AsSpan() const;
+
+		/// <summary>
+		/// Gets the elements as a read only Span, whose plain pointer iterators skip the checks of ConstIterator
+		/// </summary>
+		/// <returns>view over the elements, empty if the vector is</returns>
+		Span<const T> AsConstSpan() const;
+
 		/// <summary>
 		/// Gets whether or not this vector is empty
 		/// </summary>
@@ -597,10 +830,28 @@ namespace FieaGameEngine
 		size_t Capacity() const;
 
 		/// <summary>
-		/// Sets the capacity increment strategy callback for this vector
+		/// Sets the growth policy of this vector, only useful for policies with state such as CallbackGrowth
+		/// </summary>
+		/// <param name="growthPolicy">The new policy to be used in this vector</param>
+		void SetGrowthPolicy(const TGrowthPolicy& growthPolicy);
+
+		/// <summary>
+		/// Gets the growth policy of this vector
+		/// </summary>
+		/// <returns>The growth policy of this vector</returns>
+		const TGrowthPolicy& GetGrowthPolicy() const;
+
+		/// <summary>
+		/// Gets the allocator the elements are stored with
 		/// </summary>
-		/// <param name="callback">The new strategy to be used in this vector</param>
-		void SetIncrementCallback(const std::function<size_t(size_t, size_t)>& callback);
+		/// <returns>The allocator of this vector</returns>
+		const TAllocator& GetAllocator() const;
+
+		/// <summary>
+		/// Tells if the elements are in the inline room of the allocator, always false for allocators without it
+		/// </summary>
+		/// <returns>True if the elements live inside the vector itself</returns>
+		bool IsInline() const;
 
 	private:
 		/// <summary>
@@ -619,22 +870,96 @@ namespace FieaGameEngine
 		T* mBuffer = nullptr;
 
 		/// <summary>
-		/// The current capacity increment strategy
+		/// The current capacity growth policy
 		/// </summary>
-		std::function<size_t(size_t, size_t)> mIncrementCallback = std::function(DefaultIncrement());
+		FIEA_NO_UNIQUE_ADDRESS TGrowthPolicy mGrowthPolicy;
 
-		TItemComparator mItemComparator;
+		FIEA_NO_UNIQUE_ADDRESS TItemComparator mItemComparator;
 
 		/// <summary>
-		/// Deep copies the given vector into this
+		/// Where the buffer comes from
 		/// </summary>
-		/// <param name="other">Reference to vector to be copied</param>
-		void DeepCopy(const Vector& other);
+		FIEA_NO_UNIQUE_ADDRESS TAllocator mAllocator;
 
 		/// <summary>
-		/// TODO
+		/// Tells if an iterator type can be walked more than once, so a range can be measured before it is copied
+		/// </summary>
+		template <typename TIterator, typename = void>
+		struct IsForwardIterator : std::false_type {};
+
+		template <typename TIterator>
+		struct IsForwardIterator<TIterator, std::void_t<typename std::iterator_traits<TIterator>::iterator_category>> :
+			std::is_base_of<std::forward_iterator_tag, typename std::iterator_traits<TIterator>::iterator_category> {};
+
+		/// <summary>
+		/// Tells if an iterator type is a std::move_iterator
+		/// </summary>
+		template <typename TIterator>
+		struct IsMoveIterator : std::false_type {};
+
+		template <typename TIterator>
+		struct IsMoveIterator<std::move_iterator<TIterator>> : std::true_type {};
+
+		/// <summary>
+		/// Gets the address of the element an iterator points to when the elements after it are known to be contiguous:
+		/// pointers to T and iterators of this vector type, moving or not
+		/// </summary>
+		/// <param name="it">Iterator pointing to an element</param>
+		/// <returns>Pointer to the element, null if the iterator type is not known to be contiguous</returns>
+		template <typename TIterator>
+		static const T* ContiguousSource(const TIterator& it);
+
+		/// <summary>
+		/// Tells if the given address is one of the elements of this vector
+		/// </summary>
+		/// <param name="element">Address to check, may be null</param>
+		/// <returns>True if the address is inside the elements</returns>
+		bool Contains(const T* element) const;
+
+		/// <summary>
+		/// Copy constructs a range into uninitialized storage, destroying what was constructed if an element throws
+		/// </summary>
+		/// <param name="destination">Uninitialized storage for count elements</param>
+		/// <param name="first">Iterator to the first element to copy</param>
+		/// <param name="count">Number of elements to copy</param>
+		template <typename TForwardIterator>
+		static void ConstructRange(T* destination, TForwardIterator first, size_t count);
+
+		/// <summary>
+		/// Moves elements to possibly overlapping storage, leaving the source uninitialized
+		/// </summary>
+		/// <param name="destination">Where the elements go</param>
+		/// <param name="source">Where the elements are</param>
+		/// <param name="count">Number of elements</param>
+		static void Relocate(T* destination, T* source, size_t count);
+
+		/// <summary>
+		/// Grows the buffer so it holds at least the given number of elements, taking the growth policy's
+		/// next capacity when that is bigger so repeated appends stay amortized
+		/// </summary>
+		/// <exception cref="std::exception">Thrown if the growth policy fails to provide a valid new capacity</exception>
+		/// <param name="size">Number of elements the buffer has to hold</param>
+		void IncrementCapacity(size_t size);
+
+		/// <summary>
+		/// Moves the elements to a buffer of the given capacity. Trivially relocatable elements
+		/// are moved with realloc, any other element is move constructed into new storage.
+		/// The capacity never drops below the inline room of the allocator
+		/// </summary>
+		/// <param name="capacity">Capacity of the new buffer, at least the size</param>
+		void Reallocate(size_t capacity);
+
+		/// <summary>
+		/// Points an empty vector at the inline room of its allocator, or at nothing if it has none
+		/// </summary>
+		void ResetBuffer();
+
+		/// <summary>
+		/// Takes the elements of another vector into this empty one. The block changes hands, unless
+		/// the elements are inline, which are then moved one by one and the other keeps its inline room
 		/// </summary>
-		void IncrementCapacity();
+		/// <param name="other">Vector to take the elements from, left empty</param>
+		void TakeBuffer(Vector& other);
 	};
 }
 
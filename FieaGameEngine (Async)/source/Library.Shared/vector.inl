@@ -5,72 +5,65 @@
 
 namespace FieaGameEngine
 {
-	template <typename T, typename TItemComparator>
-	Vector<T, TItemComparator>::Vector(size_t capacity, std::function<size_t(size_t, size_t)> incrementCallback) :
-		mSize(0), mIncrementCallback(incrementCallback)
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Vector(size_t capacity, const TGrowthPolicy& growthPolicy, const TAllocator& allocator) :
+		mSize(0), mGrowthPolicy(growthPolicy), mAllocator(allocator)
 	{
+		ResetBuffer();
 		Reserve(capacity);
 	}
 
-	template <typename T, typename TItemComparator>
-	Vector<T, TItemComparator>::Vector(const Vector& other) :
-		Vector(other.mCapacity, other.mIncrementCallback)
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Vector(const TAllocator& allocator, size_t capacity) :
+		Vector(capacity, TGrowthPolicy(), allocator)
+	{
+	}
+
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Vector(const Vector& other) :
+		Vector(other.mCapacity, other.mGrowthPolicy, other.mAllocator)
 	{
 		mItemComparator = other.mItemComparator;
-		DeepCopy(other);
+		Append(other);
 	}
 
-	template <typename T, typename TItemComparator>
-	Vector<T, TItemComparator>::Vector(Vector&& other) :
-		mSize(other.mSize), mCapacity(other.mCapacity), mBuffer(other.mBuffer), mIncrementCallback(std::move(other.mIncrementCallback)), mItemComparator(std::move(other.mItemComparator))
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Vector(Vector&& other) :
+		mGrowthPolicy(std::move(other.mGrowthPolicy)), mItemComparator(std::move(other.mItemComparator)), mAllocator(other.mAllocator)
 	{
-		other.mSize = 0;
-		other.mCapacity = 0;
-		other.mBuffer = nullptr;
+		ResetBuffer();
+		TakeBuffer(other);
 	}
 
-	template <typename T, typename TItemComparator>
-	Vector<T, TItemComparator>::Vector(std::initializer_list<T> list) :
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Vector(std::initializer_list<T> list) :
 		Vector(list.size())
 	{
-		for (const auto& data : list)
-		{
-			EmplaceBack(data);
-		}
+		Append(list);
 	}
 
-	template <typename T, typename TItemComparator>
-	Vector<T, TItemComparator>::~Vector()
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::~Vector()
 	{
 		Clear();
-		free(mBuffer);
+		mAllocator.Deallocate(mBuffer, sizeof(T) * mCapacity, alignof(T));
 	}
 
-	template <typename T, typename TItemComparator>
-	Vector<T, TItemComparator>& Vector<T, TItemComparator>::operator=(const Vector<T, TItemComparator>& other)
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	Vector<T, TItemComparator, TAllocator, TGrowthPolicy>& Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::operator=(const Vector<T, TItemComparator, TAllocator, TGrowthPolicy>& other)
 	{
 		if (this != &other)
 		{
-			if (mSize > 0)
-			{
-				Clear();
-			}
-
-			if (other.mSize > mCapacity)
-			{
-				Reserve(other.mSize);
-			}
-
-			DeepCopy(other);
-			mIncrementCallback = other.mIncrementCallback;
+			Assign(other);
+			mGrowthPolicy = other.mGrowthPolicy;
 			mItemComparator = other.mItemComparator;
 		}
 
 		return *this;
 	}
 
-	template <typename T, typename TItemComparator>
-	Vector<T, TItemComparator>& Vector<T, TItemComparator>::operator=(Vector&& other)
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	Vector<T, TItemComparator, TAllocator, TGrowthPolicy>& Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::operator=(Vector&& other)
 	{
 		if (this != &other)
 		{
@@ -81,46 +74,30 @@ namespace FieaGameEngine
 
 			if (mCapacity > 0)
 			{
-				free(mBuffer);
+				mAllocator.Deallocate(mBuffer, sizeof(T) * mCapacity, alignof(T));
 			}
 
-			mSize = other.mSize;
-			mCapacity = other.mCapacity;
-			mBuffer = other.mBuffer;
-			mIncrementCallback = std::move(other.mIncrementCallback);
+			mGrowthPolicy = std::move(other.mGrowthPolicy);
 			mItemComparator = std::move(other.mItemComparator);
+			mAllocator = other.mAllocator;
 
-			other.mSize = 0;
-			other.mCapacity = 0;
-			other.mBuffer = nullptr;
+			ResetBuffer();
+			TakeBuffer(other);
 		}
 
 		return *this;
 	}
 
-	template <typename T, typename TItemComparator>
-	Vector<T, TItemComparator>& Vector<T, TItemComparator>::operator=(std::initializer_list<T> list)
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	Vector<T, TItemComparator, TAllocator, TGrowthPolicy>& Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::operator=(std::initializer_list<T> list)
 	{
-		if (mSize > 0)
-		{
-			Clear();
-		}
-
-		if (list.size() > mCapacity)
-		{
-			Reserve(list.size());
-		}
-
-		for (const auto& data : list)
-		{
-			PushBack(data);
-		}
+		Assign(list);
 
 		return *this;
 	}
 
-	template <typename T, typename TItemComparator>
-	bool Vector<T, TItemComparator>::operator==(const Vector& other)
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	bool Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::operator==(const Vector& other)
 	{
 		if (mSize != other.mSize)
 		{
@@ -138,14 +115,14 @@ namespace FieaGameEngine
 		return true;
 	}
 
-	template <typename T, typename TItemComparator>
-	bool Vector<T, TItemComparator>::operator!=(const Vector& other)
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	bool Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::operator!=(const Vector& other)
 	{
 		return !operator==(other);
 	}
 
-	template <typename T, typename TItemComparator>
-	inline T& Vector<T, TItemComparator>::operator[](size_t index)
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline T& Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::operator[](size_t index)
 	{
 		if (index >= mSize)
 		{
@@ -155,8 +132,8 @@ namespace FieaGameEngine
 		return *(mBuffer + index);
 	}
 
-	template <typename T, typename TItemComparator>
-	inline const T& Vector<T, TItemComparator>::operator[](size_t index) const
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline const T& Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::operator[](size_t index) const
 	{
 		if (index >= mSize)
 		{
@@ -166,8 +143,8 @@ namespace FieaGameEngine
 		return *(mBuffer + index);
 	}
 
-	template <typename T, typename TItemComparator>
-	T& Vector<T, TItemComparator>::At(size_t index)
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	T& Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::At(size_t index)
 	{
 		if (index >= mSize)
 		{
@@ -177,8 +154,8 @@ namespace FieaGameEngine
 		return *(mBuffer + index);
 	}
 
-	template <typename T, typename TItemComparator>
-	const T& Vector<T, TItemComparator>::At(size_t index) const
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	const T& Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::At(size_t index) const
 	{
 		if (index >= mSize)
 		{
@@ -188,20 +165,20 @@ namespace FieaGameEngine
 		return *(mBuffer + index);
 	}
 
-	template <typename T, typename TItemComparator>
-	inline typename Vector<T, TItemComparator>::Iterator Vector<T, TItemComparator>::PushBack(const T& data)
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline typename Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Iterator Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::PushBack(const T& data)
 	{
 		return EmplaceBack(data);
 	}
 
-	template <typename T, typename TItemComparator>
-	inline typename Vector<T, TItemComparator>::Iterator Vector<T, TItemComparator>::PushBack(T&& data)
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline typename Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Iterator Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::PushBack(T&& data)
 	{
 		return EmplaceBack(std::move(data));
 	}
 
-	template <typename T, typename TItemComparator>
-	inline std::pair<typename Vector<T, TItemComparator>::Iterator, bool> Vector<T, TItemComparator>::PushBackUnique(const T& data)
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline std::pair<typename Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Iterator, bool> Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::PushBackUnique(const T& data)
 	{
 		Iterator it = Find(data);
 		if (it == end())
@@ -212,8 +189,8 @@ namespace FieaGameEngine
 		return std::pair(it, false);
 	}
 
-	template <typename T, typename TItemComparator>
-	inline std::pair<typename Vector<T, TItemComparator>::Iterator, bool> Vector<T, TItemComparator>::PushBackUnique(T&& data)
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline std::pair<typename Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Iterator, bool> Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::PushBackUnique(T&& data)
 	{
 		Iterator it = Find(data);
 		if (it == end())
@@ -224,13 +201,13 @@ namespace FieaGameEngine
 		return std::pair(it, false);
 	}
 
-	template <typename T, typename TItemComparator>
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
 	template <typename... Args>
-	typename Vector<T, TItemComparator>::Iterator Vector<T, TItemComparator>::EmplaceBack(Args&&... args)
+	typename Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Iterator Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::EmplaceBack(Args&&... args)
 	{
 		if (mSize == mCapacity)
 		{
-			IncrementCapacity();
+			IncrementCapacity(mSize + 1);
 		}
 
 		new (mBuffer + mSize)T(std::forward<Args>(args)...);
@@ -239,8 +216,156 @@ namespace FieaGameEngine
 		return Iterator(*this, mSize - 1);
 	}
 
-	template <typename T, typename TItemComparator>
-	void Vector<T, TItemComparator>::PopBack()
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	template <typename... Args>
+	typename Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Iterator Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::EmplaceBackN(size_t count, const Args&... args)
+	{
+		if (mSize + count > mCapacity)
+		{
+			IncrementCapacity(mSize + count);
+		}
+
+		T* destination = mBuffer + mSize;
+		size_t constructed = 0;
+		try
+		{
+			for (; constructed < count; ++constructed)
+			{
+				new (destination + constructed)T(args...);
+			}
+		}
+		catch (...)
+		{
+			for (size_t i = 0; i < constructed; ++i)
+			{
+				destination[i].~T();
+			}
+
+			throw;
+		}
+
+		mSize += count;
+
+		return Iterator(*this, mSize - count);
+	}
+
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	template <typename TInputIterator>
+	typename Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Iterator Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Insert(const Iterator& position, TInputIterator first, TInputIterator last)
+	{
+		if (position.mOwner != this)
+		{
+			throw std::exception("The iterator is not associated with this container.");
+		}
+
+		if (position.mOffset > mSize)
+		{
+			throw std::exception("This iterator is out of range.");
+		}
+
+		if constexpr (!IsForwardIterator<TInputIterator>::value)
+		{
+			// a single pass range cannot be measured up front, so it is gathered first
+			Vector buffered(mAllocator);
+			for (; first != last; ++first)
+			{
+				buffered.EmplaceBack(*first);
+			}
+
+			return Insert(position, std::make_move_iterator(buffered.begin()), std::make_move_iterator(buffered.end()));
+		}
+		else
+		{
+			const size_t offset = position.mOffset;
+			if (first == last)
+			{
+				return Iterator(*this, offset);
+			}
+
+			const size_t count = static_cast<size_t>(std::distance(first, last));
+			if (Contains(ContiguousSource(first)))
+			{
+				// growing or opening the gap would move the range from under us
+				Vector copy(mAllocator, count);
+				copy.Append(first, last);
+
+				return Insert(position, std::make_move_iterator(copy.begin()), std::make_move_iterator(copy.end()));
+			}
+
+			if (mSize + count > mCapacity)
+			{
+				IncrementCapacity(mSize + count);
+			}
+
+			T* gap = mBuffer + offset;
+			const size_t tail = mSize - offset;
+			Relocate(gap + count, gap, tail);
+
+			try
+			{
+				ConstructRange(gap, first, count);
+			}
+			catch (...)
+			{
+				Relocate(gap, gap + count, tail);
+				throw;
+			}
+
+			mSize += count;
+
+			return Iterator(*this, offset);
+		}
+	}
+
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	template <typename TInputIterator>
+	inline typename Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Iterator Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Append(TInputIterator first, TInputIterator last)
+	{
+		return Insert(end(), first, last);
+	}
+
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	template <typename TRange>
+	inline typename Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Iterator Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Append(const TRange& range)
+	{
+		return Insert(end(), std::begin(range), std::end(range));
+	}
+
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	template <typename TInputIterator>
+	void Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Assign(TInputIterator first, TInputIterator last)
+	{
+		if constexpr (IsForwardIterator<TInputIterator>::value)
+		{
+			if (first != last && Contains(ContiguousSource(first)))
+			{
+				Vector copy(mAllocator, static_cast<size_t>(std::distance(first, last)));
+				copy.Append(first, last);
+				Assign(std::make_move_iterator(copy.begin()), std::make_move_iterator(copy.end()));
+
+				return;
+			}
+
+			Clear();
+			Reserve(static_cast<size_t>(std::distance(first, last)));
+		}
+		else
+		{
+			Clear();
+		}
+
+		Append(first, last);
+	}
+
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	template <typename TRange>
+	inline void Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Assign(const TRange& range)
+	{
+		Assign(std::begin(range), std::end(range));
+	}
+
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	void Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::PopBack()
 	{
 		if (mSize == 0)
 		{
@@ -251,18 +376,17 @@ namespace FieaGameEngine
 		--mSize;
 	}
 
-	template <typename T, typename TItemComparator>
-	void Vector<T, TItemComparator>::Reserve(size_t capacity)
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	void Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Reserve(size_t capacity)
 	{
 		if (capacity > mCapacity)
 		{
-			mBuffer = reinterpret_cast<T*>(realloc(mBuffer, sizeof(T) * capacity));
-			mCapacity = capacity;
+			Reallocate(capacity);
 		}
 	}
 
-	template <typename T, typename TItemComparator>
-	void Vector<T, TItemComparator>::Resize(size_t size)
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	void Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Resize(size_t size)
 	{
 		if (size > mSize)
 		{
@@ -289,18 +413,17 @@ namespace FieaGameEngine
 		}
 	}
 
-	template <typename T, typename TItemComparator>
-	void Vector<T, TItemComparator>::ShrinkToFit()
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	void Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::ShrinkToFit()
 	{
 		if (mCapacity > mSize)
 		{
-			mBuffer = reinterpret_cast<T*>(realloc(mBuffer, sizeof(T) * mSize));
-			mCapacity = mSize;
+			Reallocate(mSize);
 		}
 	}
 
-	template <typename T, typename TItemComparator>
-	void Vector<T, TItemComparator>::Clear()
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	void Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Clear()
 	{
 		for (size_t i = 0; i < mSize; ++i)
 		{
@@ -310,8 +433,8 @@ namespace FieaGameEngine
 		mSize = 0;
 	}
 
-	template <typename T, typename TItemComparator>
-	typename Vector<T, TItemComparator>::Iterator Vector<T, TItemComparator>::Find(const T& data)
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	typename Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Iterator Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Find(const T& data)
 	{
 		Iterator it = begin();
 		for (; it != end(); ++it)
@@ -325,8 +448,8 @@ namespace FieaGameEngine
 		return it;
 	}
 
-	template <typename T, typename TItemComparator>
-	typename Vector<T, TItemComparator>::ConstIterator Vector<T, TItemComparator>::Find(const T& data) const
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	typename Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::ConstIterator Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Find(const T& data) const
 	{
 		ConstIterator it = begin();
 		for (; it != end(); ++it)
@@ -340,14 +463,14 @@ namespace FieaGameEngine
 		return it;
 	}
 
-	template <typename T, typename TItemComparator>
-	inline bool Vector<T, TItemComparator>::Remove(const T& data)
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline bool Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Remove(const T& data)
 	{
 		return Remove(Find(data));
 	}
 
-	template <typename T, typename TItemComparator>
-	bool Vector<T, TItemComparator>::Remove(const Iterator& it)
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	bool Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Remove(const Iterator& it)
 	{
 		Iterator next = it;
 		if (it.mOwner == this)
@@ -360,8 +483,8 @@ namespace FieaGameEngine
 		return lastSize > mSize;
 	}
 
-	template <typename T, typename TItemComparator>
-	void Vector<T, TItemComparator>::Remove(const Iterator& first, const Iterator& last)
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	void Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Remove(const Iterator& first, const Iterator& last)
 	{
 		if (first.mOwner != this || last.mOwner != this)
 		{
@@ -373,6 +496,11 @@ namespace FieaGameEngine
 			throw std::exception("Invalid range.");
 		}
 
+		if (last.mOffset > mSize)
+		{
+			throw std::exception("This iterator is out of range.");
+		}
+
 		Iterator it = first;
 		for (; it != last; ++it)
 		{
@@ -381,56 +509,74 @@ namespace FieaGameEngine
 
 		if (last != end())
 		{
-			std::memmove(mBuffer + first.mOffset, mBuffer + last.mOffset, sizeof(T) * (mSize - last.mOffset));
+			Relocate(mBuffer + first.mOffset, mBuffer + last.mOffset, mSize - last.mOffset);
 		}
 
 		mSize -= last.mOffset - first.mOffset;
 	}
 
-	template <typename T, typename TItemComparator>
-	inline typename Vector<T, TItemComparator>::Iterator Vector<T, TItemComparator>::begin()
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline typename Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Iterator Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::begin()
 	{
 		return Iterator(*this);
 	}
 
-	template <typename T, typename TItemComparator>
-	inline typename Vector<T, TItemComparator>::ConstIterator Vector<T, TItemComparator>::begin() const
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline typename Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::ConstIterator Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::begin() const
 	{
 		return ConstIterator(*this);
 	}
 
-	template <typename T, typename TItemComparator>
-	inline typename Vector<T, TItemComparator>::Iterator Vector<T, TItemComparator>::end()
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline typename Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Iterator Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::end()
 	{
 		return Iterator(*this, mSize);
 	}
 
-	template <typename T, typename TItemComparator>
-	inline typename Vector<T, TItemComparator>::ConstIterator Vector<T, TItemComparator>::end() const
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline typename Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::ConstIterator Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::end() const
 	{
 		return ConstIterator(*this, mSize);
 	}
 
-	template <typename T, typename TItemComparator>
-	inline typename Vector<T, TItemComparator>::ConstIterator Vector<T, TItemComparator>::cbegin() const
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline typename Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::ConstIterator Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::cbegin() const
 	{
 		return ConstIterator(*this);
 	}
 
-	template <typename T, typename TItemComparator>
-	inline typename Vector<T, TItemComparator>::ConstIterator Vector<T, TItemComparator>::cend() const
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline typename Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::ConstIterator Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::cend() const
 	{
 		return ConstIterator(*this, mSize);
 	}
 
-	template <typename T, typename TItemComparator>
-	inline bool Vector<T, TItemComparator>::IsEmpty() const
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline Span<T> Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::AsSpan()
+	{
+		return Span<T>(mBuffer, mSize);
+	}
+
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline Span<const T> Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::AsSpan() const
+	{
+		return Span<const T>(mBuffer, mSize);
+	}
+
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline Span<const T> Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::AsConstSpan() const
+	{
+		return AsSpan();
+	}
+
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline bool Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::IsEmpty() const
 	{
 		return mSize == 0;
 	}
 
-	template <typename T, typename TItemComparator>
-	inline T& Vector<T, TItemComparator>::Front()
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline T& Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Front()
 	{
 		if (mSize == 0)
 		{
@@ -440,8 +586,8 @@ namespace FieaGameEngine
 		return *mBuffer;
 	}
 
-	template <typename T, typename TItemComparator>
-	inline const T& Vector<T, TItemComparator>::Front() const
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline const T& Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Front() const
 	{
 		if (mSize == 0)
 		{
@@ -451,8 +597,8 @@ namespace FieaGameEngine
 		return *mBuffer;
 	}
 
-	template <typename T, typename TItemComparator>
-	inline T& Vector<T, TItemComparator>::Back()
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline T& Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Back()
 	{
 		if (mSize == 0)
 		{
@@ -462,8 +608,8 @@ namespace FieaGameEngine
 		return *(mBuffer + mSize - 1);
 	}
 
-	template <typename T, typename TItemComparator>
-	inline const T& Vector<T, TItemComparator>::Back() const
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline const T& Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Back() const
 	{
 		if (mSize == 0)
 		{
@@ -473,67 +619,245 @@ namespace FieaGameEngine
 		return *(mBuffer + mSize - 1);
 	}
 
-	template <typename T, typename TItemComparator>
-	inline size_t Vector<T, TItemComparator>::Size() const
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline size_t Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Size() const
 	{
 		return mSize;
 	}
 
-	template <typename T, typename TItemComparator>
-	inline size_t Vector<T, TItemComparator>::Capacity() const
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline size_t Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Capacity() const
 	{
 		return mCapacity;
 	}
 
-	template <typename T, typename TItemComparator>
-	inline void Vector<T, TItemComparator>::SetIncrementCallback(const std::function<size_t(size_t, size_t)>& callback)
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline void Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::SetGrowthPolicy(const TGrowthPolicy& growthPolicy)
+	{
+		mGrowthPolicy = growthPolicy;
+	}
+
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline const TGrowthPolicy& Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::GetGrowthPolicy() const
+	{
+		return mGrowthPolicy;
+	}
+
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline const TAllocator& Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::GetAllocator() const
+	{
+		return mAllocator;
+	}
+
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline bool Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::IsInline() const
+	{
+		if constexpr (HasInlineStorage<TAllocator>::value)
+		{
+			return mBuffer == mAllocator.InlineBuffer();
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	template <typename TIterator>
+	inline const T* Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::ContiguousSource(const TIterator& it)
+	{
+		if constexpr (std::is_pointer_v<TIterator>)
+		{
+			if constexpr (std::is_same_v<std::remove_cv_t<std::remove_pointer_t<TIterator>>, T>)
+			{
+				return it;
+			}
+			else
+			{
+				return nullptr;
+			}
+		}
+		else if constexpr (std::is_same_v<TIterator, Iterator> || std::is_same_v<TIterator, ConstIterator>)
+		{
+			return it.mOwner->mBuffer + it.mOffset;
+		}
+		else if constexpr (IsMoveIterator<TIterator>::value)
+		{
+			return ContiguousSource(it.base());
+		}
+		else
+		{
+			return nullptr;
+		}
+	}
+
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline bool Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Contains(const T* element) const
 	{
-		mIncrementCallback = callback;
+		return element != nullptr && element >= mBuffer && element < mBuffer + mSize;
 	}
 
-	template <typename T, typename TItemComparator>
-	void Vector<T, TItemComparator>::DeepCopy(const Vector<T, TItemComparator>& other)
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	template <typename TForwardIterator>
+	void Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::ConstructRange(T* destination, TForwardIterator first, size_t count)
 	{
-		for (const auto& data : other)
+		if constexpr (std::is_trivially_copyable_v<T>)
+		{
+			if (const T* source = ContiguousSource(first); source != nullptr)
+			{
+				std::memcpy(destination, source, sizeof(T) * count);
+				return;
+			}
+		}
+
+		size_t constructed = 0;
+		try
+		{
+			for (; constructed < count; ++constructed, ++first)
+			{
+				new (destination + constructed)T(*first);
+			}
+		}
+		catch (...)
 		{
-			PushBack(data);
+			for (size_t i = 0; i < constructed; ++i)
+			{
+				destination[i].~T();
+			}
+
+			throw;
 		}
 	}
 
-	template <typename T, typename TItemComparator>
-	void Vector<T, TItemComparator>::IncrementCapacity()
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	void Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Relocate(T* destination, T* source, size_t count)
 	{
-		const size_t newCapacity = mIncrementCallback(mSize, mCapacity);
+		if (count == 0 || destination == source)
+		{
+			return;
+		}
+
+		if constexpr (IsTriviallyRelocatableV<T>)
+		{
+			std::memmove(destination, source, sizeof(T) * count);
+		}
+		else if (destination < source)
+		{
+			for (size_t i = 0; i < count; ++i)
+			{
+				new (destination + i)T(std::move(source[i]));
+				source[i].~T();
+			}
+		}
+		else
+		{
+			for (size_t i = count; i > 0; --i)
+			{
+				new (destination + i - 1)T(std::move(source[i - 1]));
+				source[i - 1].~T();
+			}
+		}
+	}
+
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	void Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::IncrementCapacity(size_t size)
+	{
+		const size_t newCapacity = mGrowthPolicy(mSize, mCapacity);
 
 		if (newCapacity <= mCapacity)
 		{
 			throw std::exception("New capacity must be at least 1 unit greater than current capacity.");
 		}
 
-		Reserve(newCapacity);
+		Reserve(newCapacity > size ? newCapacity : size);
+	}
+
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	void Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Reallocate(size_t capacity)
+	{
+		if constexpr (HasInlineStorage<TAllocator>::value)
+		{
+			if (capacity < TAllocator::InlineCapacity)
+			{
+				capacity = TAllocator::InlineCapacity;
+			}
+
+			if (capacity == mCapacity)
+			{
+				return;
+			}
+		}
+
+		if constexpr (IsTriviallyRelocatableV<T>)
+		{
+			mBuffer = reinterpret_cast<T*>(mAllocator.Reallocate(mBuffer, sizeof(T) * mCapacity, sizeof(T) * capacity, alignof(T)));
+		}
+		else
+		{
+			T* buffer = capacity > 0 ? reinterpret_cast<T*>(mAllocator.Allocate(sizeof(T) * capacity, alignof(T))) : nullptr;
+			Relocate(buffer, mBuffer, mSize);
+
+			mAllocator.Deallocate(mBuffer, sizeof(T) * mCapacity, alignof(T));
+			mBuffer = buffer;
+		}
+
+		mCapacity = capacity;
+	}
+
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline void Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::ResetBuffer()
+	{
+		if constexpr (HasInlineStorage<TAllocator>::value)
+		{
+			mBuffer = mAllocator.InlineBuffer();
+			mCapacity = TAllocator::InlineCapacity;
+		}
+		else
+		{
+			mBuffer = nullptr;
+			mCapacity = 0;
+		}
+	}
+
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	void Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::TakeBuffer(Vector& other)
+	{
+		if (other.IsInline())
+		{
+			Relocate(mBuffer, other.mBuffer, other.mSize);
+		}
+		else
+		{
+			mBuffer = other.mBuffer;
+			mCapacity = other.mCapacity;
+			other.ResetBuffer();
+		}
+
+		mSize = other.mSize;
+		other.mSize = 0;
 	}
 
 	// Iterator
-	template <typename T, typename TItemComparator>
-	Vector<T, TItemComparator>::Iterator::Iterator(const Vector<T, TItemComparator>& owner, size_t offset) :
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Iterator::Iterator(const Vector<T, TItemComparator, TAllocator, TGrowthPolicy>& owner, size_t offset) :
 		mOwner(const_cast<Vector*>(&owner)), mOffset(offset)
 	{
 	}
 
-	template <typename T, typename TItemComparator>
-	inline bool Vector<T, TItemComparator>::Iterator::operator==(const Iterator& other) const
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline bool Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Iterator::operator==(const Iterator& other) const
 	{
 		return !operator!=(other);
 	}
 
-	template <typename T, typename TItemComparator>
-	inline bool Vector<T, TItemComparator>::Iterator::operator!=(const Iterator& other) const
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline bool Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Iterator::operator!=(const Iterator& other) const
 	{
 		return (mOwner != other.mOwner) || (mOffset != other.mOffset);
 	}
 
-	template <typename T, typename TItemComparator>
-	inline bool Vector<T, TItemComparator>::Iterator::operator>(const Iterator& other) const
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline bool Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Iterator::operator>(const Iterator& other) const
 	{
 		if (mOwner != other.mOwner)
 		{
@@ -543,8 +867,8 @@ namespace FieaGameEngine
 		return mOffset > other.mOffset;
 	}
 
-	template <typename T, typename TItemComparator>
-	inline bool Vector<T, TItemComparator>::Iterator::operator<(const Iterator& other) const
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline bool Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Iterator::operator<(const Iterator& other) const
 	{
 		if (mOwner != other.mOwner)
 		{
@@ -554,8 +878,8 @@ namespace FieaGameEngine
 		return mOffset < other.mOffset;
 	}
 
-	template <typename T, typename TItemComparator>
-	inline bool Vector<T, TItemComparator>::Iterator::operator>=(const Iterator& other) const
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline bool Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Iterator::operator>=(const Iterator& other) const
 	{
 		if (mOwner != other.mOwner)
 		{
@@ -565,8 +889,8 @@ namespace FieaGameEngine
 		return mOffset >= other.mOffset;
 	}
 
-	template <typename T, typename TItemComparator>
-	inline bool Vector<T, TItemComparator>::Iterator::operator<=(const Iterator& other) const
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline bool Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Iterator::operator<=(const Iterator& other) const
 	{
 		if (mOwner != other.mOwner)
 		{
@@ -576,8 +900,8 @@ namespace FieaGameEngine
 		return mOffset <= other.mOffset;
 	}
 
-	template <typename T, typename TItemComparator>
-	typename Vector<T, TItemComparator>::Iterator& Vector<T, TItemComparator>::Iterator::operator++()
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	typename Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Iterator& Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Iterator::operator++()
 	{
 		if (mOwner == nullptr)
 		{
@@ -592,17 +916,102 @@ namespace FieaGameEngine
 		return *this;
 	}
 
-	template <typename T, typename TItemComparator>
-	inline typename Vector<T, TItemComparator>::Iterator Vector<T, TItemComparator>::Iterator::operator++(int)
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline typename Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Iterator Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Iterator::operator++(int)
 	{
-		Vector<T, TItemComparator>::Iterator it = *this;
+		Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Iterator it = *this;
 		operator++();
 
 		return it;
 	}
 
-	template <typename T, typename TItemComparator>
-	T& Vector<T, TItemComparator>::Iterator::operator*() const
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	typename Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Iterator& Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Iterator::operator--()
+	{
+		if (mOwner == nullptr)
+		{
+			throw std::exception("Unassociated iterator.");
+		}
+
+		if (mOffset == 0)
+		{
+			throw std::exception("This iterator is out of range.");
+		}
+
+		--mOffset;
+
+		return *this;
+	}
+
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline typename Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Iterator Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Iterator::operator--(int)
+	{
+		Iterator it = *this;
+		operator--();
+
+		return it;
+	}
+
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	typename Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Iterator& Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Iterator::operator+=(difference_type offset)
+	{
+		if (mOwner == nullptr)
+		{
+			throw std::exception("Unassociated iterator.");
+		}
+
+		const difference_type target = static_cast<difference_type>(mOffset) + offset;
+		if (target < 0 || static_cast<size_t>(target) > mOwner->mSize)
+		{
+			throw std::exception("This iterator is out of range.");
+		}
+
+		mOffset = static_cast<size_t>(target);
+
+		return *this;
+	}
+
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline typename Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Iterator& Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Iterator::operator-=(difference_type offset)
+	{
+		return operator+=(-offset);
+	}
+
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline typename Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Iterator Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Iterator::operator+(difference_type offset) const
+	{
+		Iterator it = *this;
+
+		return it += offset;
+	}
+
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline typename Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Iterator Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Iterator::operator-(difference_type offset) const
+	{
+		Iterator it = *this;
+
+		return it -= offset;
+	}
+
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline typename Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Iterator::difference_type Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Iterator::operator-(const Iterator& other) const
+	{
+		if (mOwner != other.mOwner)
+		{
+			throw std::exception("The iterators have different owners.");
+		}
+
+		return static_cast<difference_type>(mOffset) - static_cast<difference_type>(other.mOffset);
+	}
+
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline T& Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Iterator::operator[](difference_type offset) const
+	{
+		return *(*this + offset);
+	}
+
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	T& Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Iterator::operator*() const
 	{
 		if (mOwner == nullptr)
 		{
@@ -617,8 +1026,8 @@ namespace FieaGameEngine
 		return *(mOwner->mBuffer + mOffset);
 	}
 
-	template <typename T, typename TItemComparator>
-	T* Vector<T, TItemComparator>::Iterator::operator->() const
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	T* Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::Iterator::operator->() const
 	{
 		if (mOwner == nullptr)
 		{
@@ -635,22 +1044,22 @@ namespace FieaGameEngine
 
 	// ConstIterator
 
-	template <typename T, typename TItemComparator>
-	Vector<T, TItemComparator>::ConstIterator::ConstIterator(const Iterator& other) :
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::ConstIterator::ConstIterator(const Iterator& other) :
 		mOwner(other.mOwner), mOffset(other.mOffset)
 	{
 	}
 
-	template <typename T, typename TItemComparator>
-	Vector<T, TItemComparator>::ConstIterator::ConstIterator(Iterator&& other) :
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::ConstIterator::ConstIterator(Iterator&& other) :
 		mOwner(other.mOwner), mOffset(other.mOffset)
 	{
 		other.mOwner = nullptr;
 		other.mOffset = 0;
 	}
 
-	template <typename T, typename TItemComparator>
-	typename Vector<T, TItemComparator>::ConstIterator& Vector<T, TItemComparator>::ConstIterator::operator=(const Iterator& other)
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	typename Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::ConstIterator& Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::ConstIterator::operator=(const Iterator& other)
 	{
 		mOwner = other.mOwner;
 		mOffset = other.mOffset;
@@ -658,8 +1067,8 @@ namespace FieaGameEngine
 		return *this;
 	}
 
-	template <typename T, typename TItemComparator>
-	typename Vector<T, TItemComparator>::ConstIterator& Vector<T, TItemComparator>::ConstIterator::operator=(Iterator&& other)
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	typename Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::ConstIterator& Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::ConstIterator::operator=(Iterator&& other)
 	{
 		mOwner = other.mOwner;
 		mOffset = other.mOffset;
@@ -670,26 +1079,26 @@ namespace FieaGameEngine
 		return *this;
 	}
 
-	template <typename T, typename TItemComparator>
-	Vector<T, TItemComparator>::ConstIterator::ConstIterator(const Vector<T, TItemComparator>& owner, size_t offset) :
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::ConstIterator::ConstIterator(const Vector<T, TItemComparator, TAllocator, TGrowthPolicy>& owner, size_t offset) :
 		mOwner(const_cast<Vector*>(&owner)), mOffset(offset)
 	{
 	}
 
-	template <typename T, typename TItemComparator>
-	inline bool Vector<T, TItemComparator>::ConstIterator::operator==(const ConstIterator& other) const
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline bool Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::ConstIterator::operator==(const ConstIterator& other) const
 	{
 		return !operator!=(other);
 	}
 
-	template <typename T, typename TItemComparator>
-	inline bool Vector<T, TItemComparator>::ConstIterator::operator!=(const ConstIterator& other) const
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline bool Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::ConstIterator::operator!=(const ConstIterator& other) const
 	{
 		return (mOwner != other.mOwner) || (mOffset != other.mOffset);
 	}
 
-	template <typename T, typename TItemComparator>
-	inline bool Vector<T, TItemComparator>::ConstIterator::operator>(const ConstIterator& other) const
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline bool Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::ConstIterator::operator>(const ConstIterator& other) const
 	{
 		if (mOwner != other.mOwner)
 		{
@@ -699,8 +1108,8 @@ namespace FieaGameEngine
 		return mOffset > other.mOffset;
 	}
 
-	template <typename T, typename TItemComparator>
-	inline bool Vector<T, TItemComparator>::ConstIterator::operator<(const ConstIterator& other) const
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline bool Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::ConstIterator::operator<(const ConstIterator& other) const
 	{
 		if (mOwner != other.mOwner)
 		{
@@ -710,8 +1119,8 @@ namespace FieaGameEngine
 		return mOffset < other.mOffset;
 	}
 
-	template <typename T, typename TItemComparator>
-	inline bool Vector<T, TItemComparator>::ConstIterator::operator>=(const ConstIterator& other) const
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline bool Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::ConstIterator::operator>=(const ConstIterator& other) const
 	{
 		if (mOwner != other.mOwner)
 		{
@@ -721,8 +1130,8 @@ namespace FieaGameEngine
 		return mOffset >= other.mOffset;
 	}
 
-	template <typename T, typename TItemComparator>
-	inline bool Vector<T, TItemComparator>::ConstIterator::operator<=(const ConstIterator& other) const
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline bool Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::ConstIterator::operator<=(const ConstIterator& other) const
 	{
 		if (mOwner != other.mOwner)
 		{
@@ -732,8 +1141,8 @@ namespace FieaGameEngine
 		return mOffset <= other.mOffset;
 	}
 
-	template <typename T, typename TItemComparator>
-	typename Vector<T, TItemComparator>::ConstIterator& Vector<T, TItemComparator>::ConstIterator::operator++()
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	typename Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::ConstIterator& Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::ConstIterator::operator++()
 	{
 		if (mOwner == nullptr)
 		{
@@ -748,17 +1157,102 @@ namespace FieaGameEngine
 		return *this;
 	}
 
-	template <typename T, typename TItemComparator>
-	inline typename Vector<T, TItemComparator>::ConstIterator Vector<T, TItemComparator>::ConstIterator::operator++(int)
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline typename Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::ConstIterator Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::ConstIterator::operator++(int)
 	{
-		Vector<T, TItemComparator>::ConstIterator it = *this;
+		Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::ConstIterator it = *this;
 		operator++();
 
 		return it;
 	}
 
-	template <typename T, typename TItemComparator>
-	const T& Vector<T, TItemComparator>::ConstIterator::operator*() const
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	typename Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::ConstIterator& Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::ConstIterator::operator--()
+	{
+		if (mOwner == nullptr)
+		{
+			throw std::exception("Unassociated iterator.");
+		}
+
+		if (mOffset == 0)
+		{
+			throw std::exception("This iterator is out of range.");
+		}
+
+		--mOffset;
+
+		return *this;
+	}
+
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline typename Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::ConstIterator Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::ConstIterator::operator--(int)
+	{
+		ConstIterator it = *this;
+		operator--();
+
+		return it;
+	}
+
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	typename Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::ConstIterator& Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::ConstIterator::operator+=(difference_type offset)
+	{
+		if (mOwner == nullptr)
+		{
+			throw std::exception("Unassociated iterator.");
+		}
+
+		const difference_type target = static_cast<difference_type>(mOffset) + offset;
+		if (target < 0 || static_cast<size_t>(target) > mOwner->mSize)
+		{
+			throw std::exception("This iterator is out of range.");
+		}
+
+		mOffset = static_cast<size_t>(target);
+
+		return *this;
+	}
+
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline typename Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::ConstIterator& Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::ConstIterator::operator-=(difference_type offset)
+	{
+		return operator+=(-offset);
+	}
+
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline typename Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::ConstIterator Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::ConstIterator::operator+(difference_type offset) const
+	{
+		ConstIterator it = *this;
+
+		return it += offset;
+	}
+
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline typename Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::ConstIterator Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::ConstIterator::operator-(difference_type offset) const
+	{
+		ConstIterator it = *this;
+
+		return it -= offset;
+	}
+
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline typename Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::ConstIterator::difference_type Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::ConstIterator::operator-(const ConstIterator& other) const
+	{
+		if (mOwner != other.mOwner)
+		{
+			throw std::exception("The iterators have different owners.");
+		}
+
+		return static_cast<difference_type>(mOffset) - static_cast<difference_type>(other.mOffset);
+	}
+
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	inline const T& Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::ConstIterator::operator[](difference_type offset) const
+	{
+		return *(*this + offset);
+	}
+
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	const T& Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::ConstIterator::operator*() const
 	{
 		if (mOwner == nullptr)
 		{
@@ -773,8 +1267,8 @@ namespace FieaGameEngine
 		return *(mOwner->mBuffer + mOffset);
 	}
 
-	template <typename T, typename TItemComparator>
-	const T* Vector<T, TItemComparator>::ConstIterator::operator->() const
+	template <typename T, typename TItemComparator, typename TAllocator, typename TGrowthPolicy>
+	const T* Vector<T, TItemComparator, TAllocator, TGrowthPolicy>::ConstIterator::operator->() const
 	{
 		if (mOwner == nullptr)
 		{
@@ -0,0 +1,360 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <limits>
+#include <new>
+#include "DefaultHashFooSpecialization.h"
+#include "Allocator.h"
+#include "vector.h"
+#include "SList.h"
+#include "HashMap.h"
+#include "Foo.h"
+#include "ToStringSpecializations.h"
+#include "Utility.h"
+#include "SlabAllocator.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(AllocatorTest)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+			sStartSlabsInUse = SlabAllocator<>::Statistics().InUse;
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+
+			// slab nodes are out of sight of the CRT heap, their pools keep their own count
+			if (SlabAllocator<>::Statistics().InUse != sStartSlabsInUse)
+			{
+				Assert::Fail(L"Slab Leaks!");
+			}
+		}
+
+		TEST_METHOD(TestDefaultAllocator)
+		{
+			DefaultAllocator allocator;
+			Assert::IsTrue(allocator == DefaultAllocator());
+
+			int* memory = static_cast<int*>(allocator.Allocate(sizeof(int) * 4, alignof(int)));
+			Assert::IsNotNull(memory);
+			for (int i = 0; i < 4; ++i)
+			{
+				memory[i] = i;
+			}
+
+			memory = static_cast<int*>(allocator.Reallocate(memory, sizeof(int) * 4, sizeof(int) * 8, alignof(int)));
+			for (int i = 0; i < 4; ++i)
+			{
+				Assert::AreEqual(i, memory[i]);
+			}
+
+			// running out throws like new does, and a failed resize keeps the block
+			const size_t tooMany = std::numeric_limits<size_t>::max() / 2;
+			Assert::ExpectException<std::bad_alloc>([&allocator, tooMany] { allocator.Allocate(tooMany, alignof(int)); });
+			Assert::ExpectException<std::bad_alloc>([&allocator, &memory, tooMany] { memory = static_cast<int*>(allocator.Reallocate(memory, sizeof(int) * 8, tooMany, alignof(int))); });
+			Assert::AreEqual(3, memory[3]);
+
+			Assert::IsNull(allocator.Reallocate(memory, sizeof(int) * 8, 0, alignof(int)));
+			allocator.Deallocate(nullptr, 0, alignof(int));
+		}
+
+		TEST_METHOD(TestResourceAllocator)
+		{
+			CountingResource resource;
+			ResourceAllocator allocator(&resource);
+			Assert::IsTrue(allocator.Resource() == &resource);
+			Assert::IsTrue(allocator == ResourceAllocator(&resource));
+			Assert::IsFalse(allocator == ResourceAllocator());
+
+			int* memory = static_cast<int*>(allocator.Allocate(sizeof(int) * 4, alignof(int)));
+			Assert::AreEqual(1_z, resource.Blocks());
+			for (int i = 0; i < 4; ++i)
+			{
+				memory[i] = i;
+			}
+
+			memory = static_cast<int*>(allocator.Reallocate(memory, sizeof(int) * 4, sizeof(int) * 2, alignof(int)));
+			Assert::AreEqual(1_z, resource.Blocks());
+			Assert::AreEqual(sizeof(int) * 2, resource.Bytes());
+			Assert::AreEqual(0, memory[0]);
+			Assert::AreEqual(1, memory[1]);
+
+			Assert::IsNull(allocator.Reallocate(memory, sizeof(int) * 2, 0, alignof(int)));
+			Assert::AreEqual(0_z, resource.Blocks());
+
+			allocator.Deallocate(nullptr, 0, alignof(int));
+			Assert::AreEqual(0_z, resource.Blocks());
+		}
+
+		TEST_METHOD(TestInlineAllocator)
+		{
+			CountingResource resource;
+			InlineAllocator<int, 4, ResourceAllocator> allocator{ ResourceAllocator(&resource) };
+			Assert::IsTrue(allocator == allocator);
+			Assert::IsFalse(allocator == InlineAllocator<int, 4, ResourceAllocator>(allocator));
+
+			// blocks that fit come from inside the allocator
+			int* memory = static_cast<int*>(allocator.Allocate(sizeof(int) * 3, alignof(int)));
+			Assert::IsTrue(memory == allocator.InlineBuffer());
+			Assert::AreEqual(0_z, resource.Blocks());
+			for (int i = 0; i < 3; ++i)
+			{
+				memory[i] = i;
+			}
+
+			// and move out of it, and back, as they cross its size
+			memory = static_cast<int*>(allocator.Reallocate(memory, sizeof(int) * 4, sizeof(int) * 8, alignof(int)));
+			Assert::IsFalse(memory == allocator.InlineBuffer());
+			Assert::AreEqual(1_z, resource.Blocks());
+			Assert::AreEqual(2, memory[2]);
+			memory[7] = 7;
+
+			memory = static_cast<int*>(allocator.Reallocate(memory, sizeof(int) * 8, sizeof(int) * 16, alignof(int)));
+			Assert::AreEqual(1_z, resource.Blocks());
+			Assert::AreEqual(7, memory[7]);
+
+			memory = static_cast<int*>(allocator.Reallocate(memory, sizeof(int) * 16, sizeof(int) * 4, alignof(int)));
+			Assert::IsTrue(memory == allocator.InlineBuffer());
+			Assert::AreEqual(0_z, resource.Blocks());
+			Assert::AreEqual(1, memory[1]);
+
+			allocator.Deallocate(memory, sizeof(int) * 4, alignof(int));
+			Assert::IsNull(allocator.Reallocate(memory, sizeof(int) * 4, 0, alignof(int)));
+
+			void* block = allocator.Allocate(sizeof(int) * 5, alignof(int));
+			Assert::AreEqual(1_z, resource.Blocks());
+			allocator.Deallocate(block, sizeof(int) * 5, alignof(int));
+			Assert::AreEqual(0_z, resource.Blocks());
+		}
+
+		TEST_METHOD(TestInlineVector)
+		{
+			using InlineFooAllocator = InlineAllocator<Foo, 4, ResourceAllocator>;
+			using InlineVector = Vector<Foo, DefaultComparator<Foo>, InlineFooAllocator, DoublingGrowth>;
+
+			CountingResource resource;
+			{
+				InlineVector vector{ InlineFooAllocator(ResourceAllocator(&resource)) };
+				Assert::IsTrue(vector.IsInline());
+				Assert::AreEqual(4_z, vector.Capacity());
+
+				for (int i = 0; i < 4; ++i)
+				{
+					vector.EmplaceBack(i);
+				}
+				Assert::AreEqual(0_z, resource.Blocks());
+
+				vector.EmplaceBack(4);
+				Assert::IsFalse(vector.IsInline());
+				Assert::AreEqual(1_z, resource.Blocks());
+
+				// copies start in their own inline room, and share the fallback
+				InlineVector copy(vector);
+				Assert::IsTrue(copy == vector);
+				Assert::AreEqual(2_z, resource.Blocks());
+				copy.Resize(2);
+				copy.ShrinkToFit();
+				Assert::IsTrue(copy.IsInline());
+				Assert::AreEqual(1_z, resource.Blocks());
+
+				InlineVector moved(std::move(copy));
+				Assert::IsTrue(moved.IsInline());
+				Assert::IsTrue(copy.IsInline());
+				Assert::AreEqual(Foo(1), moved[1]);
+
+				moved = std::move(vector);
+				Assert::AreEqual(5_z, moved.Size());
+				Assert::IsTrue(vector.IsInline());
+				Assert::AreEqual(4_z, vector.Capacity());
+				Assert::AreEqual(1_z, resource.Blocks());
+			}
+			Assert::AreEqual(0_z, resource.Blocks());
+
+			// vectors whose allocator has no inline room never say they are inline
+			Assert::IsFalse(Vector<Foo>(4).IsInline());
+		}
+
+		TEST_METHOD(TestVector)
+		{
+			CountingResource resource;
+			{
+				Vector<Foo, DefaultComparator<Foo>, ResourceAllocator> vector(ResourceAllocator(&resource), 2);
+				Assert::AreEqual(1_z, resource.Blocks());
+				Assert::IsTrue(vector.GetAllocator().Resource() == &resource);
+
+				for (int i = 0; i < 10; ++i)
+				{
+					vector.EmplaceBack(i);
+				}
+				Assert::AreEqual(1_z, resource.Blocks());
+				Assert::AreEqual(sizeof(Foo) * vector.Capacity(), resource.Bytes());
+
+				auto copy = vector;
+				Assert::IsTrue(copy.GetAllocator() == vector.GetAllocator());
+				Assert::AreEqual(2_z, resource.Blocks());
+
+				auto moved = std::move(copy);
+				Assert::IsTrue(moved.GetAllocator() == vector.GetAllocator());
+				Assert::AreEqual(2_z, resource.Blocks());
+				Assert::IsTrue(vector == moved);
+
+				CountingResource other;
+				Vector<Foo, DefaultComparator<Foo>, ResourceAllocator> assigned{ ResourceAllocator(&other) };
+				assigned = vector;
+				Assert::IsTrue(assigned.GetAllocator().Resource() == &other);
+				Assert::AreEqual(1_z, other.Blocks());
+				Assert::AreEqual(2_z, resource.Blocks());
+
+				assigned = std::move(moved);
+				Assert::IsTrue(assigned.GetAllocator().Resource() == &resource);
+				Assert::AreEqual(0_z, other.Blocks());
+				Assert::AreEqual(2_z, resource.Blocks());
+			}
+			Assert::AreEqual(0_z, resource.Blocks());
+		}
+
+		TEST_METHOD(TestSList)
+		{
+			CountingResource resource;
+			{
+				SList<Foo, ResourceAllocator> list{ ResourceAllocator(&resource) };
+				for (int i = 0; i < 5; ++i)
+				{
+					list.PushBack(Foo(i));
+				}
+				Assert::AreEqual(5_z, resource.Blocks());
+
+				list.PopFront();
+				list.Remove(Foo(3));
+				Assert::AreEqual(3_z, resource.Blocks());
+
+				auto copy = list;
+				Assert::IsTrue(copy.GetAllocator() == list.GetAllocator());
+				Assert::AreEqual(6_z, resource.Blocks());
+
+				SList<Foo, ResourceAllocator> same{ ResourceAllocator(&resource) };
+				same.SpliceBack(copy);
+				Assert::AreEqual(1_z, same.Size());
+				Assert::AreEqual(6_z, resource.Blocks());
+
+				CountingResource other;
+				SList<Foo, ResourceAllocator> foreign{ ResourceAllocator(&other) };
+				auto expression = [&foreign, &copy] { foreign.SpliceBack(copy); };
+				Assert::ExpectException<std::exception>(expression);
+				Assert::AreEqual(0_z, other.Blocks());
+			}
+			Assert::AreEqual(0_z, resource.Blocks());
+		}
+
+		TEST_METHOD(TestHashMap)
+		{
+			using MapType = HashMap<Foo, int, DefaultHash<Foo>, DefaultComparator<Foo>, ResourceAllocator>;
+
+			CountingResource resource;
+			{
+				MapType map(7, ResourceAllocator(&resource));
+				Assert::IsTrue(map.GetAllocator().Resource() == &resource);
+				Assert::AreEqual(1_z, resource.Blocks());
+
+				for (int i = 0; i < 100; ++i)
+				{
+					map.Insert({ Foo(i), i });
+				}
+				while (map.IsRehashing())
+				{
+					map.Insert({ Foo(static_cast<int>(map.Size())), 0 });
+				}
+
+				// one block for the bucket array plus one per entry
+				Assert::AreEqual(map.Size() + 1, resource.Blocks());
+
+				CountingResource other;
+				{
+					MapType assigned(7, ResourceAllocator(&other));
+					assigned = map;
+					Assert::AreEqual(map.Size(), assigned.Size());
+					Assert::AreEqual(map.Size() + 1, other.Blocks());
+					Assert::AreEqual(map.Size() + 1, resource.Blocks());
+					for (int i = 0; i < 100; ++i)
+					{
+						Assert::AreEqual(i, assigned.At(Foo(i)));
+					}
+
+					// every chain has to share the map's allocator for growth to splice them
+					for (int i = 0; i < 100; ++i)
+					{
+						assigned.Insert({ Foo(1000 + i), i });
+					}
+					Assert::AreEqual(map.Size() + 1, resource.Blocks());
+				}
+				Assert::AreEqual(0_z, other.Blocks());
+
+				MapType moved = std::move(map);
+				Assert::IsTrue(moved.GetAllocator().Resource() == &resource);
+				Assert::AreEqual(moved.Size() + 1, resource.Blocks());
+
+				moved.Clear();
+				Assert::AreEqual(1_z, resource.Blocks());
+			}
+			Assert::AreEqual(0_z, resource.Blocks());
+		}
+
+	private:
+		/// <summary>
+		/// Resource that keeps track of how many blocks and bytes it has handed out
+		/// </summary>
+		class CountingResource final : public std::pmr::memory_resource
+		{
+		public:
+			size_t Blocks() const { return mBlocks; }
+			size_t Bytes() const { return mBytes; }
+
+		private:
+			void* do_allocate(size_t bytes, size_t alignment) override
+			{
+				++mBlocks;
+				mBytes += bytes;
+				return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+			}
+
+			void do_deallocate(void* memory, size_t bytes, size_t alignment) override
+			{
+				--mBlocks;
+				mBytes -= bytes;
+				std::pmr::new_delete_resource()->deallocate(memory, bytes, alignment);
+			}
+
+			bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+			{
+				return this == &other;
+			}
+
+			size_t mBlocks = 0;
+			size_t mBytes = 0;
+		};
+
+		static _CrtMemState sStartMemState;
+		static size_t sStartSlabsInUse;
+	};
+
+	_CrtMemState AllocatorTest::sStartMemState;
+	size_t AllocatorTest::sStartSlabsInUse;
+}
@@ -15,6 +15,7 @@
 #include "EnqueueEventSubscriber.h"
 #include "ToStringSpecializations.h"
 #include "Utility.h"
+#include "SlabAllocator.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace std::literals::string_literals;
@@ -32,6 +33,7 @@ namespace UnitTestLibraryDesktop
 			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
 			_CrtMemCheckpoint(&sStartMemState);
 #endif
+			sStartSlabsInUse = SlabAllocator<>::Statistics().InUse;
 		}
 
 		TEST_METHOD_CLEANUP(Cleanup)
@@ -45,6 +47,12 @@ namespace UnitTestLibraryDesktop
 				Assert::Fail(L"Memory Leaks!");
 			}
 #endif
+
+			// slab nodes are out of sight of the CRT heap, their pools keep their own count
+			if (SlabAllocator<>::Statistics().InUse != sStartSlabsInUse)
+			{
+				Assert::Fail(L"Slab Leaks!");
+			}
 		}
 
 		TEST_METHOD(TestAsync)
@@ -173,7 +181,9 @@ namespace UnitTestLibraryDesktop
 
 	private:
 		static _CrtMemState sStartMemState;
+		static size_t sStartSlabsInUse;
 	};
 
 	_CrtMemState AsyncEventsTest::sStartMemState;
+	size_t AsyncEventsTest::sStartSlabsInUse;
 }
@@ -0,0 +1,220 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <thread>
+#include "Atom.h"
+#include "OrderedHashMap.h"
+#include "vector.h"
+#include "Utility.h"
+#include "SlabAllocator.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std::literals::string_literals;
+using namespace std::literals::string_view_literals;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(AtomTest)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+			sStartSlabsInUse = SlabAllocator<>::Statistics().InUse;
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+
+			// slab nodes are out of sight of the CRT heap, their pools keep their own count
+			if (SlabAllocator<>::Statistics().InUse != sStartSlabsInUse)
+			{
+				Assert::Fail(L"Slab Leaks!");
+			}
+		}
+
+		TEST_METHOD(TestConstructor)
+		{
+			const Atom empty;
+			Assert::IsTrue(empty.IsEmpty());
+			Assert::IsTrue(empty.View().empty());
+			Assert::IsTrue(empty == Atom(""sv));
+			Assert::IsTrue(empty == ""sv);
+			Assert::AreEqual(empty.Hash(), DefaultHash<std::string_view>()(""sv));
+
+			const Atom atom("Health"sv);
+			Assert::IsFalse(atom.IsEmpty());
+			Assert::IsTrue(atom.View() == "Health"sv);
+			Assert::IsFalse(atom == empty);
+
+			const Atom copy(atom);
+			Assert::IsTrue(copy == atom);
+			Assert::IsTrue(copy.View().data() == atom.View().data());
+		}
+
+		TEST_METHOD(TestInterning)
+		{
+			const size_t count = Atom::Count();
+
+			const std::string name = "AtomTest.Interning"s;
+			const Atom first(name);
+			Assert::AreEqual(Atom::Count(), count + 1);
+
+			// every spelling is stored once, no matter where it comes from
+			const Atom second(std::string_view(name.c_str()));
+			const Atom third("AtomTest.Interning"sv);
+			Assert::AreEqual(Atom::Count(), count + 1);
+			Assert::IsTrue(first == second);
+			Assert::IsTrue(first == third);
+			Assert::IsTrue(first.View().data() == third.View().data());
+			Assert::IsTrue(first.View().data() != name.c_str());
+
+			const Atom other("AtomTest.Interning2"sv);
+			Assert::AreEqual(Atom::Count(), count + 2);
+			Assert::IsFalse(first == other);
+			Assert::IsTrue(other == "AtomTest.Interning2"sv);
+			Assert::IsFalse(other == "AtomTest.Interning"sv);
+		}
+
+		TEST_METHOD(TestFind)
+		{
+			const size_t count = Atom::Count();
+
+			Assert::IsTrue(Atom::Find("AtomTest.Find"sv).IsEmpty());
+			Assert::IsTrue(Atom::Find(""sv).IsEmpty());
+			Assert::AreEqual(Atom::Count(), count);
+
+			const Atom atom("AtomTest.Find"sv);
+			Assert::IsTrue(Atom::Find("AtomTest.Find"sv) == atom);
+			Assert::IsTrue(Atom::Find("AtomTest.Fin"sv).IsEmpty());
+			Assert::AreEqual(Atom::Count(), count + 1);
+		}
+
+		TEST_METHOD(TestHash)
+		{
+			const Atom atom("AtomTest.Hash"sv);
+			Assert::AreEqual(atom.Hash(), DefaultHash<std::string>()("AtomTest.Hash"s));
+
+			// the atom hash agrees with the string hash, so either can look up the other
+			const DefaultHash<Atom> hash;
+			Assert::AreEqual(hash(atom), hash("AtomTest.Hash"sv));
+			Assert::AreEqual(hash(atom), hash("AtomTest.Hash"s));
+			Assert::AreEqual(hash(atom), hash("AtomTest.Hash"));
+
+			const DefaultComparator<Atom> comparator;
+			Assert::IsTrue(comparator(atom, Atom("AtomTest.Hash"sv)));
+			Assert::IsTrue(comparator("AtomTest.Hash"sv, atom));
+			Assert::IsTrue(comparator("AtomTest.Hash"s, atom));
+			Assert::IsTrue(comparator("AtomTest.Hash", atom));
+			Assert::IsFalse(comparator("AtomTest.Has", atom));
+		}
+
+		TEST_METHOD(TestLongStrings)
+		{
+			// longer than a block of the pool, it gets a block of its own
+			const std::string name(100000, 'a');
+			const Atom atom(name);
+			Assert::IsTrue(atom.View() == name);
+			Assert::IsTrue(Atom(name) == atom);
+
+			const Atom next("AtomTest.LongStrings"sv);
+			Assert::IsTrue(next.View() == "AtomTest.LongStrings"sv);
+			Assert::IsTrue(atom.View() == name);
+		}
+
+		TEST_METHOD(TestManyAtoms)
+		{
+			const size_t count = Atom::Count();
+			const size_t size = Atom::PoolSize();
+
+			Vector<Atom> atoms;
+			atoms.Reserve(Count);
+			for (size_t i = 0; i < Count; ++i)
+			{
+				atoms.PushBack(Atom("AtomTest.Many." + std::to_string(i)));
+			}
+
+			Assert::AreEqual(Atom::Count(), count + Count);
+			Assert::IsTrue(Atom::PoolSize() > size);
+
+			// the pool grew many times over, earlier atoms are where they were
+			for (size_t i = 0; i < Count; ++i)
+			{
+				const std::string name = "AtomTest.Many." + std::to_string(i);
+				Assert::IsTrue(atoms[i].View() == name);
+				Assert::IsTrue(Atom(name) == atoms[i]);
+			}
+
+			Assert::AreEqual(Atom::Count(), count + Count);
+		}
+
+		TEST_METHOD(TestThreads)
+		{
+			auto work = [](Vector<Atom>& atoms)
+			{
+				for (size_t i = 0; i < 1000; ++i)
+				{
+					atoms.PushBack(Atom("AtomTest.Threads." + std::to_string(i)));
+				}
+			};
+
+			Vector<Atom> atoms[4];
+			{
+				std::thread threads[4] = { std::thread(work, std::ref(atoms[0])), std::thread(work, std::ref(atoms[1])),
+					std::thread(work, std::ref(atoms[2])), std::thread(work, std::ref(atoms[3])) };
+				for (auto& thread : threads)
+				{
+					thread.join();
+				}
+			}
+
+			// threads racing on the same names still get a single entry each
+			for (size_t i = 0; i < 1000; ++i)
+			{
+				Assert::IsTrue(atoms[0][i] == atoms[1][i]);
+				Assert::IsTrue(atoms[0][i] == atoms[2][i]);
+				Assert::IsTrue(atoms[0][i] == atoms[3][i]);
+				Assert::IsTrue(atoms[0][i] == Atom::Find("AtomTest.Threads." + std::to_string(i)));
+			}
+		}
+
+		TEST_METHOD(TestAsKey)
+		{
+			OrderedHashMap<Atom, int> map;
+			map.Emplace(Atom("Health"sv), 100);
+			map.Emplace(Atom("Mana"sv), 50);
+			Assert::AreEqual(map.Size(), 2_z);
+
+			Assert::AreEqual(map.At(Atom("Health"sv)), 100);
+			Assert::AreEqual(map.At("Mana"sv), 50);
+			Assert::AreEqual(map.At("Mana"s), 50);
+			Assert::IsTrue(map.ContainsKey("Health"));
+			Assert::IsFalse(map.ContainsKey("AtomTest.AsKey"sv));
+			Assert::IsFalse(map.ContainsKey(Atom("AtomTest.AsKey"sv)));
+
+			Assert::IsFalse(map.Emplace(Atom("Health"sv), 0).second);
+			Assert::AreEqual(map.At("Health"sv), 100);
+		}
+
+	private:
+		inline static const size_t Count = 20000;
+
+		static _CrtMemState sStartMemState;
+		static size_t sStartSlabsInUse;
+	};
+
+	_CrtMemState AtomTest::sStartMemState;
+	size_t AtomTest::sStartSlabsInUse;
+}
@@ -10,9 +10,9 @@ namespace UnitTestLibraryDesktop
 {
 	RTTI_DEFINITIONS(AttributedBar)
 
-	const Vector<Signature> AttributedBar::Signatures()
+	const SignatureListType AttributedBar::Signatures()
 	{
-		return Vector<Signature>(
+		return SignatureListType(
 			{
 				{ "Integer", Datum::DatumType::INTEGER, 1, offsetof(AttributedBar, Integer) },
 			});
@@ -9,7 +9,7 @@ namespace UnitTestLibraryDesktop
 		RTTI_DECLARATIONS(AttributedBar, Attributed)
 
 	public:
-		static const FieaGameEngine::Vector<FieaGameEngine::Signature> Signatures();
+		static const FieaGameEngine::SignatureListType Signatures();
 
 	public:
 		AttributedBar() : Attributed(TypeIdClass()) {};
@@ -0,0 +1,194 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <memory>
+#include "Attributed.h"
+#include "TypeManager.h"
+#include "Atom.h"
+#include "Factory.h"
+#include "AttributedFoo.h"
+#include "Avatar.h"
+#include "ActionIncrement.h"
+#include "vector.h"
+#include "Utility.h"
+#include "SlabAllocator.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std::literals::string_view_literals;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(AttributedBenchmark)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+			sStartSlabsInUse = SlabAllocator<>::Statistics().InUse;
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+
+			// slab nodes are out of sight of the CRT heap, their pools keep their own count
+			if (SlabAllocator<>::Statistics().InUse != sStartSlabsInUse)
+			{
+				Assert::Fail(L"Slab Leaks!");
+			}
+		}
+
+		TEST_METHOD(Spawn)
+		{
+			AvatarFactory avatarFactory;
+			ActionIncrementFactory actionIncrementFactory;
+
+			Logger::WriteMessage("Attributed spawns, one append per signature vs copying the type's prototype (ns per spawn)\n");
+			Measure<AttributedFoo>("AttributedFoo"sv, [] { return new AttributedFoo(); });
+			Measure<Avatar>("Avatar"sv, [] { return Factory<Scope>::Create("Avatar"sv); });
+			Measure<ActionIncrement>("ActionIncrement"sv, [] { return Factory<Scope>::Create("ActionIncrement"sv); });
+		}
+
+	private:
+		/// <summary>
+		/// Times spawning instances of a type through the prototype, against building the same
+		/// attribute table the way Populate used to: appending and binding one signature at a time
+		/// </summary>
+		template <typename T, typename TFunction>
+		static void Measure(std::string_view name, TFunction spawn)
+		{
+			const auto& layout = TypeManager::GetLayout(T::TypeIdClass());
+
+			// the appended tables point into a buffer the size of the type, as the instances would
+			auto storage = std::make_unique<std::byte[]>(sizeof(T));
+
+			Vector<Scope*> scopes(sSpawnCount);
+			double appendSpawn = std::numeric_limits<double>::max();
+			double prototypeSpawn = std::numeric_limits<double>::max();
+
+			// the best of a few rounds, the first ones pay for the heap growing
+			for (size_t round = 0; round < sRounds; ++round)
+			{
+				appendSpawn = std::min(appendSpawn, NanosecondsPerOperation(sSpawnCount, [&scopes, &layout, &storage]
+				{
+					for (size_t i = 0; i < sSpawnCount; ++i)
+					{
+						Scope* scope = new Scope();
+						scope->Append(Atom("this"sv)) = static_cast<RTTI*>(scope);
+						for (const auto& signature : layout.Signatures)
+						{
+							Datum& datum = scope->Append(signature.Name);
+							if (signature.Type != Datum::DatumType::TABLE)
+							{
+								Bind(datum, storage.get() + signature.Offset, signature);
+							}
+							else
+							{
+								datum.SetType(Datum::DatumType::TABLE);
+								for (size_t j = 0; j < signature.Size; ++j)
+								{
+									scope->AppendScope(signature.Name);
+								}
+							}
+						}
+
+						scopes.PushBack(scope);
+					}
+				}));
+
+				Assert::AreEqual(scopes[0]->Size(), layout.PrescribedCount);
+				DeleteAll(scopes);
+
+				prototypeSpawn = std::min(prototypeSpawn, NanosecondsPerOperation(sSpawnCount, [&scopes, &spawn]
+				{
+					for (size_t i = 0; i < sSpawnCount; ++i)
+					{
+						scopes.PushBack(spawn());
+					}
+				}));
+
+				Assert::AreEqual(scopes[0]->Size(), layout.PrescribedCount);
+				Assert::IsTrue(scopes[0]->Is(T::TypeIdClass()));
+				DeleteAll(scopes);
+			}
+
+			char line[160];
+			sprintf_s(line, "  %-16.*s %3zu attributes  append %7.1f   prototype %7.1f   (%.0f spawns per ms)\n",
+				static_cast<int>(name.size()), name.data(), layout.PrescribedCount, appendSpawn, prototypeSpawn, 1000000.0 / prototypeSpawn);
+			Logger::WriteMessage(line);
+		}
+
+		static void Bind(Datum& datum, std::byte* data, const Signature& signature)
+		{
+			switch (signature.Type)
+			{
+			case Datum::DatumType::INTEGER:
+				datum.SetStorage(reinterpret_cast<std::int32_t*>(data), signature.Size);
+				break;
+			case Datum::DatumType::FLOAT:
+				datum.SetStorage(reinterpret_cast<float*>(data), signature.Size);
+				break;
+			case Datum::DatumType::VECTOR:
+				datum.SetStorage(reinterpret_cast<glm::vec4*>(data), signature.Size);
+				break;
+			case Datum::DatumType::MATRIX:
+				datum.SetStorage(reinterpret_cast<glm::mat4*>(data), signature.Size);
+				break;
+			case Datum::DatumType::STRING:
+				datum.SetStorage(reinterpret_cast<std::string*>(data), signature.Size);
+				break;
+			case Datum::DatumType::POINTER:
+				datum.SetStorage(reinterpret_cast<RTTI**>(data), signature.Size);
+				break;
+			default:
+				Assert::Fail(L"Unexpected signature type");
+			}
+		}
+
+		static void DeleteAll(Vector<Scope*>& scopes)
+		{
+			for (Scope* scope : scopes)
+			{
+				delete scope;
+			}
+
+			scopes.Clear();
+		}
+
+		template <typename TFunction>
+		static double NanosecondsPerOperation(size_t operations, TFunction function)
+		{
+			const auto start = std::chrono::high_resolution_clock::now();
+			function();
+			const auto end = std::chrono::high_resolution_clock::now();
+
+			return std::chrono::duration<double, std::nano>(end - start).count() / operations;
+		}
+
+		inline static const size_t sSpawnCount = 10000;
+		inline static const size_t sRounds = 3;
+
+		static _CrtMemState sStartMemState;
+		static size_t sStartSlabsInUse;
+	};
+
+	_CrtMemState AttributedBenchmark::sStartMemState;
+	size_t AttributedBenchmark::sStartSlabsInUse;
+}
@@ -36,9 +36,9 @@ namespace UnitTestLibraryDesktop
 		return std::string("AttributedFoo");
 	}
 
-	Vector<Signature> AttributedFoo::Signatures()
+	SignatureListType AttributedFoo::Signatures()
 	{
-		return Vector<Signature>(
+		return SignatureListType(
 			{
 				{ "ExternalInteger", Datum::DatumType::INTEGER, 1, offsetof(AttributedFoo, ExternalInteger)},
 				{ "ExternalFloat", Datum::DatumType::FLOAT, 1, offsetof(AttributedFoo, ExternalFloat)},
@@ -12,7 +12,7 @@ namespace UnitTestLibraryDesktop
 		static const size_t sArraySize = 5;
 
 	public:
-		static FieaGameEngine::Vector<FieaGameEngine::Signature> Signatures();
+		static FieaGameEngine::SignatureListType Signatures();
 
 	public:
 		AttributedFoo();
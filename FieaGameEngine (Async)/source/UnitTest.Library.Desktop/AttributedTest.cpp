@@ -6,12 +6,14 @@
 #include "TypeManager.h"
 #include "ToStringSpecializations.h"
 #include "Utility.h"
+#include "SlabAllocator.h"
 #include <string>
 #include <tuple>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace FieaGameEngine;
 using namespace std::literals::string_literals;
+using namespace std::literals::string_view_literals;
 
 namespace UnitTestLibraryDesktop
 {
@@ -24,6 +26,7 @@ namespace UnitTestLibraryDesktop
 			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
 			_CrtMemCheckpoint(&sStartMemState);
 #endif
+			sStartSlabsInUse = SlabAllocator<>::Statistics().InUse;
 		}
 
 		TEST_METHOD_CLEANUP(Cleanup)
@@ -37,6 +40,12 @@ namespace UnitTestLibraryDesktop
 				Assert::Fail(L"Memory Leaks!");
 			}
 #endif
+
+			// slab nodes are out of sight of the CRT heap, their pools keep their own count
+			if (SlabAllocator<>::Statistics().InUse != sStartSlabsInUse)
+			{
+				Assert::Fail(L"Slab Leaks!");
+			}
 		}
 
 		TEST_METHOD(TestRTTI)
@@ -193,7 +202,7 @@ namespace UnitTestLibraryDesktop
 			{
 				AttributedFoo foo;
 				size_t size = foo.Size();
-				const std::pair<const std::string, Datum>& pair = std::make_pair("Aux"s, Datum(10));
+				const std::pair<const Atom, Datum>& pair = std::make_pair(Atom("Aux"sv), Datum(10));
 				Assert::IsNull(foo.Find(pair.first));
 				foo.AppendAuxiliaryAttribute(pair);
 				Assert::AreEqual(foo.Size(), size + 1);
@@ -211,10 +220,10 @@ namespace UnitTestLibraryDesktop
 				AttributedFoo foo;
 				size_t size = foo.Size();
 				Assert::IsNull(foo.Find("Aux"s));
-				foo.AppendAuxiliaryAttribute(std::pair("Aux"s, Datum(10)));
+				foo.AppendAuxiliaryAttribute(std::pair(Atom("Aux"sv), Datum(10)));
 				Assert::AreEqual(foo.Size(), size + 1);
 				Assert::IsNotNull(foo.Find("Aux"s));
-				foo.AppendAuxiliaryAttribute(std::pair("Aux"s, Datum(11)));
+				foo.AppendAuxiliaryAttribute(std::pair(Atom("Aux"sv), Datum(11)));
 				Assert::AreEqual(foo.Size(), size + 1);
 				Assert::ExpectException<std::exception>([&foo] { foo.AppendAuxiliaryAttribute("this"s); });
 				for (const auto& signature : TypeManager::GetSignatures(foo.TypeIdInstance()))
@@ -268,7 +277,7 @@ namespace UnitTestLibraryDesktop
 			AttributedFoo foo;
 			auto attrs = foo.Attributes();
 			Assert::IsTrue(attrs.Size() > 0);
-			Assert::AreEqual(attrs[0]->first, "this"s);
+			Assert::IsTrue(attrs[0]->first == "this"sv);
 			Assert::IsTrue(attrs[0]->second == &foo);
 			for (size_t i = 1; i < attrs.Size(); ++i)
 			{
@@ -278,7 +287,7 @@ namespace UnitTestLibraryDesktop
 			const AttributedFoo cfoo = foo;
 			auto cattrs = cfoo.Attributes();
 			Assert::IsTrue(cattrs.Size() > 0);
-			Assert::AreEqual(cattrs[0]->first, "this"s);
+			Assert::IsTrue(cattrs[0]->first == "this"sv);
 			Assert::IsTrue(cattrs[0]->second == &cfoo);
 			for (size_t i = 1; i < cattrs.Size(); ++i)
 			{
@@ -291,7 +300,7 @@ namespace UnitTestLibraryDesktop
 			AttributedFoo foo;
 			auto attrs = foo.PrescribedAttributes();
 			Assert::IsTrue(attrs.Size() > 0);
-			Assert::AreEqual(attrs[0]->first, "this"s);
+			Assert::IsTrue(attrs[0]->first == "this"sv);
 			Assert::IsTrue(attrs[0]->second == &foo);
 			for (size_t i = 1; i < attrs.Size(); ++i)
 			{
@@ -301,7 +310,7 @@ namespace UnitTestLibraryDesktop
 			const AttributedFoo cfoo = foo;
 			auto cattrs = cfoo.PrescribedAttributes();
 			Assert::IsTrue(cattrs.Size() > 0);
-			Assert::AreEqual(cattrs[0]->first, "this"s);
+			Assert::IsTrue(cattrs[0]->first == "this"sv);
 			Assert::IsTrue(cattrs[0]->second == &foo);
 			for (size_t i = 1; i < cattrs.Size(); ++i)
 			{
@@ -364,6 +373,16 @@ namespace UnitTestLibraryDesktop
 			Assert::IsNotNull(foo1.Find("A"s));
 			foo1.ClearAuxiliaryAttributes();
 			Assert::IsNull(foo1.Find("A"s));
+
+			// auxiliary child scopes are deleted, and searches cached before the removal see it
+			foo1.AppendScope("Child"s).Append("C");
+			foo1.Append("B");
+			Scope::SearchCache cache;
+			Assert::IsTrue(foo1.Search("B"sv, cache) == foo1.Find("B"sv));
+			foo1.ClearAuxiliaryAttributes();
+			Assert::IsNull(foo1.Find("Child"s));
+			Assert::IsNull(foo1.Search("B"sv, cache));
+			Assert::IsTrue(foo1.Search("ExternalInteger"sv, cache) == foo1.Find("ExternalInteger"sv));
 		}
 
 		TEST_METHOD(TestEquals)
@@ -393,7 +412,9 @@ namespace UnitTestLibraryDesktop
 
 	private:
 		static _CrtMemState sStartMemState;
+		static size_t sStartSlabsInUse;
 	};
 
 	_CrtMemState AttributedTest::sStartMemState;
+	size_t AttributedTest::sStartSlabsInUse;
 }
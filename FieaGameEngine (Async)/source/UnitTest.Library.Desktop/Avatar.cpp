@@ -7,7 +7,7 @@ namespace UnitTestLibraryDesktop
 {
 	RTTI_DEFINITIONS(Avatar)
 
-	Vector<Signature> Avatar::Signatures()
+	SignatureListType Avatar::Signatures()
 	{
 		return {
 			{ "Position", Datum::DatumType::VECTOR, 1, offsetof(Avatar, Position) }
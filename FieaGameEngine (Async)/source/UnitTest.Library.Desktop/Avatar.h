@@ -10,7 +10,7 @@ namespace UnitTestLibraryDesktop
 		RTTI_DECLARATIONS(Avatar, FieaGameEngine::Entity)
 
 	public:
-		static FieaGameEngine::Vector<FieaGameEngine::Signature> Signatures();
+		static FieaGameEngine::SignatureListType Signatures();
 
 	public:
 		Avatar();
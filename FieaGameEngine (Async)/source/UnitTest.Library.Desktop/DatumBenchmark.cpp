@@ -0,0 +1,419 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <string_view>
+#include "JsonParseMaster.h"
+#include "JsonTableParseHelper.h"
+#include "JsonTableWriter.h"
+#include "GameTime.h"
+#include "World.h"
+#include "Sector.h"
+#include "Entity.h"
+#include "ActionList.h"
+#include "ActionListIf.h"
+#include "ActionIncrement.h"
+#include "Datum.h"
+#include "DatumMath.h"
+#include "Scope.h"
+#include "vector.h"
+#include "Utility.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(DatumBenchmark)
+	{
+	public:
+		TEST_METHOD(InlineStorage)
+		{
+			Logger::WriteMessage("Datums with values after parsing the test content, inline vs heap buffers\n");
+
+			{
+				World world(std::make_shared<GameTime>());
+				SectorFactory sectorFactory;
+				EntityFactory entityFactory;
+				Measure("world.json", world, "content/world.json");
+			}
+
+			{
+				Entity entity;
+				EntityFactory entityFactory;
+				ActionListFactory actionListFactory;
+				ActionListIfFactory actionListIfFactory;
+				ActionIncrementFactory actionIncrementFactory;
+				Measure("entity.json", entity, "content/entity.json");
+			}
+		}
+
+		TEST_METHOD(BulkAccess)
+		{
+			Datum positions;
+			positions.Resize(sElementCount, glm::vec4(1.0f));
+			const glm::vec4 velocity(0.5f, 0.25f, 0.0f, 0.0f);
+
+			Logger::WriteMessage("Moving vec4 positions, checked Get vs unchecked vs span (ns per element)\n");
+
+			const double checked = NanosecondsPerElement([&positions, &velocity]
+			{
+				for (size_t i = 0; i < positions.Size(); ++i)
+				{
+					positions.Get<glm::vec4>(i) += velocity;
+				}
+			});
+
+			const double unchecked = NanosecondsPerElement([&positions, &velocity]
+			{
+				for (size_t i = 0; i < positions.Size(); ++i)
+				{
+					positions.GetUnchecked<glm::vec4>(i) += velocity;
+				}
+			});
+
+			const double span = NanosecondsPerElement([&positions, &velocity]
+			{
+				for (glm::vec4& position : positions.AsSpan<glm::vec4>())
+				{
+					position += velocity;
+				}
+			});
+
+			const float expected = 1.0f + 0.5f * static_cast<float>(sRepetitions * 3);
+			Assert::AreEqual(positions.Get<glm::vec4>(sElementCount - 1).x, expected);
+
+			char line[160];
+			sprintf_s(line, "  %zu elements  Get %5.2f   GetUnchecked %5.2f   AsSpan %5.2f\n", sElementCount, checked, unchecked, span);
+			Logger::WriteMessage(line);
+		}
+
+		TEST_METHOD(MathKernels)
+		{
+			Datum positions;
+			positions.Resize(sElementCount, glm::vec4(1.0f));
+			Datum velocities;
+			velocities.Resize(sElementCount, glm::vec4(0.5f, 0.25f, 0.0f, 0.0f));
+			Datum lengths(Datum::DatumType::FLOAT);
+			lengths.Resize(sElementCount);
+			Datum transformed(Datum::DatumType::VECTOR);
+			transformed.Resize(sElementCount);
+			const glm::mat4 transform(glm::vec4(0.8f, 0.6f, 0.0f, 0.0f), glm::vec4(-0.6f, 0.8f, 0.0f, 0.0f), glm::vec4(0.0f, 0.0f, 1.0f, 0.0f), glm::vec4(2.0f, 0.0f, 0.0f, 1.0f));
+
+			Logger::WriteMessage("Kernels over vec4 datums, a Get loop vs each instruction set (ns per element)\n");
+
+			char line[160];
+			sprintf_s(line, "  %-10s %8s %8s %8s\n", "", "Axpy", "Length", "Transform");
+			Logger::WriteMessage(line);
+
+			const double axpy = NanosecondsPerElement([&positions, &velocities]
+			{
+				for (size_t i = 0; i < positions.Size(); ++i)
+				{
+					positions.Get<glm::vec4>(i) += 0.5f * velocities.Get<glm::vec4>(i);
+				}
+			});
+
+			const double length = NanosecondsPerElement([&positions, &lengths]
+			{
+				for (size_t i = 0; i < positions.Size(); ++i)
+				{
+					lengths.Get<float>(i) = glm::length(positions.Get<glm::vec4>(i));
+				}
+			});
+
+			const double transformLoop = NanosecondsPerElement([&positions, &transformed, &transform]
+			{
+				for (size_t i = 0; i < positions.Size(); ++i)
+				{
+					transformed.Get<glm::vec4>(i) = transform * positions.Get<glm::vec4>(i);
+				}
+			});
+
+			sprintf_s(line, "  %-10s %8.2f %8.2f %8.2f\n", "Get loop", axpy, length, transformLoop);
+			Logger::WriteMessage(line);
+
+			const char* names[] = { "Scalar", "SSE4.1", "AVX2" };
+			const DatumMath::InstructionSet supported = DatumMath::GetSupportedInstructionSet();
+			for (DatumMath::InstructionSet set = DatumMath::InstructionSet::Scalar; set <= supported; set = static_cast<DatumMath::InstructionSet>(static_cast<int>(set) + 1))
+			{
+				DatumMath::SetInstructionSet(set);
+
+				const double axpyKernel = NanosecondsPerElement([&positions, &velocities] { DatumMath::Axpy(0.5f, velocities, positions); });
+				const double lengthKernel = NanosecondsPerElement([&positions, &lengths] { DatumMath::Length(positions, lengths); });
+				const double transformKernel = NanosecondsPerElement([&positions, &transformed, &transform] { DatumMath::Transform(transform, positions, transformed); });
+
+				sprintf_s(line, "  %-10s %8.2f %8.2f %8.2f\n", names[static_cast<int>(set)], axpyKernel, lengthKernel, transformKernel);
+				Logger::WriteMessage(line);
+			}
+
+			DatumMath::SetInstructionSet(supported);
+
+			// every pass moved the positions by half a velocity
+			const float expected = 1.0f + 0.25f * static_cast<float>(sRepetitions * (2 + static_cast<int>(supported)));
+			Assert::AreEqual(positions.Get<glm::vec4>(0).x, expected);
+			Assert::IsTrue(std::abs(lengths.Get<float>(0) - glm::length(positions.Get<glm::vec4>(0))) < 1e-3f);
+		}
+
+		TEST_METHOD(LoadGeneratedWorld)
+		{
+			// a thousand tables of a hundred attributes each, most of them vectors and matrices in text
+			std::string json = "{";
+			Vector<std::string> vectors;
+			Vector<std::string> matrices;
+			for (size_t table = 0; table < sTableCount; ++table)
+			{
+				json += (table > 0 ? ",\"Table" : "\"Table") + std::to_string(table) + "\":{\"type\":\"table\",\"value\":{";
+				for (size_t attribute = 0; attribute < sAttributesPerTable; ++attribute)
+				{
+					const float value = static_cast<float>(table) + static_cast<float>(attribute) * 0.125f;
+					std::string type;
+					std::string text;
+					switch (attribute % 5)
+					{
+					case 0:
+					case 1:
+						type = "vector";
+						text = glm::to_string(glm::vec4(value, -value, 0.5f, 1.0f));
+						vectors.PushBack(text);
+						break;
+					case 2:
+						type = "matrix";
+						text = glm::to_string(glm::mat4(value));
+						matrices.PushBack(text);
+						break;
+					case 3:
+						type = "string";
+						text = "Attribute " + std::to_string(attribute);
+						break;
+					default:
+						type = "integer";
+						text = std::to_string(attribute);
+						break;
+					}
+
+					const std::string quoted = type == "integer" ? text : "\"" + text + "\"";
+					json += (attribute > 0 ? ",\"A" : "\"A") + std::to_string(attribute) + "\":{\"type\":\"" + type + "\",\"value\":" + quoted + "}";
+				}
+				json += "}}";
+			}
+			json += "}";
+
+			Scope world;
+			TableSharedData data(world);
+			JsonParseMaster master(data);
+			JsonTableParseHelper helper;
+			master.AddHelper(helper);
+			master.Initialize();
+
+			const auto start = std::chrono::high_resolution_clock::now();
+			master.Parse(json);
+			const auto end = std::chrono::high_resolution_clock::now();
+
+			Assert::AreEqual(world.Size(), sTableCount);
+			Assert::IsTrue(world["Table7"][0]["A2"].Get<glm::mat4>() == glm::mat4(7.25f));
+
+			char line[160];
+			sprintf_s(line, "Loading a generated world of %zu attributes: %.1f ms\n", sTableCount * sAttributesPerTable,
+				std::chrono::duration<double, std::milli>(end - start).count());
+			Logger::WriteMessage(line);
+
+			// saving it back, per value strings from Datum::ToString vs the writer appending to one buffer
+			std::string perValue;
+			const auto toStringStart = std::chrono::high_resolution_clock::now();
+			AppendToStrings(world, perValue);
+			const auto toStringEnd = std::chrono::high_resolution_clock::now();
+
+			const auto saveStart = std::chrono::high_resolution_clock::now();
+			const std::string saved = JsonTableWriter::ToString(world);
+			const auto saveEnd = std::chrono::high_resolution_clock::now();
+
+			const double toStringMs = std::chrono::duration<double, std::milli>(toStringEnd - toStringStart).count();
+			const double saveMs = std::chrono::duration<double, std::milli>(saveEnd - saveStart).count();
+			sprintf_s(line, "Saving it: values through Datum::ToString %.1f ms, JsonTableWriter %.1f ms for %zu bytes (%.0f MB/s)\n",
+				toStringMs, saveMs, saved.size(), saved.size() / (saveMs * 1000.0));
+			Logger::WriteMessage(line);
+
+			Scope reloaded;
+			TableSharedData reloadedData(reloaded);
+			JsonParseMaster reloadMaster(reloadedData);
+			JsonTableParseHelper reloadHelper;
+			reloadMaster.AddHelper(reloadHelper);
+			reloadMaster.Initialize();
+			reloadMaster.Parse(saved);
+			Assert::IsTrue(reloaded == world);
+
+			// the text values of the world on their own, parsed the old way, one at a time and as a batch
+			Logger::WriteMessage("Parsing its vector and matrix texts, sscanf vs SetFromString vs SetFromStrings (ns per value)\n");
+			MeasureParsing("vec4", vectors, Datum::DatumType::VECTOR, [](const std::string& text)
+			{
+				glm::vec4 vector;
+				return sscanf_s(text.c_str(), " vec4( %f , %f , %f , %f ) ", &vector[0], &vector[1], &vector[2], &vector[3]) == 4;
+			});
+			MeasureParsing("mat4x4", matrices, Datum::DatumType::MATRIX, [](const std::string& text)
+			{
+				glm::mat4 matrix;
+				return sscanf_s(text.c_str(), " mat4x4( ( %f , %f , %f , %f ) , ( %f , %f , %f , %f ) , ( %f , %f , %f , %f ) , ( %f , %f , %f , %f ) ) ",
+					&matrix[0][0], &matrix[0][1], &matrix[0][2], &matrix[0][3], &matrix[1][0], &matrix[1][1], &matrix[1][2], &matrix[1][3],
+					&matrix[2][0], &matrix[2][1], &matrix[2][2], &matrix[2][3], &matrix[3][0], &matrix[3][1], &matrix[3][2], &matrix[3][3]) == 16;
+			});
+		}
+
+	private:
+		struct Counts
+		{
+			size_t Inline = 0;
+			size_t Heap = 0;
+		};
+
+		/// <summary>
+		/// Parses a file into a scope and counts the datums holding their own values. Every inline one
+		/// is a buffer the heap no longer hands out, before the inline storage each of them took one
+		/// </summary>
+		static void Measure(const char* name, Scope& root, const std::string& path)
+		{
+			TableSharedData data(root);
+			JsonParseMaster master(data);
+			JsonTableParseHelper helper;
+			master.AddHelper(helper);
+			master.Initialize();
+
+#if defined(DEBUG) || defined(_DEBUG)
+			sAllocations = 0;
+			_CRT_ALLOC_HOOK previousHook = _CrtSetAllocHook(CountAllocation);
+#endif
+			master.ParseFromFile(path);
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetAllocHook(previousHook);
+#endif
+
+			Counts counts;
+			Count(root, counts);
+			Assert::IsTrue(counts.Inline > 0);
+
+			char line[160];
+			sprintf_s(line, "  %-12s inline %4zu   heap %4zu   heap buffers before %4zu\n", name, counts.Inline, counts.Heap, counts.Inline + counts.Heap);
+			Logger::WriteMessage(line);
+
+#if defined(DEBUG) || defined(_DEBUG)
+			sprintf_s(line, "  %-12s %zu allocations while parsing\n", name, sAllocations);
+			Logger::WriteMessage(line);
+#endif
+		}
+
+		/// <summary>
+		/// Text of every value in a scope tree the way it took before the writer, a new string each
+		/// </summary>
+		static void AppendToStrings(const Scope& scope, std::string& text)
+		{
+			for (size_t i = 0; i < scope.Size(); ++i)
+			{
+				const Datum& datum = scope[i];
+				for (size_t j = 0; j < datum.Size(); ++j)
+				{
+					if (datum.Type() == Datum::DatumType::TABLE)
+					{
+						AppendToStrings(datum[j], text);
+					}
+					else if (datum.Type() != Datum::DatumType::POINTER)
+					{
+						text += datum.ToString(j);
+					}
+				}
+			}
+		}
+
+		template <typename TFunction>
+		static void MeasureParsing(const char* name, const Vector<std::string>& texts, Datum::DatumType type, TFunction scan)
+		{
+			Datum datum(type);
+			datum.Resize(texts.Size());
+
+			auto time = [&texts](auto function)
+			{
+				const auto start = std::chrono::high_resolution_clock::now();
+				function();
+				const auto end = std::chrono::high_resolution_clock::now();
+				return std::chrono::duration<double, std::nano>(end - start).count() / texts.Size();
+			};
+
+			const double scanned = time([&texts, &scan]
+			{
+				for (const std::string& text : texts)
+				{
+					Assert::IsTrue(scan(text));
+				}
+			});
+
+			const double single = time([&texts, &datum]
+			{
+				for (size_t i = 0; i < texts.Size(); ++i)
+				{
+					datum.SetFromString(texts[i], i);
+				}
+			});
+
+			const double batch = time([&texts, &datum] { datum.SetFromStrings(texts); });
+			Assert::AreEqual(datum.ToString(texts.Size() - 1), texts[texts.Size() - 1]);
+
+			char line[160];
+			sprintf_s(line, "  %-8s %6zu values  sscanf %7.1f   SetFromString %7.1f   SetFromStrings %7.1f\n", name, texts.Size(), scanned, single, batch);
+			Logger::WriteMessage(line);
+		}
+
+		static void Count(const Scope& scope, Counts& counts)
+		{
+			for (size_t i = 0; i < scope.Size(); ++i)
+			{
+				const Datum& datum = scope[i];
+				if (datum.Type() == Datum::DatumType::TABLE)
+				{
+					for (size_t j = 0; j < datum.Size(); ++j)
+					{
+						Count(datum[j], counts);
+					}
+				}
+
+				if (datum.OwnsStorage() && datum.Size() > 0)
+				{
+					++(datum.IsInline() ? counts.Inline : counts.Heap);
+				}
+			}
+		}
+
+		template <typename TFunction>
+		static double NanosecondsPerElement(TFunction function)
+		{
+			const auto start = std::chrono::high_resolution_clock::now();
+			for (size_t repetition = 0; repetition < sRepetitions; ++repetition)
+			{
+				function();
+			}
+			const auto end = std::chrono::high_resolution_clock::now();
+
+			return std::chrono::duration<double, std::nano>(end - start).count() / (sElementCount * sRepetitions);
+		}
+
+		inline static const size_t sElementCount = 100000;
+		inline static const size_t sRepetitions = 16;
+		inline static const size_t sTableCount = 1000;
+		inline static const size_t sAttributesPerTable = 100;
+
+#if defined(DEBUG) || defined(_DEBUG)
+		static int CountAllocation(int allocType, void*, size_t, int, long, const unsigned char*, int)
+		{
+			if (allocType == _HOOK_ALLOC || allocType == _HOOK_REALLOC)
+			{
+				++sAllocations;
+			}
+
+			return TRUE;
+		}
+
+		inline static size_t sAllocations = 0;
+#endif
+	};
+}
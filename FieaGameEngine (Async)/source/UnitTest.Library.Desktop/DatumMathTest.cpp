@@ -0,0 +1,422 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <cmath>
+#include <limits>
+#include "DatumMath.h"
+#include "Datum.h"
+#include "vector.h"
+#include "Utility.h"
+#include "SlabAllocator.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(DatumMathTest)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+			sStartSlabsInUse = SlabAllocator<>::Statistics().InUse;
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+			DatumMath::SetInstructionSet(DatumMath::GetSupportedInstructionSet());
+
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+
+			// slab nodes are out of sight of the CRT heap, their pools keep their own count
+			if (SlabAllocator<>::Statistics().InUse != sStartSlabsInUse)
+			{
+				Assert::Fail(L"Slab Leaks!");
+			}
+		}
+
+		TEST_METHOD(TestInstructionSet)
+		{
+			const DatumMath::InstructionSet supported = DatumMath::GetSupportedInstructionSet();
+			Assert::IsTrue(DatumMath::GetInstructionSet() == supported);
+
+			for (DatumMath::InstructionSet set : SupportedSets())
+			{
+				DatumMath::SetInstructionSet(set);
+				Assert::IsTrue(DatumMath::GetInstructionSet() == set);
+			}
+
+			if (supported != DatumMath::InstructionSet::AVX2)
+			{
+				Assert::ExpectException<std::exception>([] { DatumMath::SetInstructionSet(DatumMath::InstructionSet::AVX2); });
+			}
+		}
+
+		TEST_METHOD(TestAxpy)
+		{
+			for (DatumMath::InstructionSet set : SupportedSets())
+			{
+				DatumMath::SetInstructionSet(set);
+
+				// sizes around the register widths, so every tail gets its turn
+				for (size_t size = 0; size < 12; ++size)
+				{
+					const Datum x = Samples(size, 1.0f);
+					Datum y = Samples(size, 2.0f);
+					DatumMath::Axpy(0.5f, x, y);
+
+					for (size_t i = 0; i < size; ++i)
+					{
+						AssertNear(y.Get<glm::vec4>(i), Sample(i, 2.0f) + 0.5f * Sample(i, 1.0f));
+					}
+				}
+
+				Datum x(Datum::DatumType::FLOAT);
+				Datum y(Datum::DatumType::FLOAT);
+				for (size_t i = 0; i < 11; ++i)
+				{
+					x.PushBack(static_cast<float>(i));
+					y.PushBack(1.0f);
+				}
+
+				DatumMath::Axpy(-2.0f, x, y);
+				for (size_t i = 0; i < 11; ++i)
+				{
+					Assert::AreEqual(y.Get<float>(i), 1.0f - 2.0f * static_cast<float>(i));
+				}
+
+				// a datum added to itself
+				DatumMath::Axpy(1.0f, y, y);
+				Assert::AreEqual(y.Get<float>(10), 2.0f * (1.0f - 20.0f));
+			}
+
+			Datum vectors = Samples(3, 1.0f);
+			Datum floats(Datum::DatumType::FLOAT);
+			floats.Resize(3);
+			Datum shorter = Samples(2, 1.0f);
+			Datum strings(Datum::DatumType::STRING);
+			Assert::ExpectException<std::exception>([&vectors, &floats] { DatumMath::Axpy(1.0f, vectors, floats); });
+			Assert::ExpectException<std::exception>([&vectors, &shorter] { DatumMath::Axpy(1.0f, vectors, shorter); });
+			Assert::ExpectException<std::exception>([&strings] { DatumMath::Axpy(1.0f, strings, strings); });
+		}
+
+		TEST_METHOD(TestScaleAndClamp)
+		{
+			for (DatumMath::InstructionSet set : SupportedSets())
+			{
+				DatumMath::SetInstructionSet(set);
+
+				for (size_t size = 0; size < 12; ++size)
+				{
+					Datum vectors = Samples(size, -3.0f);
+					DatumMath::Scale(vectors, 2.0f);
+					for (size_t i = 0; i < size; ++i)
+					{
+						AssertNear(vectors.Get<glm::vec4>(i), 2.0f * Sample(i, -3.0f));
+					}
+
+					DatumMath::Clamp(vectors, -4.0f, 5.0f);
+					for (size_t i = 0; i < size; ++i)
+					{
+						AssertNear(vectors.Get<glm::vec4>(i), glm::clamp(2.0f * Sample(i, -3.0f), -4.0f, 5.0f));
+					}
+				}
+
+				Datum matrices(Datum::DatumType::MATRIX);
+				matrices.PushBack(glm::mat4(1.0f));
+				matrices.PushBack(glm::mat4(3.0f));
+				DatumMath::Scale(matrices, 0.5f);
+				Assert::IsTrue(matrices.Get<glm::mat4>(1) == glm::mat4(1.5f));
+				DatumMath::Clamp(matrices, 0.25f, 1.0f);
+				Assert::IsTrue(matrices.Get<glm::mat4>(0)[0] == glm::vec4(0.5f, 0.25f, 0.25f, 0.25f));
+				Assert::IsTrue(matrices.Get<glm::mat4>(1)[3] == glm::vec4(0.25f, 0.25f, 0.25f, 1.0f));
+			}
+
+			Datum integers(Datum::DatumType::INTEGER);
+			integers.PushBack(1);
+			Assert::ExpectException<std::exception>([&integers] { DatumMath::Scale(integers, 2.0f); });
+			Assert::ExpectException<std::exception>([&integers] { DatumMath::Clamp(integers, 0.0f, 1.0f); });
+		}
+
+		TEST_METHOD(TestClampNaN)
+		{
+			const float nan = std::numeric_limits<float>::quiet_NaN();
+
+			for (DatumMath::InstructionSet set : SupportedSets())
+			{
+				DatumMath::SetInstructionSet(set);
+
+				// 11 floats, index 2 lands in a register and index 9 in the scalar tail
+				Datum floats(Datum::DatumType::FLOAT);
+				for (size_t i = 0; i < 11; ++i)
+				{
+					floats.PushBack(i == 2 || i == 9 ? nan : static_cast<float>(i) - 5.0f);
+				}
+
+				DatumMath::Clamp(floats, -2.0f, 3.0f);
+				for (size_t i = 0; i < 11; ++i)
+				{
+					if (i == 2 || i == 9)
+					{
+						Assert::IsTrue(std::isnan(floats.Get<float>(i)));
+					}
+					else
+					{
+						Assert::AreEqual(floats.Get<float>(i), glm::clamp(static_cast<float>(i) - 5.0f, -2.0f, 3.0f));
+					}
+				}
+			}
+		}
+
+		TEST_METHOD(TestLerp)
+		{
+			for (DatumMath::InstructionSet set : SupportedSets())
+			{
+				DatumMath::SetInstructionSet(set);
+
+				for (size_t size = 0; size < 12; ++size)
+				{
+					const Datum from = Samples(size, 1.0f);
+					const Datum to = Samples(size, -2.0f);
+					Datum result;
+					DatumMath::Lerp(from, to, 0.25f, result);
+
+					Assert::IsTrue(result.Type() == Datum::DatumType::VECTOR);
+					Assert::AreEqual(result.Size(), size);
+					for (size_t i = 0; i < size; ++i)
+					{
+						AssertNear(result.Get<glm::vec4>(i), glm::mix(Sample(i, 1.0f), Sample(i, -2.0f), 0.25f));
+					}
+				}
+
+				// written back into one of the inputs
+				Datum from = Samples(5, 1.0f);
+				const Datum to = Samples(5, 3.0f);
+				DatumMath::Lerp(from, to, 1.0f, from);
+				for (size_t i = 0; i < 5; ++i)
+				{
+					AssertNear(from.Get<glm::vec4>(i), Sample(i, 3.0f));
+				}
+			}
+
+			const Datum from = Samples(3, 1.0f);
+			const Datum to = Samples(4, 1.0f);
+			Datum result;
+			Assert::ExpectException<std::exception>([&from, &to, &result] { DatumMath::Lerp(from, to, 0.5f, result); });
+
+			Datum floats(Datum::DatumType::FLOAT);
+			Assert::ExpectException<std::exception>([&from, &floats] { DatumMath::Lerp(from, from, 0.5f, floats); });
+		}
+
+		TEST_METHOD(TestDotAndLength)
+		{
+			for (DatumMath::InstructionSet set : SupportedSets())
+			{
+				DatumMath::SetInstructionSet(set);
+
+				for (size_t size = 0; size < 20; ++size)
+				{
+					const Datum left = Samples(size, 1.0f);
+					const Datum right = Samples(size, -0.5f);
+					Datum dots;
+					Datum lengths(Datum::DatumType::FLOAT);
+					lengths.PushBack(42.0f);
+					DatumMath::Dot(left, right, dots);
+					DatumMath::Length(left, lengths);
+
+					Assert::IsTrue(dots.Type() == Datum::DatumType::FLOAT);
+					Assert::AreEqual(dots.Size(), size);
+					Assert::AreEqual(lengths.Size(), size);
+					for (size_t i = 0; i < size; ++i)
+					{
+						AssertNear(dots.Get<float>(i), glm::dot(Sample(i, 1.0f), Sample(i, -0.5f)));
+						AssertNear(lengths.Get<float>(i), glm::length(Sample(i, 1.0f)));
+					}
+				}
+			}
+
+			const Datum vectors = Samples(3, 1.0f);
+			Datum floats(Datum::DatumType::FLOAT);
+			floats.Resize(3);
+			Datum result;
+			Assert::ExpectException<std::exception>([&floats, &result] { DatumMath::Dot(floats, floats, result); });
+			Assert::ExpectException<std::exception>([&floats, &result] { DatumMath::Length(floats, result); });
+
+			Datum wrongType(Datum::DatumType::VECTOR);
+			Assert::ExpectException<std::exception>([&vectors, &wrongType] { DatumMath::Length(vectors, wrongType); });
+		}
+
+		TEST_METHOD(TestTransform)
+		{
+			const glm::mat4 matrix = SampleMatrix(1.0f);
+
+			for (DatumMath::InstructionSet set : SupportedSets())
+			{
+				DatumMath::SetInstructionSet(set);
+
+				for (size_t size = 0; size < 12; ++size)
+				{
+					const Datum vectors = Samples(size, 1.0f);
+					Datum result;
+					DatumMath::Transform(matrix, vectors, result);
+
+					Assert::AreEqual(result.Size(), size);
+					for (size_t i = 0; i < size; ++i)
+					{
+						AssertNear(result.Get<glm::vec4>(i), matrix * Sample(i, 1.0f));
+					}
+				}
+
+				// in place
+				Datum vectors = Samples(7, 2.0f);
+				DatumMath::Transform(matrix, vectors, vectors);
+				for (size_t i = 0; i < 7; ++i)
+				{
+					AssertNear(vectors.Get<glm::vec4>(i), matrix * Sample(i, 2.0f));
+				}
+			}
+
+			Datum matrices(Datum::DatumType::MATRIX);
+			matrices.PushBack(matrix);
+			Datum result;
+			Assert::ExpectException<std::exception>([&matrix, &matrices, &result] { DatumMath::Transform(matrix, matrices, result); });
+		}
+
+		TEST_METHOD(TestMultiply)
+		{
+			const glm::mat4 matrix = SampleMatrix(1.0f);
+
+			for (DatumMath::InstructionSet set : SupportedSets())
+			{
+				DatumMath::SetInstructionSet(set);
+
+				for (size_t size = 0; size < 6; ++size)
+				{
+					Datum matrices(Datum::DatumType::MATRIX);
+					for (size_t i = 0; i < size; ++i)
+					{
+						matrices.PushBack(SampleMatrix(static_cast<float>(i) - 2.0f));
+					}
+
+					Datum result;
+					DatumMath::Multiply(matrix, matrices, result);
+
+					Assert::AreEqual(result.Size(), size);
+					for (size_t i = 0; i < size; ++i)
+					{
+						const glm::mat4 expected = matrix * SampleMatrix(static_cast<float>(i) - 2.0f);
+						for (glm::length_t column = 0; column < 4; ++column)
+						{
+							AssertNear(result.Get<glm::mat4>(i)[column], expected[column]);
+						}
+					}
+
+					DatumMath::Multiply(matrix, matrices, matrices);
+					Assert::IsTrue(matrices == result);
+				}
+			}
+
+			Datum vectors = Samples(2, 1.0f);
+			Datum result;
+			Assert::ExpectException<std::exception>([&matrix, &vectors, &result] { DatumMath::Multiply(matrix, vectors, result); });
+		}
+
+		TEST_METHOD(TestExternalResult)
+		{
+			const Datum vectors = Samples(4, 1.0f);
+
+			float lengths[4];
+			Datum result;
+			result.SetStorage(lengths, 4);
+			DatumMath::Length(vectors, result);
+			for (size_t i = 0; i < 4; ++i)
+			{
+				AssertNear(lengths[i], glm::length(Sample(i, 1.0f)));
+			}
+
+			// external storage is never resized
+			float tooFew[3];
+			Datum small;
+			small.SetStorage(tooFew, 3);
+			Assert::ExpectException<std::exception>([&vectors, &small] { DatumMath::Length(vectors, small); });
+
+			glm::vec4 positions[3] = { glm::vec4(1.0f), glm::vec4(2.0f), glm::vec4(3.0f) };
+			Datum external;
+			external.SetStorage(positions, 3);
+			DatumMath::Scale(external, 2.0f);
+			Assert::IsTrue(positions[2] == glm::vec4(6.0f));
+		}
+
+	private:
+		/// <summary>
+		/// Instruction sets this CPU runs, every kernel is checked with each of them
+		/// </summary>
+		static Vector<DatumMath::InstructionSet> SupportedSets()
+		{
+			Vector<DatumMath::InstructionSet> sets;
+			sets.PushBack(DatumMath::InstructionSet::Scalar);
+			if (DatumMath::GetSupportedInstructionSet() >= DatumMath::InstructionSet::SSE41)
+			{
+				sets.PushBack(DatumMath::InstructionSet::SSE41);
+			}
+			if (DatumMath::GetSupportedInstructionSet() >= DatumMath::InstructionSet::AVX2)
+			{
+				sets.PushBack(DatumMath::InstructionSet::AVX2);
+			}
+
+			return sets;
+		}
+
+		static glm::vec4 Sample(size_t index, float seed)
+		{
+			const float i = static_cast<float>(index);
+			return glm::vec4(seed + i, seed * i - 1.0f, 3.0f - i * 0.5f, seed * 0.25f + i);
+		}
+
+		static Datum Samples(size_t size, float seed)
+		{
+			Datum vectors(Datum::DatumType::VECTOR);
+			for (size_t i = 0; i < size; ++i)
+			{
+				vectors.PushBack(Sample(i, seed));
+			}
+
+			return vectors;
+		}
+
+		static glm::mat4 SampleMatrix(float seed)
+		{
+			return glm::mat4(Sample(0, seed), Sample(1, seed), Sample(2, seed), Sample(3, seed));
+		}
+
+		static void AssertNear(float actual, float expected)
+		{
+			Assert::IsTrue(std::abs(actual - expected) <= 1e-4f * std::max(1.0f, std::abs(expected)));
+		}
+
+		static void AssertNear(const glm::vec4& actual, const glm::vec4& expected)
+		{
+			for (glm::length_t i = 0; i < 4; ++i)
+			{
+				AssertNear(actual[i], expected[i]);
+			}
+		}
+
+		static _CrtMemState sStartMemState;
+		static size_t sStartSlabsInUse;
+	};
+
+	_CrtMemState DatumMathTest::sStartMemState;
+	size_t DatumMathTest::sStartSlabsInUse;
+}
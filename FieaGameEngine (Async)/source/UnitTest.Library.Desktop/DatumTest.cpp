@@ -1,15 +1,22 @@
 #include "pch.h"
+#include <algorithm>
+#include <limits>
+#include <numeric>
 #include <string>
+#include <string_view>
 #include "CppUnitTest.h"
 #include "Datum.h"
 #include "Utility.h"
 #include "ToStringSpecializations.h"
 #include "Foo.h"
+#include "vector.h"
+#include "SlabAllocator.h"
 #include <glm/glm.hpp>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace FieaGameEngine;
 using namespace std::literals::string_literals;
+using namespace std::literals::string_view_literals;
 
 namespace UnitTestLibraryDesktop
 {
@@ -22,6 +29,7 @@ namespace UnitTestLibraryDesktop
 			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
 			_CrtMemCheckpoint(&sStartMemState);
 #endif
+			sStartSlabsInUse = SlabAllocator<>::Statistics().InUse;
 		}
 
 		TEST_METHOD_CLEANUP(Cleanup)
@@ -35,6 +43,12 @@ namespace UnitTestLibraryDesktop
 				Assert::Fail(L"Memory Leaks!");
 			}
 #endif
+
+			// slab nodes are out of sight of the CRT heap, their pools keep their own count
+			if (SlabAllocator<>::Statistics().InUse != sStartSlabsInUse)
+			{
+				Assert::Fail(L"Slab Leaks!");
+			}
 		}
 
 		TEST_METHOD(TestConstructor)
@@ -877,6 +891,132 @@ namespace UnitTestLibraryDesktop
 				Assert::AreEqual(d.Get<std::string>(1), "new"s);
 				//Assert::ExpectException<std::exception>([&d] { d.SetFromString("error"s, 1); });
 			}
+
+			// numbers read like std::stoi and std::stof, from the start of the string
+			{
+				Datum d(Datum::DatumType::INTEGER);
+				d.Resize(1);
+				d.SetFromString(" +42");
+				Assert::AreEqual(d.Get<std::int32_t>(), 42);
+				d.SetFromString("-7.9 apples"sv);
+				Assert::AreEqual(d.Get<std::int32_t>(), -7);
+				Assert::ExpectException<std::exception>([&d] { d.SetFromString("apples"sv); });
+				Assert::ExpectException<std::exception>([&d] { d.SetFromString("+-1"sv); });
+				Assert::ExpectException<std::exception>([&d] { d.SetFromString(""sv); });
+				Assert::ExpectException<std::exception>([&d] { d.SetFromString("3000000000"sv); });
+				Assert::AreEqual(d.Get<std::int32_t>(), -7);
+
+				Datum f(Datum::DatumType::FLOAT);
+				f.Resize(1);
+				f.SetFromString("\t-2.5e3"sv);
+				Assert::AreEqual(f.Get<float>(), -2500.0f);
+				f.SetFromString(".5"sv);
+				Assert::AreEqual(f.Get<float>(), 0.5f);
+				Assert::ExpectException<std::exception>([&f] { f.SetFromString("1e99"sv); });
+				Assert::ExpectException<std::exception>([&f] { f.SetFromString("1e-99"sv); });
+				Assert::ExpectException<std::exception>([&f] { f.SetFromString("f"sv); });
+				Assert::ExpectException<std::exception>([&f] { f.SetFromString("+ 1"sv); });
+
+				// subnormals are in range, and long tokens read the same as short ones
+				f.SetFromString("1e-45"sv);
+				Assert::AreEqual(f.Get<float>(), std::numeric_limits<float>::denorm_min());
+				f.SetFromString("1.2500000000000000000000000000000000000000000000000000000000000000000000000000000000 apples"sv);
+				Assert::AreEqual(f.Get<float>(), 1.25f);
+			}
+
+			// vectors and matrices read back what glm::to_string writes
+			{
+				const glm::vec4 vector(1.5f, -2.25f, 1e-3f, 4096.0f);
+				const glm::mat4 matrix(vector, vector * 2.0f, glm::vec4(0.0f), glm::vec4(-1.0f, 0.125f, 3.0f, 7.0f));
+
+				Datum d(Datum::DatumType::VECTOR);
+				d.Resize(1);
+				d.SetFromString(glm::to_string(vector));
+				Assert::IsTrue(d.Get<glm::vec4>() == vector);
+				Assert::ExpectException<std::exception>([&d] { d.SetFromString("vec4(1, 2, 3)"sv); });
+				Assert::ExpectException<std::exception>([&d] { d.SetFromString("vec3(1, 2, 3, 4)"sv); });
+
+				Datum m(Datum::DatumType::MATRIX);
+				m.Resize(1);
+				m.SetFromString(glm::to_string(matrix));
+				Assert::IsTrue(m.Get<glm::mat4>() == matrix);
+				m.SetFromString("mat4x4( (1,0,0,0),(0,1,0,0) ,(0,0,1,0), (0,0,0,1) )"sv);
+				Assert::IsTrue(m.Get<glm::mat4>() == glm::mat4(1.0f));
+				Assert::ExpectException<std::exception>([&m] { m.SetFromString("mat4x4((1,0,0,0),(0,1,0,0),(0,0,1,0))"sv); });
+			}
+		}
+
+		TEST_METHOD(TestSetFromStrings)
+		{
+			// grows to fit
+			{
+				Datum d(Datum::DatumType::INTEGER);
+				const std::string_view values[] = { "1"sv, " 2"sv, "3 "sv };
+				d.SetFromStrings(values);
+				Assert::AreEqual(d.Size(), 3_z);
+				Assert::AreEqual(d.Get<std::int32_t>(2), 3);
+
+				const Vector<std::string> more = { "4"s, "5"s };
+				d.SetFromStrings(more, 2);
+				Assert::AreEqual(d.Size(), 4_z);
+				Assert::AreEqual(d.Get<std::int32_t>(1), 2);
+				Assert::AreEqual(d.Get<std::int32_t>(2), 4);
+				Assert::AreEqual(d.Get<std::int32_t>(3), 5);
+
+				d.SetFromStrings(Vector<std::string>());
+				Assert::AreEqual(d.Size(), 4_z);
+			}
+
+			// every type that has a text form
+			{
+				Datum floats(Datum::DatumType::FLOAT);
+				const char* numbers[] = { "0.5", "-1", "2e2" };
+				floats.SetFromStrings(numbers);
+				Assert::AreEqual(floats.Get<float>(2), 200.0f);
+
+				Datum vectors(Datum::DatumType::VECTOR);
+				const std::string texts[] = { glm::to_string(glm::vec4(1.0f)), glm::to_string(glm::vec4(2.0f)) };
+				vectors.SetFromStrings(texts);
+				Assert::IsTrue(vectors.Get<glm::vec4>(1) == glm::vec4(2.0f));
+
+				Datum matrices(Datum::DatumType::MATRIX);
+				const std::string identity[] = { glm::to_string(glm::mat4(1.0f)) };
+				matrices.SetFromStrings(identity);
+				Assert::IsTrue(matrices.Get<glm::mat4>() == glm::mat4(1.0f));
+
+				Datum strings(Datum::DatumType::STRING);
+				strings.SetFromStrings(texts, 1);
+				Assert::AreEqual(strings.Size(), 3_z);
+				Assert::AreEqual(strings.Get<std::string>(0), ""s);
+				Assert::AreEqual(strings.Get<std::string>(2), texts[1]);
+			}
+
+			// external storage is filled but never grown
+			{
+				float values[3] = { 0.0f, 0.0f, 0.0f };
+				Datum d;
+				d.SetStorage(values, 3);
+				const std::string_view texts[] = { "1"sv, "2"sv };
+				d.SetFromStrings(texts, 1);
+				Assert::AreEqual(values[2], 2.0f);
+				Assert::ExpectException<std::exception>([&d, &texts] { d.SetFromStrings(texts, 2); });
+			}
+
+			// errors
+			{
+				const std::string_view texts[] = { "1"sv };
+				Datum unknown;
+				Assert::ExpectException<std::exception>([&unknown, &texts] { unknown.SetFromStrings(texts); });
+
+				Datum pointers(Datum::DatumType::POINTER);
+				Assert::ExpectException<std::exception>([&pointers, &texts] { pointers.SetFromStrings(texts); });
+				Assert::AreEqual(pointers.Size(), 0_z);
+
+				Datum integers(Datum::DatumType::INTEGER);
+				const std::string_view bad[] = { "1"sv, "two"sv };
+				Assert::ExpectException<std::exception>([&integers, &bad] { integers.SetFromStrings(bad); });
+				Assert::AreEqual(integers.Get<std::int32_t>(0), 1);
+			}
 		}
 
 		TEST_METHOD(TestSetStorage)
@@ -2100,6 +2240,182 @@ namespace UnitTestLibraryDesktop
 			}
 		}
 
+		TEST_METHOD(TestInlineStorage)
+		{
+			// Integers, four fit inline and the fifth spills to the heap
+			{
+				Datum d;
+				for (std::int32_t i = 0; i < 4; ++i)
+				{
+					d.PushBack(i);
+					Assert::IsTrue(d.IsInline());
+				}
+
+				d.PushBack(4);
+				Assert::IsFalse(d.IsInline());
+				for (std::int32_t i = 0; i < 5; ++i)
+				{
+					Assert::AreEqual(d.Get<std::int32_t>(i), i);
+				}
+
+				d.Resize(2);
+				d.ShrinkToFit();
+				Assert::IsTrue(d.IsInline());
+				Assert::AreEqual(d.Capacity(), 2_z);
+				Assert::AreEqual(d.Get<std::int32_t>(1), 1);
+
+				std::int32_t sum = 0;
+				for (const auto& value : d)
+				{
+					sum += *reinterpret_cast<std::int32_t*>(value);
+				}
+				Assert::AreEqual(sum, 1);
+			}
+
+			// Vector, one fits inline
+			{
+				const glm::vec4 a(1.0f, 2.0f, 3.0f, 4.0f);
+				Datum d = a;
+				Assert::IsTrue(d.IsInline());
+				d.PushBack(a * 2.0f);
+				Assert::IsFalse(d.IsInline());
+				Assert::AreEqual(d.Get<glm::vec4>(), a);
+				Assert::AreEqual(d.Get<glm::vec4>(1), a * 2.0f);
+			}
+
+			// Strings and matrices always go to the heap
+			{
+				Datum s = "a"s;
+				Assert::IsFalse(s.IsInline());
+				Datum m = glm::mat4(1.0f);
+				Assert::IsFalse(m.IsInline());
+			}
+
+			// Copies and moves keep their own inline buffer
+			{
+				Datum d = { 1.0f, 2.0f };
+				Assert::IsTrue(d.IsInline());
+
+				Datum copy(d);
+				Assert::IsTrue(copy.IsInline());
+				Assert::IsTrue(&copy.Get<float>() != &d.Get<float>());
+				Assert::AreEqual(copy, d);
+
+				Datum moved(std::move(copy));
+				Assert::IsTrue(moved.IsInline());
+				Assert::AreEqual(moved, d);
+				Assert::AreEqual(copy.Size(), 0_z);
+				Assert::IsFalse(copy.IsInline());
+
+				Datum assigned = 5;
+				assigned = std::move(moved);
+				Assert::IsTrue(assigned.IsInline());
+				Assert::AreEqual(assigned.Get<float>(1), 2.0f);
+
+				assigned.PushBack(3.0f);
+				Assert::AreEqual(d.Size(), 2_z);
+			}
+
+			// External storage replaces the inline buffer
+			{
+				std::int32_t values[] = { 7, 8 };
+				Datum d = 1;
+				Assert::IsTrue(d.IsInline());
+				d.SetStorage(values, 2);
+				Assert::IsFalse(d.IsInline());
+				Assert::IsTrue(&d.Get<std::int32_t>() == values);
+
+				Datum copy(d);
+				Assert::IsFalse(copy.IsInline());
+				Assert::IsTrue(&copy.Get<std::int32_t>(1) == values + 1);
+			}
+
+			// Datums relocated by a growing container take their values along
+			{
+				Vector<Datum> datums;
+				for (std::int32_t i = 0; i < 32; ++i)
+				{
+					datums.PushBack(Datum(i));
+				}
+
+				for (std::int32_t i = 0; i < 32; ++i)
+				{
+					Assert::IsTrue(datums[i].IsInline());
+					Assert::AreEqual(datums[i].Get<std::int32_t>(), i);
+				}
+			}
+		}
+
+		TEST_METHOD(TestSpans)
+		{
+			// Float, writes through the span land in the datum
+			{
+				Datum d = { 3.0f, 1.0f, 2.0f };
+				Span<float> values = d.AsSpan<float>();
+				Assert::AreEqual(values.size(), 3_z);
+				Assert::AreEqual(std::accumulate(values.begin(), values.end(), 0.0f), 6.0f);
+
+				std::sort(values.begin(), values.end());
+				Assert::AreEqual(d.Get<float>(0), 1.0f);
+				Assert::AreEqual(d.Get<float>(2), 3.0f);
+
+				const Datum& constDatum = d;
+				Span<const float> constValues = constDatum.AsSpan<float>();
+				Assert::IsTrue(constValues.data() == d.AsConstSpan<float>().data());
+				Assert::AreEqual(constDatum.GetUnchecked<float>(1), 2.0f);
+
+				d.GetUnchecked<float>(1) = 5.0f;
+				Assert::AreEqual(d.Get<float>(1), 5.0f);
+
+				Assert::ExpectException<std::exception>([&d] { d.AsSpan<std::int32_t>(); });
+				Assert::ExpectException<std::exception>([&constDatum] { constDatum.AsConstSpan<glm::vec4>(); });
+			}
+
+			// Vector
+			{
+				Datum d;
+				d.Resize(100, glm::vec4(1.0f));
+				for (glm::vec4& position : d.AsSpan<glm::vec4>())
+				{
+					position += glm::vec4(0.0f, 1.0f, 0.0f, 0.0f);
+				}
+
+				for (size_t i = 0; i < d.Size(); ++i)
+				{
+					Assert::AreEqual(d.Get<glm::vec4>(i), glm::vec4(1.0f, 2.0f, 1.0f, 1.0f));
+				}
+			}
+
+			// Strings and pointers
+			{
+				Datum strings = { "a"s, "b"s };
+				Assert::IsTrue(strings.AsConstSpan<std::string>()[1] == "b"s);
+
+				Foo foo(1);
+				Datum pointers = &foo;
+				Assert::IsTrue(pointers.AsSpan<RTTI*>()[0] == &foo);
+			}
+
+			// External storage
+			{
+				std::int32_t values[] = { 1, 2, 3, 4, 5, 6 };
+				Datum d;
+				d.SetStorage(values, 6);
+				Span<std::int32_t> span = d.AsSpan<std::int32_t>();
+				Assert::IsTrue(span.data() == values);
+				Assert::AreEqual(span.size(), 6_z);
+			}
+
+			// Empty
+			{
+				Datum unknown;
+				Assert::IsTrue(unknown.AsSpan<std::int32_t>().empty());
+
+				Datum empty(Datum::DatumType::MATRIX);
+				Assert::IsTrue(empty.AsConstSpan<glm::mat4>().empty());
+			}
+		}
+
 		TEST_METHOD(TestSetType)
 		{
 			Datum d;
@@ -2152,8 +2468,10 @@ namespace UnitTestLibraryDesktop
 
 	private:
 		static _CrtMemState sStartMemState;
+		static size_t sStartSlabsInUse;
 
 	};
 
 	_CrtMemState DatumTest::sStartMemState;
+	size_t DatumTest::sStartSlabsInUse;
 }
\ No newline at end of file
@@ -0,0 +1,147 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include "DefaultHash.h"
+#include "vector.h"
+#include "Utility.h"
+#include "SlabAllocator.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(DefaultHashBenchmark)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+			sStartSlabsInUse = SlabAllocator<>::Statistics().InUse;
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+
+			// slab nodes are out of sight of the CRT heap, their pools keep their own count
+			if (SlabAllocator<>::Statistics().InUse != sStartSlabsInUse)
+			{
+				Assert::Fail(L"Slab Leaks!");
+			}
+		}
+
+		TEST_METHOD(IntegerKeys)
+		{
+			Vector<int> keys(sKeyCount);
+			for (int i = 0; i < static_cast<int>(sKeyCount); ++i)
+			{
+				keys.PushBack(i * 7919);
+			}
+
+			Logger::WriteMessage("DefaultHash vs previous functors, int keys (ns per key)\n");
+			Report("identity", 4, Measure(keys, [](int key) { return static_cast<size_t>(key); }));
+			Report("bytewise", 4, Measure(keys, [](int key) { return BytewiseHash(&key, sizeof(key)); }));
+			Report("DefaultHash", 4, Measure(keys, DefaultHash<int>()));
+		}
+
+		TEST_METHOD(StringKeys)
+		{
+			Logger::WriteMessage("DefaultHash vs previous functors, string keys (ns per key)\n");
+			for (size_t length : { 8_z, 32_z, 128_z, 1024_z })
+			{
+				Vector<std::string> keys(sKeyCount);
+				for (size_t i = 0; i < sKeyCount; ++i)
+				{
+					std::string key = std::to_string(i);
+					key.resize(length, 'x');
+					keys.PushBack(key);
+				}
+
+				Report("strlen djb2", length, Measure(keys, [](const std::string& key) { return Djb2Hash(key.c_str()); }));
+				Report("DefaultHash", length, Measure(keys, DefaultHash<std::string>()));
+			}
+		}
+
+	private:
+		/// <summary>
+		/// The generic hash before word at a time hashing: Partow's hash, one byte per step
+		/// </summary>
+		static size_t BytewiseHash(const void* data, size_t length)
+		{
+			std::uint32_t hash = 0xAAAAAAAA;
+			const std::uint8_t* bytes = static_cast<const std::uint8_t*>(data);
+			for (std::uint32_t i = 0; i < length; ++bytes, ++i)
+			{
+				hash ^= ((i & 1) == 0) ? ((hash << 7) ^ (*bytes) * (hash >> 3)) :
+					(~((hash << 11) + ((*bytes) ^ (hash >> 5))));
+			}
+
+			return static_cast<size_t>(hash);
+		}
+
+		/// <summary>
+		/// The string hash before word at a time hashing, length found with strlen
+		/// </summary>
+		static size_t Djb2Hash(const char* key)
+		{
+			std::uint32_t hash = 5381;
+			const size_t length = std::strlen(key);
+			for (size_t i = 0; i < length; ++i)
+			{
+				hash = ((hash << 5) + hash) + key[i];
+			}
+
+			return static_cast<size_t>(hash);
+		}
+
+		template <typename TKey, typename THash>
+		static double Measure(const Vector<TKey>& keys, THash hash)
+		{
+			// the hashes are folded together so the optimizer cannot drop any of them
+			size_t checksum = 0;
+			const auto start = std::chrono::high_resolution_clock::now();
+			for (size_t repetition = 0; repetition < sRepetitions; ++repetition)
+			{
+				for (const TKey& key : keys)
+				{
+					checksum += hash(key);
+				}
+			}
+			const auto end = std::chrono::high_resolution_clock::now();
+			Assert::AreNotEqual(0_z, checksum | 1);
+
+			return std::chrono::duration<double, std::nano>(end - start).count() / static_cast<double>(keys.Size() * sRepetitions);
+		}
+
+		static void Report(const char* name, size_t length, double nanoseconds)
+		{
+			char line[128];
+			sprintf_s(line, "  %-12s %5zu bytes  %8.2f ns  %8.2f GB/s\n", name, length, nanoseconds, static_cast<double>(length) / nanoseconds);
+			Logger::WriteMessage(line);
+		}
+
+		inline static const size_t sKeyCount = 4096;
+		inline static const size_t sRepetitions = 16;
+
+		static _CrtMemState sStartMemState;
+		static size_t sStartSlabsInUse;
+	};
+
+	_CrtMemState DefaultHashBenchmark::sStartMemState;
+	size_t DefaultHashBenchmark::sStartSlabsInUse;
+}
@@ -5,7 +5,12 @@
 #include "DefaultHashFooSpecialization.h"
 #include "ToStringSpecializations.h"
 #include "Foo.h"
+#include "SlabAllocator.h"
+#include <algorithm>
+#include <bitset>
 #include <string>
+#include <string_view>
+#include <vector>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace FieaGameEngine;
@@ -21,6 +26,7 @@ namespace UnitTestLibraryDesktop
 			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
 			_CrtMemCheckpoint(&sStartMemState);
 #endif
+			sStartSlabsInUse = SlabAllocator<>::Statistics().InUse;
 		}
 
 		TEST_METHOD_CLEANUP(Cleanup)
@@ -34,6 +40,12 @@ namespace UnitTestLibraryDesktop
 				Assert::Fail(L"Memory Leaks!");
 			}
 #endif
+
+			// slab nodes are out of sight of the CRT heap, their pools keep their own count
+			if (SlabAllocator<>::Statistics().InUse != sStartSlabsInUse)
+			{
+				Assert::Fail(L"Slab Leaks!");
+			}
 		}
 
 		TEST_METHOD(TestDefault) 
@@ -89,6 +101,20 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual(map[name3], Foo(3));
 		}
 
+		TEST_METHOD(TestStringView)
+		{
+			DefaultHash<std::string> hash;
+			const std::string name = "Camilo";
+			Assert::AreEqual(hash(name), hash(std::string_view(name)));
+			Assert::AreEqual(hash(name), hash("Camilo"));
+			Assert::AreEqual(hash(name), hash(std::string_view("Camilo Erika", 6)));
+
+			DefaultComparator<std::string> comparator;
+			Assert::IsTrue(comparator(std::string_view("Camilo Erika", 6), name));
+			Assert::IsTrue(comparator("Camilo", name));
+			Assert::IsFalse(comparator(std::string_view("Camilo Erika", 7), name));
+		}
+
 		TEST_METHOD(TestInt)
 		{
 			HashMap<int, Foo> map;
@@ -106,10 +132,105 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual(map[otherOne], Foo(3));
 		}
 
+		TEST_METHOD(TestAvalanchingTrait)
+		{
+			Assert::IsTrue(IsAvalanchingHash<DefaultHash<int>>::value);
+			Assert::IsTrue(IsAvalanchingHash<DefaultHash<float>>::value);
+			Assert::IsTrue(IsAvalanchingHash<DefaultHash<std::string>>::value);
+			Assert::IsTrue(IsAvalanchingHash<DefaultHash<const char*>>::value);
+			Assert::IsFalse(IsAvalanchingHash<DefaultHash<Foo>>::value);
+		}
+
+		TEST_METHOD(TestIntegerAvalanche)
+		{
+			// flipping any input bit should flip about half of the output bits
+			DefaultHash<std::uint64_t> hash;
+			for (std::uint64_t key = 0; key < 64; ++key)
+			{
+				size_t flipped = 0;
+				for (size_t bit = 0; bit < 64; ++bit)
+				{
+					flipped += std::bitset<64>(hash(key) ^ hash(key ^ (1ULL << bit))).count();
+				}
+
+				const double average = static_cast<double>(flipped) / 64;
+				Assert::IsTrue(average > 24.0 && average < 40.0);
+			}
+		}
+
+		TEST_METHOD(TestIntegerDistribution)
+		{
+			// sequential and strided keys must spread evenly over the low bits alone
+			for (int stride : { 1, 16, 1024 })
+			{
+				Assert::IsTrue(MaxBucketLoad(DefaultHash<int>(), [stride](int i) { return i * stride; }) <= sMaxLoad);
+			}
+		}
+
+		TEST_METHOD(TestStringDistribution)
+		{
+			Vector<std::string> keys(sKeyCount);
+			for (size_t i = 0; i < sKeyCount; ++i)
+			{
+				keys.PushBack("attribute" + std::to_string(i));
+			}
+			Assert::IsTrue(MaxBucketLoad(DefaultHash<std::string>(), [&keys](int i) -> const std::string& { return keys[static_cast<size_t>(i)]; }) <= sMaxLoad);
+
+			std::vector<size_t> hashes;
+			DefaultHash<std::string> hash;
+			for (const std::string& key : keys)
+			{
+				hashes.push_back(hash(key));
+			}
+			std::sort(hashes.begin(), hashes.end());
+			Assert::IsTrue(std::adjacent_find(hashes.begin(), hashes.end()) == hashes.end());
+		}
+
+		TEST_METHOD(TestBytes)
+		{
+			// the length takes part in the hash, so zero padding never collides
+			const char zeros[16] = {};
+			std::vector<size_t> hashes;
+			for (size_t length = 0; length <= sizeof(zeros); ++length)
+			{
+				hashes.push_back(static_cast<size_t>(HashBytes(zeros, length)));
+			}
+			std::sort(hashes.begin(), hashes.end());
+			Assert::IsTrue(std::adjacent_find(hashes.begin(), hashes.end()) == hashes.end());
+
+			// every byte of a word counts, including the ones past the first word
+			const std::string text = "0123456789abcdefXYZ";
+			for (size_t i = 0; i < text.size(); ++i)
+			{
+				std::string changed = text;
+				changed[i] = '_';
+				Assert::AreNotEqual(HashBytes(text.data(), text.size()), HashBytes(changed.data(), changed.size()));
+			}
+		}
+
 	private:
+		template <typename THash, typename TKeyAt>
+		static size_t MaxBucketLoad(const THash& hash, TKeyAt keyAt)
+		{
+			std::vector<size_t> buckets(sBucketCount);
+			for (int i = 0; i < static_cast<int>(sKeyCount); ++i)
+			{
+				++buckets[hash(keyAt(i)) & (sBucketCount - 1)];
+			}
+
+			return *std::max_element(buckets.begin(), buckets.end());
+		}
+
+		inline static const size_t sBucketCount = 1024;
+		inline static const size_t sKeyCount = sBucketCount * 8;
+		// a fair spread of 8 keys per bucket stays well under twice that
+		inline static const size_t sMaxLoad = 24;
+
 		static _CrtMemState sStartMemState;
+		static size_t sStartSlabsInUse;
 
 	};
 
 	_CrtMemState DefaultHashTest::sStartMemState;
+	size_t DefaultHashTest::sStartSlabsInUse;
 }
\ No newline at end of file
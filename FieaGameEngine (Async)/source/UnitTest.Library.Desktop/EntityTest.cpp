@@ -17,6 +17,7 @@
 #include "GameTime.h"
 #include "ToStringSpecializations.h"
 #include "Utility.h"
+#include "SlabAllocator.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace std::literals::string_literals;
@@ -33,6 +34,7 @@ namespace UnitTestLibraryDesktop
 			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
 			_CrtMemCheckpoint(&sStartMemState);
 #endif
+			sStartSlabsInUse = SlabAllocator<>::Statistics().InUse;
 		}
 
 		TEST_METHOD_CLEANUP(Cleanup)
@@ -46,6 +48,12 @@ namespace UnitTestLibraryDesktop
 				Assert::Fail(L"Memory Leaks!");
 			}
 #endif
+
+			// slab nodes are out of sight of the CRT heap, their pools keep their own count
+			if (SlabAllocator<>::Statistics().InUse != sStartSlabsInUse)
+			{
+				Assert::Fail(L"Slab Leaks!");
+			}
 		}
 
 		TEST_METHOD(TestConstructor)
@@ -199,7 +207,9 @@ namespace UnitTestLibraryDesktop
 
 	private:
 		static _CrtMemState sStartMemState;
+		static size_t sStartSlabsInUse;
 	};
 
 	_CrtMemState EntityTest::sStartMemState;
+	size_t EntityTest::sStartSlabsInUse;
 }
@@ -4,6 +4,7 @@
 #include "Foo.h"
 #include "ToStringSpecializations.h"
 #include "Utility.h"
+#include "SlabAllocator.h"
 #include <string>
 #include <tuple>
 
@@ -22,6 +23,7 @@ namespace UnitTestLibraryDesktop
 			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
 			_CrtMemCheckpoint(&sStartMemState);
 #endif
+			sStartSlabsInUse = SlabAllocator<>::Statistics().InUse;
 		}
 
 		TEST_METHOD_CLEANUP(Cleanup)
@@ -35,6 +37,12 @@ namespace UnitTestLibraryDesktop
 				Assert::Fail(L"Memory Leaks!");
 			}
 #endif
+
+			// slab nodes are out of sight of the CRT heap, their pools keep their own count
+			if (SlabAllocator<>::Statistics().InUse != sStartSlabsInUse)
+			{
+				Assert::Fail(L"Slab Leaks!");
+			}
 		}
 
 		TEST_METHOD(TestFind)
@@ -77,6 +85,29 @@ namespace UnitTestLibraryDesktop
 			Assert::IsNull(Factory<RTTI>::Find("Foo"s));
 		}
 
+		TEST_METHOD(TestFreeze)
+		{
+			Factory<RTTI>::Freeze();
+			Assert::IsFalse(Factory<RTTI>::IsFrozen());
+
+			{
+				FooFactory ff;
+				Factory<RTTI>::Freeze();
+				Assert::IsTrue(Factory<RTTI>::IsFrozen());
+				Assert::IsTrue(Factory<RTTI>::Find("Foo"s) == &ff);
+				Assert::IsNull(Factory<RTTI>::Find("Bar"s));
+
+				RTTI* ptr = Factory<RTTI>::Create("Foo"s);
+				Assert::IsNotNull(ptr);
+				Assert::IsTrue(ptr->Is("Foo"s));
+				delete ptr;
+			}
+
+			// removing a factory thaws the registry
+			Assert::IsFalse(Factory<RTTI>::IsFrozen());
+			Assert::IsNull(Factory<RTTI>::Find("Foo"s));
+		}
+
 		TEST_METHOD(TestClassName)
 		{
 			FooFactory ff;
@@ -85,7 +116,9 @@ namespace UnitTestLibraryDesktop
 
 	private:
 		static _CrtMemState sStartMemState;
+		static size_t sStartSlabsInUse;
 	};
 
 	_CrtMemState FactoryTest::sStartMemState;
+	size_t FactoryTest::sStartSlabsInUse;
 }
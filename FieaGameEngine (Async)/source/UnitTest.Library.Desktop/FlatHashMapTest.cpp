@@ -0,0 +1,488 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "DefaultHashFooSpecialization.h"
+#include "FlatHashMap.h"
+#include "Foo.h"
+#include "ToStringSpecializations.h"
+#include "Utility.h"
+#include "SlabAllocator.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std::literals::string_literals;
+using namespace std::literals::string_view_literals;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(FlatHashMapTest)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+			sStartSlabsInUse = SlabAllocator<>::Statistics().InUse;
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+
+			// slab nodes are out of sight of the CRT heap, their pools keep their own count
+			if (SlabAllocator<>::Statistics().InUse != sStartSlabsInUse)
+			{
+				Assert::Fail(L"Slab Leaks!");
+			}
+		}
+
+		TEST_METHOD(TestConstructor)
+		{
+			FlatHashMap<std::string, Foo> map;
+			Assert::AreEqual(map.Size(), 0_z);
+			Assert::AreEqual(map.BucketCount(), HashGroup::Width);
+
+			FlatHashMap<std::string, Foo> map2(100_z);
+			Assert::AreEqual(map2.Size(), 0_z);
+			Assert::AreEqual(map2.BucketCount(), 128_z);
+
+			FlatHashMap<std::string, Foo> map3(1_z);
+			Assert::AreEqual(map3.BucketCount(), HashGroup::Width);
+		}
+
+		TEST_METHOD(TestCopyConstructor)
+		{
+			FlatHashMap<std::string, Foo> map = { { "1", Foo(1) }, { "2", Foo(2) }, { "3", Foo(3) } };
+			map.Remove("2");
+			FlatHashMap<std::string, Foo> map2(map);
+			Assert::AreEqual(map2.Size(), 2_z);
+			Assert::AreEqual(map2.At("1"), Foo(1));
+			Assert::AreEqual(map2.At("3"), Foo(3));
+			Assert::IsFalse(map2.ContainsKey("2"));
+
+			map2["1"] = Foo(100);
+			Assert::AreEqual(map.At("1"), Foo(1));
+		}
+
+		TEST_METHOD(TestMoveConstructor)
+		{
+			FlatHashMap<std::string, Foo> map = { { "1", Foo(1) }, { "2", Foo(2) }, { "3", Foo(3) } };
+			Assert::AreEqual(map.Size(), 3_z);
+			FlatHashMap<std::string, Foo> map2(std::move(map));
+			Assert::AreEqual(map.Size(), 0_z);
+			Assert::AreEqual(map2.Size(), 3_z);
+
+			Assert::IsFalse(map.ContainsKey("1"));
+			map["4"] = Foo(4);
+			Assert::AreEqual(map.At("4"), Foo(4));
+		}
+
+		TEST_METHOD(TestInitializerListConstructor)
+		{
+			FlatHashMap<std::string, Foo> map = { { "1", Foo(1) }, { "2", Foo(2) }, { "3", Foo(3) } };
+			Assert::IsTrue(map.ContainsKey("1"));
+			Assert::IsTrue(map.ContainsKey("2"));
+			Assert::IsTrue(map.ContainsKey("3"));
+			Assert::IsFalse(map.ContainsKey("4"));
+		}
+
+		TEST_METHOD(TestCopyAssignment)
+		{
+			FlatHashMap<std::string, Foo> map1 = { { "1", Foo(1) }, { "2", Foo(2) }, { "3", Foo(3) } };
+			FlatHashMap<std::string, Foo> map2 = { { "55", Foo(33) } };
+			map2 = map1;
+			Assert::AreEqual(map1.Size(), 3_z);
+			Assert::AreEqual(map2.Size(), 3_z);
+			Assert::IsFalse(map2.ContainsKey("55"));
+			Assert::AreEqual(map2.At("2"), Foo(2));
+		}
+
+		TEST_METHOD(TestMoveAssignment)
+		{
+			FlatHashMap<std::string, Foo> map1 = { { "1", Foo(1) }, { "2", Foo(2) }, { "3", Foo(3) } };
+			Assert::AreEqual(map1.Size(), 3_z);
+			FlatHashMap<std::string, Foo> map2 = { { "55", Foo(33) } };
+			Assert::AreEqual(map2.Size(), 1_z);
+			map2 = std::move(map1);
+			Assert::AreEqual(map1.Size(), 0_z);
+			Assert::AreEqual(map2.Size(), 3_z);
+		}
+
+		TEST_METHOD(TestInitializerListAssignmentOperator)
+		{
+			FlatHashMap<std::string, Foo> map1 = { { "1", Foo(1) }, { "2", Foo(2) }, { "3", Foo(3) } };
+			FlatHashMap<std::string, Foo> map2 = { { "55", Foo(55) } };
+			Assert::AreEqual(map2.Size(), 1_z);
+			map2 = { { "1", Foo(1) }, { "2", Foo(2) }, { "3", Foo(3) } };
+			Assert::AreEqual(map2.Size(), 3_z);
+			Assert::AreEqual(map1["1"], map2["1"]);
+			map2["1"] = Foo(100);
+			Assert::AreNotEqual(map1["1"], map2["1"]);
+		}
+
+		TEST_METHOD(TestIndexOperator)
+		{
+			Foo foo1(1);
+			FlatHashMap<Foo, Foo> map = { { Foo(1), Foo(1) }, { Foo(2), Foo(2) }, { Foo(3), Foo(3) } };
+			Assert::AreEqual(map[foo1], Foo(1));
+			map[Foo(1)] = Foo(55);
+			Assert::AreEqual(map[Foo(1)], Foo(55));
+			map[Foo(4)] = Foo(4);
+			Assert::AreEqual(map[Foo(4)], Foo(4));
+			map[Foo(5)];
+			Assert::AreEqual(map[Foo(5)], Foo());
+		}
+
+		TEST_METHOD(TestAt)
+		{
+			FlatHashMap<Foo, Foo> map = { { Foo(1), Foo(1) }, { Foo(2), Foo(2) }, { Foo(3), Foo(3) } };
+			Assert::AreEqual(map.At(Foo(1)), Foo(1));
+			map.At(Foo(1)) = Foo(55);
+			Assert::AreEqual(map.At(Foo(1)), Foo(55));
+			const auto expression = [&map] { map.At(Foo(4)); };
+			Assert::ExpectException<std::exception>(expression);
+
+			const auto constMap = map;
+			Assert::AreEqual(constMap.At(Foo(1)), Foo(55));
+			const auto exp = [&constMap] { constMap.At(Foo(4)); };
+			Assert::ExpectException<std::exception>(exp);
+		}
+
+		TEST_METHOD(TestInsert)
+		{
+			FlatHashMap<Foo, Foo> map;
+			const int foos = 100;
+			for (int i = 0; i < foos; ++i)
+			{
+				auto[it, inserted] = map.Insert(std::pair(Foo(i), Foo(i)));
+				Assert::IsTrue(inserted);
+				Assert::AreEqual(it->second, Foo(i));
+				Assert::AreEqual(map[Foo(i)], Foo(i));
+			}
+			Assert::AreEqual(map.Size(), static_cast<size_t>(foos));
+			Assert::IsTrue(map.LoadFactor() <= map.MaxLoadFactor());
+
+			for (int i = 0; i < foos; ++i)
+			{
+				std::pair<Foo, Foo> pair = { Foo(i), Foo(i + 1) };
+				auto[it, inserted] = map.Insert(pair);
+				Assert::IsFalse(inserted);
+				Assert::AreEqual(it->second, Foo(i));
+			}
+			Assert::AreEqual(map.Size(), static_cast<size_t>(foos));
+		}
+
+		TEST_METHOD(TestEmplace)
+		{
+			FlatHashMap<std::string, Foo> map;
+			auto[it, inserted] = map.Emplace("1", Foo(1));
+			Assert::IsTrue(inserted);
+			Assert::AreEqual(it->first, std::string("1"));
+			Assert::AreEqual(it->second, Foo(1));
+
+			auto[it2, inserted2] = map.Emplace("1", Foo(2));
+			Assert::IsFalse(inserted2);
+			Assert::IsTrue(it == it2);
+			Assert::AreEqual(map.Size(), 1_z);
+		}
+
+		TEST_METHOD(TestFind)
+		{
+			FlatHashMap<Foo, Foo> map = { { Foo(1), Foo(1) }, { Foo(2), Foo(2) }, { Foo(3), Foo(3) } };
+			Assert::AreEqual(map.Find(Foo(1))->second, Foo(1));
+			Assert::AreEqual(map.Find(Foo(2))->second, Foo(2));
+			Assert::AreEqual(map.Find(Foo(3))->second, Foo(3));
+			Assert::AreEqual(map.Find(Foo(4)), map.end());
+
+			const FlatHashMap<Foo, Foo> constMap = map;
+			Assert::AreEqual(constMap.Find(Foo(1))->second, Foo(1));
+			Assert::AreEqual(constMap.Find(Foo(2))->second, Foo(2));
+			Assert::AreEqual(constMap.Find(Foo(3))->second, Foo(3));
+			Assert::AreEqual(constMap.Find(Foo(4)), constMap.end());
+		}
+
+		TEST_METHOD(TestHeterogeneousLookup)
+		{
+			FlatHashMap<std::string, Foo> map = { { "name"s, Foo(1) }, { "health"s, Foo(2) } };
+			Assert::AreEqual(map.Find("name"sv)->second, Foo(1));
+			Assert::AreEqual(map.Find("health")->second, Foo(2));
+			Assert::IsTrue(map.Find("armor"sv) == map.end());
+
+			Assert::IsTrue(map.ContainsKey("name"sv));
+			Assert::IsFalse(map.ContainsKey("armor"));
+			FlatHashMap<std::string, Foo>::Iterator it;
+			Assert::IsTrue(map.ContainsKey("health"sv, it));
+			Assert::AreEqual(it->second, Foo(2));
+
+			map.At("name"sv) = Foo(3);
+			Assert::AreEqual(map.At("name"s), Foo(3));
+			const auto expression = [&map] { map.At("armor"sv); };
+			Assert::ExpectException<std::exception>(expression);
+
+			// a view into a longer buffer only matches its own characters
+			const std::string buffer = "namespace";
+			Assert::IsTrue(map.ContainsKey(std::string_view(buffer.c_str(), 4)));
+			Assert::IsFalse(map.ContainsKey(std::string_view(buffer.c_str(), 5)));
+
+			const auto constMap = map;
+			Assert::AreEqual(constMap.Find("health"sv)->second, Foo(2));
+			Assert::IsTrue(constMap.Find("armor"sv) == constMap.end());
+			Assert::AreEqual(constMap.At("name"), Foo(3));
+			FlatHashMap<std::string, Foo>::ConstIterator constIt;
+			Assert::IsTrue(constMap.ContainsKey("name"sv, constIt));
+			Assert::AreEqual(constIt->second, Foo(3));
+		}
+
+		TEST_METHOD(TestRemove)
+		{
+			FlatHashMap<Foo, Foo> map = { { Foo(1), Foo(1) }, { Foo(2), Foo(2) }, { Foo(3), Foo(3) } };
+			Assert::AreEqual(map.Size(), 3_z);
+			Assert::IsTrue(map.Remove(Foo(2)));
+			Assert::IsFalse(map.Remove(Foo(2)));
+			Assert::AreEqual(map.Size(), 2_z);
+			Assert::IsTrue(map.Remove(map.Find(Foo(3))));
+			Assert::IsFalse(map.Remove(map.Find(Foo(3))));
+			Assert::AreEqual(map.Size(), 1_z);
+			Assert::IsTrue(map.Remove(Foo(1)));
+			Assert::IsFalse(map.Remove(Foo(1)));
+			Assert::AreEqual(map.Size(), 0_z);
+
+			map = { { Foo(0), Foo(0) }, { Foo(1), Foo(1) }, { Foo(2), Foo(2) }, { Foo(3), Foo(3) }, { Foo(4), Foo(4) }, { Foo(5), Foo(5) } };
+			Assert::AreEqual(map.Size(), 6_z);
+			auto middle = map.begin();
+			for (size_t i = 0; i < 3; ++i)
+			{
+				++middle;
+			}
+			map.Remove(middle, map.end());
+			Assert::AreEqual(map.Size(), 3_z);
+			map.Remove(map.begin(), ++map.begin());
+			Assert::AreEqual(map.Size(), 2_z);
+			map.Remove(map.begin(), map.end());
+			Assert::AreEqual(map.Size(), 0_z);
+			Assert::AreEqual(map.begin(), map.end());
+
+			map = { { Foo(0), Foo(0) }, { Foo(1), Foo(1) }, { Foo(2), Foo(2) }, { Foo(3), Foo(3) }, { Foo(4), Foo(4) }, { Foo(5), Foo(5) } };
+			const auto exp = [&map] { map.Remove(FlatHashMap<Foo, Foo>::Iterator(), map.begin()); };
+			Assert::ExpectException<std::exception>(exp);
+			const auto exp2 = [&map] { map.Remove(map.end(), map.begin()); };
+			Assert::ExpectException<std::exception>(exp2);
+		}
+
+		TEST_METHOD(TestInsertRemoveChurn)
+		{
+			// keeps a map at a steady size while cycling keys through it, so probing has to cope with deleted slots
+			FlatHashMap<Foo, Foo> map;
+			const int window = 12;
+			for (int i = 0; i < 2000; ++i)
+			{
+				map[Foo(i)] = Foo(i);
+				if (i >= window)
+				{
+					Assert::IsTrue(map.Remove(Foo(i - window)));
+				}
+
+				Assert::IsTrue(map.Size() <= static_cast<size_t>(window + 1));
+			}
+
+			Assert::AreEqual(map.BucketCount(), HashGroup::Width);
+			for (int i = 2000 - window; i < 2000; ++i)
+			{
+				Assert::AreEqual(map.At(Foo(i)), Foo(i));
+			}
+			Assert::IsFalse(map.ContainsKey(Foo(0)));
+		}
+
+		TEST_METHOD(TestReserve)
+		{
+			FlatHashMap<Foo, Foo> map = { { Foo(0), Foo(0) }, { Foo(1), Foo(1) }, { Foo(2), Foo(2) }, { Foo(3), Foo(3) }, { Foo(4), Foo(4) }, { Foo(5), Foo(5) } };
+			Assert::AreEqual(map.Size(), 6_z);
+			Assert::IsTrue(map.ContainsKey(Foo(2)));
+			map.Reserve(100);
+			Assert::AreEqual(map.BucketCount(), 128_z);
+			Assert::AreEqual(map.Size(), 6_z);
+			Assert::IsTrue(map.ContainsKey(Foo(2)));
+
+			const size_t bucketCount = map.BucketCount();
+			for (int i = 6; i < 100; ++i)
+			{
+				map[Foo(i)] = Foo(i);
+			}
+			Assert::AreEqual(map.BucketCount(), bucketCount);
+
+			// a smaller reservation keeps the slots
+			map.Reserve(10);
+			Assert::AreEqual(map.BucketCount(), bucketCount);
+			map.Reserve(0);
+			Assert::AreEqual(map.BucketCount(), bucketCount);
+			Assert::AreEqual(map.Size(), 100_z);
+		}
+
+		TEST_METHOD(TestRehash)
+		{
+			FlatHashMap<Foo, Foo> map = { { Foo(0), Foo(0) }, { Foo(1), Foo(1) }, { Foo(2), Foo(2) }, { Foo(3), Foo(3) }, { Foo(4), Foo(4) }, { Foo(5), Foo(5) } };
+			Assert::AreEqual(map.Size(), 6_z);
+			Assert::IsTrue(map.ContainsKey(Foo(2)));
+			map.Rehash(100);
+			Assert::AreEqual(map.BucketCount(), 128_z);
+			Assert::AreEqual(map.Size(), 6_z);
+			Assert::IsTrue(map.ContainsKey(Foo(2)));
+			map.Rehash(3);
+			Assert::AreEqual(map.BucketCount(), HashGroup::Width);
+			Assert::AreEqual(map.Size(), 6_z);
+			Assert::IsTrue(map.ContainsKey(Foo(2)));
+
+			for (int i = 6; i < 100; ++i)
+			{
+				map[Foo(i)] = Foo(i);
+			}
+			map.Rehash(3);
+			Assert::AreEqual(map.BucketCount(), 128_z);
+			for (int i = 0; i < 100; ++i)
+			{
+				Assert::AreEqual(map.At(Foo(i)), Foo(i));
+			}
+		}
+
+		TEST_METHOD(TestContainsKey)
+		{
+			FlatHashMap<Foo, Foo> map = { { Foo(0), Foo(0) }, { Foo(1), Foo(1) }, { Foo(2), Foo(2) }, { Foo(3), Foo(3) }, { Foo(4), Foo(4) }, { Foo(5), Foo(5) } };
+			Assert::IsTrue(map.ContainsKey(Foo(2)));
+			Assert::IsFalse(map.ContainsKey(Foo(10)));
+
+			FlatHashMap<Foo, Foo>::Iterator it;
+			Assert::IsTrue(map.ContainsKey(Foo(2), it));
+			Assert::AreEqual(it->first, Foo(2));
+			Assert::IsFalse(map.ContainsKey(Foo(10), it));
+			Assert::AreEqual(it, map.end());
+
+			const auto constMap = map;
+			FlatHashMap<Foo, Foo>::ConstIterator constIt;
+			Assert::IsTrue(constMap.ContainsKey(Foo(2), constIt));
+			Assert::AreEqual(constIt->first, Foo(2));
+		}
+
+		TEST_METHOD(TestClear)
+		{
+			FlatHashMap<Foo, Foo> map = { { Foo(0), Foo(0) }, { Foo(1), Foo(1) }, { Foo(2), Foo(2) }, { Foo(3), Foo(3) }, { Foo(4), Foo(4) }, { Foo(5), Foo(5) } };
+			Assert::AreEqual(map.Size(), 6_z);
+			Assert::IsTrue(map.ContainsKey(Foo(0)));
+			const size_t bucketCount = map.BucketCount();
+			map.Clear();
+			Assert::AreEqual(map.Size(), 0_z);
+			Assert::AreEqual(map.BucketCount(), bucketCount);
+			Assert::IsFalse(map.ContainsKey(Foo(0)));
+			Assert::AreEqual(map.begin(), map.end());
+		}
+
+		TEST_METHOD(TestIterators)
+		{
+			FlatHashMap<Foo, Foo> map = { { Foo(0), Foo(0) }, { Foo(1), Foo(1) }, { Foo(2), Foo(2) }, { Foo(3), Foo(3) }, { Foo(4), Foo(4) }, { Foo(5), Foo(5) } };
+			int sum = 0;
+			size_t count = 0;
+			for (auto& pair : map)
+			{
+				Assert::AreEqual(pair.first, pair.second);
+				sum += pair.first.Data();
+				++count;
+			}
+			Assert::AreEqual(count, map.Size());
+			Assert::AreEqual(sum, 15);
+
+			const auto expression = [&map] { map.end()->first; };
+			Assert::ExpectException<std::exception>(expression);
+			const auto expression2 = [&map] { map.cend()->first; };
+			Assert::ExpectException<std::exception>(expression2);
+			Assert::IsTrue(map.begin() < map.end());
+			Assert::IsTrue(map.end() > map.begin());
+			Assert::AreEqual(FlatHashMap<Foo, Foo>::ConstIterator(map.begin()), map.cbegin());
+
+			const auto map2 = map;
+			Assert::AreEqual(map2.begin()->first, map.begin()->first);
+			const auto expression3 = [&map2] { map2.end()->first; };
+			Assert::ExpectException<std::exception>(expression3);
+
+			FlatHashMap<Foo, Foo>::Iterator unassociated;
+			const auto expression4 = [&unassociated] { ++unassociated; };
+			Assert::ExpectException<std::exception>(expression4);
+			const auto expression5 = [&map] { map.begin() < FlatHashMap<Foo, Foo>::Iterator(); };
+			Assert::ExpectException<std::exception>(expression5);
+
+			map.Clear();
+			const auto exp = [&map] { map.begin()->first; };
+			Assert::ExpectException<std::exception>(exp);
+			const auto exp2 = [&map] { map.cbegin()->first; };
+			Assert::ExpectException<std::exception>(exp2);
+		}
+
+		TEST_METHOD(TestLoadFactor)
+		{
+			FlatHashMap<Foo, Foo> map;
+			Assert::AreEqual(map.MaxLoadFactor(), 0.875f);
+			Assert::AreEqual(map.LoadFactor(), 0.0f);
+			map[Foo(1)] = Foo(1);
+			Assert::AreEqual(map.LoadFactor(), 1.0f / static_cast<float>(HashGroup::Width));
+
+			const int half = static_cast<int>(HashGroup::Width / 2);
+			for (int i = 2; i <= half; ++i)
+			{
+				map[Foo(i)] = Foo(i);
+			}
+			map.MaxLoadFactor(0.5f);
+			Assert::AreEqual(map.MaxLoadFactor(), 0.5f);
+			Assert::AreEqual(map.BucketCount(), HashGroup::Width);
+			map[Foo(half + 1)] = Foo(half + 1);
+			Assert::AreEqual(map.BucketCount(), HashGroup::Width * 2);
+
+			const auto expression = [&map] { map.MaxLoadFactor(0.0f); };
+			Assert::ExpectException<std::invalid_argument>(expression);
+			const auto expression2 = [&map] { map.MaxLoadFactor(1.0f); };
+			Assert::ExpectException<std::invalid_argument>(expression2);
+		}
+
+	private:
+		static _CrtMemState sStartMemState;
+		static size_t sStartSlabsInUse;
+	};
+
+	_CrtMemState FlatHashMapTest::sStartMemState;
+	size_t FlatHashMapTest::sStartSlabsInUse;
+}
+
+namespace Microsoft::VisualStudio::CppUnitTestFramework
+{
+	template <>
+	inline std::wstring ToString<FieaGameEngine::FlatHashMap<UnitTestLibraryDesktop::Foo, UnitTestLibraryDesktop::Foo>::Iterator>(const FieaGameEngine::FlatHashMap<UnitTestLibraryDesktop::Foo, UnitTestLibraryDesktop::Foo>::Iterator& t)
+	{
+		try
+		{
+			RETURN_WIDE_STRING(t->first.Data());
+		}
+		catch (std::exception)
+		{
+			RETURN_WIDE_STRING("Invalid iterator");
+		}
+	}
+
+	template <>
+	inline std::wstring ToString<FieaGameEngine::FlatHashMap<UnitTestLibraryDesktop::Foo, UnitTestLibraryDesktop::Foo>::ConstIterator>(const FieaGameEngine::FlatHashMap<UnitTestLibraryDesktop::Foo, UnitTestLibraryDesktop::Foo>::ConstIterator& t)
+	{
+		try
+		{
+			RETURN_WIDE_STRING(t->first.Data());
+		}
+		catch (std::exception)
+		{
+			RETURN_WIDE_STRING("Invalid iterator");
+		}
+	}
+}
@@ -0,0 +1,309 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "DefaultHashFooSpecialization.h"
+#include "FrozenHashMap.h"
+#include "FlatHashMap.h"
+#include "HashMap.h"
+#include "Foo.h"
+#include "ToStringSpecializations.h"
+#include "Utility.h"
+#include "SlabAllocator.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std::literals::string_literals;
+using namespace std::literals::string_view_literals;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(FrozenHashMapTest)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+			sStartSlabsInUse = SlabAllocator<>::Statistics().InUse;
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+
+			// slab nodes are out of sight of the CRT heap, their pools keep their own count
+			if (SlabAllocator<>::Statistics().InUse != sStartSlabsInUse)
+			{
+				Assert::Fail(L"Slab Leaks!");
+			}
+		}
+
+		TEST_METHOD(TestConstructor)
+		{
+			const FrozenHashMap<std::string, Foo> map;
+			Assert::AreEqual(map.Size(), 0_z);
+			Assert::IsTrue(map.IsEmpty());
+			Assert::AreEqual(map.BucketCount(), 0_z);
+			Assert::IsFalse(map.ContainsKey("1"s));
+			Assert::IsTrue(map.Find("1"s) == map.end());
+			Assert::IsTrue(map.begin() == map.end());
+			Assert::ExpectException<std::exception>([&map] { map.At("1"s); });
+		}
+
+		TEST_METHOD(TestInitializerListConstructor)
+		{
+			const FrozenHashMap<std::string, Foo> map = { { "1", Foo(1) }, { "2", Foo(2) }, { "3", Foo(3) } };
+			Assert::AreEqual(map.Size(), 3_z);
+			Assert::IsFalse(map.IsEmpty());
+			Assert::AreEqual(map.At("1"s), Foo(1));
+			Assert::AreEqual(map.At("2"s), Foo(2));
+			Assert::AreEqual(map.At("3"s), Foo(3));
+			Assert::IsFalse(map.ContainsKey("4"s));
+
+			Assert::ExpectException<std::exception>([] { FrozenHashMap<std::string, Foo> duplicates = { { "1", Foo(1) }, { "1", Foo(2) } }; });
+		}
+
+		TEST_METHOD(TestRangeConstructor)
+		{
+			FlatHashMap<std::string, Foo> flat = { { "1", Foo(1) }, { "2", Foo(2) }, { "3", Foo(3) } };
+			const FrozenHashMap<std::string, Foo> map(flat.begin(), flat.end());
+			Assert::AreEqual(map.Size(), flat.Size());
+			for (const auto& [key, value] : flat)
+			{
+				Assert::AreEqual(map.At(key), value);
+			}
+
+			HashMap<int, int> hash;
+			for (int i = 0; i < 100; ++i)
+			{
+				hash.Insert({ i, i * 2 });
+			}
+
+			const FrozenHashMap<int, int> map2(hash.begin(), hash.end());
+			Assert::AreEqual(map2.Size(), 100_z);
+			for (int i = 0; i < 100; ++i)
+			{
+				Assert::AreEqual(map2.At(i), i * 2);
+			}
+		}
+
+		TEST_METHOD(TestCopyAndMove)
+		{
+			FrozenHashMap<std::string, Foo> map = { { "1", Foo(1) }, { "2", Foo(2) } };
+			FrozenHashMap<std::string, Foo> copy(map);
+			Assert::AreEqual(copy.Size(), 2_z);
+			Assert::AreEqual(copy.At("2"s), Foo(2));
+
+			copy.At("1"s) = Foo(100);
+			Assert::AreEqual(map.At("1"s), Foo(1));
+
+			FrozenHashMap<std::string, Foo> moved(std::move(copy));
+			Assert::AreEqual(moved.Size(), 2_z);
+			Assert::AreEqual(moved.At("1"s), Foo(100));
+
+			map = moved;
+			Assert::AreEqual(map.At("1"s), Foo(100));
+
+			moved = FrozenHashMap<std::string, Foo>{ { "3", Foo(3) } };
+			Assert::AreEqual(moved.Size(), 1_z);
+			Assert::AreEqual(moved.At("3"s), Foo(3));
+			Assert::IsFalse(moved.ContainsKey("1"s));
+		}
+
+		TEST_METHOD(TestAt)
+		{
+			FrozenHashMap<std::string, Foo> map = { { "1", Foo(1) }, { "2", Foo(2) } };
+			map.At("1"s) = Foo(10);
+			Assert::AreEqual(map.At("1"s), Foo(10));
+			Assert::ExpectException<std::exception>([&map] { map.At("3"s); });
+
+			const FrozenHashMap<std::string, Foo>& constMap = map;
+			Assert::AreEqual(constMap.At("2"s), Foo(2));
+			Assert::ExpectException<std::exception>([&constMap] { constMap.At("3"s); });
+		}
+
+		TEST_METHOD(TestFind)
+		{
+			FrozenHashMap<std::string, Foo> map = { { "1", Foo(1) }, { "2", Foo(2) } };
+			auto it = map.Find("2"s);
+			Assert::IsTrue(it != map.end());
+			Assert::AreEqual(it->first, "2"s);
+			it->second = Foo(20);
+			Assert::AreEqual(map.At("2"s), Foo(20));
+			Assert::IsTrue(map.Find("3"s) == map.end());
+
+			const FrozenHashMap<std::string, Foo>& constMap = map;
+			Assert::IsTrue(constMap.Find("1"s) != constMap.end());
+			Assert::IsTrue(constMap.Find("3"s) == constMap.end());
+		}
+
+		TEST_METHOD(TestContainsKey)
+		{
+			FrozenHashMap<std::string, Foo> map = { { "1", Foo(1) }, { "2", Foo(2) } };
+			Assert::IsTrue(map.ContainsKey("1"s));
+			Assert::IsFalse(map.ContainsKey("3"s));
+
+			FrozenHashMap<std::string, Foo>::Iterator it;
+			Assert::IsTrue(map.ContainsKey("1"s, it));
+			Assert::AreEqual(it->second, Foo(1));
+			Assert::IsFalse(map.ContainsKey("3"s, it));
+
+			const FrozenHashMap<std::string, Foo>& constMap = map;
+			FrozenHashMap<std::string, Foo>::ConstIterator cit;
+			Assert::IsTrue(constMap.ContainsKey("2"s, cit));
+			Assert::AreEqual(cit->second, Foo(2));
+			Assert::IsFalse(constMap.ContainsKey("3"s, cit));
+		}
+
+		TEST_METHOD(TestHeterogeneousLookup)
+		{
+			FrozenHashMap<std::string, Foo> map = { { "integer", Foo(1) }, { "float", Foo(2) }, { "string", Foo(3) } };
+			Assert::AreEqual(map.At("integer"sv), Foo(1));
+			Assert::AreEqual(map.At("float"), Foo(2));
+			Assert::IsTrue(map.ContainsKey("string"sv));
+			Assert::IsFalse(map.ContainsKey("vector"sv));
+			Assert::IsTrue(map.Find("vector"sv) == map.end());
+			Assert::ExpectException<std::exception>([&map] { map.At("vector"sv); });
+
+			FrozenHashMap<std::string, Foo>::Iterator it;
+			Assert::IsTrue(map.ContainsKey("float"sv, it));
+			Assert::AreEqual(it->second, Foo(2));
+
+			const FrozenHashMap<std::string, Foo>& constMap = map;
+			FrozenHashMap<std::string, Foo>::ConstIterator cit;
+			Assert::IsTrue(constMap.ContainsKey("string"sv, cit));
+			Assert::AreEqual(constMap.At("string"sv), Foo(3));
+		}
+
+		TEST_METHOD(TestManyKeys)
+		{
+			Vector<std::pair<const int, int>> pairs;
+			pairs.Reserve(Count);
+			for (int i = 0; i < static_cast<int>(Count); ++i)
+			{
+				pairs.EmplaceBack(i * 7, i);
+			}
+
+			const FrozenHashMap<int, int> map(pairs.begin(), pairs.end());
+			Assert::AreEqual(map.Size(), Count);
+			Assert::IsTrue(map.BucketCount() < Count);
+
+			for (int i = 0; i < static_cast<int>(Count); ++i)
+			{
+				Assert::AreEqual(map.At(i * 7), i);
+
+				// every miss still probes a slot, it must be told apart by the key comparison
+				Assert::IsFalse(map.ContainsKey(i * 7 + 1));
+			}
+		}
+
+		TEST_METHOD(TestWeakHash)
+		{
+			// the identity hash of Foo gets mixed before placing the keys
+			Vector<std::pair<const Foo, int>> pairs;
+			for (int i = 0; i < 1000; ++i)
+			{
+				pairs.EmplaceBack(Foo(i * 1024), i);
+			}
+
+			const FrozenHashMap<Foo, int> map(pairs.begin(), pairs.end());
+			Assert::AreEqual(map.Size(), 1000_z);
+			for (int i = 0; i < 1000; ++i)
+			{
+				Assert::AreEqual(map.At(Foo(i * 1024)), i);
+				Assert::IsFalse(map.ContainsKey(Foo(i * 1024 + 1)));
+			}
+		}
+
+		TEST_METHOD(TestCollidingHash)
+		{
+			// "a", "b" and "c" share a full hash, as do "dd" and "ee", no seed can tell them apart
+			const FrozenHashMap<std::string, int, LengthHash> map = { { "a", 1 }, { "b", 2 }, { "c", 3 }, { "dd", 4 }, { "ee", 5 }, { "fff", 6 } };
+			Assert::AreEqual(map.Size(), 6_z);
+			Assert::AreEqual(map.At("a"s), 1);
+			Assert::AreEqual(map.At("b"s), 2);
+			Assert::AreEqual(map.At("c"s), 3);
+			Assert::AreEqual(map.At("dd"s), 4);
+			Assert::AreEqual(map.At("ee"s), 5);
+			Assert::AreEqual(map.At("fff"s), 6);
+			Assert::IsTrue(map.Find("c"s)->second == 3);
+			Assert::IsFalse(map.ContainsKey("d"s));
+			Assert::IsFalse(map.ContainsKey("gg"s));
+			Assert::IsFalse(map.ContainsKey("hhhh"s));
+
+			int sum = 0;
+			for (const auto& pair : map)
+			{
+				sum += pair.second;
+			}
+			Assert::AreEqual(sum, 21);
+
+			const auto copy = map;
+			Assert::AreEqual(copy.At("ee"s), 5);
+			Assert::IsFalse(copy.ContainsKey("ff"s));
+
+			// a real duplicate among colliding keys is still an error
+			Assert::ExpectException<std::exception>([] { FrozenHashMap<std::string, int, LengthHash> duplicates = { { "a", 1 }, { "b", 2 }, { "a", 3 } }; });
+
+			// every key collides with another one
+			Vector<std::pair<const std::string, int>> pairs;
+			for (int i = 0; i < 200; ++i)
+			{
+				pairs.EmplaceBack(std::string(static_cast<size_t>(i / 2 + 1), static_cast<char>('a' + i % 2)), i);
+			}
+
+			const FrozenHashMap<std::string, int, LengthHash> many(pairs.begin(), pairs.end());
+			Assert::AreEqual(many.Size(), 200_z);
+			for (const auto& [key, value] : pairs)
+			{
+				Assert::AreEqual(many.At(key), value);
+			}
+			Assert::IsFalse(many.ContainsKey(std::string(50, 'c')));
+		}
+
+		TEST_METHOD(TestIterators)
+		{
+			FrozenHashMap<std::string, Foo> map = { { "1", Foo(1) }, { "2", Foo(2) }, { "3", Foo(3) }, { "4", Foo(4) }, { "5", Foo(5) } };
+
+			size_t count = 0;
+			int sum = 0;
+			for (auto& [key, value] : map)
+			{
+				Assert::IsTrue(map.ContainsKey(key));
+				sum += value.Data();
+				++count;
+			}
+
+			Assert::AreEqual(count, map.Size());
+			Assert::AreEqual(sum, 15);
+			Assert::IsTrue(map.cbegin() == map.begin());
+			Assert::AreEqual(static_cast<size_t>(map.cend() - map.cbegin()), map.Size());
+		}
+
+	private:
+		struct LengthHash
+		{
+			size_t operator()(const std::string& key) const
+			{
+				return key.size();
+			}
+		};
+
+		inline static const size_t Count = 10000;
+
+		static _CrtMemState sStartMemState;
+		static size_t sStartSlabsInUse;
+	};
+
+	_CrtMemState FrozenHashMapTest::sStartMemState;
+	size_t FrozenHashMapTest::sStartSlabsInUse;
+}
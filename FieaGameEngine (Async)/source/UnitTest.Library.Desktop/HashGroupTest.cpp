@@ -0,0 +1,91 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "HashGroup.h"
+#include "Utility.h"
+#include "SlabAllocator.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(HashGroupTest)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+			sStartSlabsInUse = SlabAllocator<>::Statistics().InUse;
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+
+			// slab nodes are out of sight of the CRT heap, their pools keep their own count
+			if (SlabAllocator<>::Statistics().InUse != sStartSlabsInUse)
+			{
+				Assert::Fail(L"Slab Leaks!");
+			}
+		}
+
+		TEST_METHOD(TestMatch)
+		{
+			HashGroup::ControlType tags[HashGroup::Width];
+			for (size_t i = 0; i < HashGroup::Width; ++i)
+			{
+				tags[i] = i % 4 == 0 ? HashGroup::Empty : static_cast<HashGroup::ControlType>(i);
+			}
+			tags[3] = HashGroup::Deleted;
+			tags[HashGroup::Width - 1] = 9;
+
+			const HashGroup group(tags);
+			Assert::AreEqual((1U << 9) | (1U << (HashGroup::Width - 1)), group.Match(9));
+			Assert::AreEqual(0U, group.Match(127));
+		}
+
+		TEST_METHOD(TestMatchEmpty)
+		{
+			HashGroup::ControlType tags[HashGroup::Width];
+			for (size_t i = 0; i < HashGroup::Width; ++i)
+			{
+				tags[i] = static_cast<HashGroup::ControlType>(i);
+			}
+			Assert::AreEqual(0U, HashGroup(tags).MatchEmpty());
+			Assert::AreEqual(0U, HashGroup(tags).MatchEmptyOrDeleted());
+
+			tags[2] = HashGroup::Empty;
+			tags[5] = HashGroup::Deleted;
+			tags[HashGroup::Width - 1] = HashGroup::Empty;
+
+			const HashGroup group(tags);
+			Assert::AreEqual((1U << 2) | (1U << (HashGroup::Width - 1)), group.MatchEmpty());
+			Assert::AreEqual((1U << 2) | (1U << 5) | (1U << (HashGroup::Width - 1)), group.MatchEmptyOrDeleted());
+		}
+
+		TEST_METHOD(TestLowestBit)
+		{
+			Assert::AreEqual(0_z, HashGroup::LowestBit(1U));
+			Assert::AreEqual(3_z, HashGroup::LowestBit(0b11000U));
+			Assert::AreEqual(31_z, HashGroup::LowestBit(1U << 31));
+		}
+
+	private:
+		static _CrtMemState sStartMemState;
+		static size_t sStartSlabsInUse;
+	};
+
+	_CrtMemState HashGroupTest::sStartMemState;
+	size_t HashGroupTest::sStartSlabsInUse;
+}
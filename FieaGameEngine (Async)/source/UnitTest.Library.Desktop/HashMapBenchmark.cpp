@@ -0,0 +1,514 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory_resource>
+#include "HashMap.h"
+#include "FlatHashMap.h"
+#include "FrozenHashMap.h"
+#include "OrderedHashMap.h"
+#include "Atom.h"
+#include "SmallVector.h"
+#include "Datum.h"
+#include "vector.h"
+#include "Utility.h"
+#include "SlabAllocator.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(HashMapBenchmark)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+			sStartSlabsInUse = SlabAllocator<>::Statistics().InUse;
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+
+			// slab nodes are out of sight of the CRT heap, their pools keep their own count
+			if (SlabAllocator<>::Statistics().InUse != sStartSlabsInUse)
+			{
+				Assert::Fail(L"Slab Leaks!");
+			}
+		}
+
+		TEST_METHOD(IntegerKeys)
+		{
+			Vector<int> keys(sBucketCount);
+			Vector<int> misses(sBucketCount);
+			for (int i = 0; i < static_cast<int>(sBucketCount); ++i)
+			{
+				keys.PushBack(i * 7919);
+				misses.PushBack(i * 7919 + 1);
+			}
+
+			Logger::WriteMessage("HashMap vs FlatHashMap, int keys (ns per operation)\n");
+			for (float loadFactor : sLoadFactors)
+			{
+				const size_t count = static_cast<size_t>(loadFactor * sBucketCount);
+				Report("HashMap", loadFactor, Measure<HashMap<int, int>>(keys, misses, count));
+				Report("FlatHashMap", loadFactor, Measure<FlatHashMap<int, int>>(keys, misses, count));
+			}
+		}
+
+		TEST_METHOD(StringKeys)
+		{
+			Vector<std::string> keys(sBucketCount);
+			Vector<std::string> misses(sBucketCount);
+			for (size_t i = 0; i < sBucketCount; ++i)
+			{
+				keys.PushBack("attribute" + std::to_string(i));
+				misses.PushBack("missing" + std::to_string(i));
+			}
+
+			Logger::WriteMessage("HashMap vs FlatHashMap, string keys (ns per operation)\n");
+			for (float loadFactor : sLoadFactors)
+			{
+				const size_t count = static_cast<size_t>(loadFactor * sBucketCount);
+				Report("HashMap", loadFactor, Measure<HashMap<std::string, int>>(keys, misses, count));
+				Report("FlatHashMap", loadFactor, Measure<FlatHashMap<std::string, int>>(keys, misses, count));
+			}
+		}
+
+		TEST_METHOD(FrozenKeys)
+		{
+			Vector<std::string> keys(sBucketCount);
+			Vector<std::string> misses(sBucketCount);
+			for (size_t i = 0; i < sBucketCount; ++i)
+			{
+				keys.PushBack("attribute" + std::to_string(i));
+				misses.PushBack("missing" + std::to_string(i));
+			}
+
+			Vector<int> ids(sBucketCount);
+			Vector<int> missingIds(sBucketCount);
+			for (int i = 0; i < static_cast<int>(sBucketCount); ++i)
+			{
+				ids.PushBack(i * 7919);
+				missingIds.PushBack(i * 7919 + 1);
+			}
+
+			// registries are a few dozen keys, the biggest size shows how the build scales
+			Logger::WriteMessage("FlatHashMap vs FrozenHashMap (ns per operation, insert is the freeze)\n");
+			for (size_t count : { 16_z, 64_z, 1024_z })
+			{
+				const float loadFactor = static_cast<float>(count) / sBucketCount;
+				Report("Flat int", loadFactor, Measure<FlatHashMap<int, int>>(ids, missingIds, count));
+				Report("Frozen int", loadFactor, MeasureFrozen(ids, missingIds, count));
+				Report("Flat str", loadFactor, Measure<FlatHashMap<std::string, int>>(keys, misses, count));
+				Report("Frozen str", loadFactor, MeasureFrozen(keys, misses, count));
+			}
+		}
+
+		TEST_METHOD(OrderedFootprint)
+		{
+			// the layout Scope had before: a chained map for lookups plus a list of entry pointers for the order
+			using ChainedMap = HashMap<std::string, Datum, DefaultHash<std::string>, DefaultComparator<std::string>, ResourceAllocator>;
+			using OrderList = SmallVector<ChainedMap::PairType*, 12>;
+			using OrderedMap = OrderedHashMap<std::string, Datum, DefaultHash<std::string>, DefaultComparator<std::string>, ResourceAllocator>;
+
+			Logger::WriteMessage("Scope entries, chained map + order list vs ordered map (heap bytes per attribute, ns per operation)\n");
+			for (size_t count : { 4_z, 12_z, 64_z, 1024_z })
+			{
+				Vector<std::string> names(count);
+				for (size_t i = 0; i < count; ++i)
+				{
+					// short enough to stay in the string's own buffer, only the containers allocate
+					names.PushBack("a" + std::to_string(i));
+				}
+
+				CountingResource chainedResource;
+				CountingResource orderedResource;
+				{
+					ChainedMap chained(12, ResourceAllocator(&chainedResource));
+					OrderList order(12);
+					OrderedMap ordered(12, ResourceAllocator(&orderedResource));
+					for (const auto& name : names)
+					{
+						auto [it, inserted] = chained.Emplace(name, Datum());
+						order.PushBack(&(*it));
+						ordered.Emplace(name, Datum());
+					}
+
+					// the order list keeps up to 12 pointers inline and the rest on the heap, either way one pointer per entry
+					const double chainedBytes = static_cast<double>(chainedResource.Bytes + sizeof(void*) * count) / count;
+					const double orderedBytes = static_cast<double>(orderedResource.Bytes) / count;
+
+					size_t found = 0;
+					const double chainedIndex = NanosecondsPerOperation(count * sRepetitions, [&order, &found, count]
+					{
+						for (size_t repetition = 0; repetition < sRepetitions; ++repetition)
+						{
+							for (size_t i = 0; i < count; ++i)
+							{
+								found += order[i]->second.Size();
+							}
+						}
+					});
+
+					const double orderedIndex = NanosecondsPerOperation(count * sRepetitions, [&ordered, &found, count]
+					{
+						for (size_t repetition = 0; repetition < sRepetitions; ++repetition)
+						{
+							for (size_t i = 0; i < count; ++i)
+							{
+								found += ordered.EntryAt(i).second.Size();
+							}
+						}
+					});
+
+					const double chainedFind = NanosecondsPerOperation(count * sRepetitions, [&chained, &names, &found, count]
+					{
+						for (size_t repetition = 0; repetition < sRepetitions; ++repetition)
+						{
+							for (size_t i = 0; i < count; ++i)
+							{
+								found += chained.ContainsKey(names[i]) ? 1 : 0;
+							}
+						}
+					});
+
+					const double orderedFind = NanosecondsPerOperation(count * sRepetitions, [&ordered, &names, &found, count]
+					{
+						for (size_t repetition = 0; repetition < sRepetitions; ++repetition)
+						{
+							for (size_t i = 0; i < count; ++i)
+							{
+								found += ordered.ContainsKey(names[i]) ? 1 : 0;
+							}
+						}
+					});
+					Assert::AreEqual(count * sRepetitions * 2, found);
+					Assert::IsTrue(orderedBytes < chainedBytes);
+
+					char line[160];
+					sprintf_s(line, "  %4zu entries  chained %6.1f B  index %5.1f  find %5.1f   ordered %6.1f B  index %5.1f  find %5.1f\n",
+						count, chainedBytes, chainedIndex, chainedFind, orderedBytes, orderedIndex, orderedFind);
+					Logger::WriteMessage(line);
+				}
+
+				Assert::AreEqual(0_z, chainedResource.Bytes);
+				Assert::AreEqual(0_z, orderedResource.Bytes);
+			}
+		}
+
+		TEST_METHOD(AtomKeys)
+		{
+			using StringMap = OrderedHashMap<std::string, Datum, DefaultHash<std::string>, DefaultComparator<std::string>, ResourceAllocator>;
+			using AtomMap = OrderedHashMap<Atom, Datum, DefaultHash<Atom>, DefaultComparator<Atom>, ResourceAllocator>;
+
+			// the prescribed attributes of a typical entity, a couple too long for the string's own buffer
+			const std::string names[] = { "this", "Name", "Actions", "Position", "Velocity", "Health", "TransformRotation", "CollisionRadius" };
+			const size_t nameCount = std::size(names);
+			Vector<Atom> atoms(nameCount);
+			for (const auto& name : names)
+			{
+				atoms.PushBack(Atom(name));
+			}
+
+			Logger::WriteMessage("Scope entries keyed by string vs atom (heap bytes per scope, ns per lookup)\n");
+			for (size_t scopeCount : { 16_z, 1024_z })
+			{
+				CountingResource stringResource;
+				CountingResource atomResource;
+				{
+					Vector<StringMap> stringScopes(scopeCount);
+					Vector<AtomMap> atomScopes(scopeCount);
+					size_t stringHeap = 0;
+					for (size_t i = 0; i < scopeCount; ++i)
+					{
+						StringMap& stringScope = *stringScopes.EmplaceBack(nameCount, ResourceAllocator(&stringResource));
+						AtomMap& atomScope = *atomScopes.EmplaceBack(nameCount, ResourceAllocator(&atomResource));
+						for (size_t j = 0; j < nameCount; ++j)
+						{
+							const std::string& key = (*stringScope.Emplace(names[j], Datum()).first).first;
+							atomScope.Emplace(atoms[j], Datum());
+
+							// names that do not fit in the string itself take a heap block of their own in every scope
+							stringHeap += key.capacity() > std::string().capacity() ? key.capacity() + 1 : 0;
+						}
+					}
+
+					const double stringBytes = static_cast<double>(stringResource.Bytes + stringHeap) / scopeCount;
+					const double atomBytes = static_cast<double>(atomResource.Bytes) / scopeCount;
+
+					size_t found = 0;
+					const double stringFind = NanosecondsPerOperation(scopeCount * nameCount * sRepetitions, [&stringScopes, &names, &found, nameCount]
+					{
+						for (size_t repetition = 0; repetition < sRepetitions; ++repetition)
+						{
+							for (const auto& scope : stringScopes)
+							{
+								for (size_t j = 0; j < nameCount; ++j)
+								{
+									found += scope.ContainsKey(names[j]) ? 1 : 0;
+								}
+							}
+						}
+					});
+
+					const double atomFind = NanosecondsPerOperation(scopeCount * nameCount * sRepetitions, [&atomScopes, &atoms, &found, nameCount]
+					{
+						for (size_t repetition = 0; repetition < sRepetitions; ++repetition)
+						{
+							for (const auto& scope : atomScopes)
+							{
+								for (size_t j = 0; j < nameCount; ++j)
+								{
+									found += scope.ContainsKey(atoms[j]) ? 1 : 0;
+								}
+							}
+						}
+					});
+					Assert::AreEqual(scopeCount * nameCount * sRepetitions * 2, found);
+					Assert::IsTrue(atomBytes < stringBytes);
+
+					char line[160];
+					sprintf_s(line, "  %4zu scopes  string %6.1f B  find %5.1f   atom %6.1f B  find %5.1f\n",
+						scopeCount, stringBytes, stringFind, atomBytes, atomFind);
+					Logger::WriteMessage(line);
+				}
+
+				Assert::AreEqual(0_z, stringResource.Bytes);
+				Assert::AreEqual(0_z, atomResource.Bytes);
+			}
+		}
+
+		TEST_METHOD(Growth)
+		{
+			Vector<int> keys(sBucketCount * 4);
+			for (int i = 0; i < static_cast<int>(sBucketCount * 4); ++i)
+			{
+				keys.PushBack(i * 7919);
+			}
+
+			// the map starts small and grows on its own, the slowest insert shows what a single growth costs
+			HashMap<int, int> map(16);
+			double worstInsert = 0.0;
+			const double insert = NanosecondsPerOperation(keys.Size(), [&map, &keys, &worstInsert]
+			{
+				for (size_t i = 0; i < keys.Size(); ++i)
+				{
+					const auto start = std::chrono::high_resolution_clock::now();
+					map.Insert(std::pair(keys[i], static_cast<int>(i)));
+					const auto end = std::chrono::high_resolution_clock::now();
+					worstInsert = std::max(worstInsert, std::chrono::duration<double, std::nano>(end - start).count());
+				}
+			});
+			Assert::AreEqual(keys.Size(), map.Size());
+			Assert::IsTrue(static_cast<float>(map.Size()) <= static_cast<float>(map.BucketCount()) * map.MaxLoadFactor());
+
+			size_t found = 0;
+			const double hit = NanosecondsPerOperation(keys.Size() * sRepetitions, [&map, &keys, &found]
+			{
+				for (size_t repetition = 0; repetition < sRepetitions; ++repetition)
+				{
+					for (size_t i = 0; i < keys.Size(); ++i)
+					{
+						found += map.ContainsKey(keys[i]) ? 1 : 0;
+					}
+				}
+			});
+			Assert::AreEqual(keys.Size() * sRepetitions, found);
+
+			char line[128];
+			sprintf_s(line, "HashMap growing from 16 buckets (ns): insert %.1f  worst insert %.1f  hit %.1f\n", insert, worstInsert, hit);
+			Logger::WriteMessage(line);
+		}
+
+		TEST_METHOD(Allocators)
+		{
+			Vector<std::string> keys(sBucketCount);
+			Vector<std::string> misses(sBucketCount);
+			for (size_t i = 0; i < sBucketCount; ++i)
+			{
+				keys.PushBack("attribute" + std::to_string(i));
+				misses.PushBack("missing" + std::to_string(i));
+			}
+
+			// the same map with its chain entries from malloc and from the slab pools
+			using MallocMap = HashMap<std::string, int, DefaultHash<std::string>, DefaultComparator<std::string>, DefaultAllocator>;
+			Logger::WriteMessage("HashMap chain entries from malloc vs slab pools, string keys (ns per operation)\n");
+			Report("malloc", 1.0f, Measure<MallocMap>(keys, misses, sBucketCount));
+			Report("slab", 1.0f, Measure<HashMap<std::string, int>>(keys, misses, sBucketCount));
+
+			const SlabStatistics statistics = SlabAllocator<>::Statistics();
+			char line[128];
+			sprintf_s(line, "  slab pools after the run: %zu slabs, %zu of %zu nodes in use\n", statistics.Slabs, statistics.InUse, statistics.Capacity);
+			Logger::WriteMessage(line);
+		}
+
+	private:
+		/// <summary>
+		/// Memory resource keeping count of the bytes it has handed out and not yet taken back
+		/// </summary>
+		class CountingResource final : public std::pmr::memory_resource
+		{
+		public:
+			size_t Bytes = 0;
+
+		private:
+			void* do_allocate(size_t bytes, size_t alignment) override
+			{
+				Bytes += bytes;
+				return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+			}
+
+			void do_deallocate(void* memory, size_t bytes, size_t alignment) override
+			{
+				Bytes -= bytes;
+				std::pmr::new_delete_resource()->deallocate(memory, bytes, alignment);
+			}
+
+			bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+			{
+				return this == &other;
+			}
+		};
+
+		struct Timings
+		{
+			double Insert;
+			double Hit;
+			double Miss;
+		};
+
+		template <typename TFunction>
+		static double NanosecondsPerOperation(size_t operations, TFunction function)
+		{
+			const auto start = std::chrono::high_resolution_clock::now();
+			function();
+			const auto end = std::chrono::high_resolution_clock::now();
+
+			return std::chrono::duration<double, std::nano>(end - start).count() / operations;
+		}
+
+		template <typename TMap, typename TKey>
+		static Timings Measure(const Vector<TKey>& keys, const Vector<TKey>& misses, size_t count)
+		{
+			TMap map(sBucketCount);
+			Timings timings;
+
+			timings.Insert = NanosecondsPerOperation(count, [&map, &keys, count]
+			{
+				for (size_t i = 0; i < count; ++i)
+				{
+					map.Insert(std::pair(keys[i], static_cast<int>(i)));
+				}
+			});
+			Assert::AreEqual(count, map.Size());
+			Assert::AreEqual(sBucketCount, map.BucketCount());
+
+			size_t found = 0;
+			timings.Hit = NanosecondsPerOperation(count * sRepetitions, [&map, &keys, &found, count]
+			{
+				for (size_t repetition = 0; repetition < sRepetitions; ++repetition)
+				{
+					for (size_t i = 0; i < count; ++i)
+					{
+						found += map.ContainsKey(keys[i]) ? 1 : 0;
+					}
+				}
+			});
+			Assert::AreEqual(count * sRepetitions, found);
+
+			found = 0;
+			timings.Miss = NanosecondsPerOperation(count * sRepetitions, [&map, &misses, &found, count]
+			{
+				for (size_t repetition = 0; repetition < sRepetitions; ++repetition)
+				{
+					for (size_t i = 0; i < count; ++i)
+					{
+						found += map.ContainsKey(misses[i]) ? 1 : 0;
+					}
+				}
+			});
+			Assert::AreEqual(0_z, found);
+
+			return timings;
+		}
+
+		template <typename TKey>
+		static Timings MeasureFrozen(const Vector<TKey>& keys, const Vector<TKey>& misses, size_t count)
+		{
+			FlatHashMap<TKey, int> source(sBucketCount);
+			for (size_t i = 0; i < count; ++i)
+			{
+				source.Insert(std::pair(keys[i], static_cast<int>(i)));
+			}
+
+			FrozenHashMap<TKey, int> map;
+			Timings timings;
+
+			timings.Insert = NanosecondsPerOperation(count, [&map, &source]
+			{
+				map = FrozenHashMap<TKey, int>(source.begin(), source.end());
+			});
+			Assert::AreEqual(count, map.Size());
+
+			size_t found = 0;
+			timings.Hit = NanosecondsPerOperation(count * sRepetitions, [&map, &keys, &found, count]
+			{
+				for (size_t repetition = 0; repetition < sRepetitions; ++repetition)
+				{
+					for (size_t i = 0; i < count; ++i)
+					{
+						found += map.ContainsKey(keys[i]) ? 1 : 0;
+					}
+				}
+			});
+			Assert::AreEqual(count * sRepetitions, found);
+
+			found = 0;
+			timings.Miss = NanosecondsPerOperation(count * sRepetitions, [&map, &misses, &found, count]
+			{
+				for (size_t repetition = 0; repetition < sRepetitions; ++repetition)
+				{
+					for (size_t i = 0; i < count; ++i)
+					{
+						found += map.ContainsKey(misses[i]) ? 1 : 0;
+					}
+				}
+			});
+			Assert::AreEqual(0_z, found);
+
+			return timings;
+		}
+
+		static void Report(const char* name, float loadFactor, const Timings& timings)
+		{
+			char line[128];
+			sprintf_s(line, "  %-12s load %.3f  insert %8.1f  hit %8.1f  miss %8.1f\n", name, loadFactor, timings.Insert, timings.Hit, timings.Miss);
+			Logger::WriteMessage(line);
+		}
+
+		inline static const size_t sBucketCount = 4096;
+		inline static const size_t sRepetitions = 8;
+		inline static const float sLoadFactors[] = { 0.25f, 0.5f, 0.75f, 0.875f };
+
+		static _CrtMemState sStartMemState;
+		static size_t sStartSlabsInUse;
+	};
+
+	_CrtMemState HashMapBenchmark::sStartMemState;
+	size_t HashMapBenchmark::sStartSlabsInUse;
+}
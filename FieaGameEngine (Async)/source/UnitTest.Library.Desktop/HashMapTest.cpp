@@ -1,13 +1,19 @@
 #include "pch.h"
 #include "CppUnitTest.h"
+#include <limits>
+#include <stdexcept>
 #include "DefaultHashFooSpecialization.h"
 #include "HashMap.h"
 #include "Foo.h"
+#include "vector.h"
 #include "ToStringSpecializations.h"
 #include "Utility.h"
+#include "SlabAllocator.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace FieaGameEngine;
+using namespace std::literals::string_literals;
+using namespace std::literals::string_view_literals;
 
 namespace UnitTestLibraryDesktop
 {
@@ -20,6 +26,7 @@ namespace UnitTestLibraryDesktop
 			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
 			_CrtMemCheckpoint(&sStartMemState);
 #endif
+			sStartSlabsInUse = SlabAllocator<>::Statistics().InUse;
 		}
 
 		TEST_METHOD_CLEANUP(Cleanup)
@@ -33,6 +40,12 @@ namespace UnitTestLibraryDesktop
 				Assert::Fail(L"Memory Leaks!");
 			}
 #endif
+
+			// slab nodes are out of sight of the CRT heap, their pools keep their own count
+			if (SlabAllocator<>::Statistics().InUse != sStartSlabsInUse)
+			{
+				Assert::Fail(L"Slab Leaks!");
+			}
 		}
 
 		TEST_METHOD(TestConstructor)
@@ -43,7 +56,15 @@ namespace UnitTestLibraryDesktop
 
 			HashMap<std::string, Foo> map2(100_z);
 			Assert::AreEqual(map2.Size(), 0_z);
-			Assert::AreEqual(map2.BucketCount(), 100_z);
+			Assert::AreEqual(map2.BucketCount(), 128_z);
+
+			// the Foo hash is not avalanching, so its buckets are picked by modulo
+			HashMap<Foo, Foo> map3(100_z);
+			Assert::AreEqual(map3.BucketCount(), 100_z);
+			map3.Rehash(37);
+			Assert::AreEqual(map3.BucketCount(), 37_z);
+			map2.Rehash(37);
+			Assert::AreEqual(map2.BucketCount(), 64_z);
 		}
 
 		TEST_METHOD(TestMoveConstructor)
@@ -150,6 +171,38 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual(constMap.Find(Foo(4)), constMap.end());
 		}
 
+		TEST_METHOD(TestHeterogeneousLookup)
+		{
+			HashMap<std::string, Foo> map = { { "name"s, Foo(1) }, { "health"s, Foo(2) } };
+			Assert::AreEqual(map.Find("name"sv)->second, Foo(1));
+			Assert::AreEqual(map.Find("health")->second, Foo(2));
+			Assert::IsTrue(map.Find("armor"sv) == map.end());
+
+			Assert::IsTrue(map.ContainsKey("name"sv));
+			Assert::IsFalse(map.ContainsKey("armor"));
+			HashMap<std::string, Foo>::Iterator it;
+			Assert::IsTrue(map.ContainsKey("health"sv, it));
+			Assert::AreEqual(it->second, Foo(2));
+
+			map.At("name"sv) = Foo(3);
+			Assert::AreEqual(map.At("name"s), Foo(3));
+			const auto expression = [&map] { map.At("armor"sv); };
+			Assert::ExpectException<std::exception>(expression);
+
+			// a view into a longer buffer only matches its own characters
+			const std::string buffer = "namespace";
+			Assert::IsTrue(map.ContainsKey(std::string_view(buffer.c_str(), 4)));
+			Assert::IsFalse(map.ContainsKey(std::string_view(buffer.c_str(), 5)));
+
+			const auto constMap = map;
+			Assert::AreEqual(constMap.Find("health"sv)->second, Foo(2));
+			Assert::IsTrue(constMap.Find("armor"sv) == constMap.end());
+			Assert::AreEqual(constMap.At("name"), Foo(3));
+			HashMap<std::string, Foo>::ConstIterator constIt;
+			Assert::IsTrue(constMap.ContainsKey("name"sv, constIt));
+			Assert::AreEqual(constIt->second, Foo(3));
+		}
+
 		TEST_METHOD(TestRemove)
 		{
 			HashMap<Foo, Foo> map = { { Foo(1), Foo(1) }, { Foo(2), Foo(2) }, { Foo(3), Foo(3) } };
@@ -189,6 +242,15 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual(map.BucketCount(), 100_z);
 			Assert::AreEqual(map.Size(), 6_z);
 			Assert::IsTrue(map.ContainsKey(Foo(2)));
+
+			// reserving less than there is room for leaves the buckets alone
+			map.Reserve(1);
+			Assert::AreEqual(map.BucketCount(), 100_z);
+			map.Reserve(100);
+			Assert::AreEqual(map.BucketCount(), 100_z);
+			map.Reserve(0);
+			Assert::AreEqual(map.BucketCount(), 100_z);
+			Assert::IsTrue(map.ContainsKey(Foo(5)));
 		}
 
 		TEST_METHOD(TestRehash)
@@ -206,6 +268,31 @@ namespace UnitTestLibraryDesktop
 			Assert::IsTrue(map.ContainsKey(Foo(2)));
 		}
 
+		TEST_METHOD(TestCachedHashes)
+		{
+			CountingHash::sCalls = 0;
+			HashMap<int, int, CountingHash> map(4);
+			for (int i = 0; i < 20; ++i)
+			{
+				map[i] = i;
+			}
+			Assert::AreEqual(20_z, CountingHash::sCalls);
+
+			// redistributing the entries reuses the stored hashes
+			map.Rehash(64);
+			map.Reserve(200);
+			Assert::AreEqual(20_z, CountingHash::sCalls);
+			for (int i = 0; i < 20; ++i)
+			{
+				Assert::AreEqual(map.At(i), i);
+			}
+			Assert::AreEqual(40_z, CountingHash::sCalls);
+
+			Assert::IsTrue(map.Remove(7));
+			Assert::IsFalse(map.ContainsKey(7));
+			Assert::AreEqual(19_z, map.Size());
+		}
+
 		TEST_METHOD(TestContainsKey)
 		{
 			HashMap<Foo, Foo> map = { { Foo(0), Foo(0) }, { Foo(1), Foo(1) }, { Foo(2), Foo(2) }, { Foo(3), Foo(3) }, { Foo(4), Foo(4) }, { Foo(5), Foo(5) } };
@@ -267,13 +354,140 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual(map.LoadFactor(), 1.0f / 16);
 			map.MaxLoadFactor(0.5f);
 			Assert::AreEqual(map.MaxLoadFactor(), 0.5f);
+			map.MaxLoadFactor(4.0f);
+			Assert::AreEqual(map.MaxLoadFactor(), 4.0f);
+
+			// factors that would grow the buckets on every insertion
+			Assert::ExpectException<std::invalid_argument>([&map] { map.MaxLoadFactor(0.0f); });
+			Assert::ExpectException<std::invalid_argument>([&map] { map.MaxLoadFactor(-1.0f); });
+			Assert::ExpectException<std::invalid_argument>([&map] { map.MaxLoadFactor(std::numeric_limits<float>::quiet_NaN()); });
+			Assert::ExpectException<std::invalid_argument>([&map] { map.MaxLoadFactor(std::numeric_limits<float>::infinity()); });
+			Assert::AreEqual(map.MaxLoadFactor(), 4.0f);
+
+			for (int i = 2; i < 40; ++i)
+			{
+				map[Foo(i)] = Foo(i);
+			}
+			Assert::AreEqual(map.BucketCount(), 16_z);
+		}
+
+		TEST_METHOD(TestAutomaticGrowth)
+		{
+			HashMap<Foo, Foo> map;
+			Vector<std::pair<const Foo, Foo>*> pairs;
+			for (int i = 0; i < 17; ++i)
+			{
+				pairs.PushBack(&*map.Insert(std::pair(Foo(i), Foo(i))).first);
+			}
+			Assert::AreEqual(32_z, map.BucketCount());
+			Assert::IsTrue(map.IsRehashing());
+
+			// the old buckets are still being moved, everything must be reachable anyway
+			for (int i = 0; i < 17; ++i)
+			{
+				Assert::IsTrue(map.ContainsKey(Foo(i)));
+				Assert::AreEqual(Foo(i), map.At(Foo(i)));
+			}
+			Assert::IsFalse(map.ContainsKey(Foo(17)));
+
+			Vector<int> visits(17);
+			visits.Resize(17);
+			for (const auto& pair : map)
+			{
+				++visits[pair.first.Data()];
+			}
+			for (int visitCount : visits)
+			{
+				Assert::AreEqual(1, visitCount);
+			}
+
+			for (int i = 17; i < 24; ++i)
+			{
+				pairs.PushBack(&*map.Insert(std::pair(Foo(i), Foo(i))).first);
+			}
+			Assert::IsTrue(map.IsRehashing());
+			Assert::IsTrue(map.Remove(Foo(3)));
+			Assert::IsFalse(map.ContainsKey(Foo(3)));
+			Assert::AreEqual(23_z, map.Size());
+			size_t count = 0;
+			for (auto it = map.begin(); it != map.end(); ++it)
+			{
+				++count;
+			}
+			Assert::AreEqual(23_z, count);
+
+			for (int i = 24; i < 32; ++i)
+			{
+				pairs.PushBack(&*map.Insert(std::pair(Foo(i), Foo(i))).first);
+			}
+			Assert::IsFalse(map.IsRehashing());
+			Assert::AreEqual(32_z, map.BucketCount());
+
+			// entries are moved between buckets, never copied
+			for (int i = 0; i < 32; ++i)
+			{
+				if (i != 3)
+				{
+					Assert::IsTrue(pairs[i] == &*map.Find(Foo(i)));
+				}
+			}
+
+			map.Rehash(8);
+			Assert::IsFalse(map.IsRehashing());
+			Assert::IsTrue(pairs[31] == &*map.Find(Foo(31)));
+		}
+
+		TEST_METHOD(TestGrowthAfterMigration)
+		{
+			// low factors leave fewer insertions per growth, the migration has to keep up anyway
+			for (float maxLoadFactor : { 0.1f, 0.25f, 0.4f, 0.5f, 0.75f, 1.0f, 3.0f })
+			{
+				HashMap<Foo, Foo> map;
+				map.MaxLoadFactor(maxLoadFactor);
+
+				size_t growths = 0;
+				for (int i = 0; i < 3000; ++i)
+				{
+					const size_t bucketCount = map.BucketCount();
+					const bool wasRehashing = map.IsRehashing();
+					map.Insert(std::pair(Foo(i), Foo(i)));
+
+					if (map.BucketCount() != bucketCount)
+					{
+						Assert::IsFalse(wasRehashing);
+						Assert::IsTrue(map.IsRehashing());
+						++growths;
+					}
+				}
+
+				Assert::IsTrue(growths > 0);
+				Assert::AreEqual(3000_z, map.Size());
+				Assert::IsTrue(map.LoadFactor() <= maxLoadFactor);
+				for (int i = 0; i < 3000; ++i)
+				{
+					Assert::AreEqual(Foo(i), map.At(Foo(i)));
+				}
+			}
 		}
 
 	private:
+		struct CountingHash
+		{
+			size_t operator()(int key) const
+			{
+				++sCalls;
+				return static_cast<size_t>(key);
+			}
+
+			inline static size_t sCalls = 0;
+		};
+
 		static _CrtMemState sStartMemState;
+		static size_t sStartSlabsInUse;
 	};
 
 	_CrtMemState HashMapTest::sStartMemState;
+	size_t HashMapTest::sStartSlabsInUse;
 }
 
 namespace Microsoft::VisualStudio::CppUnitTestFramework
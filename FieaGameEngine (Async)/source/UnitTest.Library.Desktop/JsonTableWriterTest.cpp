@@ -0,0 +1,262 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <memory>
+#include <string>
+#include "JsonParseMaster.h"
+#include "JsonTableParseHelper.h"
+#include "JsonTableWriter.h"
+#include "TextWriter.h"
+#include "AttributedFoo.h"
+#include "Entity.h"
+#include "ActionList.h"
+#include "ActionListIf.h"
+#include "ActionIncrement.h"
+#include "WorldState.h"
+#include "GameTime.h"
+#include "ToStringSpecializations.h"
+#include "Utility.h"
+#include "SlabAllocator.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace std::literals::string_literals;
+using namespace FieaGameEngine;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(JsonTableWriterTest)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+			sStartSlabsInUse = SlabAllocator<>::Statistics().InUse;
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+
+			// slab nodes are out of sight of the CRT heap, their pools keep their own count
+			if (SlabAllocator<>::Statistics().InUse != sStartSlabsInUse)
+			{
+				Assert::Fail(L"Slab Leaks!");
+			}
+		}
+
+		TEST_METHOD(TestSchema)
+		{
+			Scope table;
+			table["Health"s] = 100;
+			table["Speeds"s] = { 1.5f, 2.0f };
+			table["Position"s] = glm::vec4(1.0f, 2.0f, 3.0f, 4.0f);
+			table["Name"s] = "\"Hero\""s;
+			table["Empty"s].SetType(Datum::DatumType::STRING);
+			table["Untyped"s];
+			table["Self"s] = static_cast<RTTI*>(&table);
+			table.AppendScope("Items"s)["Damage"s] = 5;
+
+			Assert::AreEqual(JsonTableWriter::ToString(table),
+				R"json({"Health":{"type":"integer","value":100},)json"
+				R"json("Speeds":{"type":"float","value":[1.5,2]},)json"
+				R"json("Position":{"type":"vector","value":"vec4(1, 2, 3, 4)"},)json"
+				R"json("Name":{"type":"string","value":"\"Hero\""},)json"
+				R"json("Empty":{"type":"string","value":[]},)json"
+				R"json("Items":{"type":"table","value":[{"type":"table","value":{"Damage":{"type":"integer","value":5}}}]}})json"s);
+		}
+
+		TEST_METHOD(TestRoundTrip)
+		{
+			Scope table;
+			Parse(table, "content/json/table.json"s);
+
+			const std::string json = JsonTableWriter::ToString(table);
+			Scope loaded;
+			ParseString(loaded, json);
+
+			Assert::IsTrue(loaded == table);
+			Assert::AreEqual(loaded["ATable"s].Size(), 3_z);
+			Assert::AreEqual(loaded["ATable"s][2]["Damage"s].Get<float>(), 5.25f);
+
+			// writing what was read back gives the same text
+			Assert::AreEqual(JsonTableWriter::ToString(loaded), json);
+		}
+
+		TEST_METHOD(TestAttributed)
+		{
+			AttributedFoo foo;
+			Parse(foo, "content/json/attributed_foo.json"s);
+			foo.ExternalFloat = 1.0f / 3.0f;
+			foo.ExternalMatrixArray[4] = glm::mat4(-0.125f);
+
+			AttributedFoo loaded;
+			ParseString(loaded, JsonTableWriter::ToString(foo));
+
+			Assert::AreEqual(loaded.ExternalInteger, foo.ExternalInteger);
+			Assert::AreEqual(loaded.ExternalFloat, foo.ExternalFloat);
+			Assert::IsTrue(loaded.ExternalVector == foo.ExternalVector);
+			Assert::IsTrue(loaded.ExternalMatrix == foo.ExternalMatrix);
+			Assert::AreEqual(loaded.ExternalString, foo.ExternalString);
+			for (size_t i = 0; i < 5; ++i)
+			{
+				Assert::AreEqual(loaded.ExternalIntegerArray[i], foo.ExternalIntegerArray[i]);
+				Assert::AreEqual(loaded.ExternalFloatArray[i], foo.ExternalFloatArray[i]);
+				Assert::IsTrue(loaded.ExternalVectorArray[i] == foo.ExternalVectorArray[i]);
+				Assert::IsTrue(loaded.ExternalMatrixArray[i] == foo.ExternalMatrixArray[i]);
+			}
+
+			Assert::AreEqual(loaded["NestedScopeArray"s].Size(), 5_z);
+			Assert::IsTrue(loaded["NestedScopeArray"s][0] == foo["NestedScopeArray"s][0]);
+
+			// the pointer to itself stays out of the text
+			Assert::IsTrue(JsonTableWriter::ToString(foo).find("\"this\"") == std::string::npos);
+		}
+
+		TEST_METHOD(TestClasses)
+		{
+			EntityFactory entityFactory;
+			ActionListFactory actionListFactory;
+			ActionListIfFactory actionListIfFactory;
+			ActionIncrementFactory actionIncrementFactory;
+
+			Entity entity;
+			Parse(entity, "content/entity.json"s);
+
+			const std::string json = JsonTableWriter::ToString(entity);
+			Assert::IsTrue(json.find(R"("class":"ActionListIf")") != std::string::npos);
+
+			Entity loaded;
+			ParseString(loaded, json);
+			Assert::AreEqual(loaded["Actions"s].Size(), entity["Actions"s].Size());
+			Assert::IsTrue(loaded["Actions"s][0].Is(ActionIncrement::TypeIdClass()));
+			Assert::IsTrue(loaded["Actions"s][1].Is(ActionList::TypeIdClass()));
+
+			// the loaded entity behaves as the one it was saved from
+			WorldState worldState(std::make_shared<GameTime>());
+			loaded.Update(worldState);
+			loaded.Update(worldState);
+			Assert::AreEqual(loaded["A"s].Get<std::int32_t>(), 2);
+			Assert::AreEqual(loaded["B"s].Get<float>(), 2.5f);
+			Assert::AreEqual(loaded["C"s].Get<std::int32_t>(), 1);
+		}
+
+		TEST_METHOD(TestMixedClasses)
+		{
+			ActionIncrementFactory actionIncrementFactory;
+
+			// a plain scope after one with a class stays plain
+			Scope table;
+			table.Adopt("Things"s, *new ActionIncrement());
+			table.AppendScope("Things"s)["Plain"s] = 1;
+
+			Scope loaded;
+			ParseString(loaded, JsonTableWriter::ToString(table));
+			Assert::AreEqual(loaded["Things"s].Size(), 2_z);
+			Assert::IsTrue(loaded["Things"s][0].Is(ActionIncrement::TypeIdClass()));
+			Assert::IsTrue(loaded["Things"s][1].TypeIdInstance() == Scope::TypeIdClass());
+			Assert::AreEqual(loaded["Things"s][1]["Plain"s].Get<std::int32_t>(), 1);
+		}
+
+		TEST_METHOD(TestNonFinite)
+		{
+			const float infinity = std::numeric_limits<float>::infinity();
+			const float nan = std::numeric_limits<float>::quiet_NaN();
+
+			// the largest and smallest finite values still make the trip
+			Scope table;
+			table["Max"s] = std::numeric_limits<float>::max();
+			table["Lowest"s] = std::numeric_limits<float>::lowest();
+			table["Tiny"s] = std::numeric_limits<float>::denorm_min();
+			table["Vector"s] = glm::vec4(std::numeric_limits<float>::max(), -0.0f, 1.0f, std::numeric_limits<float>::lowest());
+
+			Scope loaded;
+			ParseString(loaded, JsonTableWriter::ToString(table));
+			Assert::IsTrue(loaded["Max"s] == table["Max"s]);
+			Assert::IsTrue(loaded["Lowest"s] == table["Lowest"s]);
+			Assert::IsTrue(loaded["Tiny"s] == table["Tiny"s]);
+			Assert::IsTrue(loaded["Vector"s] == table["Vector"s]);
+			Assert::IsTrue(std::signbit(loaded["Vector"s].Get<glm::vec4>().y));
+
+			Scope floats;
+			Datum& values = floats["Values"s];
+			values.PushBack(1.0f);
+			values.PushBack(infinity);
+			Assert::ExpectException<std::exception>([&floats] { JsonTableWriter::ToString(floats); });
+			values.Set(-infinity, 1);
+			Assert::ExpectException<std::exception>([&floats] { JsonTableWriter::ToString(floats); });
+			values.Set(nan, 1);
+			Assert::ExpectException<std::exception>([&floats] { JsonTableWriter::ToString(floats); });
+
+			Scope vectors;
+			vectors["Vector"s] = glm::vec4(0.0f, 0.0f, nan, 0.0f);
+			Assert::ExpectException<std::exception>([&vectors] { JsonTableWriter::ToString(vectors); });
+
+			// nested scopes are checked too
+			Scope matrices;
+			glm::mat4 matrix(1.0f);
+			matrix[3][3] = infinity;
+			matrices.AppendScope("Child"s)["Matrix"s] = matrix;
+			Assert::ExpectException<std::exception>([&matrices] { JsonTableWriter::ToString(matrices); });
+
+			const std::string filename = "JsonTableWriterTest.json"s;
+			Assert::ExpectException<std::exception>([&floats, &filename] { JsonTableWriter::WriteToFile(floats, filename); });
+			std::remove(filename.c_str());
+		}
+
+		TEST_METHOD(TestFile)
+		{
+			Scope table;
+			Parse(table, "content/json/table.json"s);
+
+			const std::string filename = "JsonTableWriterTest.json"s;
+			JsonTableWriter::WriteToFile(table, filename);
+
+			Scope loaded;
+			Parse(loaded, filename);
+			std::remove(filename.c_str());
+			Assert::IsTrue(loaded == table);
+
+			Assert::ExpectException<std::exception>([&table] { JsonTableWriter::WriteToFile(table, "missing/directory/table.json"s); });
+		}
+
+	private:
+		static void Parse(Scope& scope, const std::string& filename)
+		{
+			TableSharedData data(scope);
+			JsonParseMaster master(data);
+			JsonTableParseHelper helper;
+			master.AddHelper(helper);
+			master.Initialize();
+			master.ParseFromFile(filename);
+		}
+
+		static void ParseString(Scope& scope, const std::string& json)
+		{
+			TableSharedData data(scope);
+			JsonParseMaster master(data);
+			JsonTableParseHelper helper;
+			master.AddHelper(helper);
+			master.Initialize();
+			master.Parse(json);
+		}
+
+		static _CrtMemState sStartMemState;
+		static size_t sStartSlabsInUse;
+	};
+
+	_CrtMemState JsonTableWriterTest::sStartMemState;
+	size_t JsonTableWriterTest::sStartSlabsInUse;
+}
@@ -0,0 +1,439 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <algorithm>
+#include <vector>
+#include "DefaultHashFooSpecialization.h"
+#include "OrderedHashMap.h"
+#include "Foo.h"
+#include "ToStringSpecializations.h"
+#include "Utility.h"
+#include "SlabAllocator.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std::literals::string_literals;
+using namespace std::literals::string_view_literals;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(OrderedHashMapTest)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+			sStartSlabsInUse = SlabAllocator<>::Statistics().InUse;
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+
+			// slab nodes are out of sight of the CRT heap, their pools keep their own count
+			if (SlabAllocator<>::Statistics().InUse != sStartSlabsInUse)
+			{
+				Assert::Fail(L"Slab Leaks!");
+			}
+		}
+
+		TEST_METHOD(TestConstructor)
+		{
+			OrderedHashMap<std::string, Foo> map;
+			Assert::AreEqual(map.Size(), 0_z);
+			Assert::IsTrue(map.IsEmpty());
+			Assert::AreEqual(map.BucketCount(), 0_z);
+			Assert::IsFalse(map.ContainsKey("1"s));
+			Assert::IsTrue(map.begin() == map.end());
+
+			// three quarters of the slots at most point at a pair
+			OrderedHashMap<std::string, Foo> map2(12_z);
+			Assert::AreEqual(map2.Capacity(), 12_z);
+			Assert::AreEqual(map2.BucketCount(), 16_z);
+
+			OrderedHashMap<std::string, Foo> map3(13_z);
+			Assert::AreEqual(map3.BucketCount(), 32_z);
+		}
+
+		TEST_METHOD(TestCopyConstructor)
+		{
+			OrderedHashMap<std::string, Foo> map = { { "1", Foo(1) }, { "2", Foo(2) }, { "3", Foo(3) } };
+			OrderedHashMap<std::string, Foo> map2(map);
+			Assert::AreEqual(map2.Size(), 3_z);
+			Assert::AreEqual(map2.EntryAt(0).first, "1"s);
+			Assert::AreEqual(map2.At("3"s), Foo(3));
+
+			map2["1"s] = Foo(100);
+			Assert::AreEqual(map.At("1"s), Foo(1));
+		}
+
+		TEST_METHOD(TestMoveConstructor)
+		{
+			OrderedHashMap<std::string, Foo> map = { { "1", Foo(1) }, { "2", Foo(2) }, { "3", Foo(3) } };
+			OrderedHashMap<std::string, Foo> map2(std::move(map));
+			Assert::AreEqual(map.Size(), 0_z);
+			Assert::AreEqual(map2.Size(), 3_z);
+			Assert::AreEqual(map2.At("2"s), Foo(2));
+
+			Assert::IsFalse(map.ContainsKey("1"s));
+			map["4"s] = Foo(4);
+			Assert::AreEqual(map.At("4"s), Foo(4));
+		}
+
+		TEST_METHOD(TestInitializerListConstructor)
+		{
+			OrderedHashMap<std::string, Foo> map = { { "3", Foo(3) }, { "1", Foo(1) }, { "3", Foo(33) }, { "2", Foo(2) } };
+			Assert::AreEqual(map.Size(), 3_z);
+			Assert::AreEqual(map.EntryAt(0).first, "3"s);
+			Assert::AreEqual(map.EntryAt(1).first, "1"s);
+			Assert::AreEqual(map.EntryAt(2).first, "2"s);
+
+			// a repeated key keeps its first value
+			Assert::AreEqual(map.At("3"s), Foo(3));
+		}
+
+		TEST_METHOD(TestAssignment)
+		{
+			OrderedHashMap<std::string, Foo> map1 = { { "1", Foo(1) }, { "2", Foo(2) }, { "3", Foo(3) } };
+			OrderedHashMap<std::string, Foo> map2 = { { "55", Foo(33) } };
+			map2 = map1;
+			Assert::AreEqual(map2.Size(), 3_z);
+			Assert::IsFalse(map2.ContainsKey("55"s));
+			Assert::AreEqual(map2.At("2"s), Foo(2));
+
+			OrderedHashMap<std::string, Foo> map3;
+			map3 = std::move(map2);
+			Assert::AreEqual(map2.Size(), 0_z);
+			Assert::AreEqual(map3.Size(), 3_z);
+
+			map3 = { { "9", Foo(9) }, { "8", Foo(8) } };
+			Assert::AreEqual(map3.Size(), 2_z);
+			Assert::IsFalse(map3.ContainsKey("1"s));
+			Assert::AreEqual(map3.EntryAt(0).second, Foo(9));
+			Assert::AreEqual(map3.EntryAt(1).second, Foo(8));
+		}
+
+		TEST_METHOD(TestIndexOperator)
+		{
+			Foo foo1(1);
+			OrderedHashMap<Foo, Foo> map = { { Foo(1), Foo(1) }, { Foo(2), Foo(2) }, { Foo(3), Foo(3) } };
+			Assert::AreEqual(map[foo1], Foo(1));
+			map[Foo(1)] = Foo(55);
+			Assert::AreEqual(map[Foo(1)], Foo(55));
+			map[Foo(4)] = Foo(4);
+			Assert::AreEqual(map[Foo(4)], Foo(4));
+			map[Foo(5)];
+			Assert::AreEqual(map[Foo(5)], Foo());
+			Assert::AreEqual(map.EntryAt(4).first, Foo(5));
+		}
+
+		TEST_METHOD(TestAt)
+		{
+			OrderedHashMap<Foo, Foo> map = { { Foo(1), Foo(1) }, { Foo(2), Foo(2) }, { Foo(3), Foo(3) } };
+			Assert::AreEqual(map.At(Foo(1)), Foo(1));
+			map.At(Foo(1)) = Foo(55);
+			Assert::AreEqual(map.At(Foo(1)), Foo(55));
+			Assert::ExpectException<std::exception>([&map] { map.At(Foo(4)); });
+
+			const auto constMap = map;
+			Assert::AreEqual(constMap.At(Foo(1)), Foo(55));
+			Assert::ExpectException<std::exception>([&constMap] { constMap.At(Foo(4)); });
+		}
+
+		TEST_METHOD(TestEntryAt)
+		{
+			OrderedHashMap<std::string, Foo> map;
+			Assert::ExpectException<std::exception>([&map] { map.EntryAt(0); });
+
+			map.Emplace("b", Foo(2));
+			map.Emplace("a", Foo(1));
+			Assert::AreEqual(map.EntryAt(0).first, "b"s);
+			Assert::AreEqual(map.EntryAt(1).first, "a"s);
+			map.EntryAt(1).second = Foo(10);
+			Assert::AreEqual(map.At("a"s), Foo(10));
+
+			const auto& constMap = map;
+			Assert::AreEqual(constMap.EntryAt(0).second, Foo(2));
+			Assert::ExpectException<std::exception>([&constMap] { constMap.EntryAt(2); });
+		}
+
+		TEST_METHOD(TestInsert)
+		{
+			OrderedHashMap<Foo, Foo> map;
+			const int foos = 100;
+			for (int i = 0; i < foos; ++i)
+			{
+				auto[it, inserted] = map.Insert(std::pair(Foo(i), Foo(i)));
+				Assert::IsTrue(inserted);
+				Assert::AreEqual(it->second, Foo(i));
+				Assert::AreEqual(map[Foo(i)], Foo(i));
+			}
+
+			Assert::AreEqual(map.Size(), static_cast<size_t>(foos));
+			Assert::IsTrue(map.Size() * 4 <= map.BucketCount() * 3);
+
+			for (int i = 0; i < foos; ++i)
+			{
+				std::pair<const Foo, Foo> pair = { Foo(i), Foo(i + 1) };
+				auto[it, inserted] = map.Insert(pair);
+				Assert::IsFalse(inserted);
+				Assert::AreEqual(it->second, Foo(i));
+				Assert::AreEqual(map.EntryAt(static_cast<size_t>(i)).first, Foo(i));
+			}
+
+			Assert::AreEqual(map.Size(), static_cast<size_t>(foos));
+		}
+
+		TEST_METHOD(TestEmplace)
+		{
+			OrderedHashMap<std::string, Foo> map;
+			auto[it, inserted] = map.Emplace("1", Foo(1));
+			Assert::IsTrue(inserted);
+			Assert::AreEqual(it->first, "1"s);
+			Assert::AreEqual(it->second, Foo(1));
+
+			// a present key leaves the pairs where they are
+			const auto* address = &map.EntryAt(0);
+			auto[it2, inserted2] = map.Emplace("1", Foo(2));
+			Assert::IsFalse(inserted2);
+			Assert::IsTrue(it == it2);
+			Assert::IsTrue(address == &map.EntryAt(0));
+			Assert::AreEqual(map.Size(), 1_z);
+		}
+
+		TEST_METHOD(TestFind)
+		{
+			OrderedHashMap<std::string, Foo> map = { { "1", Foo(1) }, { "2", Foo(2) } };
+			auto it = map.Find("2"s);
+			Assert::IsTrue(it != map.end());
+			Assert::AreEqual(it->second, Foo(2));
+			Assert::IsTrue(map.Find("3"s) == map.end());
+
+			const auto& constMap = map;
+			Assert::IsTrue(constMap.Find("1"s) == constMap.begin());
+			Assert::IsTrue(constMap.Find("3"s) == constMap.end());
+		}
+
+		TEST_METHOD(TestHeterogeneousLookup)
+		{
+			OrderedHashMap<std::string, Foo> map = { { "health", Foo(1) }, { "mana", Foo(2) } };
+			Assert::AreEqual(map.At("health"sv), Foo(1));
+			Assert::AreEqual(map.At("mana"), Foo(2));
+			Assert::IsTrue(map.ContainsKey("mana"sv));
+			Assert::IsFalse(map.ContainsKey("armor"sv));
+			Assert::IsTrue(map.Find("armor"sv) == map.end());
+			Assert::ExpectException<std::exception>([&map] { map.At("armor"sv); });
+
+			OrderedHashMap<std::string, Foo>::Iterator it;
+			Assert::IsTrue(map.ContainsKey("mana"sv, it));
+			Assert::AreEqual(it->second, Foo(2));
+
+			const auto& constMap = map;
+			OrderedHashMap<std::string, Foo>::ConstIterator cit;
+			Assert::IsTrue(constMap.ContainsKey("health"sv, cit));
+			Assert::IsFalse(constMap.ContainsKey("armor"sv, cit));
+			Assert::AreEqual(constMap.At("health"sv), Foo(1));
+		}
+
+		TEST_METHOD(TestContainsKey)
+		{
+			OrderedHashMap<std::string, Foo> map = { { "1", Foo(1) }, { "2", Foo(2) } };
+			Assert::IsTrue(map.ContainsKey("1"s));
+			Assert::IsFalse(map.ContainsKey("3"s));
+
+			OrderedHashMap<std::string, Foo>::Iterator it;
+			Assert::IsTrue(map.ContainsKey("2"s, it));
+			Assert::AreEqual(it->second, Foo(2));
+			Assert::IsFalse(map.ContainsKey("3"s, it));
+
+			const auto& constMap = map;
+			OrderedHashMap<std::string, Foo>::ConstIterator cit;
+			Assert::IsTrue(constMap.ContainsKey("1"s, cit));
+			Assert::AreEqual(cit->second, Foo(1));
+		}
+
+		TEST_METHOD(TestRemove)
+		{
+			OrderedHashMap<std::string, Foo> map = { { "1", Foo(1) }, { "2", Foo(2) }, { "3", Foo(3) }, { "4", Foo(4) }, { "5", Foo(5) } };
+			Assert::IsFalse(map.Remove("6"s));
+			Assert::IsFalse(map.Remove(map.end()));
+
+			// the pairs after a removed one move down, lookups still find them
+			Assert::IsTrue(map.Remove("2"s));
+			Assert::AreEqual(map.Size(), 4_z);
+			Assert::IsFalse(map.ContainsKey("2"s));
+			Assert::AreEqual(map.EntryAt(1).first, "3"s);
+			Assert::AreEqual(map.At("5"s), Foo(5));
+
+			Assert::IsTrue(map.Remove(map.begin()));
+			Assert::AreEqual(map.EntryAt(0).first, "3"s);
+
+			map.Remove(map.begin() + 1, map.end());
+			Assert::AreEqual(map.Size(), 1_z);
+			Assert::AreEqual(map.At("3"s), Foo(3));
+			Assert::IsFalse(map.ContainsKey("4"s));
+			Assert::IsFalse(map.ContainsKey("5"s));
+
+			map["6"s] = Foo(6);
+			Assert::AreEqual(map.EntryAt(1).second, Foo(6));
+
+			OrderedHashMap<std::string, Foo> other = { { "1", Foo(1) } };
+			Assert::ExpectException<std::exception>([&map, &other] { map.Remove(other.begin(), other.end()); });
+		}
+
+		TEST_METHOD(TestReserve)
+		{
+			OrderedHashMap<int, int> map;
+			map.Reserve(100);
+			Assert::AreEqual(map.Capacity(), 100_z);
+			Assert::AreEqual(map.BucketCount(), 256_z);
+
+			map.Emplace(0, 0);
+			const auto* address = &map.EntryAt(0);
+			for (int i = 1; i < 100; ++i)
+			{
+				map.Emplace(i, i);
+			}
+
+			// nothing moved or reindexed while filling the reserved room
+			Assert::IsTrue(address == &map.EntryAt(0));
+			Assert::AreEqual(map.BucketCount(), 256_z);
+
+			map.Reserve(10);
+			Assert::AreEqual(map.Capacity(), 100_z);
+		}
+
+		TEST_METHOD(TestClear)
+		{
+			OrderedHashMap<std::string, Foo> map = { { "1", Foo(1) }, { "2", Foo(2) }, { "3", Foo(3) } };
+			const size_t buckets = map.BucketCount();
+			map.Clear();
+			Assert::AreEqual(map.Size(), 0_z);
+			Assert::AreEqual(map.BucketCount(), buckets);
+			Assert::IsFalse(map.ContainsKey("1"s));
+
+			map["2"s] = Foo(20);
+			Assert::AreEqual(map.EntryAt(0).second, Foo(20));
+		}
+
+		TEST_METHOD(TestIterators)
+		{
+			OrderedHashMap<std::string, int> map;
+			for (int i = 0; i < 50; ++i)
+			{
+				map.Emplace(std::to_string(49 - i), i);
+			}
+
+			// always insertion order, whatever the hashes
+			int expected = 0;
+			for (const auto& [key, value] : map)
+			{
+				Assert::AreEqual(key, std::to_string(49 - expected));
+				Assert::AreEqual(value, expected++);
+			}
+
+			Assert::AreEqual(expected, 50);
+			Assert::IsTrue(map.cbegin() == map.begin());
+			Assert::AreEqual(static_cast<size_t>(map.cend() - map.cbegin()), map.Size());
+		}
+
+		TEST_METHOD(TestWeakHash)
+		{
+			// the identity hash of Foo gets mixed, so probe starts and fragments still spread
+			OrderedHashMap<Foo, int> map;
+			for (int i = 0; i < 1000; ++i)
+			{
+				map.Emplace(Foo(i * 1024), i);
+			}
+
+			for (int i = 0; i < 1000; ++i)
+			{
+				Assert::AreEqual(map.At(Foo(i * 1024)), i);
+				Assert::AreEqual(map.EntryAt(static_cast<size_t>(i)).second, i);
+				Assert::IsFalse(map.ContainsKey(Foo(i * 1024 + 1)));
+			}
+		}
+
+		TEST_METHOD(TestRemoveMendsIndex)
+		{
+			// every four keys start probing from the same slot, so removals leave clusters to mend
+			OrderedHashMap<int, int, ClusteredHash> map;
+			std::vector<int> expected;
+			for (int i = 0; i < 400; ++i)
+			{
+				map.Emplace(i, i);
+				expected.push_back(i);
+			}
+
+			// the last pair, no other one moves and only its cluster is looked at
+			ClusteredHash::sCalls = 0;
+			Assert::IsTrue(map.Remove(map.end() - 1));
+			expected.pop_back();
+			Assert::IsTrue(ClusteredHash::sCalls < 16_z);
+
+			// nothing at all for an empty range
+			ClusteredHash::sCalls = 0;
+			map.Remove(map.begin() + 5, map.begin() + 5);
+			Assert::AreEqual(0_z, ClusteredHash::sCalls);
+			Assert::ExpectException<std::exception>([&map] { map.Remove(map.begin() + 6, map.begin() + 5); });
+
+			// from the middle and the front, one pair and short ranges
+			Assert::IsTrue(map.Remove(map.begin() + 100));
+			expected.erase(expected.begin() + 100);
+			map.Remove(map.begin(), map.begin() + 10);
+			expected.erase(expected.begin(), expected.begin() + 10);
+			map.Remove(map.begin() + 37, map.begin() + 61);
+			expected.erase(expected.begin() + 37, expected.begin() + 61);
+			Assert::IsTrue(ClusteredHash::sCalls < 200_z);
+
+			// most of it at once
+			map.Remove(map.begin() + 20, map.end() - 20);
+			expected.erase(expected.begin() + 20, expected.end() - 20);
+
+			Assert::AreEqual(expected.size(), map.Size());
+			for (size_t i = 0; i < expected.size(); ++i)
+			{
+				Assert::AreEqual(map.EntryAt(i).first, expected[i]);
+				Assert::AreEqual(map.At(expected[i]), expected[i]);
+			}
+
+			for (int i = 0; i < 400; ++i)
+			{
+				Assert::AreEqual(map.ContainsKey(i), std::find(expected.begin(), expected.end(), i) != expected.end());
+			}
+
+			map[1000] = 1000;
+			Assert::AreEqual(map.EntryAt(expected.size()).first, 1000);
+		}
+
+	private:
+		struct ClusteredHash
+		{
+			using is_avalanching = void;
+
+			size_t operator()(int key) const
+			{
+				++sCalls;
+				return static_cast<size_t>(key / 4 * 8);
+			}
+
+			inline static size_t sCalls = 0;
+		};
+
+		static _CrtMemState sStartMemState;
+		static size_t sStartSlabsInUse;
+	};
+
+	_CrtMemState OrderedHashMapTest::sStartMemState;
+	size_t OrderedHashMapTest::sStartSlabsInUse;
+}
@@ -5,6 +5,7 @@
 #include "Foo.h"
 #include "ToStringSpecializations.h"
 #include "Utility.h"
+#include "SlabAllocator.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace FieaGameEngine;
@@ -20,6 +21,7 @@ namespace UnitTestLibraryDesktop
 			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
 			_CrtMemCheckpoint(&sStartMemState);
 #endif
+			sStartSlabsInUse = SlabAllocator<>::Statistics().InUse;
 		}
 
 		TEST_METHOD_CLEANUP(Cleanup)
@@ -33,6 +35,12 @@ namespace UnitTestLibraryDesktop
 				Assert::Fail(L"Memory Leaks!");
 			}
 #endif
+
+			// slab nodes are out of sight of the CRT heap, their pools keep their own count
+			if (SlabAllocator<>::Statistics().InUse != sStartSlabsInUse)
+			{
+				Assert::Fail(L"Slab Leaks!");
+			}
 		}
 
 		TEST_METHOD(TestDefaultConstructor)
@@ -503,6 +511,43 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual(fooPtrList.Back(), &foo2);
 		}
 
+		TEST_METHOD(TestSpliceBack)
+		{
+			SList<Foo> source = { Foo(1), Foo(2), Foo(3) };
+			SList<Foo> target;
+			const Foo* address = &source.Front();
+
+			auto it = target.SpliceBack(source);
+			Assert::AreEqual(*it, Foo(1));
+			Assert::IsTrue(&(*it) == address);
+			Assert::AreEqual(source.Size(), 2_z);
+			Assert::AreEqual(source.Front(), Foo(2));
+			Assert::AreEqual(target.Size(), 1_z);
+			Assert::AreEqual(target.Front(), Foo(1));
+			Assert::AreEqual(target.Back(), Foo(1));
+
+			target.SpliceBack(source);
+			target.SpliceBack(source);
+			Assert::IsTrue(source.IsEmpty());
+			Assert::AreEqual(target.Size(), 3_z);
+			Assert::AreEqual(target.Front(), Foo(1));
+			Assert::AreEqual(target.Back(), Foo(3));
+
+			source.PushBack(Foo(4));
+			Assert::AreEqual(source.Front(), Foo(4));
+			Assert::AreEqual(source.Back(), Foo(4));
+
+			// a list can rotate its own front to the back
+			target.SpliceBack(target);
+			Assert::AreEqual(target.Front(), Foo(2));
+			Assert::AreEqual(target.Back(), Foo(1));
+			Assert::AreEqual(target.Size(), 3_z);
+
+			SList<Foo> empty;
+			auto expression = [&target, &empty] { target.SpliceBack(empty); };
+			Assert::ExpectException<std::exception>(expression);
+		}
+
 		TEST_METHOD(TestInsertAfter)
 		{
 			SList<Foo> list = { Foo(1), Foo(3), Foo(6) };
@@ -809,8 +854,10 @@ namespace UnitTestLibraryDesktop
 
 	private:
 		static _CrtMemState sStartMemState;
+		static size_t sStartSlabsInUse;
 
 	};
 
 	_CrtMemState SListTest::sStartMemState;
+	size_t SListTest::sStartSlabsInUse;
 }
\ No newline at end of file
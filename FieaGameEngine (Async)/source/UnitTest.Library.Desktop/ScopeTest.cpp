@@ -4,11 +4,13 @@
 #include "Scope.h"
 #include "ToStringSpecializations.h"
 #include "Utility.h"
+#include "SlabAllocator.h"
 #include <string>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace FieaGameEngine;
 using namespace std::literals::string_literals;
+using namespace std::literals::string_view_literals;
 
 namespace UnitTestLibraryDesktop
 {
@@ -21,6 +23,7 @@ namespace UnitTestLibraryDesktop
 			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
 			_CrtMemCheckpoint(&sStartMemState);
 #endif
+			sStartSlabsInUse = SlabAllocator<>::Statistics().InUse;
 		}
 
 		TEST_METHOD_CLEANUP(Cleanup)
@@ -34,6 +37,12 @@ namespace UnitTestLibraryDesktop
 				Assert::Fail(L"Memory Leaks!");
 			}
 #endif
+
+			// slab nodes are out of sight of the CRT heap, their pools keep their own count
+			if (SlabAllocator<>::Statistics().InUse != sStartSlabsInUse)
+			{
+				Assert::Fail(L"Slab Leaks!");
+			}
 		}
 
 		TEST_METHOD(TestRTTI)
@@ -288,6 +297,43 @@ namespace UnitTestLibraryDesktop
 			}
 		}
 
+		TEST_METHOD(TestInsertionOrder)
+		{
+			// well past the entries a scope makes room for up front, so the entries move while growing
+			Scope s;
+			for (std::int32_t i = 0; i < 100; ++i)
+			{
+				s.Append("entry"s + std::to_string(i)).PushBack(i);
+				if (i % 10 == 0)
+				{
+					s.AppendScope("child"s + std::to_string(i));
+				}
+			}
+
+			Assert::AreEqual(s.Size(), 110_z);
+			for (std::int32_t i = 0; i < 100; ++i)
+			{
+				const Datum* datum = s.Find("entry"s + std::to_string(i));
+				Assert::IsNotNull(datum);
+				Assert::AreEqual(datum->Get<std::int32_t>(), i);
+				Assert::IsTrue(datum == &s[static_cast<size_t>(i + (i + 9) / 10)]);
+			}
+
+			for (std::int32_t i = 0; i < 100; i += 10)
+			{
+				Scope& child = s.At("child"s + std::to_string(i))[0];
+				Assert::IsTrue(child.GetParent() == &s);
+				Assert::AreEqual(s.FindName(&child), "child"s + std::to_string(i));
+			}
+
+			const Scope copy = s;
+			Assert::AreEqual(copy.Size(), s.Size());
+			Assert::AreEqual(copy[2].Get<std::int32_t>(), 1);
+			Assert::AreEqual(copy[109].Get<std::int32_t>(), 99);
+			const Scope& copiedChild = copy.At("child50"s)[0];
+			Assert::IsTrue(copiedChild.GetParent() == &copy);
+		}
+
 		TEST_METHOD(TestAppendScope)
 		{
 			// Copy
@@ -359,6 +405,30 @@ namespace UnitTestLibraryDesktop
 			const Scope cs = s;
 			Assert::IsNotNull(cs.Find("armor"s));
 			Assert::IsNull(cs.Find("error"s));
+
+			Assert::IsNotNull(s.Find("name"sv));
+			Assert::IsNotNull(s.Find("health"));
+			Assert::IsNull(cs.Find("error"sv));
+			Assert::AreEqual(&s.At("armor"sv), s.Find("armor"));
+		}
+
+		TEST_METHOD(TestFindFilteredOut)
+		{
+			// with a single name most others miss the name filter, and the rest miss the map
+			Scope s;
+			s["present"s] = 1;
+			Scope& child = s.AppendScope("child"s);
+
+			for (int i = 0; i < 200; ++i)
+			{
+				const Atom name("ScopeTest.Filtered" + std::to_string(i));
+				Assert::IsNull(s.Find(name));
+				Assert::IsNull(s.Find(name.View()));
+				Assert::IsNull(child.Search(name));
+			}
+
+			Assert::IsTrue(s.Find(Atom("present"sv)) == &s["present"s]);
+			Assert::IsTrue(child.Search(Atom("present"sv)) == &s["present"s]);
 		}
 
 		TEST_METHOD(TestFindChildScope)
@@ -416,6 +486,89 @@ namespace UnitTestLibraryDesktop
 			Assert::IsNull(out);
 		}
 
+		TEST_METHOD(TestSearchCache)
+		{
+			Scope s;
+			s["health"s] = 100;
+			Scope& l1 = s.AppendScope("level1"s);
+			Scope& l2 = l1.AppendScope("level2"s);
+
+			Scope::SearchCache cache;
+			Datum* health = l2.Search("health"sv, cache);
+			Assert::IsTrue(health == s.Find("health"sv));
+			Assert::IsTrue(l2.Search("health"sv, cache) == health);
+
+			// appending to the owner may move its entries
+			for (int i = 0; i < 100; ++i)
+			{
+				s.Append("datum" + std::to_string(i));
+			}
+			Assert::IsTrue(l2.Search("health"sv, cache) == s.Find("health"sv));
+			Assert::AreEqual(l2.Search("health"sv, cache)->Get<std::int32_t>(), 100);
+
+			// a closer entry hides the owner's
+			l1["health"s] = 50;
+			Assert::IsTrue(l2.Search("health"sv, cache) == l1.Find("health"sv));
+
+			// other names and other origins through the same cache
+			Assert::IsTrue(l2.Search("datum10"sv, cache) == s.Find("datum10"sv));
+			Assert::IsTrue(s.Search("health"sv, cache) == s.Find("health"sv));
+			Assert::IsTrue(l2.Search("health"sv, cache) == l1.Find("health"sv));
+
+			// misses are remembered too, until the name shows up on the way
+			Assert::IsNull(l2.Search("ScopeTest.SearchCache.Miss"sv, cache));
+			Assert::IsNull(l2.Search("ScopeTest.SearchCache.Miss"sv, cache));
+			Assert::IsNull(s.Search("ScopeTest.SearchCache.Miss"sv, cache));
+			Assert::IsTrue(Atom::Find("ScopeTest.SearchCache.Miss"sv).IsEmpty());
+
+			// a name interned since the miss is looked for again
+			const Atom interned("ScopeTest.SearchCache.Miss.Interned"sv);
+			Assert::IsNull(l2.Search("ScopeTest.SearchCache.Miss.Interned"sv, cache));
+			l1["ScopeTest.SearchCache.Miss.Interned"s] = 3;
+			Assert::IsTrue(l2.Search("ScopeTest.SearchCache.Miss.Interned"sv, cache) == l1.Find(interned));
+			Assert::IsNull(l2.Search("ScopeTest.SearchCache.Miss"sv, cache));
+			Scope other;
+			other["ScopeTest.SearchCache.Miss"s] = 1;
+			Assert::IsNull(l2.Search("ScopeTest.SearchCache.Miss"sv, cache));
+			s["ScopeTest.SearchCache.Miss"s] = 2;
+			Assert::IsTrue(l2.Search("ScopeTest.SearchCache.Miss"sv, cache) == s.Find("ScopeTest.SearchCache.Miss"sv));
+
+			// moving a scope under another parent changes what it sees
+			Assert::IsTrue(l2.Search("health"sv, cache) == l1.Find("health"sv));
+			other["health"s] = 10;
+			other.Adopt("adopted"s, l2);
+			Assert::IsTrue(l2.Search("health"sv, cache) == other.Find("health"sv));
+			s.Adopt("adopted"s, l2);
+			Assert::IsTrue(l2.Search("health"sv, cache) == s.Find("health"sv));
+
+			// clearing the owner, which also takes it away from its parent
+			Assert::IsTrue(l1.Search("health"sv, cache) == l1.Find("health"sv));
+			l1.Clear();
+			Assert::IsNull(l1.GetParent());
+			Assert::IsNull(l1.Search("health"sv, cache));
+			delete &l1;
+		}
+
+		TEST_METHOD(TestSearchManyNames)
+		{
+			// enough names to fill every bit of a scope's name filter
+			Scope s;
+			Scope& child = s.AppendScope("child"s);
+			for (int i = 0; i < 500; ++i)
+			{
+				s["name" + std::to_string(i)] = i;
+			}
+
+			for (int i = 0; i < 500; ++i)
+			{
+				const std::string name = "name" + std::to_string(i);
+				Assert::IsTrue(child.Search(name) == s.Find(name));
+				Assert::IsNull(child.Find(name));
+			}
+
+			Assert::IsNull(child.Search("name500"s));
+		}
+
 		TEST_METHOD(TestFindName)
 		{
 			Scope s;
@@ -501,8 +654,10 @@ namespace UnitTestLibraryDesktop
 
 	private:
 		static _CrtMemState sStartMemState;
+		static size_t sStartSlabsInUse;
 
 	};
 
 	_CrtMemState ScopeTest::sStartMemState;
+	size_t ScopeTest::sStartSlabsInUse;
 }
@@ -0,0 +1,252 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <cstdint>
+#include <cstring>
+#include <thread>
+#include "SlabAllocator.h"
+#include "SList.h"
+#include "HashMap.h"
+#include "Utility.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(SlabAllocatorTest)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+			sStartSlabsInUse = SlabAllocator<>::Statistics().InUse;
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+
+			// slab nodes are out of sight of the CRT heap, their pools keep their own count
+			if (SlabAllocator<>::Statistics().InUse != sStartSlabsInUse)
+			{
+				Assert::Fail(L"Slab Leaks!");
+			}
+		}
+
+		TEST_METHOD(TestAllocate)
+		{
+			SlabAllocator<> allocator;
+			Assert::IsTrue(allocator == SlabAllocator<>());
+
+			const SlabStatistics before = SlabAllocator<>::Statistics(NodeSize);
+			void* nodes[Count];
+			for (size_t i = 0; i < Count; ++i)
+			{
+				nodes[i] = allocator.Allocate(NodeSize, alignof(std::max_align_t));
+				Assert::AreEqual(0_z, reinterpret_cast<std::uintptr_t>(nodes[i]) % SlabPool::NodeAlignment);
+				std::memset(nodes[i], static_cast<int>(i), NodeSize);
+			}
+
+			const SlabStatistics during = SlabAllocator<>::Statistics(NodeSize);
+			Assert::AreEqual(before.InUse + Count, during.InUse);
+			Assert::IsTrue(during.Slabs > before.Slabs);
+			Assert::IsTrue(during.Capacity >= during.InUse);
+			Assert::IsTrue(during.Utilisation() > 0.0f && during.Utilisation() <= 1.0f);
+
+			for (size_t i = 0; i < Count; ++i)
+			{
+				Assert::AreEqual(static_cast<unsigned char>(i), static_cast<unsigned char*>(nodes[i])[NodeSize - 1]);
+			}
+
+			// freed nodes are handed out again before any new slab is taken
+			allocator.Deallocate(nodes[7], NodeSize, alignof(std::max_align_t));
+			nodes[7] = allocator.Allocate(NodeSize, alignof(std::max_align_t));
+			Assert::AreEqual(during.Slabs, SlabAllocator<>::Statistics(NodeSize).Slabs);
+
+			for (size_t i = 0; i < Count; ++i)
+			{
+				allocator.Deallocate(nodes[i], NodeSize, alignof(std::max_align_t));
+			}
+			allocator.Deallocate(nullptr, NodeSize, alignof(std::max_align_t));
+
+			const SlabStatistics after = SlabAllocator<>::Statistics(NodeSize);
+			Assert::AreEqual(before.InUse, after.InUse);
+			Assert::IsTrue(after.Slabs <= before.Slabs + 1);
+
+			SlabAllocator<>::Trim();
+			Assert::IsTrue(SlabAllocator<>::Statistics(NodeSize).Slabs <= before.Slabs);
+		}
+
+		TEST_METHOD(TestLargeBlocks)
+		{
+			SlabAllocator<> allocator;
+			const SlabStatistics before = SlabAllocator<>::Statistics();
+
+			void* block = allocator.Allocate(SlabPoolSet::MaxNodeSize + 1, alignof(int));
+			void* aligned = allocator.Allocate(32, 64);
+			Assert::AreEqual(before.InUse, SlabAllocator<>::Statistics().InUse);
+
+			allocator.Deallocate(block, SlabPoolSet::MaxNodeSize + 1, alignof(int));
+			allocator.Deallocate(aligned, 32, 64);
+			Assert::IsFalse(SlabPoolSet::Handles(0, alignof(int)));
+		}
+
+		TEST_METHOD(TestReallocate)
+		{
+			SlabAllocator<> allocator;
+			const SlabStatistics before = SlabAllocator<>::Statistics();
+
+			int* memory = static_cast<int*>(allocator.Reallocate(nullptr, 0, sizeof(int) * 4, alignof(int)));
+			for (int i = 0; i < 4; ++i)
+			{
+				memory[i] = i;
+			}
+			Assert::AreEqual(before.InUse + 1, SlabAllocator<>::Statistics().InUse);
+
+			// from a node to the heap and back
+			memory = static_cast<int*>(allocator.Reallocate(memory, sizeof(int) * 4, sizeof(int) * 256, alignof(int)));
+			Assert::AreEqual(before.InUse, SlabAllocator<>::Statistics().InUse);
+			memory = static_cast<int*>(allocator.Reallocate(memory, sizeof(int) * 256, sizeof(int) * 512, alignof(int)));
+			memory = static_cast<int*>(allocator.Reallocate(memory, sizeof(int) * 512, sizeof(int) * 2, alignof(int)));
+			Assert::AreEqual(before.InUse + 1, SlabAllocator<>::Statistics().InUse);
+			Assert::AreEqual(0, memory[0]);
+			Assert::AreEqual(1, memory[1]);
+
+			Assert::IsNull(allocator.Reallocate(memory, sizeof(int) * 2, 0, alignof(int)));
+			Assert::AreEqual(before.InUse, SlabAllocator<>::Statistics().InUse);
+		}
+
+		TEST_METHOD(TestThreadLocal)
+		{
+			const SlabStatistics shared = SlabAllocator<>::Statistics();
+			size_t threadInUse = 0;
+			size_t threadInUseAfter = 1;
+
+			std::thread thread([&threadInUse, &threadInUseAfter]
+			{
+				{
+					SList<int, SlabAllocator<true>> list;
+					for (int i = 0; i < 100; ++i)
+					{
+						list.PushBack(i);
+					}
+					threadInUse = SlabAllocator<true>::Statistics().InUse;
+				}
+				threadInUseAfter = SlabAllocator<true>::Statistics().InUse;
+			});
+			thread.join();
+
+			Assert::AreEqual(100_z, threadInUse);
+			Assert::AreEqual(0_z, threadInUseAfter);
+			Assert::AreEqual(shared.InUse, SlabAllocator<>::Statistics().InUse);
+			Assert::AreEqual(0_z, SlabAllocator<true>::Statistics().InUse);
+		}
+
+		TEST_METHOD(TestThreadExit)
+		{
+			const SlabStatistics shared = SlabAllocator<>::Statistics(NodeSize);
+			const size_t count = 5000;
+			void* nodes[count];
+
+			// the thread leaves its nodes behind, enough of them to fill a slab or two
+			std::thread thread([&nodes]
+			{
+				SlabAllocator<true> allocator;
+				for (size_t i = 0; i < count; ++i)
+				{
+					nodes[i] = allocator.Allocate(NodeSize, alignof(std::max_align_t));
+					std::memset(nodes[i], static_cast<int>(i & 0xFF), NodeSize);
+				}
+			});
+			thread.join();
+
+			// they live on in the shared pools, intact
+			const SlabStatistics adopted = SlabAllocator<>::Statistics(NodeSize);
+			Assert::AreEqual(shared.InUse + count, adopted.InUse);
+			Assert::IsTrue(adopted.Slabs > shared.Slabs);
+			for (size_t i = 0; i < count; ++i)
+			{
+				Assert::AreEqual(static_cast<int>(i & 0xFF), static_cast<int>(*static_cast<unsigned char*>(nodes[i])));
+			}
+
+			// and this thread can release them through its own thread local allocator
+			SlabAllocator<true> allocator;
+			for (size_t i = 0; i < count; ++i)
+			{
+				allocator.Deallocate(nodes[i], NodeSize, alignof(std::max_align_t));
+			}
+
+			Assert::AreEqual(shared.InUse, SlabAllocator<>::Statistics(NodeSize).InUse);
+			Assert::AreEqual(0_z, SlabAllocator<true>::Statistics().InUse);
+		}
+
+		TEST_METHOD(TestConcurrentUse)
+		{
+			const SlabStatistics before = SlabAllocator<>::Statistics();
+
+			auto work = []
+			{
+				SList<std::int64_t> list;
+				for (int repetition = 0; repetition < 50; ++repetition)
+				{
+					for (std::int64_t i = 0; i < 200; ++i)
+					{
+						list.PushFront(i);
+					}
+					list.Clear();
+				}
+			};
+
+			std::thread threads[4] = { std::thread(work), std::thread(work), std::thread(work), std::thread(work) };
+			for (auto& thread : threads)
+			{
+				thread.join();
+			}
+
+			Assert::AreEqual(before.InUse, SlabAllocator<>::Statistics().InUse);
+		}
+
+		TEST_METHOD(TestContainers)
+		{
+			const SlabStatistics before = SlabAllocator<>::Statistics();
+			{
+				SList<int> list;
+				HashMap<int, int> map(256);
+				for (int i = 0; i < 100; ++i)
+				{
+					list.PushBack(i);
+					map.Insert({ i, i });
+				}
+
+				// every element is one node, the bucket array is too big for the pools
+				const SlabStatistics during = SlabAllocator<>::Statistics();
+				Assert::AreEqual(before.InUse + 200, during.InUse);
+
+				SList<int> copy = list;
+				Assert::AreEqual(before.InUse + 300, SlabAllocator<>::Statistics().InUse);
+			}
+			Assert::AreEqual(before.InUse, SlabAllocator<>::Statistics().InUse);
+		}
+
+	private:
+		inline static const size_t NodeSize = 24;
+		inline static const size_t Count = 10000;
+
+		static _CrtMemState sStartMemState;
+		static size_t sStartSlabsInUse;
+	};
+
+	_CrtMemState SlabAllocatorTest::sStartMemState;
+	size_t SlabAllocatorTest::sStartSlabsInUse;
+}
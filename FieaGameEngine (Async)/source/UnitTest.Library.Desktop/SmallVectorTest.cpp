@@ -0,0 +1,251 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <algorithm>
+#include <limits>
+#include <new>
+#include "SmallVector.h"
+#include "Foo.h"
+#include "ToStringSpecializations.h"
+#include "Utility.h"
+#include "SlabAllocator.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(SmallVectorTest)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+			sStartSlabsInUse = SlabAllocator<>::Statistics().InUse;
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+
+			// slab nodes are out of sight of the CRT heap, their pools keep their own count
+			if (SlabAllocator<>::Statistics().InUse != sStartSlabsInUse)
+			{
+				Assert::Fail(L"Slab Leaks!");
+			}
+		}
+
+		TEST_METHOD(TestConstructor)
+		{
+			SmallVector<Foo, 4> list;
+			Assert::AreEqual(list.Size(), 0_z);
+			Assert::AreEqual(list.Capacity(), 4_z);
+			Assert::IsTrue(list.IsInline());
+
+			SmallVector<Foo, 4> list2(10);
+			Assert::AreEqual(list2.Capacity(), 10_z);
+			Assert::IsFalse(list2.IsInline());
+
+			SmallVector<Foo, 4> list3 = { Foo(1), Foo(2), Foo(3) };
+			Assert::AreEqual(list3.Size(), 3_z);
+			Assert::IsTrue(list3.IsInline());
+			Assert::AreEqual(list3[2], Foo(3));
+		}
+
+		TEST_METHOD(TestPushBack)
+		{
+			SmallVector<Foo, 4> list;
+			for (int i = 0; i < 4; ++i)
+			{
+				Assert::AreEqual(*list.PushBack(Foo(i)), Foo(i));
+				Assert::IsTrue(list.IsInline());
+			}
+
+			list.EmplaceBack(4);
+			Assert::IsFalse(list.IsInline());
+			Assert::AreEqual(list.Capacity(), 8_z);
+			for (int i = 0; i < 5; ++i)
+			{
+				Assert::AreEqual(list[i], Foo(i));
+			}
+
+			Assert::IsFalse(list.PushBackUnique(Foo(2)).second);
+			Assert::IsTrue(list.PushBackUnique(Foo(5)).second);
+			Assert::AreEqual(list.Back(), Foo(5));
+			list.PopBack();
+			Assert::AreEqual(list.Back(), Foo(4));
+			Assert::AreEqual(list.Front(), Foo(0));
+		}
+
+		TEST_METHOD(TestCopy)
+		{
+			SmallVector<Foo, 2> inlineList = { Foo(1), Foo(2) };
+			SmallVector<Foo, 2> heapList = { Foo(1), Foo(2), Foo(3) };
+
+			SmallVector<Foo, 2> copy(inlineList);
+			Assert::IsTrue(copy.IsInline());
+			Assert::IsTrue(copy == inlineList);
+			copy[0].Data(50);
+			Assert::AreNotEqual(copy[0], inlineList[0]);
+
+			copy = heapList;
+			Assert::AreEqual(copy.Size(), 3_z);
+			Assert::IsTrue(copy == heapList);
+			copy = { Foo(7) };
+			Assert::AreEqual(copy.Size(), 1_z);
+			Assert::AreEqual(copy[0], Foo(7));
+		}
+
+		TEST_METHOD(TestMove)
+		{
+			// inline elements are moved one by one, a heap block changes hands
+			SmallVector<Foo, 2> inlineList = { Foo(1), Foo(2) };
+			SmallVector<Foo, 2> moved(std::move(inlineList));
+			Assert::AreEqual(inlineList.Size(), 0_z);
+			Assert::IsTrue(moved.IsInline());
+			Assert::AreEqual(moved[1], Foo(2));
+
+			SmallVector<Foo, 2> heapList = { Foo(1), Foo(2), Foo(3) };
+			const Foo* elements = &heapList[0];
+			SmallVector<Foo, 2> stolen(std::move(heapList));
+			Assert::AreEqual(heapList.Size(), 0_z);
+			Assert::IsTrue(heapList.IsInline());
+			Assert::IsTrue(elements == &stolen[0]);
+
+			moved = std::move(stolen);
+			Assert::AreEqual(moved.Size(), 3_z);
+			Assert::IsTrue(elements == &moved[0]);
+			Assert::AreEqual(stolen.Size(), 0_z);
+
+			stolen.PushBack(Foo(9));
+			moved = std::move(stolen);
+			Assert::AreEqual(moved.Size(), 1_z);
+			Assert::IsTrue(moved.IsInline());
+			Assert::AreEqual(moved[0], Foo(9));
+		}
+
+		TEST_METHOD(TestReserveAndShrink)
+		{
+			SmallVector<Foo, 4> list;
+			list.Reserve(2);
+			Assert::IsTrue(list.IsInline());
+			list.Reserve(6);
+			Assert::IsFalse(list.IsInline());
+			Assert::AreEqual(list.Capacity(), 6_z);
+
+			list.PushBack(Foo(1));
+			list.PushBack(Foo(2));
+			list.ShrinkToFit();
+			Assert::IsTrue(list.IsInline());
+			Assert::AreEqual(list.Capacity(), 4_z);
+			Assert::AreEqual(list[1], Foo(2));
+
+			list.Resize(6);
+			Assert::AreEqual(list.Size(), 6_z);
+			Assert::AreEqual(list[5], Foo());
+			list.ShrinkToFit();
+			Assert::AreEqual(list.Capacity(), 6_z);
+			list.Resize(1);
+			list.ShrinkToFit();
+			Assert::IsTrue(list.IsInline());
+			Assert::AreEqual(list[0], Foo(1));
+
+			list.Clear();
+			Assert::IsTrue(list.IsEmpty());
+		}
+
+		TEST_METHOD(TestOutOfMemory)
+		{
+			// a growth the heap cannot serve throws and leaves the elements where they were
+			const size_t tooMany = std::numeric_limits<size_t>::max() / (2 * sizeof(Foo));
+			SmallVector<Foo, 4> list = { Foo(1), Foo(2) };
+			Assert::ExpectException<std::bad_alloc>([&list, tooMany] { list.Reserve(tooMany); });
+			Assert::IsTrue(list.IsInline());
+			Assert::AreEqual(list[1], Foo(2));
+
+			list.Resize(6);
+			Assert::ExpectException<std::bad_alloc>([&list, tooMany] { list.Reserve(tooMany); });
+			Assert::AreEqual(list.Capacity(), 6_z);
+			Assert::AreEqual(list[1], Foo(2));
+
+			SmallVector<int, 4> numbers = { 1, 2, 3, 4, 5 };
+			Assert::ExpectException<std::bad_alloc>([&numbers, tooMany] { numbers.Reserve(tooMany); });
+			Assert::AreEqual(numbers.Capacity(), 5_z);
+			Assert::AreEqual(numbers[4], 5);
+		}
+
+		TEST_METHOD(TestRemove)
+		{
+			SmallVector<Foo, 4> list;
+			for (int i = 0; i < 10; ++i)
+			{
+				list.PushBack(Foo(i));
+			}
+
+			Assert::IsTrue(list.Remove(Foo(0)));
+			Assert::IsFalse(list.Remove(Foo(0)));
+			list.Remove(list.Find(Foo(2)), list.Find(Foo(7)));
+			Assert::AreEqual(list.Size(), 4_z);
+			Assert::AreEqual(list[1], Foo(7));
+
+			const auto expression = [&list] { list.Remove(list.end(), list.begin()); };
+			Assert::ExpectException<std::exception>(expression);
+
+			list.Remove(list.begin(), list.end());
+			Assert::IsTrue(list.IsEmpty());
+		}
+
+		TEST_METHOD(TestIterators)
+		{
+			SmallVector<Foo, 4> list = { Foo(1), Foo(2), Foo(3) };
+			int expected = 1;
+			for (const Foo& foo : list)
+			{
+				Assert::AreEqual(foo, Foo(expected++));
+			}
+
+			const SmallVector<Foo, 4>& constList = list;
+			Assert::IsTrue(constList.Find(Foo(2)) != constList.end());
+			Assert::IsTrue(constList.Find(Foo(5)) == constList.cend());
+			Assert::AreEqual(*constList.cbegin(), Foo(1));
+
+			SmallVector<int, 4> numbers = { 1, 2, 3, 0 };
+			Assert::AreEqual(4_z, static_cast<size_t>(numbers.end() - numbers.begin()));
+			Assert::AreEqual(0, numbers.begin()[3]);
+			std::rotate(numbers.begin(), numbers.end() - 1, numbers.end());
+			Assert::AreEqual(0, *numbers.begin());
+			Assert::AreEqual(3, *(numbers.cend() - 1));
+
+			// the span's pointers skip the checks, and follow the elements to the heap
+			const auto span = numbers.AsSpan();
+			std::sort(span.begin(), span.end());
+			Assert::AreEqual(0, numbers[0]);
+			numbers.PushBack(-1);
+			const auto constSpan = numbers.AsConstSpan();
+			Assert::AreEqual(5_z, constSpan.size());
+			Assert::AreEqual(-1, *std::min_element(constSpan.begin(), constSpan.end()));
+
+			const auto expression = [&list] { *list.end(); };
+			Assert::ExpectException<std::exception>(expression);
+			const auto expression2 = [] { ++SmallVector<Foo, 4>::Iterator(); };
+			Assert::ExpectException<std::exception>(expression2);
+		}
+
+	private:
+		static _CrtMemState sStartMemState;
+		static size_t sStartSlabsInUse;
+	};
+
+	_CrtMemState SmallVectorTest::sStartMemState;
+	size_t SmallVectorTest::sStartSlabsInUse;
+}
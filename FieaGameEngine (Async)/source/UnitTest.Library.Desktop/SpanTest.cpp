@@ -0,0 +1,97 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <algorithm>
+#include <type_traits>
+#include "Span.h"
+#include "Utility.h"
+#include "SlabAllocator.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(SpanTest)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+			sStartSlabsInUse = SlabAllocator<>::Statistics().InUse;
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+
+			// slab nodes are out of sight of the CRT heap, their pools keep their own count
+			if (SlabAllocator<>::Statistics().InUse != sStartSlabsInUse)
+			{
+				Assert::Fail(L"Slab Leaks!");
+			}
+		}
+
+		TEST_METHOD(TestConstructor)
+		{
+			Span<int> empty;
+			Assert::IsTrue(empty.empty());
+			Assert::AreEqual(empty.size(), 0_z);
+			Assert::IsTrue(empty.data() == nullptr);
+			Assert::IsTrue(empty.begin() == empty.end());
+
+			int values[] = { 4, 1, 3, 2 };
+			Span<int> span(values, 4);
+			Assert::IsFalse(span.empty());
+			Assert::AreEqual(span.size(), 4_z);
+			Assert::IsTrue(span.data() == values);
+			Assert::IsTrue(span.end() == values + 4);
+
+			// mutable views convert to read only ones, never the other way around
+			Span<const int> constSpan = span;
+			Assert::IsTrue(constSpan.data() == values);
+			Assert::AreEqual(constSpan.size(), 4_z);
+			Assert::IsTrue((std::is_convertible_v<Span<int>, Span<const int>>));
+			Assert::IsFalse((std::is_convertible_v<Span<const int>, Span<int>>));
+		}
+
+		TEST_METHOD(TestAccess)
+		{
+			int values[] = { 4, 1, 3, 2 };
+			Span<int> span(values, 4);
+			span[1] = 5;
+			Assert::AreEqual(values[1], 5);
+
+			int sum = 0;
+			for (int value : span)
+			{
+				sum += value;
+			}
+			Assert::AreEqual(sum, 14);
+
+			std::sort(span.begin(), span.end());
+			Assert::AreEqual(values[0], 2);
+			Assert::AreEqual(values[3], 5);
+
+			constexpr Span<const int> constSpan(nullptr, 0);
+			static_assert(constSpan.empty(), "An empty view is usable in constant expressions.");
+		}
+
+	private:
+		static _CrtMemState sStartMemState;
+		static size_t sStartSlabsInUse;
+	};
+
+	_CrtMemState SpanTest::sStartMemState;
+	size_t SpanTest::sStartSlabsInUse;
+}
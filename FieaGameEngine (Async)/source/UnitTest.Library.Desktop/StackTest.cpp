@@ -0,0 +1,162 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include "Stack.h"
+#include "TypeManager.h"
+#include "AttributedFoo.h"
+#include "Foo.h"
+#include "ToStringSpecializations.h"
+#include "Utility.h"
+#include "SlabAllocator.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(StackTest)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+			sStartSlabsInUse = SlabAllocator<>::Statistics().InUse;
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+
+			// slab nodes are out of sight of the CRT heap, their pools keep their own count
+			if (SlabAllocator<>::Statistics().InUse != sStartSlabsInUse)
+			{
+				Assert::Fail(L"Slab Leaks!");
+			}
+		}
+
+		TEST_METHOD(TestPushAndPop)
+		{
+			Stack<Foo> stack;
+			Assert::IsTrue(stack.IsEmpty());
+
+			for (int i = 0; i < 10; ++i)
+			{
+				stack.Push(Foo(i));
+			}
+			stack.Emplace(10);
+			Assert::AreEqual(11_z, stack.Size());
+
+			for (int i = 10; i >= 0; --i)
+			{
+				Assert::AreEqual(Foo(i), stack.Top());
+				stack.Pop();
+			}
+			Assert::IsTrue(stack.IsEmpty());
+
+			auto expression = [&stack] { stack.Pop(); };
+			Assert::ExpectException<std::exception>(expression);
+			auto expression2 = [&stack] { stack.Top(); };
+			Assert::ExpectException<std::exception>(expression2);
+			const Stack<Foo>& constStack = stack;
+			auto expression3 = [&constStack] { constStack.Top(); };
+			Assert::ExpectException<std::exception>(expression3);
+		}
+
+		TEST_METHOD(TestCopyAndMove)
+		{
+			Stack<Foo> stack;
+			stack.Push(Foo(1));
+			stack.Push(Foo(2));
+
+			Stack<Foo> copy = stack;
+			copy.Pop();
+			Assert::AreEqual(Foo(1), copy.Top());
+			Assert::AreEqual(Foo(2), stack.Top());
+
+			Stack<Foo> moved = std::move(stack);
+			Assert::AreEqual(2_z, moved.Size());
+			Assert::AreEqual(Foo(2), moved.Top());
+
+			copy = moved;
+			Assert::AreEqual(2_z, copy.Size());
+			copy.Clear();
+			Assert::IsTrue(copy.IsEmpty());
+		}
+
+		TEST_METHOD(TestCapacity)
+		{
+			Stack<int> stack(32);
+			Assert::AreEqual(32_z, stack.Capacity());
+
+			// steady state pushing and popping never touches the capacity
+			for (int repetition = 0; repetition < 10; ++repetition)
+			{
+				for (int i = 0; i < 32; ++i)
+				{
+					stack.Push(i);
+				}
+				while (!stack.IsEmpty())
+				{
+					stack.Pop();
+				}
+			}
+			Assert::AreEqual(32_z, stack.Capacity());
+
+			stack.Reserve(64);
+			Assert::AreEqual(64_z, stack.Capacity());
+		}
+
+		TEST_METHOD(TestInlineCapacity)
+		{
+			Stack<Foo, 4> stack;
+			Assert::AreEqual(4_z, stack.Capacity());
+
+			for (int i = 0; i < 6; ++i)
+			{
+				stack.Emplace(i);
+			}
+			Assert::IsTrue(stack.Capacity() >= 6_z);
+
+			Stack<Foo, 4> copy = stack;
+			for (int i = 5; i >= 0; --i)
+			{
+				Assert::AreEqual(Foo(i), copy.Top());
+				copy.Pop();
+			}
+
+			Stack<Foo, 4> moved = std::move(stack);
+			Assert::AreEqual(Foo(5), moved.Top());
+		}
+
+		TEST_METHOD(TestInheritanceChain)
+		{
+			auto chain = TypeManager::GetInheritanceChain(AttributedFoo::TypeIdClass());
+			Assert::AreEqual(TypeManager::InheritanceChainType().Capacity(), chain.Capacity());
+			Assert::IsFalse(chain.IsEmpty());
+
+			// the type itself is pushed first, its bases on top of it
+			while (chain.Size() > 1)
+			{
+				chain.Pop();
+			}
+			Assert::IsTrue(AttributedFoo::TypeIdClass() == chain.Top());
+		}
+
+	private:
+		static _CrtMemState sStartMemState;
+		static size_t sStartSlabsInUse;
+	};
+
+	_CrtMemState StackTest::sStartMemState;
+	size_t StackTest::sStartSlabsInUse;
+}
@@ -39,6 +39,7 @@ namespace UnitTestLibraryDesktop
 		REGISTER_TYPE(EventMessageAttributed);
 		REGISTER_TYPE(ActionCreateAction);
 		REGISTER_TYPE(ActionDeleteAction);
+		TypeManager::Freeze();
 	}
 
 	TEST_MODULE_CLEANUP(ModuleCleanup)
@@ -0,0 +1,202 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <limits>
+#include <sstream>
+#include <string>
+#include "TextWriter.h"
+#include "Datum.h"
+#include "Utility.h"
+#include "SlabAllocator.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+using namespace std::literals::string_literals;
+using namespace std::literals::string_view_literals;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(TextWriterTest)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+			sStartSlabsInUse = SlabAllocator<>::Statistics().InUse;
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+
+			// slab nodes are out of sight of the CRT heap, their pools keep their own count
+			if (SlabAllocator<>::Statistics().InUse != sStartSlabsInUse)
+			{
+				Assert::Fail(L"Slab Leaks!");
+			}
+		}
+
+		TEST_METHOD(TestBuffer)
+		{
+			std::string buffer = "start:"s;
+			{
+				TextWriter writer(buffer);
+				writer.Write('[').Write("text"sv).Write(']');
+				Assert::AreEqual(buffer, "start:[text]"s);
+				Assert::AreEqual(writer.BytesWritten(), 6_z);
+
+				// nothing to flush, the caller's buffer already has it all
+				writer.Flush();
+				Assert::AreEqual(buffer, "start:[text]"s);
+			}
+
+			Assert::AreEqual(buffer, "start:[text]"s);
+		}
+
+		TEST_METHOD(TestNumbers)
+		{
+			std::string buffer;
+			TextWriter writer(buffer);
+
+			writer.Write(0).Write(' ').Write(-42).Write(' ').Write(std::numeric_limits<std::int32_t>::min());
+			Assert::AreEqual(buffer, "0 -42 -2147483648"s);
+
+			// the fewest digits that read back exactly
+			buffer.clear();
+			writer.Write(1.0f).Write(' ').Write(0.1f).Write(' ').Write(-2.5e-8f).Write(' ').Write(1e20f);
+			Assert::AreEqual(buffer, "1 0.1 -2.5e-08 1e+20"s);
+
+			const float values[] = { 3.14159265f, 1.0f / 3.0f, std::numeric_limits<float>::max(), std::numeric_limits<float>::denorm_min() };
+			for (float value : values)
+			{
+				buffer.clear();
+				writer.Write(value);
+
+				Datum datum(Datum::DatumType::FLOAT);
+				datum.Resize(1);
+				datum.SetFromString(buffer);
+				Assert::AreEqual(datum.Get<float>(), value);
+			}
+		}
+
+		TEST_METHOD(TestVectorAndMatrix)
+		{
+			std::string buffer;
+			TextWriter writer(buffer);
+
+			const glm::vec4 vector(1.0f, -0.5f, 0.1f, 100.0f);
+			writer.Write(vector);
+			Assert::AreEqual(buffer, "vec4(1, -0.5, 0.1, 100)"s);
+
+			buffer.clear();
+			writer.Write(glm::mat4(2.0f));
+			Assert::AreEqual(buffer, "mat4x4((2, 0, 0, 0), (0, 2, 0, 0), (0, 0, 2, 0), (0, 0, 0, 2))"s);
+
+			// what is written reads back through SetFromString
+			const glm::mat4 matrix(vector, vector * 3.0f, glm::vec4(1.0f / 3.0f), glm::vec4(-7.0f));
+			buffer.clear();
+			writer.Write(matrix);
+
+			Datum datum(Datum::DatumType::MATRIX);
+			datum.Resize(1);
+			datum.SetFromString(buffer);
+			Assert::IsTrue(datum.Get<glm::mat4>() == matrix);
+		}
+
+		TEST_METHOD(TestDatum)
+		{
+			std::string buffer;
+			TextWriter writer(buffer);
+
+			Datum integers = { 1, 2, 3 };
+			writer.Write(integers, 2);
+			Assert::AreEqual(buffer, "3"s);
+
+			Datum strings = { "a \"quote\""s };
+			buffer.clear();
+			writer.Write(strings);
+			Assert::AreEqual(buffer, "a \"quote\""s);
+
+			Datum vectors = { glm::vec4(1.0f) };
+			buffer.clear();
+			writer.Write(vectors);
+			Assert::AreEqual(buffer, "vec4(1, 1, 1, 1)"s);
+
+			Assert::ExpectException<std::exception>([&writer, &integers] { writer.Write(integers, 3); });
+
+			Datum empty;
+			Assert::ExpectException<std::exception>([&writer, &empty] { writer.Write(empty); });
+
+			Datum pointers(Datum::DatumType::POINTER);
+			pointers.PushBack(static_cast<RTTI*>(nullptr));
+			Assert::ExpectException<std::exception>([&writer, &pointers] { writer.Write(pointers); });
+		}
+
+		TEST_METHOD(TestQuoted)
+		{
+			std::string buffer;
+			TextWriter writer(buffer);
+
+			writer.WriteQuoted("plain"sv);
+			Assert::AreEqual(buffer, "\"plain\""s);
+
+			buffer.clear();
+			writer.WriteQuoted("say \"hi\"\\\n\t\r\x01"sv);
+			Assert::AreEqual(buffer, R"("say \"hi\"\\\n\t\r\u0001")"s);
+
+			buffer.clear();
+			writer.WriteQuoted(""sv);
+			Assert::AreEqual(buffer, "\"\""s);
+		}
+
+		TEST_METHOD(TestStream)
+		{
+			std::ostringstream stream;
+			{
+				// a tiny buffer, so it flushes along the way
+				TextWriter writer(stream, 8);
+				for (std::int32_t i = 0; i < 100; ++i)
+				{
+					writer.Write(i).Write(',');
+				}
+
+				Assert::IsTrue(stream.str().size() > 0);
+				Assert::IsTrue(stream.str().size() < writer.BytesWritten());
+			}
+
+			// the rest arrives when the writer goes away
+			std::string expected;
+			for (std::int32_t i = 0; i < 100; ++i)
+			{
+				expected += std::to_string(i) + ",";
+			}
+
+			Assert::AreEqual(stream.str(), expected);
+
+			std::ostringstream flushed;
+			TextWriter writer(flushed);
+			writer.Write("abc"sv);
+			Assert::IsTrue(flushed.str().empty());
+			writer.Flush();
+			Assert::AreEqual(flushed.str(), "abc"s);
+			Assert::AreEqual(writer.BytesWritten(), 3_z);
+		}
+
+	private:
+		static _CrtMemState sStartMemState;
+		static size_t sStartSlabsInUse;
+	};
+
+	_CrtMemState TextWriterTest::sStartMemState;
+	size_t TextWriterTest::sStartSlabsInUse;
+}
@@ -1,26 +1,42 @@
 #include "pch.h"
 #include "CppUnitTest.h"
 #include "AttributedFoo.h"
+#include "AttributedBar.h"
+#include "Foo.h"
 #include "TypeManager.h"
 #include "ToStringSpecializations.h"
 #include "Utility.h"
+#include "SlabAllocator.h"
+#include <cstddef>
 #include <string>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace FieaGameEngine;
 using namespace std::literals::string_literals;
+using namespace std::literals::string_view_literals;
 
 namespace UnitTestLibraryDesktop
 {
 	TEST_CLASS(TypeManagerTest)
 	{
 	public:
+		TEST_CLASS_INITIALIZE(ClassInitialize)
+		{
+			// other tests register their own types, which thaws the registry the module initializer froze.
+			// Freezing it again here keeps the rebuild out of the leak checks
+			TypeManager::Freeze();
+
+			// the layout handed out for unregistered types is built on first use
+			TypeManager::GetLayout(Foo::TypeIdClass());
+		}
+
 		TEST_METHOD_INITIALIZE(Initialize)
 		{
 #if defined(DEBUG) || defined(_DEBUG)
 			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
 			_CrtMemCheckpoint(&sStartMemState);
 #endif
+			sStartSlabsInUse = SlabAllocator<>::Statistics().InUse;
 		}
 
 		TEST_METHOD_CLEANUP(Cleanup)
@@ -34,11 +50,148 @@ namespace UnitTestLibraryDesktop
 				Assert::Fail(L"Memory Leaks!");
 			}
 #endif
+
+			// slab nodes are out of sight of the CRT heap, their pools keep their own count
+			if (SlabAllocator<>::Statistics().InUse != sStartSlabsInUse)
+			{
+				Assert::Fail(L"Slab Leaks!");
+			}
+		}
+
+		TEST_METHOD(TestFreeze)
+		{
+			TypeManager::Freeze();
+			Assert::IsTrue(TypeManager::IsFrozen());
+			Assert::IsTrue(TypeManager::FindBaseId(AttributedFoo::TypeIdClass()) == std::make_pair(true, Attributed::TypeIdClass()));
+			Assert::IsTrue(TypeManager::GetSignatureCount(AttributedFoo::TypeIdClass()) > 0_z);
+			Assert::IsFalse(TypeManager::FindBaseId(Foo::TypeIdClass()).first);
+			Assert::ExpectException<std::exception>([] { TypeManager::GetSignatures(Foo::TypeIdClass()); });
+
+			TypeManager::RegisterType(Foo::TypeIdClass(), SignatureListType(), AttributedFoo::TypeIdClass());
+			Assert::IsFalse(TypeManager::IsFrozen());
+			Assert::IsTrue(TypeManager::FindBaseId(Foo::TypeIdClass()) == std::make_pair(true, AttributedFoo::TypeIdClass()));
+			Assert::AreEqual(TypeManager::GetInheritanceChain(Foo::TypeIdClass()).Size(), TypeManager::GetInheritanceChain(AttributedFoo::TypeIdClass()).Size() + 1);
+
+			TypeManager::UnregisterType(Foo::TypeIdClass());
+			TypeManager::Freeze();
+			Assert::IsTrue(TypeManager::IsFrozen());
+			Assert::IsFalse(TypeManager::FindBaseId(Foo::TypeIdClass()).first);
+			Assert::IsTrue(TypeManager::FindBaseId(AttributedFoo::TypeIdClass()).first);
+		}
+
+		TEST_METHOD(TestLayout)
+		{
+			TypeManager::Freeze();
+
+			// 'this' comes first, then the signatures of every type in the chain, root first
+			const auto& layout = TypeManager::GetLayout(AttributedFoo::TypeIdClass());
+			const auto& signatures = TypeManager::GetSignatures(AttributedFoo::TypeIdClass());
+			Assert::AreEqual(layout.PrescribedCount, signatures.Size() + 1);
+			Assert::AreEqual(layout.Signatures.Size(), signatures.Size());
+			Assert::AreEqual(layout.Names.Size(), layout.PrescribedCount);
+			Assert::AreEqual(layout.Names.At("this"sv), 0_z);
+			Assert::AreEqual(layout.Prototype.Size(), layout.PrescribedCount);
+			Assert::IsTrue(layout.Prototype.EntryAt(0).first == "this"sv);
+			for (size_t i = 0; i < signatures.Size(); ++i)
+			{
+				Assert::IsTrue(layout.Signatures[i].Name == signatures[i].Name);
+				Assert::AreEqual(layout.Signatures[i].Offset, signatures[i].Offset);
+				Assert::AreEqual(layout.Names.At(signatures[i].Name), i + 1);
+
+				// instances copy their entries from the prototype, bound to nothing yet
+				const auto& [name, datum] = layout.Prototype.EntryAt(i + 1);
+				Assert::IsTrue(name == signatures[i].Name);
+				Assert::IsTrue(datum.Type() == signatures[i].Type);
+				Assert::AreEqual(datum.Size(), 0_z);
+			}
+			Assert::IsFalse(layout.Names.ContainsKey("TypeManagerTest.Layout"sv));
+
+			// unregistered types only have 'this'
+			const auto& unregistered = TypeManager::GetLayout(Foo::TypeIdClass());
+			Assert::AreEqual(unregistered.PrescribedCount, 1_z);
+			Assert::IsTrue(unregistered.Signatures.IsEmpty());
+			Assert::IsTrue(unregistered.Names.ContainsKey("this"sv));
+			Assert::AreEqual(unregistered.Prototype.Size(), 1_z);
+
+			// the registry moves its entries around when it changes, keep copies
+			const size_t count = signatures.Size();
+			const Atom first = signatures[0].Name;
+
+			// registering a derived type flattens its base's signatures in front of its own
+			SignatureListType derived;
+			derived.PushBack(Signature("TypeManagerTest.Layout"sv, Datum::DatumType::INTEGER, 1, sizeof(AttributedFoo)));
+			TypeManager::RegisterType(Foo::TypeIdClass(), std::move(derived), AttributedFoo::TypeIdClass());
+			{
+				const auto& flattened = TypeManager::GetLayout(Foo::TypeIdClass());
+				Assert::AreEqual(flattened.PrescribedCount, count + 2);
+				Assert::IsTrue(flattened.Signatures[count].Name == "TypeManagerTest.Layout"sv);
+				Assert::AreEqual(flattened.Names.At("TypeManagerTest.Layout"sv), count + 1);
+				Assert::AreEqual(flattened.Names.At(first), 1_z);
+			}
+
+			TypeManager::UnregisterType(Foo::TypeIdClass());
+			Assert::AreEqual(TypeManager::GetLayout(Foo::TypeIdClass()).PrescribedCount, 1_z);
+			Assert::AreEqual(TypeManager::GetLayout(AttributedFoo::TypeIdClass()).PrescribedCount, count + 1);
+			TypeManager::Freeze();
+		}
+
+		TEST_METHOD(TestRedeclaredName)
+		{
+			TypeManager::Freeze();
+
+			// the registry moves its entries around when it changes, keep copies
+			const auto& signatures = TypeManager::GetSignatures(AttributedFoo::TypeIdClass());
+			const size_t count = signatures.Size();
+			const Signature first = signatures[0];
+
+			// a name the base already declares, and 'this', keep the attributes they already have
+			SignatureListType derived;
+			derived.PushBack(Signature(first.Name, first.Type, 1, sizeof(AttributedFoo)));
+			derived.PushBack(Signature("this"sv, Datum::DatumType::POINTER, 1, sizeof(AttributedFoo)));
+			derived.PushBack(Signature("TypeManagerTest.Redeclared"sv, Datum::DatumType::INTEGER, 1, sizeof(AttributedFoo)));
+			TypeManager::RegisterType(Foo::TypeIdClass(), std::move(derived), AttributedFoo::TypeIdClass());
+			{
+				const auto& layout = TypeManager::GetLayout(Foo::TypeIdClass());
+				Assert::AreEqual(layout.PrescribedCount, count + 2);
+				Assert::AreEqual(layout.Signatures.Size() + 1, layout.PrescribedCount);
+				Assert::AreEqual(layout.Names.Size(), layout.PrescribedCount);
+				Assert::AreEqual(layout.Prototype.Size(), layout.PrescribedCount);
+				for (size_t i = 0; i < layout.Signatures.Size(); ++i)
+				{
+					Assert::IsTrue(layout.Prototype.EntryAt(i + 1).first == layout.Signatures[i].Name);
+					Assert::AreEqual(layout.Names.At(layout.Signatures[i].Name), i + 1);
+				}
+
+				Assert::AreEqual(layout.Signatures[0].Offset, first.Offset);
+				Assert::AreEqual(layout.Names.At("TypeManagerTest.Redeclared"sv), count + 1);
+			}
+			TypeManager::UnregisterType(Foo::TypeIdClass());
+
+			// an instance of a type naming an attribute twice populates without tripping over it
+			SignatureListType twice;
+			twice.PushBack(Signature("Integer"sv, Datum::DatumType::INTEGER, 1, offsetof(AttributedBar, Integer)));
+			twice.PushBack(Signature("Integer"sv, Datum::DatumType::INTEGER, 1, offsetof(AttributedBar, Integer)));
+			TypeManager::RegisterType(AttributedBar::TypeIdClass(), std::move(twice), Attributed::TypeIdClass());
+			{
+				AttributedBar bar;
+				bar.Integer = 5;
+				Assert::AreEqual(bar.PrescribedAttributes().Size(), 2_z);
+				Assert::AreEqual(bar["Integer"s].Get<std::int32_t>(), 5);
+
+				AttributedBar copy = bar;
+				Assert::AreEqual(copy["Integer"s].Get<std::int32_t>(), 5);
+				Assert::AreEqual(copy.Size(), 2_z);
+			}
+			TypeManager::UnregisterType(AttributedBar::TypeIdClass());
+
+			TypeManager::Freeze();
 		}
 
 	private:
 		static _CrtMemState sStartMemState;
+		static size_t sStartSlabsInUse;
 	};
 
 	_CrtMemState TypeManagerTest::sStartMemState;
+	size_t TypeManagerTest::sStartSlabsInUse;
 }
@@ -0,0 +1,212 @@
+#include "pch.h"
+#include "CppUnitTest.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <execution>
+#include <iterator>
+#include <random>
+#include <vector>
+#include "vector.h"
+#include "HashMap.h"
+#include "Scope.h"
+#include "Utility.h"
+#include "SlabAllocator.h"
+
+using namespace Microsoft::VisualStudio::CppUnitTestFramework;
+using namespace FieaGameEngine;
+
+namespace UnitTestLibraryDesktop
+{
+	TEST_CLASS(VectorBenchmark)
+	{
+	public:
+		TEST_METHOD_INITIALIZE(Initialize)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
+			_CrtMemCheckpoint(&sStartMemState);
+#endif
+			sStartSlabsInUse = SlabAllocator<>::Statistics().InUse;
+		}
+
+		TEST_METHOD_CLEANUP(Cleanup)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			_CrtMemState endMemState, diffMemState;
+			_CrtMemCheckpoint(&endMemState);
+			if (_CrtMemDifference(&diffMemState, &sStartMemState, &endMemState))
+			{
+				_CrtMemDumpStatistics(&diffMemState);
+				Assert::Fail(L"Memory Leaks!");
+			}
+#endif
+
+			// slab nodes are out of sight of the CRT heap, their pools keep their own count
+			if (SlabAllocator<>::Statistics().InUse != sStartSlabsInUse)
+			{
+				Assert::Fail(L"Slab Leaks!");
+			}
+		}
+
+		TEST_METHOD(Growth)
+		{
+			// plain data keeps growing through realloc, the move constructed copy of glm::vec4 shows the other path
+			Assert::IsTrue(IsTriviallyRelocatableV<std::int32_t>);
+			Assert::IsTrue(IsTriviallyRelocatableV<glm::vec4>);
+			Assert::IsFalse(IsTriviallyRelocatableV<MovedVec4>);
+
+			Logger::WriteMessage("Vector growth from empty (ns per PushBack)\n");
+			Report("int32_t", Measure<std::int32_t>());
+			Report("glm::vec4", Measure<glm::vec4>());
+			Report("moved vec4", Measure<MovedVec4>());
+		}
+
+		TEST_METHOD(Algorithms)
+		{
+			// random access iterators let the standard algorithms take their fast paths on engine vectors
+			Logger::WriteMessage("Algorithms over 65536 shuffled ints (ns per element)\n");
+			Report("sort", MeasureAlgorithm<Vector<int>>([](auto& values) { std::sort(values.begin(), values.end()); }));
+			Report("std sort", MeasureAlgorithm<std::vector<int>>([](auto& values) { std::sort(values.begin(), values.end()); }));
+			Report("par sort", MeasureAlgorithm<Vector<int>>([](auto& values) { std::sort(std::execution::par_unseq, values.begin(), values.end()); }));
+			Report("partition", MeasureAlgorithm<Vector<int>>([](auto& values) { std::partition(values.begin(), values.end(), [](int value) { return value % 2 == 0; }); }));
+			Report("std partition", MeasureAlgorithm<std::vector<int>>([](auto& values) { std::partition(values.begin(), values.end(), [](int value) { return value % 2 == 0; }); }));
+
+			// the span skips the checks of the iterators, its pointers are what std::vector hands out too
+			Report("span sort", MeasureAlgorithm<Vector<int>>([](auto& values) { const auto span = values.AsSpan(); std::sort(span.begin(), span.end()); }));
+			Report("span part.", MeasureAlgorithm<Vector<int>>([](auto& values) { const auto span = values.AsSpan(); std::partition(span.begin(), span.end(), [](int value) { return value % 2 == 0; }); }));
+		}
+
+		TEST_METHOD(BulkInsertion)
+		{
+			// a single growth and, for plain data, a single memcpy instead of one PushBack per element
+			Logger::WriteMessage("Appending 65536 elements to an empty vector (ns per element)\n");
+			Report("int loop", MeasureAppend<std::int32_t>([](auto& vector, const auto& source) { for (const auto& value : source) { vector.PushBack(value); } }));
+			Report("int inserter", MeasureAppend<std::int32_t>([](auto& vector, const auto& source) { std::copy(source.begin(), source.end(), std::back_inserter(vector)); }));
+			Report("int Append", MeasureAppend<std::int32_t>([](auto& vector, const auto& source) { vector.Append(source); }));
+			Report("vec4 loop", MeasureAppend<MovedVec4>([](auto& vector, const auto& source) { for (const auto& value : source) { vector.PushBack(value); } }));
+			Report("vec4 Append", MeasureAppend<MovedVec4>([](auto& vector, const auto& source) { vector.Append(source); }));
+			Report("fill loop", MeasureAppend<std::int32_t>([](auto& vector, const auto& source) { for (size_t i = 0; i < source.Size(); ++i) { vector.EmplaceBack(1); } }));
+			Report("EmplaceBackN", MeasureAppend<std::int32_t>([](auto& vector, const auto& source) { vector.EmplaceBackN(source.Size(), 1); }));
+		}
+
+		TEST_METHOD(Footprint)
+		{
+			// the callback policy is the layout every vector had before growth became a template parameter
+			using CallbackVector = Vector<std::int32_t, DefaultComparator<std::int32_t>, DefaultAllocator, CallbackGrowth>;
+			Assert::IsTrue(sizeof(Vector<std::int32_t>) < sizeof(CallbackVector));
+
+			Logger::WriteMessage("Footprint (bytes)\n");
+			ReportSize("callback", sizeof(CallbackVector));
+			ReportSize("geometric", sizeof(Vector<std::int32_t>));
+			ReportSize("no growth", sizeof(Vector<std::int32_t, DefaultComparator<std::int32_t>, DefaultAllocator, NoGrowth>));
+			ReportSize("HashMap", sizeof(HashMap<std::string, Datum>));
+			ReportSize("Scope", sizeof(Scope));
+		}
+
+	private:
+		/// <summary>
+		/// Same bytes as glm::vec4, but its user provided move constructor makes it non trivially relocatable
+		/// </summary>
+		struct MovedVec4 final
+		{
+			MovedVec4(float value) : Value(value) {}
+			MovedVec4(const MovedVec4& other) : Value(other.Value) {}
+			MovedVec4(MovedVec4&& other) noexcept : Value(other.Value) {}
+
+			glm::vec4 Value;
+		};
+
+		template <typename T>
+		static double Measure()
+		{
+			double total = 0.0;
+			for (size_t repetition = 0; repetition < sRepetitions; ++repetition)
+			{
+				Vector<T> vector;
+				const auto start = std::chrono::high_resolution_clock::now();
+				for (size_t i = 0; i < sCount; ++i)
+				{
+					vector.PushBack(T(static_cast<float>(i)));
+				}
+				const auto end = std::chrono::high_resolution_clock::now();
+				Assert::AreEqual(sCount, vector.Size());
+
+				total += std::chrono::duration<double, std::nano>(end - start).count();
+			}
+
+			return total / static_cast<double>(sCount * sRepetitions);
+		}
+
+		template <typename T, typename TAppend>
+		static double MeasureAppend(TAppend append)
+		{
+			Vector<T> source(sCount);
+			for (size_t i = 0; i < sCount; ++i)
+			{
+				source.PushBack(T(static_cast<float>(i)));
+			}
+
+			double total = 0.0;
+			for (size_t repetition = 0; repetition < sRepetitions; ++repetition)
+			{
+				Vector<T> vector;
+				const auto start = std::chrono::high_resolution_clock::now();
+				append(vector, source);
+				const auto end = std::chrono::high_resolution_clock::now();
+				Assert::AreEqual(sCount, vector.Size());
+
+				total += std::chrono::duration<double, std::nano>(end - start).count();
+			}
+
+			return total / static_cast<double>(sCount * sRepetitions);
+		}
+
+		template <typename TContainer, typename TAlgorithm>
+		static double MeasureAlgorithm(TAlgorithm algorithm)
+		{
+			std::mt19937 generator(42);
+			double total = 0.0;
+			for (size_t repetition = 0; repetition < sRepetitions; ++repetition)
+			{
+				TContainer values;
+				for (size_t i = 0; i < sCount; ++i)
+				{
+					values.push_back(static_cast<int>(generator()));
+				}
+
+				const auto start = std::chrono::high_resolution_clock::now();
+				algorithm(values);
+				const auto end = std::chrono::high_resolution_clock::now();
+
+				total += std::chrono::duration<double, std::nano>(end - start).count();
+			}
+
+			return total / static_cast<double>(sCount * sRepetitions);
+		}
+
+		static void Report(const char* name, double nanoseconds)
+		{
+			char line[128];
+			sprintf_s(line, "  %-12s %8.2f\n", name, nanoseconds);
+			Logger::WriteMessage(line);
+		}
+
+		static void ReportSize(const char* name, size_t bytes)
+		{
+			char line[128];
+			sprintf_s(line, "  %-12s %8zu\n", name, bytes);
+			Logger::WriteMessage(line);
+		}
+
+		inline static const size_t sCount = 1 << 16;
+		inline static const size_t sRepetitions = 8;
+
+		static _CrtMemState sStartMemState;
+		static size_t sStartSlabsInUse;
+	};
+
+	_CrtMemState VectorBenchmark::sStartMemState;
+	size_t VectorBenchmark::sStartSlabsInUse;
+}
@@ -1,9 +1,13 @@
 #include "pch.h"
 #include "CppUnitTest.h"
 #include "vector.h"
+#include "SList.h"
+#include <memory>
+#include <algorithm>
 #include "Foo.h"
 #include "ToStringSpecializations.h"
 #include "Utility.h"
+#include "SlabAllocator.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 using namespace FieaGameEngine;
@@ -19,6 +23,7 @@ namespace UnitTestLibraryDesktop
 			_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF);
 			_CrtMemCheckpoint(&sStartMemState);
 #endif
+			sStartSlabsInUse = SlabAllocator<>::Statistics().InUse;
 		}
 
 		TEST_METHOD_CLEANUP(Cleanup)
@@ -32,6 +37,12 @@ namespace UnitTestLibraryDesktop
 				Assert::Fail(L"Memory Leaks!");
 			}
 #endif
+
+			// slab nodes are out of sight of the CRT heap, their pools keep their own count
+			if (SlabAllocator<>::Statistics().InUse != sStartSlabsInUse)
+			{
+				Assert::Fail(L"Slab Leaks!");
+			}
 		}
 
 		TEST_METHOD(TestDefaultConstructor)
@@ -76,10 +87,10 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual(list[0], Foo(1));
 		}
 
-		TEST_METHOD(TestIncrementCallbackConstructor)
+		TEST_METHOD(TestGrowthPolicyConstructor)
 		{
 			const auto increment = [](size_t, size_t capacity) { return capacity + 1; };
-			Vector<Foo> list(0, increment);
+			Vector<Foo, DefaultComparator<Foo>, DefaultAllocator, CallbackGrowth> list(0, increment);
 			Assert::AreEqual(list.Size(), 0_z);
 			Assert::AreEqual(list.Capacity(), 0_z);
 			list.PushBack(Foo(1));
@@ -180,7 +191,7 @@ namespace UnitTestLibraryDesktop
 
 		TEST_METHOD(TestPushBack)
 		{
-			Vector<Foo> list;
+			Vector<Foo, DefaultComparator<Foo>, DefaultAllocator, CallbackGrowth> list;
 			const int foos = 10;
 			for (int i = 0; i < foos; ++i)
 			{
@@ -193,7 +204,7 @@ namespace UnitTestLibraryDesktop
 
 			list.ShrinkToFit();
 			const auto increment = [](size_t, size_t) { return 0_z; };
-			list.SetIncrementCallback(increment);
+			list.SetGrowthPolicy(increment);
 			const auto expression = [&list] { list.PushBack(Foo()); };
 			Assert::ExpectException<std::exception>(expression);
 
@@ -253,6 +264,42 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual(list.Capacity(), 1_z);
 		}
 
+		TEST_METHOD(TestRelocation)
+		{
+			Assert::IsTrue(IsTriviallyRelocatableV<std::int32_t>);
+			Assert::IsTrue(IsTriviallyRelocatableV<glm::vec4>);
+			Assert::IsTrue(IsTriviallyRelocatableV<SList<Foo>>);
+			Assert::IsFalse(IsTriviallyRelocatableV<std::shared_ptr<int>>);
+			Assert::IsFalse(IsTriviallyRelocatableV<SelfAware>);
+
+			// elements that know their own address must be moved through their constructors
+			Vector<SelfAware> list;
+			for (int i = 0; i < 50; ++i)
+			{
+				list.EmplaceBack(i);
+			}
+			list.Remove(list.Find(SelfAware(10)), list.Find(SelfAware(20)));
+			list.ShrinkToFit();
+			Assert::AreEqual(40_z, list.Size());
+			for (const SelfAware& item : list)
+			{
+				Assert::IsTrue(item.IsInPlace());
+			}
+			Assert::AreEqual(20, list[10].Data);
+
+			const std::shared_ptr<int> shared = std::make_shared<int>(5);
+			Vector<std::shared_ptr<int>> pointers;
+			for (int i = 0; i < 50; ++i)
+			{
+				pointers.PushBack(shared);
+			}
+			pointers.Remove(pointers.begin());
+			pointers.ShrinkToFit();
+			Assert::AreEqual(50L, shared.use_count());
+			pointers.Clear();
+			Assert::AreEqual(1L, shared.use_count());
+		}
+
 		TEST_METHOD(TestClear)
 		{
 			Vector<Foo> list;
@@ -321,6 +368,13 @@ namespace UnitTestLibraryDesktop
 			const auto expression2 = [&list] { list.Remove(list.begin(), Vector<Foo>::Iterator()); };
 			Assert::ExpectException<std::exception>(expression2);
 
+			// an end iterator taken before a shrink is past the new end
+			const auto staleEnd = list.end();
+			list.PopBack();
+			const auto expression3 = [&list, &staleEnd] { list.Remove(list.begin(), staleEnd); };
+			Assert::ExpectException<std::exception>(expression3);
+			Assert::AreEqual(list.Size(), capacity - 7);
+
 			list.Remove(list.begin(), list.end());
 			Assert::AreEqual(list.Size(), 0_z);
 			Assert::AreEqual(list.Capacity(), capacity);
@@ -357,6 +411,210 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual(constList.end(), constList.cend());
 		}
 
+		TEST_METHOD(TestAsSpan)
+		{
+			Vector<int> list = { 5, 3, 8, 1, 9, 2 };
+			const auto span = list.AsSpan();
+			Assert::AreEqual(list.Size(), span.size());
+			Assert::IsTrue(&span[0] == &list.Front());
+
+			std::sort(span.begin(), span.end());
+			Assert::IsTrue(std::is_sorted(list.cbegin(), list.cend()));
+			Assert::AreEqual(9, list.Back());
+
+			const Vector<int>& constList = list;
+			Assert::IsTrue(constList.AsSpan().data() == span.data());
+			const auto constSpan = constList.AsConstSpan();
+			Assert::AreEqual(3, *std::lower_bound(constSpan.begin(), constSpan.end(), 3));
+
+			Vector<int> empty;
+			Assert::IsTrue(empty.AsSpan().empty());
+		}
+
+		TEST_METHOD(TestRandomAccessIterators)
+		{
+			Vector<int> list = { 5, 3, 8, 1, 9, 2 };
+			auto it = list.begin();
+			it += 2;
+			Assert::AreEqual(8, *it);
+			Assert::AreEqual(3, *--it);
+			Assert::AreEqual(3, *it--);
+			Assert::AreEqual(5, *it);
+			Assert::AreEqual(9, it[4]);
+			Assert::AreEqual(1, *(it + 3));
+			Assert::AreEqual(1, *(3 + it));
+			Assert::AreEqual(6_z, static_cast<size_t>(list.end() - list.begin()));
+			Assert::AreEqual(-6, static_cast<int>(list.begin() - list.end()));
+			Assert::IsTrue(list.end() - 6 == list.begin());
+
+			std::sort(list.begin(), list.end());
+			Assert::IsTrue(std::is_sorted(list.cbegin(), list.cend()));
+			Assert::IsTrue(std::binary_search(list.cbegin(), list.cend(), 8));
+			Assert::AreEqual(2, static_cast<int>(std::lower_bound(list.cbegin(), list.cend(), 3) - list.cbegin()));
+
+			const Vector<int>& constList = list;
+			auto constIt = constList.end();
+			constIt -= 2;
+			Assert::AreEqual(8, *constIt);
+			Assert::AreEqual(9, constIt[1]);
+			Assert::AreEqual(4_z, static_cast<size_t>(constIt - constList.begin()));
+
+			Vector<int> other = { 1 };
+			auto expression = [&list] { list.begin() += 7; };
+			Assert::ExpectException<std::exception>(expression);
+			auto expression2 = [&list] { --list.begin(); };
+			Assert::ExpectException<std::exception>(expression2);
+			auto expression3 = [&list] { list.end()[0]; };
+			Assert::ExpectException<std::exception>(expression3);
+			auto expression4 = [&list, &other] { list.end() - other.begin(); };
+			Assert::ExpectException<std::exception>(expression4);
+			auto expression5 = [] { Vector<int>::ConstIterator() += 1; };
+			Assert::ExpectException<std::exception>(expression5);
+		}
+
+		TEST_METHOD(TestEmplaceBackN)
+		{
+			Vector<Foo> list;
+			auto it = list.EmplaceBackN(3, 7);
+			Assert::IsTrue(it == list.begin());
+			Assert::AreEqual(3_z, list.Size());
+			Assert::AreEqual(3_z, list.Capacity());
+			for (const Foo& foo : list)
+			{
+				Assert::AreEqual(Foo(7), foo);
+			}
+
+			it = list.EmplaceBackN(2);
+			Assert::AreEqual(Foo(), *it);
+			Assert::AreEqual(5_z, list.Size());
+			Assert::IsTrue(list.EmplaceBackN(0) == list.end());
+
+			Vector<int, DefaultComparator<int>, DefaultAllocator, NoGrowth> bounded(2);
+			const auto expression = [&bounded] { bounded.EmplaceBackN(3, 1); };
+			Assert::ExpectException<std::exception>(expression);
+			Assert::AreEqual(0_z, bounded.Size());
+			bounded.EmplaceBackN(2, 1);
+			Assert::AreEqual(2_z, bounded.Size());
+		}
+
+		TEST_METHOD(TestInsertRange)
+		{
+			Vector<Foo> list = { Foo(0), Foo(4) };
+			const Foo middle[] = { Foo(1), Foo(2), Foo(3) };
+			auto it = list.Insert(list.begin() + 1, std::begin(middle), std::end(middle));
+			Assert::AreEqual(Foo(1), *it);
+			Assert::AreEqual(5_z, list.Size());
+			for (size_t i = 0; i < list.Size(); ++i)
+			{
+				Assert::AreEqual(Foo(static_cast<int>(i)), list[i]);
+			}
+
+			// SList iterators cannot be measured up front
+			SList<Foo> tail;
+			tail.PushBack(Foo(5));
+			tail.PushBack(Foo(6));
+			it = list.Insert(list.end(), tail.begin(), tail.end());
+			Assert::AreEqual(Foo(5), *it);
+			Assert::AreEqual(7_z, list.Size());
+
+			// a range of the vector itself survives the growth
+			list.Insert(list.begin(), list.begin() + 5, list.end());
+			Assert::AreEqual(9_z, list.Size());
+			Assert::AreEqual(Foo(5), list[0]);
+			Assert::AreEqual(Foo(6), list[1]);
+			Assert::AreEqual(Foo(0), list[2]);
+			Assert::AreEqual(Foo(6), list[8]);
+
+			it = list.Insert(list.begin() + 1, list.end(), list.end());
+			Assert::IsTrue(it == list.begin() + 1);
+			Assert::AreEqual(9_z, list.Size());
+
+			Vector<Foo> other;
+			const auto expression = [&list, &other, &middle] { list.Insert(other.begin(), std::begin(middle), std::end(middle)); };
+			Assert::ExpectException<std::exception>(expression);
+
+			// an end iterator taken before a shrink is past the new end
+			const auto staleEnd = list.end();
+			list.PopBack();
+			const auto expression2 = [&list, &staleEnd, &middle] { list.Insert(staleEnd, std::begin(middle), std::end(middle)); };
+			Assert::ExpectException<std::exception>(expression2);
+			Assert::AreEqual(8_z, list.Size());
+			Assert::AreEqual(Foo(5), list[7]);
+
+			// elements that are not trivially relocatable are moved out of the way one by one
+			Vector<SelfAware> aware;
+			aware.EmplaceBack(0);
+			aware.EmplaceBack(3);
+			const SelfAware values[] = { SelfAware(1), SelfAware(2) };
+			aware.Insert(aware.begin() + 1, std::begin(values), std::end(values));
+			Assert::AreEqual(4_z, aware.Size());
+			for (size_t i = 0; i < aware.Size(); ++i)
+			{
+				Assert::AreEqual(static_cast<int>(i), aware[i].Data);
+				Assert::IsTrue(aware[i].IsInPlace());
+			}
+		}
+
+		TEST_METHOD(TestAppend)
+		{
+			Vector<int> source;
+			for (int i = 0; i < 100; ++i)
+			{
+				source.PushBack(i);
+			}
+
+			Vector<int> list;
+			list.PushBack(-1);
+			auto it = list.Append(source);
+			Assert::AreEqual(0, *it);
+			Assert::AreEqual(101_z, list.Size());
+			Assert::AreEqual(101_z, list.Capacity());
+			for (size_t i = 0; i < source.Size(); ++i)
+			{
+				Assert::AreEqual(source[i], list[i + 1]);
+			}
+
+			const int raw[] = { 7, 8 };
+			list.Append(source.begin(), source.begin() + 10);
+			list.Append(raw);
+			Assert::AreEqual(113_z, list.Size());
+			Assert::AreEqual(9, list[110]);
+			Assert::AreEqual(8, list.Back());
+
+			Vector<Foo> foos = { Foo(1), Foo(2) };
+			Vector<Foo> moved;
+			moved.Append(std::make_move_iterator(foos.begin()), std::make_move_iterator(foos.end()));
+			Assert::AreEqual(2_z, moved.Size());
+			Assert::AreEqual(Foo(2), moved.Back());
+		}
+
+		TEST_METHOD(TestAssign)
+		{
+			Vector<Foo> list = { Foo(1), Foo(2), Foo(3) };
+			const Foo values[] = { Foo(4), Foo(5) };
+			list.Assign(values);
+			Assert::AreEqual(2_z, list.Size());
+			Assert::AreEqual(3_z, list.Capacity());
+			Assert::AreEqual(Foo(4), list.Front());
+
+			list.Assign(list.begin() + 1, list.end());
+			Assert::AreEqual(1_z, list.Size());
+			Assert::AreEqual(Foo(5), list.Front());
+
+			SList<Foo> foos;
+			foos.PushBack(Foo(6));
+			list.Assign(foos);
+			Assert::AreEqual(1_z, list.Size());
+			Assert::AreEqual(Foo(6), list.Front());
+
+			Vector<int> ints;
+			const int many[] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+			ints.Assign(many);
+			Assert::AreEqual(10_z, ints.Size());
+			Assert::AreEqual(10_z, ints.Capacity());
+			Assert::AreEqual(9, ints.Back());
+		}
+
 		TEST_METHOD(TestIsEmpty)
 		{
 			Vector<Foo> list;
@@ -458,20 +716,83 @@ namespace UnitTestLibraryDesktop
 			Assert::AreEqual(list.Capacity(), 0_z);
 		}
 
-		TEST_METHOD(TestSetIncrementCallback)
+		TEST_METHOD(TestSetGrowthPolicy)
 		{
-			Vector<Foo> list;
+			Vector<Foo, DefaultComparator<Foo>, DefaultAllocator, CallbackGrowth> list;
 			list.PushBack(Foo(1));
 			Assert::IsTrue(list.Capacity() >= list.Size());
+			Assert::AreEqual(2_z, list.GetGrowthPolicy()(1, 1));
 			list.ShrinkToFit();
-			list.SetIncrementCallback([](size_t, size_t) { return 0_z; });
+			list.SetGrowthPolicy([](size_t, size_t) { return 0_z; });
+			Assert::AreEqual(0_z, list.GetGrowthPolicy()(1, 1));
 			const auto expression = [&list] { list.PushBack(Foo(1)); };
 			Assert::ExpectException<std::exception>(expression);
+
+			auto copy = list;
+			const auto copyExpression = [&copy] { copy.PushBack(Foo(1)); };
+			Assert::ExpectException<std::exception>(copyExpression);
+		}
+
+		TEST_METHOD(TestGrowthPolicies)
+		{
+			Vector<int> geometric;
+			Vector<int, DefaultComparator<int>, DefaultAllocator, FixedStepGrowth<4>> fixed;
+			Vector<int, DefaultComparator<int>, DefaultAllocator, PowerOfTwoGrowth> powerOfTwo;
+			Vector<int, DefaultComparator<int>, DefaultAllocator, DoublingGrowth> doubling(3);
+			size_t geometricCapacity = 0;
+			for (int i = 0; i < 100; ++i)
+			{
+				if (geometric.Size() == geometric.Capacity())
+				{
+					geometricCapacity = static_cast<size_t>(geometricCapacity * DefaultIncrementMultiplier) + 1;
+				}
+
+				geometric.PushBack(i);
+				fixed.PushBack(i);
+				powerOfTwo.PushBack(i);
+				doubling.PushBack(i);
+				Assert::AreEqual(geometricCapacity, geometric.Capacity());
+				Assert::AreEqual(0_z, fixed.Capacity() % 4);
+				Assert::AreEqual(0_z, powerOfTwo.Capacity() & (powerOfTwo.Capacity() - 1));
+			}
+			Assert::AreEqual(100_z, fixed.Capacity());
+			Assert::AreEqual(128_z, powerOfTwo.Capacity());
+			Assert::AreEqual(192_z, doubling.Capacity());
+
+			Vector<int, DefaultComparator<int>, DefaultAllocator, NoGrowth> bounded(2);
+			bounded.PushBack(1);
+			bounded.PushBack(2);
+			const auto expression = [&bounded] { bounded.PushBack(3); };
+			Assert::ExpectException<std::exception>(expression);
+			Assert::AreEqual(2_z, bounded.Size());
+			bounded.Reserve(3);
+			bounded.PushBack(3);
+			Assert::AreEqual(3, bounded.Back());
+
+			// stateless policies take no room
+			Assert::AreEqual(sizeof(Vector<int>), sizeof(Vector<int, DefaultComparator<int>, DefaultAllocator, PowerOfTwoGrowth>));
+			Assert::IsTrue(sizeof(Vector<int>) < sizeof(Vector<int, DefaultComparator<int>, DefaultAllocator, CallbackGrowth>));
 		}
 
 	private:
+		struct SelfAware final
+		{
+			explicit SelfAware(int data) : Data(data), mSelf(this) {}
+			SelfAware(const SelfAware& other) : Data(other.Data), mSelf(this) {}
+			SelfAware& operator=(const SelfAware& other) { Data = other.Data; return *this; }
+			bool operator==(const SelfAware& other) const { return Data == other.Data; }
+			bool IsInPlace() const { return mSelf == this; }
+
+			int Data;
+
+		private:
+			const SelfAware* mSelf;
+		};
+
 		static _CrtMemState sStartMemState;
+		static size_t sStartSlabsInUse;
 	};
 
 	_CrtMemState VectorTest::sStartMemState;
+	size_t VectorTest::sStartSlabsInUse;
 }
\ No newline at end of file